@@ -0,0 +1,169 @@
+/*
+    BlobdEdxParity: RecoKernels::BlobdEdx vs the TH1D dE/dx HTBlob::idBlobdEdx used before
+
+    Usage: ./BlobdEdxParity.exe [nBlobs]
+
+    Blobs are generated with a fixed seed, so every run checks the same inputs:
+        clusters in X, U and V along a random direction from a random start point
+        with gaps, zero energy clusters, clusters on the 45 mm bin edges and
+        clusters past the 4500 mm profile, for 1 to 6 planes
+    Both must return exactly the same dE/dx for every blob.
+    Exit code is 1 if any blob does not agree.
+*/
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+#include "TH1D.h"
+
+#include "../src/Pi0Reco/RecoCluster.h"
+#include "../src/Pi0Reco/RecoKernels.h"
+
+using namespace std;
+
+// Deterministic on every platform, unlike rand()
+class BlobGenerator
+{
+    public:
+        BlobGenerator(unsigned long long seed) : state(seed) {}
+
+        double Uniform()
+        {
+            state = state*6364136223846793005ULL + 1442695040888963407ULL;
+            return (state >> 11)*(1.0/9007199254740992.0);
+        }
+
+        int Integer(int n) { return int(Uniform()*n); }
+
+        void Generate(vector<RecoCluster>& clusters, RecoKernels::ViewPoint& start, int& nPlanes);
+
+    private:
+        unsigned long long state;
+};
+
+void BlobGenerator::Generate(vector<RecoCluster>& clusters, RecoKernels::ViewPoint& start, int& nPlanes)
+{
+    const double x0 = Uniform()*2000 - 1000;
+    const double y0 = Uniform()*2000 - 1000;
+    start.z = 5000 + Uniform()*3000;
+    start.t[RecoCluster::X] =  x0;
+    start.t[RecoCluster::U] = -y0*sqrt(3)/2 + x0*.5; //  -ycos30 + xsin30
+    start.t[RecoCluster::V] =  y0*sqrt(3)/2 + x0*.5; //   ycos30 + xsin30
+
+    nPlanes = 1 + Integer(6);
+
+    // Short blobs find the window often, long ones rarely
+    const double length = Integer(3) == 0 ? 150 : 1500;
+    const double dx = Uniform()*2 - 1;
+    const double dz = Uniform()*2 - 0.5;
+    const double norm = sqrt(dx*dx + dz*dz);
+
+    clusters.clear();
+    const int nClusters = Integer(30);
+    for (int i = 0; i < nClusters; ++i){
+        RecoCluster c;
+        c.view = Integer(3);
+        c.time = 0;
+        c.nDigits = 1 + Integer(3);
+        c.tpos1 = 0;
+        c.tpos2 = 0;
+
+        double d = Uniform()*length;
+        if (Integer(50) == 0) d = 4500 + Uniform()*10;     // past the profile
+        if (Integer(80) == 0) d = 45*Integer(5);            // on a bin edge
+        c.z = start.z + d*dz/norm;
+        c.position = start.t[c.view] + d*dx/norm;
+
+        c.energy = Integer(10) == 0 ? 0.0 : Uniform()*10;
+        c.pe = c.energy*10;
+        clusters.push_back(c);
+    }
+}
+
+// HTBlob::FinddEdxPlanes() before RecoKernels
+bool FinddEdxPlanes(TH1D* h, int& index, double& dEdx, int nPlanes)
+{
+    dEdx = 0;
+    int count = 0;
+
+    for (int i = index; i <= nPlanes/2; i++){
+        if (h->GetBinContent(i) > 0){
+            count++;
+            dEdx += h->GetBinContent(i);
+        }
+        else { index = i; break; }
+    }
+    return count == nPlanes/2;
+}
+
+// HTBlob::idBlobdEdx() before RecoKernels
+double BlobdEdx_TH1D(const vector<RecoCluster>& clusters, const RecoKernels::ViewPoint& start, int nPlanes)
+{
+    TH1D* h = new TH1D("h","h", 100,0,4500); // bin size 45mm <> 1 module
+    double dEdx = 0;
+
+    for (unsigned int i = 0; i < clusters.size(); ++i){
+        double x = start.t[RecoCluster::X] - clusters[i].position;
+        double z = start.z - clusters[i].z;
+
+        if (clusters[i].view == RecoCluster::U) x = start.t[RecoCluster::U] - clusters[i].position;
+        if (clusters[i].view == RecoCluster::V) x = start.t[RecoCluster::V] - clusters[i].position;
+
+        double distance = sqrt(pow(x,2) + pow(z,2));
+        h->Fill(distance, clusters[i].energy);
+    }
+
+    int binmin = h->FindFirstBinAbove();
+    int binmax = (h->FindLastBinAbove() - nPlanes/2);
+
+    for (int i = binmin; i <= binmax; i++){
+        if (FinddEdxPlanes(h, i, dEdx, nPlanes)) break;
+        dEdx = 0;
+    }
+    if (dEdx == 0) dEdx = -999;
+    else dEdx = dEdx/nPlanes;
+
+    delete h;
+    return dEdx;
+}
+
+int main(int argc, char* argv[])
+{
+    if (argc > 2){
+        cout<<"Usage: ./BlobdEdxParity.exe [nBlobs]"<<endl;
+        return 1;
+    }
+    int nBlobs = argc == 2 ? atoi(argv[1]) : 100000;
+
+    TH1::AddDirectory(false);
+
+    BlobGenerator generator(20140524);
+    vector<RecoCluster> clusters;
+    RecoKernels::ViewPoint start;
+    int nPlanes;
+
+    int nFailed = 0;
+    int nFound = 0;
+    for (int i = 0; i < nBlobs; ++i){
+        generator.Generate(clusters, start, nPlanes);
+
+        double dEdx_TH1D = BlobdEdx_TH1D(clusters, start, nPlanes);
+        double dEdx_Kernel = RecoKernels::BlobdEdx(clusters, start, nPlanes);
+
+        if (dEdx_TH1D != -999) nFound++;
+        if (dEdx_TH1D != dEdx_Kernel){
+            if (nFailed < 10){
+                cout.precision(17);
+                cout<<"Blob "<<i<<": nClusters = "<<clusters.size()<<" nPlanes = "<<nPlanes
+                    <<" TH1D = "<<dEdx_TH1D<<" RecoKernels = "<<dEdx_Kernel<<endl;
+            }
+            nFailed++;
+        }
+    }
+
+    cout<<"Blobs with dE/dx: "<<nFound<<" / "<<nBlobs<<endl;
+    cout<<"Parity: "<<nBlobs - nFailed<<" / "<<nBlobs<<" blobs agree"<<endl;
+
+    return nFailed > 0 ? 1 : 0;
+}
@@ -0,0 +1,338 @@
+/*
+    HoughParity: HoughAccumulator vs the TH2D Hough space HTtool used before
+
+    Usage: ./HoughParity.exe [nEvents] [repeats]
+           ./HoughParity.exe -w <dump file> [nEvents]     write the generated calls
+           ./HoughParity.exe -f <dump file> [repeats]     check the calls of a dump
+
+    Hit sets are the Hough2D calls HTtool makes for the blobs of SyntheticEvent
+    events (default 2000, fixed seed): in every view of every blob the points are
+    the clusters around the highest pe cluster (HTtool::GetReference), once for
+    each binning, with and without the vertex vote.
+    A dump holds one call per block:
+        H nTheta thetaMin thetaMax nR rMin rMax nPoints
+        x z w       (nPoints lines)
+
+    For every call both are filled with the same points:
+        TH2D is created per call and filled as the old HTtool::FillHough1Cluster()
+        HoughAccumulator is reused as in HTtool
+    Entries, every bin content and the maximum (r, theta) must agree exactly.
+    Exit code is 1 if any call does not agree.
+
+    All calls are repeated [repeats] times (default 10) for the timing.
+*/
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <vector>
+
+#include "TH1.h"
+#include "TH2D.h"
+#include "TStopwatch.h"
+
+#include "SyntheticEvent.h"
+#include "../src/Pi0Reco/HoughAccumulator.h"
+
+using namespace std;
+
+struct HoughCall
+{
+    int nTheta;
+    double thetaMin;
+    double thetaMax;
+    int nR;
+    double rMin;
+    double rMax;
+    vector<double> x;
+    vector<double> z;
+    vector<double> w;
+};
+
+// Same value as CLHEP::pi
+const double pi = 3.14159265358979323846;
+
+bool ReadDump(const char* fileName, vector<HoughCall>& calls)
+{
+    ifstream file(fileName);
+    if (!file.is_open()){
+        cout<<"ERROR: Cannot open "<<fileName<<endl;
+        return false;
+    }
+
+    string tag;
+    while (file>>tag){
+        if (tag != "H"){
+            cout<<"ERROR: Corrupted dump, expected H got "<<tag<<endl;
+            return false;
+        }
+
+        HoughCall call;
+        unsigned int nPoints;
+        file>>call.nTheta>>call.thetaMin>>call.thetaMax>>call.nR>>call.rMin>>call.rMax>>nPoints;
+        call.x.resize(nPoints);
+        call.z.resize(nPoints);
+        call.w.resize(nPoints);
+        for (unsigned int i = 0; i < nPoints; ++i){
+            file>>call.x[i]>>call.z[i]>>call.w[i];
+        }
+        if (!file){
+            cout<<"ERROR: Corrupted dump, truncated call "<<calls.size()<<endl;
+            return false;
+        }
+        calls.push_back(call);
+    }
+
+    return true;
+}
+
+bool WriteDump(const char* fileName, const vector<HoughCall>& calls)
+{
+    ofstream file(fileName);
+    if (!file.is_open()){
+        cout<<"ERROR: Cannot open "<<fileName<<endl;
+        return false;
+    }
+
+    file.precision(17);
+    for (unsigned int i = 0; i < calls.size(); ++i){
+        const HoughCall& call = calls[i];
+        file<<"H "<<call.nTheta<<" "<<call.thetaMin<<" "<<call.thetaMax<<" "
+            <<call.nR<<" "<<call.rMin<<" "<<call.rMax<<" "<<call.x.size()<<"\n";
+        for (unsigned int p = 0; p < call.x.size(); ++p){
+            file<<call.x[p]<<" "<<call.z[p]<<" "<<call.w[p]<<"\n";
+        }
+    }
+
+    return true;
+}
+
+HoughCall MakeCall(int nTheta, double thetaMin, double thetaMax, int nR, double rMin, double rMax)
+{
+    HoughCall call;
+    call.nTheta = nTheta;
+    call.thetaMin = thetaMin;
+    call.thetaMax = thetaMax;
+    call.nR = nR;
+    call.rMin = rMin;
+    call.rMax = rMax;
+    return call;
+}
+
+// HTtool::Hough2D() calls for the clusters of one view of a blob
+void AddViewCalls(const vector<RecoCluster>& clusters, int view, const RecoKernels::ViewPoint& vertex,
+                  vector<HoughCall>& calls)
+{
+    // Reference point: highest pe cluster, as HTtool::GetReference()
+    double maxpe = 0;
+    double refX = 0, refZ = 0;
+    unsigned int nClusters = 0;
+    for (unsigned int c = 0; c < clusters.size(); ++c){
+        if (clusters[c].view != view) continue;
+        nClusters++;
+        if (clusters[c].pe > maxpe){
+            maxpe = clusters[c].pe;
+            refX = clusters[c].position;
+            refZ = clusters[c].z;
+        }
+    }
+    if (nClusters == 0) return;
+
+    // Clusters, clusters with the vertex, seeds, seeds with the vertex
+    HoughCall binnings[4] = { MakeCall(46,-92,92,275,-5500,5500),
+                              MakeCall(46,-92,92,275,-5500,5500),
+                              MakeCall(90,-90,90,275,-5500,5500),
+                              MakeCall(92,-92,92,260,-5500,5500) };
+    const double vertexWeight[4] = { 0, maxpe/2, 0, maxpe };
+
+    for (int b = 0; b < 4; ++b){
+        HoughCall& call = binnings[b];
+        for (unsigned int c = 0; c < clusters.size(); ++c){
+            if (clusters[c].view != view) continue;
+            call.x.push_back(clusters[c].position - refX);
+            call.z.push_back(clusters[c].z - refZ);
+            call.w.push_back(clusters[c].pe);
+        }
+        if (vertexWeight[b] > 0){
+            call.x.push_back(vertex.t[view] - refX);
+            call.z.push_back(vertex.z - refZ);
+            call.w.push_back(vertexWeight[b]);
+        }
+        calls.push_back(call);
+    }
+}
+
+void GenerateCalls(int nEvents, vector<HoughCall>& calls)
+{
+    SyntheticEvent generator(20140524);
+    for (int i = 0; i < nEvents; ++i){
+        generator.Generate();
+        const vector<SyntheticEvent::Blob>& blobs = generator.GetBlobs();
+        for (unsigned int b = 0; b < blobs.size(); ++b){
+            for (int view = RecoCluster::X; view <= RecoCluster::V; ++view){
+                AddViewCalls(blobs[b].clusters, view, generator.GetVertex(), calls);
+            }
+        }
+    }
+}
+
+// Old HTtool: new TH2D per call, every point votes once per theta bin
+TH2D* FillTH2D(const HoughCall& call)
+{
+    TH2D* h = new TH2D("h","Hough Space",call.nTheta,call.thetaMin,call.thetaMax,call.nR,call.rMin,call.rMax);
+    for (unsigned int p = 0; p < call.x.size(); ++p){
+        for (int i = h->GetXaxis()->GetFirst(); i <= h->GetXaxis()->GetLast(); i++){
+            double theta = h->GetXaxis()->GetBinCenter(i)*pi/180; // angle radians
+            double r = call.x[p]*sin(theta) + call.z[p]*cos(theta);
+            h->Fill(theta*180/pi, r, call.w[p]); // must be filled in degree
+        }
+    }
+    return h;
+}
+
+bool GetMaximumTH2D(TH2D* h, double& r, double& theta)
+{
+    if (!h->GetEntries()) return false;
+
+    int x = 0, y = 0, z = 0;
+    h->GetMaximumBin(x, y, z);
+    r     = h->GetYaxis()->GetBinCenter(y);
+    theta = h->GetXaxis()->GetBinCenter(x);
+    return true;
+}
+
+HoughAccumulator& GetAccumulator(vector<HoughAccumulator>& accumulators, const HoughCall& call)
+{
+    for (unsigned int i = 0; i < accumulators.size(); ++i){
+        HoughAccumulator& h = accumulators[i];
+        if (h.GetNThetaBins() == call.nTheta && h.GetThetaMin() == call.thetaMin && h.GetThetaMax() == call.thetaMax &&
+            h.GetNRBins() == call.nR && h.GetRMin() == call.rMin && h.GetRMax() == call.rMax){
+            return h;
+        }
+    }
+    accumulators.push_back(HoughAccumulator(call.nTheta,call.thetaMin,call.thetaMax,call.nR,call.rMin,call.rMax));
+    return accumulators.back();
+}
+
+void FillAccumulator(HoughAccumulator& h, const HoughCall& call)
+{
+    h.Reset();
+    for (unsigned int p = 0; p < call.x.size(); ++p){
+        h.Fill(call.x[p], call.z[p], call.w[p]);
+    }
+}
+
+bool CompareCall(unsigned int ind, const HoughCall& call, vector<HoughAccumulator>& accumulators)
+{
+    TH2D* th2d = FillTH2D(call);
+    HoughAccumulator& acc = GetAccumulator(accumulators, call);
+    FillAccumulator(acc, call);
+
+    bool isSame = true;
+    if (th2d->GetEntries() != acc.GetEntries()){
+        cout<<"Call "<<ind<<": Entries TH2D = "<<th2d->GetEntries()<<" HoughAccumulator = "<<acc.GetEntries()<<endl;
+        isSame = false;
+    }
+
+    int nDiffBins = 0;
+    for (int i = 0; i < call.nTheta; ++i){
+        for (int j = 0; j < call.nR; ++j){
+            if (th2d->GetBinContent(i+1, j+1) != acc.GetBinContent(i, j)) nDiffBins++;
+        }
+    }
+    if (nDiffBins > 0){
+        cout<<"Call "<<ind<<": "<<nDiffBins<<" bins differ"<<endl;
+        isSame = false;
+    }
+
+    double r_th2d = 0, theta_th2d = 0;
+    double r_acc = 0, theta_acc = 0;
+    bool found_th2d = GetMaximumTH2D(th2d, r_th2d, theta_th2d);
+    bool found_acc = acc.GetMaximum(r_acc, theta_acc);
+    if (found_th2d != found_acc || r_th2d != r_acc || theta_th2d != theta_acc){
+        cout<<"Call "<<ind<<": Maximum TH2D (r, theta) = ("<<r_th2d<<", "<<theta_th2d<<")"
+            <<" HoughAccumulator = ("<<r_acc<<", "<<theta_acc<<")"<<endl;
+        isSame = false;
+    }
+
+    delete th2d;
+    return isSame;
+}
+
+int main(int argc, char* argv[])
+{
+    const string mode = argc > 1 ? argv[1] : "";
+    const bool isFile = mode == "-f" || mode == "-w";
+    if (argc > 4 || (isFile && argc < 3) || (!isFile && argc > 3)){
+        cout<<"Usage: ./HoughParity.exe [nEvents] [repeats]"<<endl;
+        cout<<"       ./HoughParity.exe -w <dump file> [nEvents]"<<endl;
+        cout<<"       ./HoughParity.exe -f <dump file> [repeats]"<<endl;
+        return 1;
+    }
+
+    TH1::AddDirectory(false);
+
+    vector<HoughCall> calls;
+    int nRepeats = 10;
+    if (mode == "-f"){
+        if (argc == 4) nRepeats = atoi(argv[3]);
+        if (!ReadDump(argv[2], calls)) return 1;
+        cout<<"Read "<<argv[2]<<endl;
+    }else if (mode == "-w"){
+        GenerateCalls(argc == 4 ? atoi(argv[3]) : 2000, calls);
+        if (!WriteDump(argv[2], calls)) return 1;
+        cout<<"Wrote "<<calls.size()<<" Hough2D calls to "<<argv[2]<<endl;
+        return 0;
+    }else{
+        if (argc == 3) nRepeats = atoi(argv[2]);
+        GenerateCalls(argc > 1 ? atoi(argv[1]) : 2000, calls);
+    }
+
+    unsigned int nPoints = 0;
+    for (unsigned int i = 0; i < calls.size(); ++i) nPoints += calls[i].x.size();
+    cout<<calls.size()<<" Hough2D calls, "<<nPoints<<" points"<<endl;
+
+    // Parity
+    vector<HoughAccumulator> accumulators;
+    int nFailed = 0;
+    for (unsigned int i = 0; i < calls.size(); ++i){
+        if (!CompareCall(i, calls[i], accumulators)) nFailed++;
+    }
+    cout<<"Parity: "<<calls.size() - nFailed<<" / "<<calls.size()<<" calls agree"<<endl;
+
+    // Timing -- maximum is accumulated so the work is not optimized away
+    TStopwatch timer;
+    double sum_th2d = 0;
+    timer.Start();
+    for (int n = 0; n < nRepeats; ++n){
+        for (unsigned int i = 0; i < calls.size(); ++i){
+            double r = 0, theta = 0;
+            TH2D* h = FillTH2D(calls[i]);
+            if (GetMaximumTH2D(h, r, theta)) sum_th2d += r + theta;
+            delete h;
+        }
+    }
+    timer.Stop();
+    double time_th2d = timer.CpuTime();
+
+    double sum_acc = 0;
+    timer.Start();
+    for (int n = 0; n < nRepeats; ++n){
+        for (unsigned int i = 0; i < calls.size(); ++i){
+            double r = 0, theta = 0;
+            HoughAccumulator& h = GetAccumulator(accumulators, calls[i]);
+            FillAccumulator(h, calls[i]);
+            if (h.GetMaximum(r, theta)) sum_acc += r + theta;
+        }
+    }
+    timer.Stop();
+    double time_acc = timer.CpuTime();
+
+    cout<<"Timing: "<<nRepeats<<" x "<<calls.size()<<" calls"<<endl;
+    cout<<"\tTH2D             = "<<time_th2d<<" s"<<endl;
+    cout<<"\tHoughAccumulator = "<<time_acc<<" s"<<endl;
+    if (time_acc > 0) cout<<"\tSpeedup          = "<<time_th2d/time_acc<<endl;
+    if (sum_th2d != sum_acc) cout<<"Timing loops found different maxima!"<<endl;
+
+    return nFailed > 0 ? 1 : 0;
+}
@@ -0,0 +1,152 @@
+/*
+    RecoKernelBench: Throughput of the Pi0Reco kernels on synthetic events
+
+    Usage: ./RecoKernelBench.exe [nEvents] [repeats]
+
+    Events come from SyntheticEvent with a fixed seed (2 photons, a muon and
+    a proton in 2 out of 3 events), so results are comparable between builds.
+    Every kernel runs over all blobs [repeats] times (default 10000 events, 20 repeats):
+        RecoKernels::BlobdEdx           4 planes, from the blob start
+        RecoKernels::BlobDirectionSums  around the event vertex
+        HoughAccumulator                X clusters of the event, HTtool cluster binning
+        AngleScanCore                   all clusters of the event, seeded in X, U and V
+                                        (cone search, UV match by z, view completion)
+    Checksums of the results are printed, they must not change unless the
+    kernel results change.
+
+    No ROOT or Gaudi is needed.
+*/
+#include <cstdlib>
+#include <ctime>
+#include <iostream>
+#include <vector>
+
+#include "SyntheticEvent.h"
+#include "../src/Pi0Reco/AngleScanCore.h"
+#include "../src/Pi0Reco/HoughAccumulator.h"
+#include "../src/Pi0Reco/RecoKernels.h"
+
+using namespace std;
+
+struct BenchEvent
+{
+    RecoKernels::ViewPoint vertex;
+    vector<SyntheticEvent::Blob> blobs;
+    vector<RecoCluster> xClusters;
+    vector<RecoCluster> allClusters;
+};
+
+double GetCpuTime(clock_t start)
+{
+    return double(clock() - start)/CLOCKS_PER_SEC;
+}
+
+void PrintResult(const char* name, double time, unsigned long nCalls, double checksum)
+{
+    cout.precision(6);
+    cout<<"\t"<<name<<": "<<time<<" s, "<<nCalls<<" calls, "
+        <<1e9*time/nCalls<<" ns/call, "<<nCalls/time<<" calls/s";
+    cout.precision(17);
+    cout<<", checksum = "<<checksum<<endl;
+}
+
+int main(int argc, char* argv[])
+{
+    if (argc > 3){
+        cout<<"Usage: ./RecoKernelBench.exe [nEvents] [repeats]"<<endl;
+        return 1;
+    }
+    const int nEvents = argc > 1 ? atoi(argv[1]) : 10000;
+    const int nRepeats = argc > 2 ? atoi(argv[2]) : 20;
+
+    // Generate once, outside the timing
+    SyntheticEvent generator(20140524);
+    vector<BenchEvent> events(nEvents);
+    unsigned long nBlobs = 0;
+    unsigned long nClusters = 0;
+    for (int i = 0; i < nEvents; ++i){
+        generator.Generate();
+        BenchEvent& event = events[i];
+        event.vertex = generator.GetVertex();
+        event.blobs = generator.GetBlobs();
+        for (unsigned int b = 0; b < event.blobs.size(); ++b){
+            const vector<RecoCluster>& clusters = event.blobs[b].clusters;
+            for (unsigned int c = 0; c < clusters.size(); ++c){
+                if (clusters[c].view == RecoCluster::X) event.xClusters.push_back(clusters[c]);
+                event.allClusters.push_back(clusters[c]);
+            }
+            nClusters += clusters.size();
+        }
+        nBlobs += event.blobs.size();
+    }
+    cout<<"Generated "<<nEvents<<" events, "<<nBlobs<<" blobs, "<<nClusters<<" clusters"<<endl;
+    cout<<"Repeats: "<<nRepeats<<endl;
+
+    // dE/dx
+    double checksum = 0.0;
+    clock_t start = clock();
+    for (int n = 0; n < nRepeats; ++n){
+        for (int i = 0; i < nEvents; ++i){
+            for (unsigned int b = 0; b < events[i].blobs.size(); ++b){
+                const SyntheticEvent::Blob& blob = events[i].blobs[b];
+                checksum += RecoKernels::BlobdEdx(blob.clusters, blob.start, 4);
+            }
+        }
+    }
+    PrintResult("BlobdEdx         ", GetCpuTime(start), nRepeats*nBlobs, checksum/nRepeats);
+
+    // Direction
+    checksum = 0.0;
+    start = clock();
+    for (int n = 0; n < nRepeats; ++n){
+        for (int i = 0; i < nEvents; ++i){
+            for (unsigned int b = 0; b < events[i].blobs.size(); ++b){
+                RecoKernels::DirectionSums sums;
+                if (RecoKernels::BlobDirectionSums(events[i].blobs[b].clusters, events[i].vertex, sums)){
+                    checksum += sums.Xx + sums.Zx + sums.Xu + sums.Xv;
+                }
+            }
+        }
+    }
+    PrintResult("BlobDirectionSums", GetCpuTime(start), nRepeats*nBlobs, checksum/nRepeats);
+
+    // Hough transform of the X view around the vertex, as HTtool::Hough2D()
+    HoughAccumulator hough(46,-92,92,275,-5500,5500);
+    checksum = 0.0;
+    start = clock();
+    for (int n = 0; n < nRepeats; ++n){
+        for (int i = 0; i < nEvents; ++i){
+            const BenchEvent& event = events[i];
+            hough.Reset();
+            for (unsigned int c = 0; c < event.xClusters.size(); ++c){
+                hough.Fill(event.xClusters[c].position - event.vertex.t[RecoCluster::X],
+                           event.xClusters[c].z - event.vertex.z, event.xClusters[c].pe);
+            }
+            double r, theta;
+            if (hough.GetMaximum(r, theta)) checksum += r + theta;
+        }
+    }
+    PrintResult("HoughAccumulator ", GetCpuTime(start), (unsigned long)nRepeats*nEvents, checksum/nRepeats);
+
+    // Angle scan as AngleScan, AngleScan_U and AngleScan_V
+    const char* scanNames[3] = { "AngleScanCore X  ", "AngleScanCore U  ", "AngleScanCore V  " };
+    AngleScanCore scan;
+    for (int seedView = RecoCluster::X; seedView <= RecoCluster::V; ++seedView){
+        checksum = 0.0;
+        start = clock();
+        for (int n = 0; n < nRepeats; ++n){
+            for (int i = 0; i < nEvents; ++i){
+                scan.Run(events[i].allClusters, events[i].vertex, seedView);
+
+                // Candidate sizes and positions of their first cluster
+                const vector<AngleScanCore::Candidate>& candidates = scan.GetCandidates();
+                for (unsigned int s = 0; s < candidates.size(); ++s){
+                    checksum += candidates[s].size() + 1e-3*candidates[s].front();
+                }
+            }
+        }
+        PrintResult(scanNames[seedView], GetCpuTime(start), (unsigned long)nRepeats*nEvents, checksum/nRepeats);
+    }
+
+    return 0;
+}
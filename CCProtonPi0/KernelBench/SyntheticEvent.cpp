@@ -0,0 +1,163 @@
+#include <cmath>
+
+#include "SyntheticEvent.h"
+
+namespace {
+    const double pi = 3.14159265358979323846;
+}
+
+const double SyntheticEvent::planeSpacing = 22.5;
+
+SyntheticEvent::SyntheticEvent(unsigned long long seed)
+    : fState(seed),
+      fVertexX(0.0),
+      fVertexY(0.0)
+{
+}
+
+double SyntheticEvent::Uniform()
+{
+    fState = fState*6364136223846793005ULL + 1442695040888963407ULL;
+    return (fState >> 11)*(1.0/9007199254740992.0);
+}
+
+double SyntheticEvent::Gaus(double mean, double sigma)
+{
+    // Box-Muller, 1 - Uniform() is never 0
+    const double u1 = 1.0 - Uniform();
+    const double u2 = Uniform();
+    return mean + sigma*sqrt(-2.0*log(u1))*cos(2.0*pi*u2);
+}
+
+void SyntheticEvent::Generate()
+{
+    fVertexX = Uniform()*1600 - 800;
+    fVertexY = Uniform()*1600 - 800;
+    const double z = 5000 + Uniform()*3000;
+    fVertex.t[RecoCluster::X] =  fVertexX;
+    fVertex.t[RecoCluster::U] = -fVertexY*sqrt(3.)/2 + fVertexX/2;
+    fVertex.t[RecoCluster::V] =  fVertexY*sqrt(3.)/2 + fVertexX/2;
+    fVertex.z = planeSpacing*floor(z/planeSpacing);
+
+    const bool hasProton = Uniform() < 2.0/3.0;
+    fBlobs.resize(hasProton ? 4 : 3);
+
+    AddPhoton(fBlobs[0]);
+    AddPhoton(fBlobs[1]);
+    AddTrack(fBlobs[2], false);
+    if (hasProton) AddTrack(fBlobs[3], true);
+}
+
+const RecoKernels::ViewPoint& SyntheticEvent::GetVertex() const
+{
+    return fVertex;
+}
+
+const std::vector<SyntheticEvent::Blob>& SyntheticEvent::GetBlobs() const
+{
+    return fBlobs;
+}
+
+void SyntheticEvent::AddPhoton(Blob& blob)
+{
+    blob.clusters.clear();
+
+    // Forward going direction, conversion 2 to 20 planes from the vertex
+    const double theta = acos(0.2 + 0.8*Uniform());
+    const double phi = 2*pi*Uniform();
+    const double dx = sin(theta)*cos(phi);
+    const double dy = sin(theta)*sin(phi);
+    const double dz = cos(theta);
+
+    const double gap = (2 + 18*Uniform())*planeSpacing/dz;
+    const double energy = 50 + 450*Uniform();               // visible [MeV]
+    const double length = 400 + 1.5*energy;                 // along the shower [mm]
+
+    const double x0 = fVertexX + gap*dx;
+    const double y0 = fVertexY + gap*dy;
+    const double z0 = fVertex.z + gap*dz;
+    SetStart(blob, x0, y0, z0);
+
+    const int nPlanes = int(length*dz/planeSpacing) + 1;
+    const int first = int(ceil(z0/planeSpacing));
+    double norm = 0.0;
+    std::vector<double> weights(nPlanes);
+    for (int i = 0; i < nPlanes; ++i) {
+        const double t = 6.0*(i + 0.5)/nPlanes;
+        weights[i] = t*exp(-t);
+        norm += weights[i];
+    }
+
+    for (int i = 0; i < nPlanes; ++i) {
+        const double z = (first + i)*planeSpacing;
+        const double s = (z - z0)/dz;
+        const double spread = 10 + 0.05*s;
+        const double e = energy*weights[i]/norm*(0.7 + 0.6*Uniform());
+
+        // A few empty planes inside the shower
+        if (Uniform() < 0.1) continue;
+
+        AddCluster(blob, x0 + s*dx + Gaus(0, spread), y0 + s*dy + Gaus(0, spread), z, e);
+    }
+}
+
+void SyntheticEvent::AddTrack(Blob& blob, bool isProton)
+{
+    blob.clusters.clear();
+
+    const double theta = acos((isProton ? 0.3 : 0.6) + (isProton ? 0.7 : 0.4)*Uniform());
+    const double phi = 2*pi*Uniform();
+    const double dx = sin(theta)*cos(phi);
+    const double dy = sin(theta)*sin(phi);
+    const double dz = cos(theta);
+
+    const double length = isProton ? 50 + 400*Uniform() : 1500 + 1500*Uniform();
+    SetStart(blob, fVertexX, fVertexY, fVertex.z);
+
+    const int nPlanes = int(length*dz/planeSpacing) + 1;
+    for (int i = 1; i <= nPlanes; ++i) {
+        const double z = fVertex.z + i*planeSpacing;
+        const double s = (z - fVertex.z)/dz;
+        const double residual = length - s;
+        if (residual < 0) break;
+
+        double e = 2.0*planeSpacing/dz/10.0;                // ~2 MeV/cm
+        if (isProton) e *= 1.0 + 30.0/(residual + 10.0);     // rises at the end
+        e *= 0.8 + 0.4*Uniform();
+
+        AddCluster(blob, fVertexX + s*dx + Gaus(0, 3), fVertexY + s*dy + Gaus(0, 3), z, e);
+    }
+}
+
+void SyntheticEvent::AddCluster(Blob& blob, double x, double y, double z, double energy)
+{
+    // X U X V
+    const int plane = int(floor(z/planeSpacing + 0.5));
+    int view = RecoCluster::X;
+    if (plane%4 == 1) view = RecoCluster::U;
+    if (plane%4 == 3) view = RecoCluster::V;
+
+    double position = x;
+    if (view == RecoCluster::U) position = -y*sqrt(3.)/2 + x/2;
+    if (view == RecoCluster::V) position =  y*sqrt(3.)/2 + x/2;
+
+    RecoCluster c;
+    c.view = view;
+    c.z = z;
+    c.position = position;
+    c.tpos1 = position - 8.5;
+    c.tpos2 = position + 8.5;
+    c.energy = energy;
+    c.pe = energy*25.0;
+    c.time = 0.0;
+    c.nDigits = 1 + int(energy/5.0);
+    blob.clusters.push_back(c);
+}
+
+void SyntheticEvent::SetStart(Blob& blob, double x, double y, double z)
+{
+    blob.start.t[RecoCluster::X] =  x;
+    blob.start.t[RecoCluster::U] = -y*sqrt(3.)/2 + x/2;
+    blob.start.t[RecoCluster::V] =  y*sqrt(3.)/2 + x/2;
+    blob.start.z = z;
+}
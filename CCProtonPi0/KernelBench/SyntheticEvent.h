@@ -0,0 +1,54 @@
+#ifndef SyntheticEvent_h
+#define SyntheticEvent_h
+
+#include <vector>
+
+#include "../src/Pi0Reco/RecoCluster.h"
+#include "../src/Pi0Reco/RecoKernels.h"
+
+/// Deterministic photon showers and muon/proton tracks as RecoCluster lists
+///
+///     Planes are 22.5 mm apart in z with the X U X V pattern, a particle
+///     leaves at most one cluster per plane. The random numbers come from a
+///     64 bit LCG, so the same seed gives the same blobs on every platform.
+class SyntheticEvent {
+  public:
+    struct Blob {
+        std::vector<RecoCluster> clusters;
+        RecoKernels::ViewPoint start;   ///< first plane of the particle
+    };
+
+    explicit SyntheticEvent(unsigned long long seed);
+
+    /// Vertex, 2 photons, a muon and a proton in 2 out of 3 events
+    void Generate();
+
+    const RecoKernels::ViewPoint& GetVertex() const;
+    const std::vector<Blob>& GetBlobs() const;
+
+  private:
+    static const double planeSpacing;
+
+    unsigned long long fState;
+
+    RecoKernels::ViewPoint fVertex;
+    double fVertexX;
+    double fVertexY;
+    std::vector<Blob> fBlobs;
+
+    double Uniform();
+    double Gaus(double mean, double sigma);
+
+    /// Photon: starts after a gap of a few planes, energy along the
+    /// shower follows t*exp(-t) with a wide transverse spread
+    void AddPhoton(Blob& blob);
+
+    /// Track: starts at the vertex, muons deposit the same energy in every
+    /// plane, protons rise towards the Bragg peak at the end
+    void AddTrack(Blob& blob, bool isProton);
+
+    void AddCluster(Blob& blob, double x, double y, double z, double energy);
+    void SetStart(Blob& blob, double x, double y, double z);
+};
+
+#endif
@@ -15,6 +15,11 @@ void CCProtonPi0_Analyzer::specifyRunTime()
     isDataAnalysis = true;
     isScanRun = false;
     fillErrors_ByHand = true; // Affects only Vertical Error Bands - Lateral Bands always filled ByHand
+    fillSystematics = true; // false: CV only -- Error Bands stay empty and Systematics Branches are not read
+
+    // Columnar NTuple -- Flat arrays of the Analysis Mode branches next to the Reduced NTuple
+    writeColumnarNTuple = false; // reduce() writes ReducedNTuple_<version>_Columnar/
+    readColumnarNTuple = false;  // analyze() maps the columns instead of reading the Chain
 
     applyGENIETuning_Complete = true;
     
@@ -70,6 +75,9 @@ void CCProtonPi0_Analyzer::reduce(string playlist)
     if(m_isMC) rootDir = Folder_List::rootOut + Folder_List::MC + Folder_List::reduced + "ReducedNTuple_" + version + ".root";
     else rootDir = Folder_List::rootOut + Folder_List::Data + Folder_List::reduced + "ReducedNTuple_" + version + ".root";
 
+    // Incremental Reduce writes one chunk for each input file
+    rootDir = GetOutputFileName(rootDir);
+
     cout<<"Reducing NTuple Files to a single file"<<endl;
     cout<<"\tRoot File: "<<rootDir<<endl;
     TFile* f = new TFile(rootDir.c_str(),"RECREATE");
@@ -87,6 +95,15 @@ void CCProtonPi0_Analyzer::reduce(string playlist)
     // Clone Tree from Chain
     TTree* tree = fChain->CloneTree(0);
 
+    // Columnar NTuple with the branches used in Analysis Mode
+    CCProtonPi0_ColumnarNTuple columnar;
+    if (writeColumnarNTuple){
+        std::vector<std::string> columns;
+        ReadBranchManifest(Folder_List::BranchManifest, columns);
+        if (m_isMC) ReadBranchManifest(Folder_List::BranchManifest_MC, columns);
+        columnar.OpenWrite(CCProtonPi0_ColumnarNTuple::GetColumnarDir(rootDir), fChain, columns);
+    }
+
     // Get First Line for the first File
     getline(DSTFileList,scanFileName);
 
@@ -95,20 +112,13 @@ void CCProtonPi0_Analyzer::reduce(string playlist)
     //------------------------------------------------------------------------
     cout<<"Looping over all entries"<<endl;
 
-    Long64_t nbytes = 0, nb = 0;
     Long64_t nentries = fChain->GetEntriesFast();
+    CCProtonPi0_EventSource events(fChain, 0, nentries);
+    events.CountBranchBytes(activeBranches);
 
-    for (Long64_t jentry=0; jentry < nentries; jentry++) {
-
-        Long64_t ientry = fChain->GetEntry(jentry);
-        if (ientry < 0) break;
+    while (events.Next()) {
 
-        nb = fChain->GetEntry(jentry);   nbytes += nb;    
-
-        if (ientry == 0) {
-            cout<<"\tGetEntry failure "<<jentry<<endl;
-            break;
-        }
+        Long64_t jentry = events.GetEntryNumber();
 
         // Reset Counters isCounted
         counter1.isCounted = false;
@@ -148,7 +158,10 @@ void CCProtonPi0_Analyzer::reduce(string playlist)
         if( !isPassedAllCuts ) continue;
 
         tree->Fill();
+        if (writeColumnarNTuple) columnar.Fill();
     }
+    events.PrintSummary();
+    if (writeColumnarNTuple) columnar.Close();
 
     if (!m_isMC){
         AddVertErrorBands_Data(cutList.invMass_all);
@@ -175,6 +188,8 @@ void CCProtonPi0_Analyzer::reduce(string playlist)
     }
     cutList.writeCutTable();
     cutList.writeHistograms();
+    if (IsPartitioned()) writeReduceChunkCounts();
+    writeBranchesRead(fChain, events);
 
     cout<<">> Writing "<<rootDir<<endl;
     tree->AutoSave();    
@@ -216,17 +231,25 @@ void CCProtonPi0_Analyzer::analyze(string playlist)
     // Get First Line for the first File
     getline(DSTFileList,scanFileName);
 
-    Long64_t nbytes = 0, nb = 0;
-    Long64_t nentries = fChain->GetEntriesFast();
-    for (Long64_t jentry=0; jentry < nentries; jentry++) {
+    // Columnar NTuple replaces the Chain as the event source
+    CCProtonPi0_ColumnarNTuple columnar;
+    if (readColumnarNTuple) columnar.OpenRead(fChain);
 
-        nb = fChain->GetEntry(jentry);   nbytes += nb;    
-        Long64_t ientry = fChain->GetEntry(jentry);
+    // Partitioned Runs need the exact number of entries to split the chain
+    Long64_t nentries;
+    if (readColumnarNTuple) nentries = columnar.GetEntries();
+    else nentries = IsPartitioned() ? fChain->GetEntries() : fChain->GetEntriesFast();
+    Long64_t first_entry, last_entry;
+    GetPartitionRange(nentries, first_entry, last_entry);
+    if (IsPartitioned()) cout<<"\tPartition "<<partitionID<<" Entries "<<first_entry<<" - "<<last_entry<<endl;
 
-        if (ientry == 0) {
-            cout<<"\tGetEntry failure "<<jentry<<endl;
-            break;
-        }
+    CCProtonPi0_EventSource events(fChain, first_entry, last_entry);
+    if (readColumnarNTuple) events.SetColumnarNTuple(&columnar);
+    else events.CountBranchBytes(activeBranches);
+
+    while (events.Next()) {
+
+        Long64_t jentry = events.GetEntryNumber();
 
         // Progress Message on Terminal
         int msg_entry;
@@ -301,7 +324,7 @@ void CCProtonPi0_Analyzer::analyze(string playlist)
         //----------------------------------------------------------------------
         if (isDataAnalysis){
             fill_XSecVars();
-            if (m_isMC){
+            if (m_isMC && fillSystematics){
                 FillLatErrorBands_ByHand();
             }
         }
@@ -357,9 +380,13 @@ void CCProtonPi0_Analyzer::analyze(string playlist)
         //Study_DeltaResonance();
         //Study_NonRES();
     } // end for-loop
+    events.PrintSummary();
 
     if (!m_isMC) AddErrorBands_Data();
 
+    // Serial Run writes them too -- Reference for checkRun
+    writePartitionCounters();
+
     //--------------------------------------------------------------------------
     // Studies Outside Loop 
     //--------------------------------------------------------------------------
@@ -373,6 +400,7 @@ void CCProtonPi0_Analyzer::analyze(string playlist)
     //--------------------------------------------------------------------------
     bckgTool.writeBackgroundTable();
     //getPi0Family(); // Pi0 Family Information written inside FailFile
+    writeBranchesRead(fChain, events);
 
     //--------------------------------------------------------------------------
     // Write Root Files
@@ -390,6 +418,37 @@ void CCProtonPi0_Analyzer::analyze(string playlist)
     writeEventTypeTable();
 }
 
+void CCProtonPi0_Analyzer::mergePartitions()
+{
+    cout<<"Merging "<<nPartitions<<" Partitions"<<endl;
+
+    // Counters and Background Tables -- Compensated sums in partition order
+    std::vector<double> comp;
+    std::vector<double> comp_bckg;
+    for (int part_id = 0; part_id < nPartitions; ++part_id){
+        addPartitionCounters(part_id, comp, comp_bckg);
+    }
+    addPartitionCompensation(comp, comp_bckg);
+    writePartitionCounters();
+
+    avg_Enu = avg_Enu / n_data;
+    avg_Enu_10 = avg_Enu_10 / n_data_10;
+    std::cout<<"Average Neutrino Energy = "<<avg_Enu<<std::endl;
+    std::cout<<"Average Neutrino Energy less than 10 GeV = "<<avg_Enu_10<<std::endl;
+
+    bckgTool.writeBackgroundTable();
+
+    // Histograms -- Including all Error Band Universes
+    interaction.mergePartitions();
+    muon.mergePartitions();
+    proton.mergePartitions();
+    pi0.mergePartitions();
+    pi0Blob.mergePartitions();
+
+    printCounters();
+    writeEventTypeTable();
+}
+
 //------------------------------------------------------------------------------
 //  Constructor
 //------------------------------------------------------------------------------
@@ -416,8 +475,15 @@ CCProtonPi0_Analyzer::CCProtonPi0_Analyzer(bool isModeReduce, bool isMC) :
 
     initLateralErrorBandShifts(isModeReduce);
 
+    if (isMC && !isModeReduce) initLatErrorBandHandles();
+    if (isMC) initLatErrorBandHandles_invMass(); // Side Band invMass is filled in Reduce Mode too
+
     initCVWeights();
 
+    initBckgConstraintWeights();
+
+    initEventWeights();
+
     InformSignalType();
 
     cout<<"Initialization Finished!\n"<<endl;
@@ -1008,7 +1074,7 @@ bool CCProtonPi0_Analyzer::getCutStatistics()
         FillInvMass_TruthMatch();
         FillHistogramWithVertErrors(cutList.hCut_pi0invMass, pi0_invMass);
         // Fill Lateral Error Bands on hCut_pi0invMass
-        if (m_isMC){
+        if (m_isMC && fillSystematics){
             FillLatErrorBand_EM_EnergyScale_SideBand_invMass();
             FillLatErrorBand_MuonMomentum_SideBand_invMass();
             FillLatErrorBand_MuonTheta_SideBand_invMass();
@@ -1602,13 +1668,15 @@ void CCProtonPi0_Analyzer::fill_BackgroundSubtractionHists()
         else FillHistogramWithVertErrors(cutList.invMass_mc_reco_bckg, pi0_invMass);
 
         // Fill Lateral Error Bands
-        FillLatErrorBand_EM_EnergyScale_invMass();
-        FillLatErrorBand_MuonMomentum_invMass();
-        FillLatErrorBand_MuonTheta_invMass();
-        FillLatErrorBand_ProtonEnergy_Birks_invMass();
-        FillLatErrorBand_ProtonEnergy_invMass("ProtonEnergy_MassModel");
-        FillLatErrorBand_ProtonEnergy_invMass("ProtonEnergy_MEU");
-        FillLatErrorBand_ProtonEnergy_invMass("ProtonEnergy_BetheBloch");
+        if (fillSystematics){
+            FillLatErrorBand_EM_EnergyScale_invMass();
+            FillLatErrorBand_MuonMomentum_invMass();
+            FillLatErrorBand_MuonTheta_invMass();
+            FillLatErrorBand_ProtonEnergy_Birks_invMass();
+            FillLatErrorBand_ProtonEnergy_invMass("ProtonEnergy_MassModel");
+            FillLatErrorBand_ProtonEnergy_invMass("ProtonEnergy_MEU");
+            FillLatErrorBand_ProtonEnergy_invMass("ProtonEnergy_BetheBloch");
+        }
     }else{
         FillHistogram(cutList.invMass_all, pi0_invMass);
     }
@@ -2173,7 +2241,12 @@ void CCProtonPi0_Analyzer::CalcEventWeight()
             cvweight *= cvweight_CCRES;
         }
 
-        UpdateGENIESystematics();
+        // Systematic Weights for the Error Bands
+        //      Reduce Mode fills Error Bands too (hCut_pi0invMass in getCutStatistics)
+        if (fillSystematics){
+            UpdateGENIESystematics();
+            FillEventWeights();
+        }
     }else{
         cvweight = 1.0; 
     }
@@ -2206,21 +2279,17 @@ void CCProtonPi0_Analyzer::FillInvMass_TruthMatch()
 
 double CCProtonPi0_Analyzer::GetMINOSCorrectionErr()
 {
-    std::string playlist = GetPlaylist(mc_run, mc_intType);
-    if (playlist.compare("minerva_2p2h") == 0) playlist = "minerva13C";
-
-    MnvNormalizer normalizer("Eroica", playlist);
-    double correctionErr = normalizer.GetCorrectionErr(CCProtonPi0_minos_trk_p);
+    // MnvNormalizer for the playlist is set by UpdateFluxReweighter()
+    UpdateFluxReweighter(mc_run, mc_intType);
+    double correctionErr = minos_normalizer->GetCorrectionErr(CCProtonPi0_minos_trk_p);
     return correctionErr;
 }
 
 double CCProtonPi0_Analyzer::GetMINOSCorrection()
 {
-    std::string playlist = GetPlaylist(mc_run, mc_intType);
-    if (playlist.compare("minerva_2p2h") == 0) playlist = "minerva13C";
-
-    MnvNormalizer normalizer("Eroica", playlist);
-    double correction = normalizer.GetCorrection(CCProtonPi0_minos_trk_p);
+    // MnvNormalizer for the playlist is set by UpdateFluxReweighter()
+    UpdateFluxReweighter(mc_run, mc_intType);
+    double correction = minos_normalizer->GetCorrection(CCProtonPi0_minos_trk_p);
     return correction;
 }
 
@@ -2524,7 +2593,7 @@ void CCProtonPi0_Analyzer::fill_SideBand_InvMass()
         FillInvMass_TruthMatch();
         FillHistogramWithVertErrors(cutList.hCut_pi0invMass, pi0_invMass);
         // Fill Lateral Error Bands
-        if (m_isMC){
+        if (m_isMC && fillSystematics){
             FillLatErrorBand_EM_EnergyScale_SideBand_invMass();
             FillLatErrorBand_MuonMomentum_SideBand_invMass();
             FillLatErrorBand_MuonTheta_SideBand_invMass();
@@ -3321,6 +3390,155 @@ void CCProtonPi0_Analyzer::writeEventTypeTable()
     }
 }
 
+std::vector<CCProtonPi0_Counter*> CCProtonPi0_Analyzer::GetAllCounters()
+{
+    std::vector<CCProtonPi0_Counter*> all;
+
+    all.push_back(&nSignalOut_Acceptance);
+    all.push_back(&nSignalOut_Kinematics);
+    all.push_back(&nMichel_Truth);
+    all.push_back(&nMichel_Total_Found);
+    all.push_back(&nMichel_Total_Found_Improved);
+    all.push_back(&nMichel_Truth_Found);
+    all.push_back(&nMichel_Truth_Found_Improved);
+    all.push_back(&n2p2h);
+    for (int i = 0; i < 3; ++i){
+        all.push_back(&nAll[i]);
+        all.push_back(&nAll_Signal[i]);
+        all.push_back(&nAll_Bckg[i]);
+        all.push_back(&nSignal_Delta_RES[i]);
+        all.push_back(&nSignal_Other_RES[i]);
+        all.push_back(&nSignal_Non_RES[i]);
+        all.push_back(&nBckg_WithPi0[i]);
+        all.push_back(&nBckg_QELike[i]);
+        all.push_back(&nBckg_PiPlus[i]);
+        all.push_back(&nBckg_Other[i]);
+    }
+    all.push_back(&counter1);
+    all.push_back(&counter2);
+    all.push_back(&counter3);
+    all.push_back(&counter4);
+
+    return all;
+}
+
+void CCProtonPi0_Analyzer::writeReduceChunkCounts()
+{
+    std::string fileName = Folder_List::output + Folder_List::textOut + "ReduceChunkCounts.txt";
+    std::ofstream file;
+    OpenTextFile(fileName, file);
+    cutList.writeCutCounts(file);
+    file.close();
+}
+
+void CCProtonPi0_Analyzer::mergeReduceChunks(const std::vector<int>& chunk_ids)
+{
+    cout<<"Merging "<<chunk_ids.size()<<" Reduce Chunks"<<endl;
+
+    for (unsigned int i = 0; i < chunk_ids.size(); ++i){
+        std::string fileName = GetPartitionFileName(Folder_List::output + Folder_List::textOut + "ReduceChunkCounts.txt", chunk_ids[i]);
+        std::ifstream file(fileName.c_str());
+        if (!file.is_open()){
+            RunTimeError("Cannot open reduce chunk counts " + fileName);
+        }
+        cutList.addCutCounts(file);
+        file.close();
+    }
+
+    cutList.writeCutTable();
+    cutList.mergeHistograms(chunk_ids);
+}
+
+std::string CCProtonPi0_Analyzer::GetCountersFileName()
+{
+    return Folder_List::output + Folder_List::textOut + "PartitionCounters.txt";
+}
+
+std::vector<std::string> CCProtonPi0_Analyzer::GetOutputRootFiles(bool isMC)
+{
+    std::vector<std::string> files;
+    if (isMC){
+        files.push_back(Folder_List::rootDir_Interaction_mc);
+        files.push_back(Folder_List::rootDir_Muon_mc);
+        files.push_back(Folder_List::rootDir_Proton_mc);
+        files.push_back(Folder_List::rootDir_Pion_mc);
+        files.push_back(Folder_List::rootDir_Pi0Blob_mc);
+    }else{
+        files.push_back(Folder_List::rootDir_Interaction_data);
+        files.push_back(Folder_List::rootDir_Muon_data);
+        files.push_back(Folder_List::rootDir_Proton_data);
+        files.push_back(Folder_List::rootDir_Pion_data);
+        files.push_back(Folder_List::rootDir_Pi0Blob_data);
+    }
+    return files;
+}
+
+void CCProtonPi0_Analyzer::writePartitionCounters()
+{
+    std::string fileName = GetCountersFileName();
+    std::ofstream file;
+    OpenTextFile(fileName, file);
+
+    // Full precision -- Merged Counters must match the serial run
+    file<<std::setprecision(17);
+
+    std::vector<CCProtonPi0_Counter*> all = GetAllCounters();
+    for (unsigned int i = 0; i < all.size(); ++i){
+        file<<all[i]->getCount()<<std::endl;
+    }
+    file<<avg_Enu<<" "<<avg_Enu_10<<" "<<n_data<<" "<<n_data_10<<std::endl;
+
+    bckgTool.writeBackgroundCounts(file);
+    file.close();
+}
+
+void CCProtonPi0_Analyzer::addPartitionCounters(int part_id, std::vector<double>& comp, std::vector<double>& comp_bckg)
+{
+    std::string fileName = GetPartitionFileName(GetCountersFileName(), part_id);
+    std::ifstream file(fileName.c_str());
+    if (!file.is_open()){
+        RunTimeError("Cannot open partition counters " + fileName);
+    }
+
+    // Rounding Errors -- All Counters, then avg_Enu, avg_Enu_10, n_data, n_data_10
+    std::vector<CCProtonPi0_Counter*> all = GetAllCounters();
+    comp.resize(all.size() + 4, 0.0);
+
+    double count;
+    for (unsigned int i = 0; i < all.size(); ++i){
+        if (!(file>>count)) RunTimeError("Cannot read Counter " + all[i]->getName() + " from " + fileName);
+        double old_count = all[i]->getCount();
+        all[i]->increment(count);
+        comp[i] += Data_Functions::getRoundingError(old_count, count, all[i]->getCount());
+    }
+
+    double part_avg_Enu, part_avg_Enu_10, part_n_data, part_n_data_10;
+    file>>part_avg_Enu>>part_avg_Enu_10>>part_n_data>>part_n_data_10;
+    Data_Functions::compensatedAdd(avg_Enu, comp[all.size()], part_avg_Enu);
+    Data_Functions::compensatedAdd(avg_Enu_10, comp[all.size()+1], part_avg_Enu_10);
+    Data_Functions::compensatedAdd(n_data, comp[all.size()+2], part_n_data);
+    Data_Functions::compensatedAdd(n_data_10, comp[all.size()+3], part_n_data_10);
+
+    bckgTool.addBackgroundCounts(file, comp_bckg);
+    file.close();
+}
+
+void CCProtonPi0_Analyzer::addPartitionCompensation(const std::vector<double>& comp, const std::vector<double>& comp_bckg)
+{
+    std::vector<CCProtonPi0_Counter*> all = GetAllCounters();
+    if (comp.size() != all.size() + 4) return;
+
+    for (unsigned int i = 0; i < all.size(); ++i){
+        all[i]->increment(comp[i]);
+    }
+    avg_Enu += comp[all.size()];
+    avg_Enu_10 += comp[all.size()+1];
+    n_data += comp[all.size()+2];
+    n_data_10 += comp[all.size()+3];
+
+    bckgTool.addBackgroundCompensation(comp_bckg);
+}
+
 void CCProtonPi0_Analyzer::writeEventTypeTableLine(CCProtonPi0_Counter &counter, CCProtonPi0_Counter &base)
 {
     eventTypeTable.width(20); eventTypeTable<<counter.getName(); 
@@ -24,6 +24,7 @@
 #include <TVector3.h>
 #include <TLorentzVector.h>
 #include <sstream>
+#include <map>
 #include <unordered_map>
 
 #include "PlotUtils/MnvNormalization.h"
@@ -42,6 +43,129 @@
 #include "../BckgConstrainer/CCProtonPi0_BckgConstrainer.h"
 #include "../Counter/CCProtonPi0_Counter.h"
 #include "../QSqFitter/CCProtonPi0_QSqFitter.h"
+#include "../EventSource/CCProtonPi0_EventSource.h"
+#include "../ColumnarNTuple/CCProtonPi0_ColumnarNTuple.h"
+
+// Lateral Error Band Handle
+//  Resolved once per (histogram, error band) and reused for every universe
+struct LatErrorBandHandle
+{
+    std::string err_name;
+    int bckg_err_id;
+    MnvLatErrorBand* err_band;
+    std::vector<TH1D*> err_hists;
+    int nbins;
+
+    // CV Bin of the last filled value
+    bool isCVBinSet;
+    double cv_var;
+    int cvbin;
+    double cvBinLowEdge;
+    double cvBinHighEdge;
+};
+
+struct LatErrorBandHandle2D
+{
+    std::string err_name;
+    int bckg_err_id;
+    MnvH2D* hist;
+    MnvLatErrorBand2D* err_band;
+    std::vector<TH2D*> err_hists;
+};
+
+// Handles for the 5 Cross Section histograms of a single variable
+struct LatErrorBand_XSecVar
+{
+    LatErrorBandHandle* mc_reco_all;
+    LatErrorBandHandle* mc_truth_signal;
+    LatErrorBandHandle* mc_reco_signal;
+    LatErrorBandHandle* mc_reco_bckg;
+    LatErrorBandHandle2D* response;
+};
+
+struct LatErrorBand_XSecVars
+{
+    LatErrorBand_XSecVar pi0_P;
+    LatErrorBand_XSecVar pi0_KE;
+    LatErrorBand_XSecVar pi0_theta;
+    LatErrorBand_XSecVar muon_P;
+    LatErrorBand_XSecVar muon_theta;
+    LatErrorBand_XSecVar QSq;
+    LatErrorBand_XSecVar W;
+    LatErrorBand_XSecVar Enu;
+    LatErrorBand_XSecVar deltaInvMass;
+    LatErrorBand_XSecVar Delta_pi_theta;
+    LatErrorBand_XSecVar Delta_pi_phi;
+};
+
+// Handles for the Background Subtraction invMass histograms
+struct LatErrorBand_InvMass
+{
+    LatErrorBandHandle* mc_reco_all;
+    LatErrorBandHandle* mc_reco_signal;
+    LatErrorBandHandle* mc_reco_bckg;
+};
+
+// Handles for the Side Band invMass histograms -- one per cutList.hCut_pi0invMass
+typedef std::vector<LatErrorBandHandle*> LatErrorBand_SideBand;
+
+// Shifted Event Kinematics for All Lateral Universes
+//  Structure of Arrays -- filled by Calc_LatUniverseKinematics_*()
+struct LatUniverseKinematics
+{
+    double gamma1_E[CCProtonPi0_NTupleAnalysis::n_lateral_universes];
+    double gamma2_E[CCProtonPi0_NTupleAnalysis::n_lateral_universes];
+    double pi0_invMass[CCProtonPi0_NTupleAnalysis::n_lateral_universes];
+    double pi0_px[CCProtonPi0_NTupleAnalysis::n_lateral_universes];
+    double pi0_py[CCProtonPi0_NTupleAnalysis::n_lateral_universes];
+    double pi0_pz[CCProtonPi0_NTupleAnalysis::n_lateral_universes];
+    double pi0_P[CCProtonPi0_NTupleAnalysis::n_lateral_universes];
+    double pi0_E[CCProtonPi0_NTupleAnalysis::n_lateral_universes];
+    double pi0_KE[CCProtonPi0_NTupleAnalysis::n_lateral_universes];
+    double muon_px[CCProtonPi0_NTupleAnalysis::n_lateral_universes];
+    double muon_py[CCProtonPi0_NTupleAnalysis::n_lateral_universes];
+    double muon_pz[CCProtonPi0_NTupleAnalysis::n_lateral_universes];
+    double muon_P[CCProtonPi0_NTupleAnalysis::n_lateral_universes];
+    double muon_E[CCProtonPi0_NTupleAnalysis::n_lateral_universes];
+    double muon_theta[CCProtonPi0_NTupleAnalysis::n_lateral_universes];
+    double Enu[CCProtonPi0_NTupleAnalysis::n_lateral_universes];
+    double QSq[CCProtonPi0_NTupleAnalysis::n_lateral_universes];
+    double W[CCProtonPi0_NTupleAnalysis::n_lateral_universes];
+    double deltaInvMass[CCProtonPi0_NTupleAnalysis::n_lateral_universes];
+    double Delta_pi_theta[CCProtonPi0_NTupleAnalysis::n_lateral_universes];
+    double Delta_pi_phi[CCProtonPi0_NTupleAnalysis::n_lateral_universes];
+    bool PassedCuts[CCProtonPi0_NTupleAnalysis::n_lateral_universes];
+};
+
+// Vertical Error Band Weights of a Single Event
+struct VertErrorWeights
+{
+    std::string err_name;
+    int bckg_err_id;
+    std::vector<double> errors;
+};
+
+// Event Weight Cache -- Calculated once per event in CalcEventWeight()
+struct EventWeights
+{
+    VertErrorWeights Flux;      // bckg_err_id is set in initBckgConstraintWeights()
+    std::vector<VertErrorWeights> Genie;
+    VertErrorWeights BckgConstraint_WithPi0;
+    VertErrorWeights BckgConstraint_SinglePiPlus;
+    VertErrorWeights BckgConstraint_QELike;
+    VertErrorWeights MichelTrue;
+    VertErrorWeights MichelFake;
+    VertErrorWeights TargetMass;
+    VertErrorWeights Unfolding;
+    VertErrorWeights Weight_2p2h;
+    VertErrorWeights ProtonTracking;
+    VertErrorWeights MuonTracking;
+    VertErrorWeights PionResponse;
+    VertErrorWeights NeutronResponse;
+
+    // Constrained Background Type: 0 SinglePiPlus, 1 QELike, 2 WithPi0, -1 Not Constrained
+    int bckg_type;
+};
 
 class CCProtonPi0_Analyzer : public CCProtonPi0_NTupleAnalysis
 {
@@ -56,6 +180,16 @@ class CCProtonPi0_Analyzer : public CCProtonPi0_NTupleAnalysis
         void analyze(string playlist);
         void reduce(string playlist);
 
+        // Partitioned Runs -- Merges outputs of all partitions after workers finish
+        void mergePartitions();
+
+        // Outputs of analyze() compared by checkRun -- Serial vs Partitioned
+        static std::string GetCountersFileName();
+        static std::vector<std::string> GetOutputRootFiles(bool isMC);
+
+        // Incremental Reduce -- Accumulates Cut Tables and Cut Histograms of all chunks
+        void mergeReduceChunks(const std::vector<int>& chunk_ids);
+
     private:
         //  Runtime and CCProtonPi0_Analyzer Functions
         bool getCutStatistics();
@@ -106,10 +240,28 @@ class CCProtonPi0_Analyzer : public CCProtonPi0_NTupleAnalysis
         void FillHistogramWithLeadingErrors(MnvH2D* hist, double xval, double yval);
 
         // Vertical Error Band
-        void FillVertErrorBand_ByHand(MnvH1D* h, double var, std::string error_name, std::vector<double> errors);
+        void FillVertErrorBand_ByHand(MnvH1D* h, double var, const std::string& error_name, const std::vector<double>& errors);
+        void FillVertErrorBand_ByHand(MnvH1D* h, double var, const std::string& error_name, const std::vector<double>& errors, int bckg_err_id);
         void FillVertErrorBand_ByHand(MnvH1D* h, double var, std::string error_name, double err_down, double err_up);
-        void FillVertErrorBand_ByHand(MnvH2D* h, double xval, double yval, std::string error_name, std::vector<double> errors);
+        void FillVertErrorBand_ByHand(MnvH2D* h, double xval, double yval, const std::string& error_name, const std::vector<double>& errors);
+        void FillVertErrorBand_ByHand(MnvH2D* h, double xval, double yval, const std::string& error_name, const std::vector<double>& errors, int bckg_err_id);
         void FillVertErrorBand_ByHand(MnvH2D* h, double xval, double yval, std::string error_name, double err_down, double err_up);
+        void FillVertErrorBand(MnvH1D* h, double var, const VertErrorWeights& weights);
+        void FillVertErrorBand(MnvH2D* h, double xval, double yval, const VertErrorWeights& weights);
+        void FillVertErrorBand_ByHand(MnvH1D* h, double var, const VertErrorWeights& weights);
+        void FillVertErrorBand_ByHand(MnvH2D* h, double xval, double yval, const VertErrorWeights& weights);
+
+        // Event Weight Cache
+        void initEventWeights();
+        void initEventWeight(VertErrorWeights& weights, std::string err_name);
+        void AddGenieEventWeight(std::string err_name, double* genie_wgts);
+        void SetEventWeight(VertErrorWeights& weights, double correctionErr);
+        void FillEventWeights();
+        void initBckgConstraintWeights();
+        const std::vector<double>* GetBckgConstraintWeights(int bckg_err_id);
+        EventWeights eventWeights;
+        std::vector<double*> genie_wgt_arrays;
+        std::vector< std::vector<double> > bckgConstraintWeights[N_BCKG_TYPES];
         void FillVertErrorBand_Flux(MnvH1D* h, double var);
         void FillVertErrorBand_Flux(MnvH2D* h, double xval, double yval);
         void FillVertErrorBand_Flux_ByHand(MnvH1D* h, double var);
@@ -211,9 +363,33 @@ class CCProtonPi0_Analyzer : public CCProtonPi0_NTupleAnalysis
         void Calc_Birks_random_shifts();
         double Calc_Enu_shifted(double muon_E_shifted, double pi0_E_shifted, double total_proton_KE_shifted);
         void FillLatErrorBands_ByHand();
-        void FillLatErrorBand_SingleUniverse(MnvH1D* hist, std::string err_name, int unv, double var, double shift);
-        void FillLatErrorBand_SingleUniverse2(MnvH1D* hist, std::string err_name, int unv, double var, double shift);
-        void FillLatErrorBand_SingleUniverse(MnvH2D* hist, std::string err_name, int unv, double xval, double yval, double x_shift, double y_shift);
+        void FillLatErrorBand_SingleUniverse(LatErrorBandHandle* handle, int unv, double var, double shift);
+        void FillLatErrorBand_SingleUniverse(LatErrorBandHandle2D* handle, int unv, double xval, double yval, double x_shift, double y_shift);
+        void FillLatErrorBand_SingleUniverse(LatErrorBand_XSecVar& band, int unv, double reco, double truth, double shift);
+        void FillLatErrorBand_SingleUniverse(LatErrorBand_InvMass& band, int unv, double var, double shift);
+        void FillLatErrorBand_SingleUniverse(LatErrorBand_SideBand& band, int unv, double var, double shift);
+
+        // Lateral Universe Kinematics
+        void Calc_LatUniverseKinematics_EM_EnergyScale(LatUniverseKinematics& __restrict kin, const double* __restrict shifts, double reco_muon_theta);
+        void Calc_LatUniverseKinematics_MuonMomentum(LatUniverseKinematics& __restrict kin, const double* __restrict shifts, double reco_muon_theta);
+        void Calc_LatUniverseKinematics_MuonTheta(LatUniverseKinematics& __restrict kin, const double* __restrict shifts, double reco_muon_theta);
+        void Calc_LatUniverse_DeltaKinematics(LatUniverseKinematics& kin);
+        LatUniverseKinematics latUniverseKinematics;
+
+        // Lateral Error Band Handle Registry
+        void initLatErrorBandHandles();
+        void initLatErrorBandHandles_invMass();
+        void initLatErrorBand_XSecVar(LatErrorBand_XSecVar& band, std::string err_name, MnvH1D* mc_reco_all, MnvH1D* mc_truth_signal, MnvH1D* mc_reco_signal, MnvH1D* mc_reco_bckg, MnvH2D* response);
+        LatErrorBandHandle* GetLatErrorBandHandle(MnvH1D* hist, std::string err_name);
+        LatErrorBandHandle2D* GetLatErrorBandHandle(MnvH2D* hist, std::string err_name);
+        LatErrorBand_XSecVars& GetLatErrorBand_XSecVars(std::string err_name);
+        LatErrorBand_InvMass& GetLatErrorBand_InvMass(std::string err_name);
+        LatErrorBand_SideBand& GetLatErrorBand_SideBand(std::string err_name);
+        std::map< std::pair<MnvH1D*, std::string>, LatErrorBandHandle > latErrorBandHandles;
+        std::map< std::pair<MnvH2D*, std::string>, LatErrorBandHandle2D > latErrorBandHandles2D;
+        std::map< std::string, LatErrorBand_XSecVars > latErrorBands_XSec;
+        std::map< std::string, LatErrorBand_InvMass > latErrorBands_invMass;
+        std::map< std::string, LatErrorBand_SideBand > latErrorBands_SideBand;
 
         void FillLatErrorBand_EM_EnergyScale();
         void FillLatErrorBand_EM_EnergyScale_invMass();
@@ -305,7 +481,7 @@ class CCProtonPi0_Analyzer : public CCProtonPi0_NTupleAnalysis
         void setCounterNames();
         void GetMichelStatistics();
         void GetMichelStatistics_Showers();
-        double GetBckgConstraint(std::string error_name, int hist_ind);
+        double GetBckgConstraint(int bckg_err_id, int hist_ind);
         std::vector<int> GetPrimaryParticles();
         void Study_BckgSubtraction();
         void Study_W();
@@ -369,6 +545,13 @@ class CCProtonPi0_Analyzer : public CCProtonPi0_NTupleAnalysis
 
         // Default Functions
         void Init(string playlist, TChain* fChain);
+
+        // Branch Manifest and TTreeCache
+        static const Long64_t treeCacheSize = 100000000; // 100 MB
+        std::vector<std::string> activeBranches;
+        void SetBranchManifest(TChain* fChain);
+        void ReadBranchManifest(std::string fileName, std::vector<std::string> &branchNames);
+        void writeBranchesRead(TChain* fChain, const CCProtonPi0_EventSource& events);
         Int_t GetEntry(Long64_t entry);
         Long64_t LoadTree(Long64_t entry);
 
@@ -394,10 +577,13 @@ class CCProtonPi0_Analyzer : public CCProtonPi0_NTupleAnalysis
 
         // Other Variables
         bool fillErrors_ByHand;
+        bool fillSystematics;
         bool m_isMC;
         bool m_isModeReduce;
         bool isScanRun;
         bool isDataAnalysis;
+        bool writeColumnarNTuple;
+        bool readColumnarNTuple;
         bool applyGENIETuning_Complete;
         bool applyGENIETuning_DeltaSuppression;
         bool applyBckgConstraints_CV;
@@ -441,6 +627,11 @@ class CCProtonPi0_Analyzer : public CCProtonPi0_NTupleAnalysis
         void update_EventTypeCounters(int i);
         void printCounters();
         void writeEventTypeTable();
+        std::vector<CCProtonPi0_Counter*> GetAllCounters();
+        void writePartitionCounters();
+        void addPartitionCounters(int part_id, std::vector<double>& comp, std::vector<double>& comp_bckg);
+        void addPartitionCompensation(const std::vector<double>& comp, const std::vector<double>& comp_bckg);
+        void writeReduceChunkCounts();
         void writeEventTypeTableLine(CCProtonPi0_Counter &counter, CCProtonPi0_Counter &base);
         bool isDeltaRichSample();
         bool isDeltaRichSample_Truth();
@@ -802,6 +802,92 @@ void CCProtonPi0_Analyzer::Init(string playlist, TChain* fChain)
     fChain->SetBranchAddress("prong_part_charge", prong_part_charge, &b_prong_part_charge);
     fChain->SetBranchAddress("prong_part_pid", prong_part_pid, &b_prong_part_pid);
 
+    SetBranchManifest(fChain);
+}
+
+void CCProtonPi0_Analyzer::SetBranchManifest(TChain* fChain)
+{
+    activeBranches.clear();
+
+    TObjArray* branches = fChain->GetListOfBranches();
+    if (branches == NULL){
+        cout<<"WARNING! Chain has no branches -- Branch Manifest not applied"<<endl;
+        return;
+    }
+
+    if (m_isModeReduce){
+        // Reduced NTuple is a clone of the Chain -- All Branches must stay active
+        for (int i = 0; i < branches->GetEntries(); ++i){
+            activeBranches.push_back(branches->At(i)->GetName());
+        }
+    }else{
+        std::vector<std::string> manifest;
+        ReadBranchManifest(Folder_List::BranchManifest, manifest);
+        if (m_isMC) ReadBranchManifest(Folder_List::BranchManifest_MC, manifest);
+        if (m_isMC && fillSystematics) ReadBranchManifest(Folder_List::BranchManifest_MC_Systematics, manifest);
+
+        fChain->SetBranchStatus("*", 0);
+        for (unsigned int i = 0; i < manifest.size(); ++i){
+            if (fChain->GetBranch(manifest[i].c_str()) == NULL){
+                cout<<"WARNING! Branch in Manifest not found in Chain: "<<manifest[i]<<endl;
+                continue;
+            }
+            fChain->SetBranchStatus(manifest[i].c_str(), 1);
+            activeBranches.push_back(manifest[i]);
+        }
+    }
+
+    // Read only the active Branches through the TTreeCache
+    CCProtonPi0_EventSource::EnableAsyncPrefetching();
+    fChain->SetCacheSize(treeCacheSize);
+    for (unsigned int i = 0; i < activeBranches.size(); ++i){
+        fChain->AddBranchToCache(activeBranches[i].c_str(), kTRUE);
+    }
+    fChain->StopCacheLearningPhase();
+
+    cout<<"\tActive Branches = "<<activeBranches.size()<<" / "<<branches->GetEntries()<<endl;
+    cout<<"\tTTreeCache Size = "<<treeCacheSize/1000000<<" MB"<<endl;
+}
+
+void CCProtonPi0_Analyzer::ReadBranchManifest(std::string fileName, std::vector<std::string> &branchNames)
+{
+    ifstream manifest(fileName.c_str());
+    if (!manifest.is_open()){
+        cerr<<"Cannot open Branch Manifest: "<<fileName<<endl;
+        exit(1);
+    }
+    cout<<"Reading Branch Manifest: "<<fileName<<endl;
+
+    std::string line;
+    while (getline(manifest, line)){
+        // Skip empty lines and comments
+        if (line.empty() || line[0] == '#') continue;
+        branchNames.push_back(line);
+    }
+    manifest.close();
+}
+
+void CCProtonPi0_Analyzer::writeBranchesRead(TChain* fChain, const CCProtonPi0_EventSource& events)
+{
+    ofstream file;
+    std::string mode = m_isModeReduce ? "Reduce" : "Analyze";
+    std::string fileName = Folder_List::output + Folder_List::textOut + "BranchesRead_" + mode + ".txt";
+    OpenTextFile(fileName, file);
+
+    Long64_t bytesRead = TFile::GetFileBytesRead();
+
+    file<<"Active Branches = "<<activeBranches.size()<<" / "<<fChain->GetListOfBranches()->GetEntries()<<endl;
+    file<<"Bytes Read = "<<bytesRead<<endl;
+    file<<"Uncompressed Bytes Read = "<<events.GetBytesRead()<<endl;
+    file<<"Branch"<<"\t"<<"Entries Read"<<"\t"<<"Bytes Read"<<"\t"<<"Fraction"<<endl;
+    const std::vector<std::string>& branch_names = events.GetBranchNames();
+    for (unsigned int i = 0; i < branch_names.size(); ++i){
+        double fraction = events.GetBytesRead() > 0 ? (double)events.GetBranchBytes(i)/events.GetBytesRead() : 0.0;
+        file<<branch_names[i]<<"\t"<<events.GetBranchEntries(i)<<"\t"<<events.GetBranchBytes(i)<<"\t"<<fraction<<endl;
+    }
+    file.close();
+
+    cout<<"\tActive Branches = "<<activeBranches.size()<<" Bytes Read = "<<bytesRead/1000000<<" MB"<<endl;
 }
 
 CCProtonPi0_Analyzer::~CCProtonPi0_Analyzer()
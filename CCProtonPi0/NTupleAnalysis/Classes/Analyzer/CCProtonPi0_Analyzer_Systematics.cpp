@@ -39,163 +39,30 @@ void CCProtonPi0_Analyzer::AddErrorBands_Data()
 
 void CCProtonPi0_Analyzer::FillVertErrorBand_Genie(MnvH1D* h, double var)
 {
-    h->FillVertErrorBand("GENIE_AGKYxF1pi"         ,var, truth_genie_wgt_AGKYxF1pi[2]        , truth_genie_wgt_AGKYxF1pi[4]        , cvweight);
-    h->FillVertErrorBand("GENIE_AhtBY"             ,var, truth_genie_wgt_AhtBY[2]            , truth_genie_wgt_AhtBY[4]            , cvweight);
-    h->FillVertErrorBand("GENIE_BhtBY"             ,var, truth_genie_wgt_BhtBY[2]            , truth_genie_wgt_BhtBY[4]            , cvweight);
-    h->FillVertErrorBand("GENIE_CCQEPauliSupViaKF" ,var, truth_genie_wgt_CCQEPauliSupViaKF[2], truth_genie_wgt_CCQEPauliSupViaKF[4], cvweight);
-    h->FillVertErrorBand("GENIE_CV1uBY"            ,var, truth_genie_wgt_CV1uBY[2]           , truth_genie_wgt_CV1uBY[4]           , cvweight);
-    h->FillVertErrorBand("GENIE_CV2uBY"            ,var, truth_genie_wgt_CV2uBY[2]           , truth_genie_wgt_CV2uBY[4]           , cvweight);
-    h->FillVertErrorBand("GENIE_EtaNCEL"           ,var, truth_genie_wgt_EtaNCEL[2]          , truth_genie_wgt_EtaNCEL[4]          , cvweight);
-    h->FillVertErrorBand("GENIE_FrAbs_N"           ,var, truth_genie_wgt_FrAbs_N[2]          , truth_genie_wgt_FrAbs_N[4]          , cvweight);
-    h->FillVertErrorBand("GENIE_FrAbs_pi"          ,var, truth_genie_wgt_FrAbs_pi[2]         , truth_genie_wgt_FrAbs_pi[4]         , cvweight);
-    h->FillVertErrorBand("GENIE_FrCEx_N"           ,var, truth_genie_wgt_FrCEx_N[2]          , truth_genie_wgt_FrCEx_N[4]          , cvweight);
-    h->FillVertErrorBand("GENIE_FrCEx_pi"          ,var, truth_genie_wgt_FrCEx_pi[2]         , truth_genie_wgt_FrCEx_pi[4]         , cvweight);
-    h->FillVertErrorBand("GENIE_FrElas_N"          ,var, truth_genie_wgt_FrElas_N[2]         , truth_genie_wgt_FrElas_N[4]         , cvweight);
-    h->FillVertErrorBand("GENIE_FrElas_pi"         ,var, truth_genie_wgt_FrElas_pi[2]        , truth_genie_wgt_FrElas_pi[4]        , cvweight);
-    h->FillVertErrorBand("GENIE_FrInel_N"          ,var, truth_genie_wgt_FrInel_N[2]         , truth_genie_wgt_FrInel_N[4]         , cvweight);
-    h->FillVertErrorBand("GENIE_FrInel_pi"         ,var, truth_genie_wgt_FrInel_pi[2]        , truth_genie_wgt_FrInel_pi[4]        , cvweight);
-    h->FillVertErrorBand("GENIE_FrPiProd_N"        ,var, truth_genie_wgt_FrPiProd_N[2]       , truth_genie_wgt_FrPiProd_N[4]       , cvweight);
-    h->FillVertErrorBand("GENIE_FrPiProd_pi"       ,var, truth_genie_wgt_FrPiProd_pi[2]      , truth_genie_wgt_FrPiProd_pi[4]      , cvweight);
-    h->FillVertErrorBand("GENIE_MFP_N"             ,var, truth_genie_wgt_MFP_N[2]            , truth_genie_wgt_MFP_N[4]            , cvweight);
-    h->FillVertErrorBand("GENIE_MFP_pi"            ,var, truth_genie_wgt_MFP_pi[2]           , truth_genie_wgt_MFP_pi[4]           , cvweight);
-    h->FillVertErrorBand("GENIE_MaCCQE"            ,var, truth_genie_wgt_MaCCQE[2]           , truth_genie_wgt_MaCCQE[4]           , cvweight);
-    //h->FillVertErrorBand("GENIE_MaCCQEshape"       ,var, truth_genie_wgt_MaCCQEshape[2]      , truth_genie_wgt_MaCCQEshape[4]      , cvweight);
-    h->FillVertErrorBand("GENIE_MaNCEL"            ,var, truth_genie_wgt_MaNCEL[2]           , truth_genie_wgt_MaNCEL[4]           , cvweight);
-    //h->FillVertErrorBand("GENIE_NormCCQE"          ,var, truth_genie_wgt_NormCCQE[2]         , truth_genie_wgt_NormCCQE[4]         , cvweight);
-    h->FillVertErrorBand("GENIE_NormDISCC"         ,var, truth_genie_wgt_NormDISCC[2]        , truth_genie_wgt_NormDISCC[4]        , cvweight);
-    h->FillVertErrorBand("GENIE_NormNCRES"         ,var, truth_genie_wgt_NormNCRES[2]        , truth_genie_wgt_NormNCRES[4]        , cvweight);
-    h->FillVertErrorBand("GENIE_RDecBR1gamma"      ,var, truth_genie_wgt_RDecBR1gamma[2]     , truth_genie_wgt_RDecBR1gamma[4]     , cvweight);
-    h->FillVertErrorBand("GENIE_Rvn2pi"            ,var, truth_genie_wgt_Rvn2pi[2]           , truth_genie_wgt_Rvn2pi[4]           , cvweight);
-    h->FillVertErrorBand("GENIE_Rvp2pi"            ,var, truth_genie_wgt_Rvp2pi[2]           , truth_genie_wgt_Rvp2pi[4]           , cvweight);
-    h->FillVertErrorBand("GENIE_VecFFCCQEshape"    ,var, truth_genie_wgt_VecFFCCQEshape[2]   , truth_genie_wgt_VecFFCCQEshape[4]   , cvweight);
-
-    h->FillVertErrorBand("GENIE_NormCCRES"         ,var, updated_genie_wgt_NormCCRES[2]        , updated_genie_wgt_NormCCRES[4]        , cvweight);
-    h->FillVertErrorBand("GENIE_Theta_Delta2Npi"   ,var, updated_genie_wgt_Theta_Delta2Npi[2]  , updated_genie_wgt_Theta_Delta2Npi[4]  , cvweight);
-    h->FillVertErrorBand("GENIE_MaRES"             ,var, updated_genie_wgt_MaRES[2]            , updated_genie_wgt_MaRES[4]            , cvweight);
-    h->FillVertErrorBand("GENIE_MvRES"             ,var, updated_genie_wgt_MvRES[2]            , updated_genie_wgt_MvRES[4]            , cvweight);
-    h->FillVertErrorBand("GENIE_Rvn1pi"            ,var, updated_genie_wgt_Rvn1pi[2]           , updated_genie_wgt_Rvn1pi[4]           , cvweight);
-    h->FillVertErrorBand("GENIE_Rvp1pi"            ,var, updated_genie_wgt_Rvp1pi[2]           , updated_genie_wgt_Rvp1pi[4]           , cvweight);
+    for (unsigned int i = 0; i < eventWeights.Genie.size(); ++i){
+        FillVertErrorBand(h, var, eventWeights.Genie[i]);
+    }
 }
 
 void CCProtonPi0_Analyzer::FillVertErrorBand_Genie_ByHand(MnvH1D* h, double var)
 {
-    FillVertErrorBand_ByHand(h, var, "GENIE_AGKYxF1pi"         , truth_genie_wgt_AGKYxF1pi[2]        , truth_genie_wgt_AGKYxF1pi[4]        );
-    FillVertErrorBand_ByHand(h, var, "GENIE_AhtBY"             , truth_genie_wgt_AhtBY[2]            , truth_genie_wgt_AhtBY[4]            );
-    FillVertErrorBand_ByHand(h, var, "GENIE_BhtBY"             , truth_genie_wgt_BhtBY[2]            , truth_genie_wgt_BhtBY[4]            );
-    FillVertErrorBand_ByHand(h, var, "GENIE_CCQEPauliSupViaKF" , truth_genie_wgt_CCQEPauliSupViaKF[2], truth_genie_wgt_CCQEPauliSupViaKF[4]);
-    FillVertErrorBand_ByHand(h, var, "GENIE_CV1uBY"            , truth_genie_wgt_CV1uBY[2]           , truth_genie_wgt_CV1uBY[4]           );
-    FillVertErrorBand_ByHand(h, var, "GENIE_CV2uBY"            , truth_genie_wgt_CV2uBY[2]           , truth_genie_wgt_CV2uBY[4]           );
-    FillVertErrorBand_ByHand(h, var, "GENIE_EtaNCEL"           , truth_genie_wgt_EtaNCEL[2]          , truth_genie_wgt_EtaNCEL[4]          );
-    FillVertErrorBand_ByHand(h, var, "GENIE_FrAbs_N"           , truth_genie_wgt_FrAbs_N[2]          , truth_genie_wgt_FrAbs_N[4]          );
-    FillVertErrorBand_ByHand(h, var, "GENIE_FrAbs_pi"          , truth_genie_wgt_FrAbs_pi[2]         , truth_genie_wgt_FrAbs_pi[4]         );
-    FillVertErrorBand_ByHand(h, var, "GENIE_FrCEx_N"           , truth_genie_wgt_FrCEx_N[2]          , truth_genie_wgt_FrCEx_N[4]          );
-    FillVertErrorBand_ByHand(h, var, "GENIE_FrCEx_pi"          , truth_genie_wgt_FrCEx_pi[2]         , truth_genie_wgt_FrCEx_pi[4]         );
-    FillVertErrorBand_ByHand(h, var, "GENIE_FrElas_N"          , truth_genie_wgt_FrElas_N[2]         , truth_genie_wgt_FrElas_N[4]         );
-    FillVertErrorBand_ByHand(h, var, "GENIE_FrElas_pi"         , truth_genie_wgt_FrElas_pi[2]        , truth_genie_wgt_FrElas_pi[4]        );
-    FillVertErrorBand_ByHand(h, var, "GENIE_FrInel_N"          , truth_genie_wgt_FrInel_N[2]         , truth_genie_wgt_FrInel_N[4]         );
-    FillVertErrorBand_ByHand(h, var, "GENIE_FrInel_pi"         , truth_genie_wgt_FrInel_pi[2]        , truth_genie_wgt_FrInel_pi[4]        );
-    FillVertErrorBand_ByHand(h, var, "GENIE_FrPiProd_N"        , truth_genie_wgt_FrPiProd_N[2]       , truth_genie_wgt_FrPiProd_N[4]       );
-    FillVertErrorBand_ByHand(h, var, "GENIE_FrPiProd_pi"       , truth_genie_wgt_FrPiProd_pi[2]      , truth_genie_wgt_FrPiProd_pi[4]      );
-    FillVertErrorBand_ByHand(h, var, "GENIE_MFP_N"             , truth_genie_wgt_MFP_N[2]            , truth_genie_wgt_MFP_N[4]            );
-    FillVertErrorBand_ByHand(h, var, "GENIE_MFP_pi"            , truth_genie_wgt_MFP_pi[2]           , truth_genie_wgt_MFP_pi[4]           );
-    FillVertErrorBand_ByHand(h, var, "GENIE_MaCCQE"            , truth_genie_wgt_MaCCQE[2]           , truth_genie_wgt_MaCCQE[4]           );
-    //FillVertErrorBand_ByHand(h, var, "GENIE_MaCCQEshape"       , truth_genie_wgt_MaCCQEshape[2]      , truth_genie_wgt_MaCCQEshape[4]      );
-    FillVertErrorBand_ByHand(h, var, "GENIE_MaNCEL"            , truth_genie_wgt_MaNCEL[2]           , truth_genie_wgt_MaNCEL[4]           );
-    //FillVertErrorBand_ByHand(h, var, "GENIE_NormCCQE"          , truth_genie_wgt_NormCCQE[2]         , truth_genie_wgt_NormCCQE[4]         );
-    FillVertErrorBand_ByHand(h, var, "GENIE_NormDISCC"         , truth_genie_wgt_NormDISCC[2]        , truth_genie_wgt_NormDISCC[4]        );
-    FillVertErrorBand_ByHand(h, var, "GENIE_NormNCRES"         , truth_genie_wgt_NormNCRES[2]        , truth_genie_wgt_NormNCRES[4]        );
-    FillVertErrorBand_ByHand(h, var, "GENIE_RDecBR1gamma"      , truth_genie_wgt_RDecBR1gamma[2]     , truth_genie_wgt_RDecBR1gamma[4]     );
-    FillVertErrorBand_ByHand(h, var, "GENIE_Rvn2pi"            , truth_genie_wgt_Rvn2pi[2]           , truth_genie_wgt_Rvn2pi[4]           );
-    FillVertErrorBand_ByHand(h, var, "GENIE_Rvp2pi"            , truth_genie_wgt_Rvp2pi[2]           , truth_genie_wgt_Rvp2pi[4]           );
-    FillVertErrorBand_ByHand(h, var, "GENIE_VecFFCCQEshape"    , truth_genie_wgt_VecFFCCQEshape[2]   , truth_genie_wgt_VecFFCCQEshape[4]   );
-
-    FillVertErrorBand_ByHand(h, var, "GENIE_NormCCRES"         , updated_genie_wgt_NormCCRES[2]        , updated_genie_wgt_NormCCRES[4]        );
-    FillVertErrorBand_ByHand(h, var, "GENIE_Theta_Delta2Npi"   , updated_genie_wgt_Theta_Delta2Npi[2]  , updated_genie_wgt_Theta_Delta2Npi[4]  );
-    FillVertErrorBand_ByHand(h, var, "GENIE_MaRES"             , updated_genie_wgt_MaRES[2]            , updated_genie_wgt_MaRES[4]            );
-    FillVertErrorBand_ByHand(h, var, "GENIE_MvRES"             , updated_genie_wgt_MvRES[2]            , updated_genie_wgt_MvRES[4]            );
-    FillVertErrorBand_ByHand(h, var, "GENIE_Rvn1pi"            , updated_genie_wgt_Rvn1pi[2]           , updated_genie_wgt_Rvn1pi[4]           );
-    FillVertErrorBand_ByHand(h, var, "GENIE_Rvp1pi"            , updated_genie_wgt_Rvp1pi[2]           , updated_genie_wgt_Rvp1pi[4]           );
-
+    for (unsigned int i = 0; i < eventWeights.Genie.size(); ++i){
+        FillVertErrorBand_ByHand(h, var, eventWeights.Genie[i]);
+    }
 }
 
 void CCProtonPi0_Analyzer::FillVertErrorBand_Genie(MnvH2D* h, double xval, double yval)
 {
-    h->FillVertErrorBand("GENIE_AGKYxF1pi"         ,xval, yval, truth_genie_wgt_AGKYxF1pi[2]        , truth_genie_wgt_AGKYxF1pi[4]        , cvweight);
-    h->FillVertErrorBand("GENIE_AhtBY"             ,xval, yval, truth_genie_wgt_AhtBY[2]            , truth_genie_wgt_AhtBY[4]            , cvweight);
-    h->FillVertErrorBand("GENIE_BhtBY"             ,xval, yval, truth_genie_wgt_BhtBY[2]            , truth_genie_wgt_BhtBY[4]            , cvweight);
-    h->FillVertErrorBand("GENIE_CCQEPauliSupViaKF" ,xval, yval, truth_genie_wgt_CCQEPauliSupViaKF[2], truth_genie_wgt_CCQEPauliSupViaKF[4], cvweight);
-    h->FillVertErrorBand("GENIE_CV1uBY"            ,xval, yval, truth_genie_wgt_CV1uBY[2]           , truth_genie_wgt_CV1uBY[4]           , cvweight);
-    h->FillVertErrorBand("GENIE_CV2uBY"            ,xval, yval, truth_genie_wgt_CV2uBY[2]           , truth_genie_wgt_CV2uBY[4]           , cvweight);
-    h->FillVertErrorBand("GENIE_EtaNCEL"           ,xval, yval, truth_genie_wgt_EtaNCEL[2]          , truth_genie_wgt_EtaNCEL[4]          , cvweight);
-    h->FillVertErrorBand("GENIE_FrAbs_N"           ,xval, yval, truth_genie_wgt_FrAbs_N[2]          , truth_genie_wgt_FrAbs_N[4]          , cvweight);
-    h->FillVertErrorBand("GENIE_FrAbs_pi"          ,xval, yval, truth_genie_wgt_FrAbs_pi[2]         , truth_genie_wgt_FrAbs_pi[4]         , cvweight);
-    h->FillVertErrorBand("GENIE_FrCEx_N"           ,xval, yval, truth_genie_wgt_FrCEx_N[2]          , truth_genie_wgt_FrCEx_N[4]          , cvweight);
-    h->FillVertErrorBand("GENIE_FrCEx_pi"          ,xval, yval, truth_genie_wgt_FrCEx_pi[2]         , truth_genie_wgt_FrCEx_pi[4]         , cvweight);
-    h->FillVertErrorBand("GENIE_FrElas_N"          ,xval, yval, truth_genie_wgt_FrElas_N[2]         , truth_genie_wgt_FrElas_N[4]         , cvweight);
-    h->FillVertErrorBand("GENIE_FrElas_pi"         ,xval, yval, truth_genie_wgt_FrElas_pi[2]        , truth_genie_wgt_FrElas_pi[4]        , cvweight);
-    h->FillVertErrorBand("GENIE_FrInel_N"          ,xval, yval, truth_genie_wgt_FrInel_N[2]         , truth_genie_wgt_FrInel_N[4]         , cvweight);
-    h->FillVertErrorBand("GENIE_FrInel_pi"         ,xval, yval, truth_genie_wgt_FrInel_pi[2]        , truth_genie_wgt_FrInel_pi[4]        , cvweight);
-    h->FillVertErrorBand("GENIE_FrPiProd_N"        ,xval, yval, truth_genie_wgt_FrPiProd_N[2]       , truth_genie_wgt_FrPiProd_N[4]       , cvweight);
-    h->FillVertErrorBand("GENIE_FrPiProd_pi"       ,xval, yval, truth_genie_wgt_FrPiProd_pi[2]      , truth_genie_wgt_FrPiProd_pi[4]      , cvweight);
-    h->FillVertErrorBand("GENIE_MFP_N"             ,xval, yval, truth_genie_wgt_MFP_N[2]            , truth_genie_wgt_MFP_N[4]            , cvweight);
-    h->FillVertErrorBand("GENIE_MFP_pi"            ,xval, yval, truth_genie_wgt_MFP_pi[2]           , truth_genie_wgt_MFP_pi[4]           , cvweight);
-    h->FillVertErrorBand("GENIE_MaCCQE"            ,xval, yval, truth_genie_wgt_MaCCQE[2]           , truth_genie_wgt_MaCCQE[4]           , cvweight);
-    //h->FillVertErrorBand("GENIE_MaCCQEshape"       ,xval, yval, truth_genie_wgt_MaCCQEshape[2]      , truth_genie_wgt_MaCCQEshape[4]      , cvweight);
-    h->FillVertErrorBand("GENIE_MaNCEL"            ,xval, yval, truth_genie_wgt_MaNCEL[2]           , truth_genie_wgt_MaNCEL[4]           , cvweight);
-    //h->FillVertErrorBand("GENIE_NormCCQE"          ,xval, yval, truth_genie_wgt_NormCCQE[2]         , truth_genie_wgt_NormCCQE[4]         , cvweight);
-    h->FillVertErrorBand("GENIE_NormDISCC"         ,xval, yval, truth_genie_wgt_NormDISCC[2]        , truth_genie_wgt_NormDISCC[4]        , cvweight);
-    h->FillVertErrorBand("GENIE_NormNCRES"         ,xval, yval, truth_genie_wgt_NormNCRES[2]        , truth_genie_wgt_NormNCRES[4]        , cvweight);
-    h->FillVertErrorBand("GENIE_RDecBR1gamma"      ,xval, yval, truth_genie_wgt_RDecBR1gamma[2]     , truth_genie_wgt_RDecBR1gamma[4]     , cvweight);
-    h->FillVertErrorBand("GENIE_Rvn2pi"            ,xval, yval, truth_genie_wgt_Rvn2pi[2]           , truth_genie_wgt_Rvn2pi[4]           , cvweight);
-    h->FillVertErrorBand("GENIE_Rvp2pi"            ,xval, yval, truth_genie_wgt_Rvp2pi[2]           , truth_genie_wgt_Rvp2pi[4]           , cvweight);
-    h->FillVertErrorBand("GENIE_VecFFCCQEshape"    ,xval, yval, truth_genie_wgt_VecFFCCQEshape[2]   , truth_genie_wgt_VecFFCCQEshape[4]   , cvweight);
-
-    h->FillVertErrorBand("GENIE_NormCCRES"         ,xval, yval, updated_genie_wgt_NormCCRES[2]        , updated_genie_wgt_NormCCRES[4]        , cvweight);
-    h->FillVertErrorBand("GENIE_Theta_Delta2Npi"   ,xval, yval, updated_genie_wgt_Theta_Delta2Npi[2]  , updated_genie_wgt_Theta_Delta2Npi[4]  , cvweight);
-    h->FillVertErrorBand("GENIE_MaRES"             ,xval, yval, updated_genie_wgt_MaRES[2]            , updated_genie_wgt_MaRES[4]            , cvweight);
-    h->FillVertErrorBand("GENIE_MvRES"             ,xval, yval, updated_genie_wgt_MvRES[2]            , updated_genie_wgt_MvRES[4]            , cvweight);
-    h->FillVertErrorBand("GENIE_Rvn1pi"            ,xval, yval, updated_genie_wgt_Rvn1pi[2]           , updated_genie_wgt_Rvn1pi[4]           , cvweight);
-    h->FillVertErrorBand("GENIE_Rvp1pi"            ,xval, yval, updated_genie_wgt_Rvp1pi[2]           , updated_genie_wgt_Rvp1pi[4]           , cvweight);
+    for (unsigned int i = 0; i < eventWeights.Genie.size(); ++i){
+        FillVertErrorBand(h, xval, yval, eventWeights.Genie[i]);
+    }
 }
 
 void CCProtonPi0_Analyzer::FillVertErrorBand_Genie_ByHand(MnvH2D* h, double xval, double yval)
 {
-    FillVertErrorBand_ByHand(h, xval, yval, "GENIE_AGKYxF1pi"         , truth_genie_wgt_AGKYxF1pi[2]        , truth_genie_wgt_AGKYxF1pi[4]        );
-    FillVertErrorBand_ByHand(h, xval, yval, "GENIE_AhtBY"             , truth_genie_wgt_AhtBY[2]            , truth_genie_wgt_AhtBY[4]            );
-    FillVertErrorBand_ByHand(h, xval, yval, "GENIE_BhtBY"             , truth_genie_wgt_BhtBY[2]            , truth_genie_wgt_BhtBY[4]            );
-    FillVertErrorBand_ByHand(h, xval, yval, "GENIE_CCQEPauliSupViaKF" , truth_genie_wgt_CCQEPauliSupViaKF[2], truth_genie_wgt_CCQEPauliSupViaKF[4]);
-    FillVertErrorBand_ByHand(h, xval, yval, "GENIE_CV1uBY"            , truth_genie_wgt_CV1uBY[2]           , truth_genie_wgt_CV1uBY[4]           );
-    FillVertErrorBand_ByHand(h, xval, yval, "GENIE_CV2uBY"            , truth_genie_wgt_CV2uBY[2]           , truth_genie_wgt_CV2uBY[4]           );
-    FillVertErrorBand_ByHand(h, xval, yval, "GENIE_EtaNCEL"           , truth_genie_wgt_EtaNCEL[2]          , truth_genie_wgt_EtaNCEL[4]          );
-    FillVertErrorBand_ByHand(h, xval, yval, "GENIE_FrAbs_N"           , truth_genie_wgt_FrAbs_N[2]          , truth_genie_wgt_FrAbs_N[4]          );
-    FillVertErrorBand_ByHand(h, xval, yval, "GENIE_FrAbs_pi"          , truth_genie_wgt_FrAbs_pi[2]         , truth_genie_wgt_FrAbs_pi[4]         );
-    FillVertErrorBand_ByHand(h, xval, yval, "GENIE_FrCEx_N"           , truth_genie_wgt_FrCEx_N[2]          , truth_genie_wgt_FrCEx_N[4]          );
-    FillVertErrorBand_ByHand(h, xval, yval, "GENIE_FrCEx_pi"          , truth_genie_wgt_FrCEx_pi[2]         , truth_genie_wgt_FrCEx_pi[4]         );
-    FillVertErrorBand_ByHand(h, xval, yval, "GENIE_FrElas_N"          , truth_genie_wgt_FrElas_N[2]         , truth_genie_wgt_FrElas_N[4]         );
-    FillVertErrorBand_ByHand(h, xval, yval, "GENIE_FrElas_pi"         , truth_genie_wgt_FrElas_pi[2]        , truth_genie_wgt_FrElas_pi[4]        );
-    FillVertErrorBand_ByHand(h, xval, yval, "GENIE_FrInel_N"          , truth_genie_wgt_FrInel_N[2]         , truth_genie_wgt_FrInel_N[4]         );
-    FillVertErrorBand_ByHand(h, xval, yval, "GENIE_FrInel_pi"         , truth_genie_wgt_FrInel_pi[2]        , truth_genie_wgt_FrInel_pi[4]        );
-    FillVertErrorBand_ByHand(h, xval, yval, "GENIE_FrPiProd_N"        , truth_genie_wgt_FrPiProd_N[2]       , truth_genie_wgt_FrPiProd_N[4]       );
-    FillVertErrorBand_ByHand(h, xval, yval, "GENIE_FrPiProd_pi"       , truth_genie_wgt_FrPiProd_pi[2]      , truth_genie_wgt_FrPiProd_pi[4]      );
-    FillVertErrorBand_ByHand(h, xval, yval, "GENIE_MFP_N"             , truth_genie_wgt_MFP_N[2]            , truth_genie_wgt_MFP_N[4]            );
-    FillVertErrorBand_ByHand(h, xval, yval, "GENIE_MFP_pi"            , truth_genie_wgt_MFP_pi[2]           , truth_genie_wgt_MFP_pi[4]           );
-    FillVertErrorBand_ByHand(h, xval, yval, "GENIE_MaCCQE"            , truth_genie_wgt_MaCCQE[2]           , truth_genie_wgt_MaCCQE[4]           );
-    //FillVertErrorBand_ByHand(h, xval, yval, "GENIE_MaCCQEshape"       , truth_genie_wgt_MaCCQEshape[2]      , truth_genie_wgt_MaCCQEshape[4]      );
-    FillVertErrorBand_ByHand(h, xval, yval, "GENIE_MaNCEL"            , truth_genie_wgt_MaNCEL[2]           , truth_genie_wgt_MaNCEL[4]           );
-    //FillVertErrorBand_ByHand(h, xval, yval, "GENIE_NormCCQE"          , truth_genie_wgt_NormCCQE[2]         , truth_genie_wgt_NormCCQE[4]         );
-    FillVertErrorBand_ByHand(h, xval, yval, "GENIE_NormDISCC"         , truth_genie_wgt_NormDISCC[2]        , truth_genie_wgt_NormDISCC[4]        );
-    FillVertErrorBand_ByHand(h, xval, yval, "GENIE_NormNCRES"         , truth_genie_wgt_NormNCRES[2]        , truth_genie_wgt_NormNCRES[4]        );
-    FillVertErrorBand_ByHand(h, xval, yval, "GENIE_RDecBR1gamma"      , truth_genie_wgt_RDecBR1gamma[2]     , truth_genie_wgt_RDecBR1gamma[4]     );
-    FillVertErrorBand_ByHand(h, xval, yval, "GENIE_Rvn2pi"            , truth_genie_wgt_Rvn2pi[2]           , truth_genie_wgt_Rvn2pi[4]           );
-    FillVertErrorBand_ByHand(h, xval, yval, "GENIE_Rvp2pi"            , truth_genie_wgt_Rvp2pi[2]           , truth_genie_wgt_Rvp2pi[4]           );
-    FillVertErrorBand_ByHand(h, xval, yval, "GENIE_VecFFCCQEshape"    , truth_genie_wgt_VecFFCCQEshape[2]   , truth_genie_wgt_VecFFCCQEshape[4]   );
-
-    FillVertErrorBand_ByHand(h, xval, yval, "GENIE_NormCCRES"         , updated_genie_wgt_NormCCRES[2]        , updated_genie_wgt_NormCCRES[4]        );
-    FillVertErrorBand_ByHand(h, xval, yval, "GENIE_Theta_Delta2Npi"   , updated_genie_wgt_Theta_Delta2Npi[2]  , updated_genie_wgt_Theta_Delta2Npi[4]  );
-    FillVertErrorBand_ByHand(h, xval, yval, "GENIE_MaRES"             , updated_genie_wgt_MaRES[2]            , updated_genie_wgt_MaRES[4]            );
-    FillVertErrorBand_ByHand(h, xval, yval, "GENIE_MvRES"             , updated_genie_wgt_MvRES[2]            , updated_genie_wgt_MvRES[4]            );
-    FillVertErrorBand_ByHand(h, xval, yval, "GENIE_Rvn1pi"            , updated_genie_wgt_Rvn1pi[2]           , updated_genie_wgt_Rvn1pi[4]           );
-    FillVertErrorBand_ByHand(h, xval, yval, "GENIE_Rvp1pi"            , updated_genie_wgt_Rvp1pi[2]           , updated_genie_wgt_Rvp1pi[4]           );
+    for (unsigned int i = 0; i < eventWeights.Genie.size(); ++i){
+        FillVertErrorBand_ByHand(h, xval, yval, eventWeights.Genie[i]);
+    }
 }
 
 void CCProtonPi0_Analyzer::FillHistogramWithVertErrors(vector<MnvH1D*> &hist, double var)
@@ -220,7 +87,13 @@ void CCProtonPi0_Analyzer::FillHistogramWithVertErrors(vector<MnvH1D*> &hist, do
     }
 }
 
-void CCProtonPi0_Analyzer::FillVertErrorBand_ByHand(MnvH1D* h, double var, std::string error_name, std::vector<double> errors)
+void CCProtonPi0_Analyzer::FillVertErrorBand_ByHand(MnvH1D* h, double var, const std::string& error_name, const std::vector<double>& errors)
+{
+    int bckg_err_id = applyBckgConstraints_Unv ? BckgConstrainer.GetErrorBandID(error_name) : -1;
+    FillVertErrorBand_ByHand(h, var, error_name, errors, bckg_err_id);
+}
+
+void CCProtonPi0_Analyzer::FillVertErrorBand_ByHand(MnvH1D* h, double var, const std::string& error_name, const std::vector<double>& errors, int bckg_err_id)
 {
     // Get a Pointer to Error Band
     MnvVertErrorBand* err_band =  h->GetVertErrorBand(error_name);
@@ -242,10 +115,15 @@ void CCProtonPi0_Analyzer::FillVertErrorBand_ByHand(MnvH1D* h, double var, std::
         cvbin = err_band->FindBin(var);
     }
 
+    // wgt_bckg is universe_wgt / cv_wgt 
+    const std::vector<double>* bckg_wgts = applyBckgConstraints_Unv ? GetBckgConstraintWeights(bckg_err_id) : NULL;
+    if (bckg_wgts != NULL && bckg_wgts->size() < err_hists.size()){
+        RunTimeError("Not enough Background Constraint Universes for " + error_name);
+    }
+
     for (unsigned int i = 0; i < err_hists.size(); ++i ) {
 
-        // wgt_bckg is universe_wgt / cv_wgt 
-        double wgt_bckg = applyBckgConstraints_Unv ? GetBckgConstraint(error_name, i) : 1.0;
+        double wgt_bckg = bckg_wgts ? (*bckg_wgts)[i] : 1.0;
 
         const double applyWeight = cvweight * wgt_bckg;
         const double wgtU = errors[i]*applyWeight;
@@ -267,7 +145,13 @@ void CCProtonPi0_Analyzer::FillVertErrorBand_ByHand(MnvH1D* h, double var, std::
     FillVertErrorBand_ByHand(h, var, error_name, errors);
 }
 
-void CCProtonPi0_Analyzer::FillVertErrorBand_ByHand(MnvH2D* h, double xval, double yval, std::string error_name, std::vector<double> errors)
+void CCProtonPi0_Analyzer::FillVertErrorBand_ByHand(MnvH2D* h, double xval, double yval, const std::string& error_name, const std::vector<double>& errors)
+{
+    int bckg_err_id = applyBckgConstraints_Unv ? BckgConstrainer.GetErrorBandID(error_name) : -1;
+    FillVertErrorBand_ByHand(h, xval, yval, error_name, errors, bckg_err_id);
+}
+
+void CCProtonPi0_Analyzer::FillVertErrorBand_ByHand(MnvH2D* h, double xval, double yval, const std::string& error_name, const std::vector<double>& errors, int bckg_err_id)
 {
     // Get a Pointer to Error Band
     MnvVertErrorBand2D* err_band =  h->GetVertErrorBand(error_name);
@@ -287,10 +171,15 @@ void CCProtonPi0_Analyzer::FillVertErrorBand_ByHand(MnvH2D* h, double xval, doub
         cvbin = err_band->FindBin( xval, yval );
     }
 
+    // wgt_bckg is universe_wgt / cv_wgt
+    const std::vector<double>* bckg_wgts = applyBckgConstraints_Unv ? GetBckgConstraintWeights(bckg_err_id) : NULL;
+    if (bckg_wgts != NULL && bckg_wgts->size() < err_hists.size()){
+        RunTimeError("Not enough Background Constraint Universes for " + error_name);
+    }
+
     for( unsigned int i = 0; i < err_hists.size(); ++i ){
 
-        // wgt_bckg is universe_wgt / cv_wgt
-        double wgt_bckg = applyBckgConstraints_Unv ? GetBckgConstraint(error_name, i) : 1.0;
+        double wgt_bckg = bckg_wgts ? (*bckg_wgts)[i] : 1.0;
         const double applyWeight = cvweight * wgt_bckg;
         const double wgtU = errors[i]*applyWeight;
         err_hists[i]->AddBinContent( cvbin, wgtU );
@@ -311,316 +200,426 @@ void CCProtonPi0_Analyzer::FillVertErrorBand_ByHand(MnvH2D* h, double xval, doub
     FillVertErrorBand_ByHand(h, xval, yval, error_name, errors);
 }
 
+void CCProtonPi0_Analyzer::FillVertErrorBand(MnvH1D* h, double var, const VertErrorWeights& weights)
+{
+    h->FillVertErrorBand(weights.err_name, var, weights.errors[0], weights.errors[1], cvweight);
+}
+
+void CCProtonPi0_Analyzer::FillVertErrorBand(MnvH2D* h, double xval, double yval, const VertErrorWeights& weights)
+{
+    h->FillVertErrorBand(weights.err_name, xval, yval, weights.errors[0], weights.errors[1], cvweight);
+}
+
+void CCProtonPi0_Analyzer::FillVertErrorBand_ByHand(MnvH1D* h, double var, const VertErrorWeights& weights)
+{
+    FillVertErrorBand_ByHand(h, var, weights.err_name, weights.errors, weights.bckg_err_id);
+}
+
+void CCProtonPi0_Analyzer::FillVertErrorBand_ByHand(MnvH2D* h, double xval, double yval, const VertErrorWeights& weights)
+{
+    FillVertErrorBand_ByHand(h, xval, yval, weights.err_name, weights.errors, weights.bckg_err_id);
+}
+
+void CCProtonPi0_Analyzer::initEventWeights()
+{
+    // GENIE Knobs -- Order is same as the Error Band Fill Order
+    AddGenieEventWeight("GENIE_AGKYxF1pi",        truth_genie_wgt_AGKYxF1pi);
+    AddGenieEventWeight("GENIE_AhtBY",            truth_genie_wgt_AhtBY);
+    AddGenieEventWeight("GENIE_BhtBY",            truth_genie_wgt_BhtBY);
+    AddGenieEventWeight("GENIE_CCQEPauliSupViaKF", truth_genie_wgt_CCQEPauliSupViaKF);
+    AddGenieEventWeight("GENIE_CV1uBY",           truth_genie_wgt_CV1uBY);
+    AddGenieEventWeight("GENIE_CV2uBY",           truth_genie_wgt_CV2uBY);
+    AddGenieEventWeight("GENIE_EtaNCEL",          truth_genie_wgt_EtaNCEL);
+    AddGenieEventWeight("GENIE_FrAbs_N",          truth_genie_wgt_FrAbs_N);
+    AddGenieEventWeight("GENIE_FrAbs_pi",         truth_genie_wgt_FrAbs_pi);
+    AddGenieEventWeight("GENIE_FrCEx_N",          truth_genie_wgt_FrCEx_N);
+    AddGenieEventWeight("GENIE_FrCEx_pi",         truth_genie_wgt_FrCEx_pi);
+    AddGenieEventWeight("GENIE_FrElas_N",         truth_genie_wgt_FrElas_N);
+    AddGenieEventWeight("GENIE_FrElas_pi",        truth_genie_wgt_FrElas_pi);
+    AddGenieEventWeight("GENIE_FrInel_N",         truth_genie_wgt_FrInel_N);
+    AddGenieEventWeight("GENIE_FrInel_pi",        truth_genie_wgt_FrInel_pi);
+    AddGenieEventWeight("GENIE_FrPiProd_N",       truth_genie_wgt_FrPiProd_N);
+    AddGenieEventWeight("GENIE_FrPiProd_pi",      truth_genie_wgt_FrPiProd_pi);
+    AddGenieEventWeight("GENIE_MFP_N",            truth_genie_wgt_MFP_N);
+    AddGenieEventWeight("GENIE_MFP_pi",           truth_genie_wgt_MFP_pi);
+    AddGenieEventWeight("GENIE_MaCCQE",           truth_genie_wgt_MaCCQE);
+    //AddGenieEventWeight("GENIE_MaCCQEshape",    truth_genie_wgt_MaCCQEshape);
+    AddGenieEventWeight("GENIE_MaNCEL",           truth_genie_wgt_MaNCEL);
+    //AddGenieEventWeight("GENIE_NormCCQE",       truth_genie_wgt_NormCCQE);
+    AddGenieEventWeight("GENIE_NormDISCC",        truth_genie_wgt_NormDISCC);
+    AddGenieEventWeight("GENIE_NormNCRES",        truth_genie_wgt_NormNCRES);
+    AddGenieEventWeight("GENIE_RDecBR1gamma",     truth_genie_wgt_RDecBR1gamma);
+    AddGenieEventWeight("GENIE_Rvn2pi",           truth_genie_wgt_Rvn2pi);
+    AddGenieEventWeight("GENIE_Rvp2pi",           truth_genie_wgt_Rvp2pi);
+    AddGenieEventWeight("GENIE_VecFFCCQEshape",   truth_genie_wgt_VecFFCCQEshape);
+
+    AddGenieEventWeight("GENIE_NormCCRES",        updated_genie_wgt_NormCCRES);
+    AddGenieEventWeight("GENIE_Theta_Delta2Npi",  updated_genie_wgt_Theta_Delta2Npi);
+    AddGenieEventWeight("GENIE_MaRES",            updated_genie_wgt_MaRES);
+    AddGenieEventWeight("GENIE_MvRES",            updated_genie_wgt_MvRES);
+    AddGenieEventWeight("GENIE_Rvn1pi",           updated_genie_wgt_Rvn1pi);
+    AddGenieEventWeight("GENIE_Rvp1pi",           updated_genie_wgt_Rvp1pi);
+
+    initEventWeight(eventWeights.BckgConstraint_WithPi0, "BckgConstraint_WithPi0");
+    initEventWeight(eventWeights.BckgConstraint_SinglePiPlus, "BckgConstraint_SinglePiPlus");
+    initEventWeight(eventWeights.BckgConstraint_QELike, "BckgConstraint_QELike");
+    initEventWeight(eventWeights.MichelTrue, "MichelTrue");
+    initEventWeight(eventWeights.MichelFake, "MichelFake");
+    initEventWeight(eventWeights.TargetMass, "TargetMass");
+    initEventWeight(eventWeights.Unfolding, "Unfolding");
+    initEventWeight(eventWeights.Weight_2p2h, "2p2h");
+    initEventWeight(eventWeights.ProtonTracking, "ProtonTracking");
+    initEventWeight(eventWeights.MuonTracking, "MuonTracking");
+    initEventWeight(eventWeights.PionResponse, "PionResponse");
+    initEventWeight(eventWeights.NeutronResponse, "NeutronResponse");
+
+    eventWeights.Flux.err_name = "Flux";
+    eventWeights.Flux.errors.assign(n_universe, 1.0);
+    eventWeights.bckg_type = -1;
+}
+
+void CCProtonPi0_Analyzer::initEventWeight(VertErrorWeights& weights, std::string err_name)
+{
+    weights.err_name = err_name;
+    weights.bckg_err_id = BckgConstrainer.GetErrorBandID(err_name);
+    weights.errors.assign(2, 1.0);
+}
+
+void CCProtonPi0_Analyzer::AddGenieEventWeight(std::string err_name, double* genie_wgts)
+{
+    VertErrorWeights weights;
+    initEventWeight(weights, err_name);
+
+    eventWeights.Genie.push_back(weights);
+    genie_wgt_arrays.push_back(genie_wgts);
+}
+
+void CCProtonPi0_Analyzer::SetEventWeight(VertErrorWeights& weights, double correctionErr)
+{
+    weights.errors[0] = 1-correctionErr;
+    weights.errors[1] = 1+correctionErr;
+}
+
+void CCProtonPi0_Analyzer::FillEventWeights()
+{
+    // Flux Universes
+    eventWeights.Flux.errors = GetFluxError(mc_incomingE * MeV_to_GeV, mc_incoming);
+
+    // GENIE -1 sigma and +1 sigma Shifts
+    for (unsigned int i = 0; i < eventWeights.Genie.size(); ++i){
+        eventWeights.Genie[i].errors[0] = genie_wgt_arrays[i][2];
+        eventWeights.Genie[i].errors[1] = genie_wgt_arrays[i][4];
+    }
+
+    SetEventWeight(eventWeights.BckgConstraint_WithPi0, GetBckgConstraint_WithPi0Err());
+    SetEventWeight(eventWeights.BckgConstraint_SinglePiPlus, GetBckgConstraint_SinglePiPlusErr());
+    SetEventWeight(eventWeights.BckgConstraint_QELike, GetBckgConstraint_QELikeErr());
+    SetEventWeight(eventWeights.MichelTrue, GetMichelTrueErr());
+    SetEventWeight(eventWeights.MichelFake, GetMichelFakeErr());
+    SetEventWeight(eventWeights.TargetMass, GetTargetMassErr());
+    SetEventWeight(eventWeights.Unfolding, GetUnfoldingErr());
+    SetEventWeight(eventWeights.Weight_2p2h, err_2p2h);
+    SetEventWeight(eventWeights.ProtonTracking, GetProtonTrackingErr());
+    SetEventWeight(eventWeights.MuonTracking, GetMINOSCorrectionErr());
+    SetEventWeight(eventWeights.PionResponse, GetPionResponseErr());
+    SetEventWeight(eventWeights.NeutronResponse, GetNeutronResponseErr());
+
+    // Background Constraint Universe Weights depend only on Background Type
+    if (truth_isBckg_Compact_SinglePiPlus) eventWeights.bckg_type = BCKG_SINGLEPIPLUS;
+    else if (truth_isBckg_Compact_QELike) eventWeights.bckg_type = BCKG_QELIKE;
+    else if (truth_isBckg_Compact_WithPi0) eventWeights.bckg_type = BCKG_WITHPI0;
+    else eventWeights.bckg_type = -1;
+}
+
+void CCProtonPi0_Analyzer::initBckgConstraintWeights()
+{
+    // Universe Weights normalized to CV Weight -- wgt_bckg = universe_wgt / cv_wgt
+    double cv_wgts[N_BCKG_TYPES];
+    cv_wgts[BCKG_SINGLEPIPLUS] = cv_wgt_SinglePiPlus;
+    cv_wgts[BCKG_QELIKE] = cv_wgt_QELike;
+    cv_wgts[BCKG_WITHPI0] = cv_wgt_WithPi0;
+
+    const int nErrorBands = BckgConstrainer.GetNErrorBands();
+    for (int bckg_type = 0; bckg_type < N_BCKG_TYPES; ++bckg_type){
+        bckgConstraintWeights[bckg_type].resize(nErrorBands);
+        for (int err_id = 0; err_id < nErrorBands; ++err_id){
+            std::vector<double>& wgts = bckgConstraintWeights[bckg_type][err_id];
+            const int nUniverses = BckgConstrainer.GetNUniverses(err_id);
+            for (int hist_ind = 0; hist_ind < nUniverses; ++hist_ind){
+                wgts.push_back(BckgConstrainer.GetBckgConstraint(err_id, hist_ind, bckg_type) / cv_wgts[bckg_type]);
+            }
+        }
+    }
+
+    // Flux is filled by hand for every event -- Resolve its Error Band once
+    eventWeights.Flux.bckg_err_id = BckgConstrainer.GetErrorBandID("Flux");
+}
+
+const std::vector<double>* CCProtonPi0_Analyzer::GetBckgConstraintWeights(int bckg_err_id)
+{
+    if (eventWeights.bckg_type == -1 || bckg_err_id == -1) return NULL;
+
+    return &bckgConstraintWeights[eventWeights.bckg_type][bckg_err_id];
+}
+
 void CCProtonPi0_Analyzer::FillVertErrorBand_NeutronResponse(MnvH1D* h, double var)
 {
-    double correctionErr = GetNeutronResponseErr();
-    h->FillVertErrorBand("NeutronResponse", var, 1-correctionErr, 1+correctionErr, cvweight);
+    FillVertErrorBand(h, var, eventWeights.NeutronResponse);
 }
 
 void CCProtonPi0_Analyzer::FillVertErrorBand_NeutronResponse_ByHand(MnvH1D* h, double var)
 {
-    double correctionErr = GetNeutronResponseErr();
-    FillVertErrorBand_ByHand(h, var, "NeutronResponse", 1-correctionErr, 1+correctionErr);
+    FillVertErrorBand_ByHand(h, var, eventWeights.NeutronResponse);
 }
 
 void CCProtonPi0_Analyzer::FillVertErrorBand_NeutronResponse(MnvH2D* h, double xval, double yval)
 {
-    double correctionErr = GetNeutronResponseErr();
-    h->FillVertErrorBand("NeutronResponse", xval, yval, 1-correctionErr, 1+correctionErr, cvweight);
+    FillVertErrorBand(h, xval, yval, eventWeights.NeutronResponse);
 }
 
 void CCProtonPi0_Analyzer::FillVertErrorBand_NeutronResponse_ByHand(MnvH2D* h, double xval, double yval)
 {
-    double correctionErr = GetNeutronResponseErr();
-    FillVertErrorBand_ByHand(h, xval, yval, "NeutronResponse", 1-correctionErr, 1+correctionErr);
+    FillVertErrorBand_ByHand(h, xval, yval, eventWeights.NeutronResponse);
 }
 
 void CCProtonPi0_Analyzer::FillVertErrorBand_PionResponse(MnvH1D* h, double var)
 {
-    double correctionErr = GetPionResponseErr();
-    h->FillVertErrorBand("PionResponse", var, 1-correctionErr, 1+correctionErr, cvweight);
+    FillVertErrorBand(h, var, eventWeights.PionResponse);
 }
 
 void CCProtonPi0_Analyzer::FillVertErrorBand_PionResponse_ByHand(MnvH1D* h, double var)
 {
-    double correctionErr = GetPionResponseErr();
-    FillVertErrorBand_ByHand(h, var, "PionResponse", 1-correctionErr, 1+correctionErr);
+    FillVertErrorBand_ByHand(h, var, eventWeights.PionResponse);
 }
 
 void CCProtonPi0_Analyzer::FillVertErrorBand_PionResponse(MnvH2D* h, double xval, double yval)
 {
-    double correctionErr = GetPionResponseErr();
-    h->FillVertErrorBand("PionResponse", xval, yval, 1-correctionErr, 1+correctionErr, cvweight);
+    FillVertErrorBand(h, xval, yval, eventWeights.PionResponse);
 }
 
 void CCProtonPi0_Analyzer::FillVertErrorBand_PionResponse_ByHand(MnvH2D* h, double xval, double yval)
 {
-    double correctionErr = GetPionResponseErr();
-    FillVertErrorBand_ByHand(h, xval, yval, "PionResponse", 1-correctionErr, 1+correctionErr);
+    FillVertErrorBand_ByHand(h, xval, yval, eventWeights.PionResponse);
 }
 
 void CCProtonPi0_Analyzer::FillVertErrorBand_BckgConstraint_WithPi0(MnvH1D* h, double var)
 {
-    double correctionErr = GetBckgConstraint_WithPi0Err();
-    h->FillVertErrorBand("BckgConstraint_WithPi0", var, 1-correctionErr, 1+correctionErr, cvweight);
+    FillVertErrorBand(h, var, eventWeights.BckgConstraint_WithPi0);
 }
 
 void CCProtonPi0_Analyzer::FillVertErrorBand_BckgConstraint_WithPi0_ByHand(MnvH1D* h, double var)
 {
-    double correctionErr = GetBckgConstraint_WithPi0Err();
-    FillVertErrorBand_ByHand(h, var, "BckgConstraint_WithPi0", 1-correctionErr, 1+correctionErr);
+    FillVertErrorBand_ByHand(h, var, eventWeights.BckgConstraint_WithPi0);
 }
 
 void CCProtonPi0_Analyzer::FillVertErrorBand_BckgConstraint_WithPi0(MnvH2D* h, double xval, double yval)
 {
-    double correctionErr = GetBckgConstraint_WithPi0Err();
-    h->FillVertErrorBand("BckgConstraint_WithPi0", xval, yval, 1-correctionErr, 1+correctionErr, cvweight);
+    FillVertErrorBand(h, xval, yval, eventWeights.BckgConstraint_WithPi0);
 }
 
 void CCProtonPi0_Analyzer::FillVertErrorBand_BckgConstraint_WithPi0_ByHand(MnvH2D* h, double xval, double yval)
 {
-    double correctionErr = GetBckgConstraint_WithPi0Err();
-    FillVertErrorBand_ByHand(h, xval, yval, "BckgConstraint_WithPi0", 1-correctionErr, 1+correctionErr);
+    FillVertErrorBand_ByHand(h, xval, yval, eventWeights.BckgConstraint_WithPi0);
 }
 
 void CCProtonPi0_Analyzer::FillVertErrorBand_BckgConstraint_SinglePiPlus(MnvH1D* h, double var)
 {
-    double correctionErr = GetBckgConstraint_SinglePiPlusErr();
-    h->FillVertErrorBand("BckgConstraint_SinglePiPlus", var, 1-correctionErr, 1+correctionErr, cvweight);
+    FillVertErrorBand(h, var, eventWeights.BckgConstraint_SinglePiPlus);
 }
 
 void CCProtonPi0_Analyzer::FillVertErrorBand_BckgConstraint_SinglePiPlus_ByHand(MnvH1D* h, double var)
 {
-    double correctionErr = GetBckgConstraint_SinglePiPlusErr();
-    FillVertErrorBand_ByHand(h, var, "BckgConstraint_SinglePiPlus", 1-correctionErr, 1+correctionErr);
+    FillVertErrorBand_ByHand(h, var, eventWeights.BckgConstraint_SinglePiPlus);
 }
 
 void CCProtonPi0_Analyzer::FillVertErrorBand_BckgConstraint_SinglePiPlus(MnvH2D* h, double xval, double yval)
 {
-    double correctionErr = GetBckgConstraint_SinglePiPlusErr();
-    h->FillVertErrorBand("BckgConstraint_SinglePiPlus", xval, yval, 1-correctionErr, 1+correctionErr, cvweight);
+    FillVertErrorBand(h, xval, yval, eventWeights.BckgConstraint_SinglePiPlus);
 }
 
 void CCProtonPi0_Analyzer::FillVertErrorBand_BckgConstraint_SinglePiPlus_ByHand(MnvH2D* h, double xval, double yval)
 {
-    double correctionErr = GetBckgConstraint_SinglePiPlusErr();
-    FillVertErrorBand_ByHand(h, xval, yval, "BckgConstraint_SinglePiPlus", 1-correctionErr, 1+correctionErr);
+    FillVertErrorBand_ByHand(h, xval, yval, eventWeights.BckgConstraint_SinglePiPlus);
 }
 
 void CCProtonPi0_Analyzer::FillVertErrorBand_BckgConstraint_QELike(MnvH1D* h, double var)
 {
-    double correctionErr = GetBckgConstraint_QELikeErr();
-    h->FillVertErrorBand("BckgConstraint_QELike", var, 1-correctionErr, 1+correctionErr, cvweight);
+    FillVertErrorBand(h, var, eventWeights.BckgConstraint_QELike);
 }
 
 void CCProtonPi0_Analyzer::FillVertErrorBand_BckgConstraint_QELike_ByHand(MnvH1D* h, double var)
 {
-    double correctionErr = GetBckgConstraint_QELikeErr();
-    FillVertErrorBand_ByHand(h, var, "BckgConstraint_QELike", 1-correctionErr, 1+correctionErr);
+    FillVertErrorBand_ByHand(h, var, eventWeights.BckgConstraint_QELike);
 }
 
 void CCProtonPi0_Analyzer::FillVertErrorBand_BckgConstraint_QELike(MnvH2D* h, double xval, double yval)
 {
-    double correctionErr = GetBckgConstraint_QELikeErr();
-    h->FillVertErrorBand("BckgConstraint_QELike", xval, yval, 1-correctionErr, 1+correctionErr, cvweight);
+    FillVertErrorBand(h, xval, yval, eventWeights.BckgConstraint_QELike);
 }
 
 void CCProtonPi0_Analyzer::FillVertErrorBand_BckgConstraint_QELike_ByHand(MnvH2D* h, double xval, double yval)
 {
-    double correctionErr = GetBckgConstraint_QELikeErr();
-    FillVertErrorBand_ByHand(h, xval, yval, "BckgConstraint_QELike", 1-correctionErr, 1+correctionErr);
+    FillVertErrorBand_ByHand(h, xval, yval, eventWeights.BckgConstraint_QELike);
 }
 
 void CCProtonPi0_Analyzer::FillVertErrorBand_MichelTrue(MnvH1D* h, double var)
 {
-    double correctionErr = GetMichelTrueErr();
-    h->FillVertErrorBand("MichelTrue", var, 1-correctionErr, 1+correctionErr, cvweight);
+    FillVertErrorBand(h, var, eventWeights.MichelTrue);
 }
 
 void CCProtonPi0_Analyzer::FillVertErrorBand_MichelTrue_ByHand(MnvH1D* h, double var)
 {
-    double correctionErr = GetMichelTrueErr();
-    FillVertErrorBand_ByHand(h, var, "MichelTrue", 1-correctionErr, 1+correctionErr);
+    FillVertErrorBand_ByHand(h, var, eventWeights.MichelTrue);
 }
 
 void CCProtonPi0_Analyzer::FillVertErrorBand_MichelTrue(MnvH2D* h, double xval, double yval)
 {
-    double correctionErr = GetMichelTrueErr();
-    h->FillVertErrorBand("MichelTrue", xval, yval, 1-correctionErr, 1+correctionErr, cvweight);
+    FillVertErrorBand(h, xval, yval, eventWeights.MichelTrue);
 }
 
 void CCProtonPi0_Analyzer::FillVertErrorBand_MichelTrue_ByHand(MnvH2D* h, double xval, double yval)
 {
-    double correctionErr = GetMichelTrueErr();
-    FillVertErrorBand_ByHand(h, xval, yval, "MichelTrue", 1-correctionErr, 1+correctionErr);
+    FillVertErrorBand_ByHand(h, xval, yval, eventWeights.MichelTrue);
 }
 
 void CCProtonPi0_Analyzer::FillVertErrorBand_MichelFake(MnvH1D* h, double var)
 {
-    double correctionErr = GetMichelFakeErr();
-    h->FillVertErrorBand("MichelFake", var, 1-correctionErr, 1+correctionErr, cvweight);
+    FillVertErrorBand(h, var, eventWeights.MichelFake);
 }
 
 void CCProtonPi0_Analyzer::FillVertErrorBand_MichelFake_ByHand(MnvH1D* h, double var)
 {
-    double correctionErr = GetMichelFakeErr();
-    FillVertErrorBand_ByHand(h, var, "MichelFake", 1-correctionErr, 1+correctionErr);
+    FillVertErrorBand_ByHand(h, var, eventWeights.MichelFake);
 }
 
 void CCProtonPi0_Analyzer::FillVertErrorBand_MichelFake(MnvH2D* h, double xval, double yval)
 {
-    double correctionErr = GetMichelFakeErr();
-    h->FillVertErrorBand("MichelFake", xval, yval, 1-correctionErr, 1+correctionErr, cvweight);
+    FillVertErrorBand(h, xval, yval, eventWeights.MichelFake);
 }
 
 void CCProtonPi0_Analyzer::FillVertErrorBand_MichelFake_ByHand(MnvH2D* h, double xval, double yval)
 {
-    double correctionErr = GetMichelFakeErr();
-    FillVertErrorBand_ByHand(h, xval, yval, "MichelFake", 1-correctionErr, 1+correctionErr);
+    FillVertErrorBand_ByHand(h, xval, yval, eventWeights.MichelFake);
 }
 
 void CCProtonPi0_Analyzer::FillVertErrorBand_TargetMass(MnvH1D* h, double var)
 {
-    double correctionErr = GetTargetMassErr();
-    h->FillVertErrorBand("TargetMass", var, 1-correctionErr, 1+correctionErr, cvweight);
+    FillVertErrorBand(h, var, eventWeights.TargetMass);
 }
 
 void CCProtonPi0_Analyzer::FillVertErrorBand_TargetMass_ByHand(MnvH1D* h, double var)
 {
-    double correctionErr = GetTargetMassErr();
-    FillVertErrorBand_ByHand(h, var, "TargetMass", 1-correctionErr, 1+correctionErr);
+    FillVertErrorBand_ByHand(h, var, eventWeights.TargetMass);
 }
 
 void CCProtonPi0_Analyzer::FillVertErrorBand_TargetMass(MnvH2D* h, double xval, double yval)
 {
-    double correctionErr = GetTargetMassErr();
-    h->FillVertErrorBand("TargetMass", xval, yval, 1-correctionErr, 1+correctionErr, cvweight);
+    FillVertErrorBand(h, xval, yval, eventWeights.TargetMass);
 }
 
 void CCProtonPi0_Analyzer::FillVertErrorBand_TargetMass_ByHand(MnvH2D* h, double xval, double yval)
 {
-    double correctionErr = GetTargetMassErr();
-    FillVertErrorBand_ByHand(h, xval, yval, "TargetMass", 1-correctionErr, 1+correctionErr);
+    FillVertErrorBand_ByHand(h, xval, yval, eventWeights.TargetMass);
 }
 
 void CCProtonPi0_Analyzer::FillVertErrorBand_2p2h(MnvH1D* h, double var)
 {
-    double correctionErr = err_2p2h;
-    h->FillVertErrorBand("2p2h", var, 1-correctionErr, 1+correctionErr, cvweight);
+    FillVertErrorBand(h, var, eventWeights.Weight_2p2h);
 }
 
 void CCProtonPi0_Analyzer::FillVertErrorBand_2p2h_ByHand(MnvH1D* h, double var)
 {
-    double correctionErr = err_2p2h;
-    FillVertErrorBand_ByHand(h, var, "2p2h", 1-correctionErr, 1+correctionErr);
+    FillVertErrorBand_ByHand(h, var, eventWeights.Weight_2p2h);
 }
 
 void CCProtonPi0_Analyzer::FillVertErrorBand_2p2h(MnvH2D* h, double xval, double yval)
 {
-    double correctionErr = err_2p2h;
-    h->FillVertErrorBand("2p2h", xval, yval, 1-correctionErr, 1+correctionErr, cvweight);
+    FillVertErrorBand(h, xval, yval, eventWeights.Weight_2p2h);
 }
 
 void CCProtonPi0_Analyzer::FillVertErrorBand_2p2h_ByHand(MnvH2D* h, double xval, double yval)
 {
-    double correctionErr = err_2p2h;
-    FillVertErrorBand_ByHand(h, xval, yval, "2p2h", 1-correctionErr, 1+correctionErr);
+    FillVertErrorBand_ByHand(h, xval, yval, eventWeights.Weight_2p2h);
 }
 
 void CCProtonPi0_Analyzer::FillVertErrorBand_Unfolding(MnvH1D* h, double var)
 {
-    double correctionErr = GetUnfoldingErr();
-    h->FillVertErrorBand("Unfolding", var, 1-correctionErr, 1+correctionErr, cvweight);
+    FillVertErrorBand(h, var, eventWeights.Unfolding);
 }
 
 void CCProtonPi0_Analyzer::FillVertErrorBand_Unfolding_ByHand(MnvH1D* h, double var)
 {
-    double correctionErr = GetUnfoldingErr();
-    FillVertErrorBand_ByHand(h, var, "Unfolding", 1-correctionErr, 1+correctionErr);
+    FillVertErrorBand_ByHand(h, var, eventWeights.Unfolding);
 }
 
 void CCProtonPi0_Analyzer::FillVertErrorBand_Unfolding(MnvH2D* h, double xval, double yval)
 {
-    double correctionErr = GetUnfoldingErr();
-    h->FillVertErrorBand("Unfolding", xval, yval, 1-correctionErr, 1+correctionErr, cvweight);
+    FillVertErrorBand(h, xval, yval, eventWeights.Unfolding);
 }
 
 void CCProtonPi0_Analyzer::FillVertErrorBand_Unfolding_ByHand(MnvH2D* h, double xval, double yval)
 {
-    double correctionErr = GetUnfoldingErr();
-    FillVertErrorBand_ByHand(h, xval, yval, "Unfolding", 1-correctionErr, 1+correctionErr);
+    FillVertErrorBand_ByHand(h, xval, yval, eventWeights.Unfolding);
 }
 
 void CCProtonPi0_Analyzer::FillVertErrorBand_ProtonTracking(MnvH1D* h, double var)
 {
-    double correctionErr = GetProtonTrackingErr();
-    h->FillVertErrorBand("ProtonTracking", var, 1-correctionErr, 1+correctionErr, cvweight);
+    FillVertErrorBand(h, var, eventWeights.ProtonTracking);
 }
 
 void CCProtonPi0_Analyzer::FillVertErrorBand_ProtonTracking_ByHand(MnvH1D* h, double var)
 {
-    double correctionErr = GetProtonTrackingErr();
-    FillVertErrorBand_ByHand(h, var, "ProtonTracking", 1-correctionErr, 1+correctionErr);
+    FillVertErrorBand_ByHand(h, var, eventWeights.ProtonTracking);
 }
 
 void CCProtonPi0_Analyzer::FillVertErrorBand_ProtonTracking(MnvH2D* h, double xval, double yval)
 {
-    double correctionErr = GetProtonTrackingErr();
-    h->FillVertErrorBand("ProtonTracking", xval, yval, 1-correctionErr, 1+correctionErr, cvweight);
+    FillVertErrorBand(h, xval, yval, eventWeights.ProtonTracking);
 }
 
 void CCProtonPi0_Analyzer::FillVertErrorBand_ProtonTracking_ByHand(MnvH2D* h, double xval, double yval)
 {
-    double correctionErr = GetProtonTrackingErr();
-    FillVertErrorBand_ByHand(h, xval, yval, "ProtonTracking", 1-correctionErr, 1+correctionErr);
+    FillVertErrorBand_ByHand(h, xval, yval, eventWeights.ProtonTracking);
 }
 
 void CCProtonPi0_Analyzer::FillVertErrorBand_MuonTracking(MnvH1D* h, double var)
 {
-    double correctionErr = GetMINOSCorrectionErr();
-    h->FillVertErrorBand("MuonTracking", var, 1-correctionErr, 1+correctionErr, cvweight);
+    FillVertErrorBand(h, var, eventWeights.MuonTracking);
 }
 
 void CCProtonPi0_Analyzer::FillVertErrorBand_MuonTracking_ByHand(MnvH1D* h, double var)
 {
-    double correctionErr = GetMINOSCorrectionErr();
-    FillVertErrorBand_ByHand(h, var, "MuonTracking", 1-correctionErr, 1+correctionErr);
+    FillVertErrorBand_ByHand(h, var, eventWeights.MuonTracking);
 }
 
 void CCProtonPi0_Analyzer::FillVertErrorBand_MuonTracking(MnvH2D* h, double xval, double yval)
 {
-    double correctionErr = GetMINOSCorrectionErr();
-    h->FillVertErrorBand("MuonTracking", xval, yval, 1-correctionErr, 1+correctionErr, cvweight);
+    FillVertErrorBand(h, xval, yval, eventWeights.MuonTracking);
 }
 
 void CCProtonPi0_Analyzer::FillVertErrorBand_MuonTracking_ByHand(MnvH2D* h, double xval, double yval)
 {
-    double correctionErr = GetMINOSCorrectionErr();
-    FillVertErrorBand_ByHand(h, xval, yval, "MuonTracking", 1-correctionErr, 1+correctionErr);
+    FillVertErrorBand_ByHand(h, xval, yval, eventWeights.MuonTracking);
 }
 
 void CCProtonPi0_Analyzer::FillVertErrorBand_Flux(MnvH1D* h, double var)
 {
-    std::vector<double> flux_errors = GetFluxError(mc_incomingE * MeV_to_GeV, mc_incoming);
-    h->FillVertErrorBand("Flux",  var, &flux_errors[0],  cvweight, 1.0);
+    h->FillVertErrorBand("Flux",  var, &eventWeights.Flux.errors[0],  cvweight, 1.0);
 }
 
 void CCProtonPi0_Analyzer::FillVertErrorBand_Flux_ByHand(MnvH1D* h, double var)
 {
-    std::vector<double> flux_errors = GetFluxError(mc_incomingE * MeV_to_GeV, mc_incoming);
-    FillVertErrorBand_ByHand(h, var, "Flux", flux_errors);
+    FillVertErrorBand_ByHand(h, var, eventWeights.Flux);
 }
 
 void CCProtonPi0_Analyzer::FillVertErrorBand_Flux(MnvH2D* h, double xval, double yval)
 {
-    std::vector<double> flux_errors = GetFluxError(mc_incomingE * MeV_to_GeV, mc_incoming);
-    h->FillVertErrorBand("Flux",  xval, yval,  &flux_errors[0],  cvweight, 1.0);
+    h->FillVertErrorBand("Flux",  xval, yval,  &eventWeights.Flux.errors[0],  cvweight, 1.0);
 }
 
 void CCProtonPi0_Analyzer::FillVertErrorBand_Flux_ByHand(MnvH2D* h, double xval, double yval)
 {
-    std::vector<double> flux_errors = GetFluxError(mc_incomingE * MeV_to_GeV, mc_incoming);
-    FillVertErrorBand_ByHand(h, xval, yval, "Flux", flux_errors);
+    FillVertErrorBand_ByHand(h, xval, yval, eventWeights.Flux);
 }
 
 void CCProtonPi0_Analyzer::FillVertErrorBand_HighMaRES_ByHand(MnvH1D* h, double var)
@@ -696,6 +695,7 @@ void CCProtonPi0_Analyzer::FillHistogramWithVertErrors(MnvH1D* hist, double var)
 {
     // Fill CV Value
     hist->Fill(var, cvweight);
+    if (!fillSystematics) return;
 
     // Fill Vertical Error Bands
     if (fillErrors_ByHand){
@@ -740,6 +740,7 @@ void CCProtonPi0_Analyzer::FillHistogramWithVertErrors(MnvH2D* hist, double xval
 {
     // Fill CV Value
     hist->Fill(xval,yval, cvweight);
+    if (!fillSystematics) return;
 
     // Fill Vertical Error Bands
     if (fillErrors_ByHand){
@@ -866,6 +867,7 @@ void CCProtonPi0_Analyzer::FillLatErrorBands_ByHand()
 
 void CCProtonPi0_Analyzer::FillLatErrorBand_ProtonEnergy(std::string err_name)
 {
+    LatErrorBand_XSecVars& bands = GetLatErrorBand_XSecVars(err_name);
     double reco_muon_theta = GetCorrectedMuonTheta();
 
     bool PassedCuts;
@@ -936,127 +938,17 @@ void CCProtonPi0_Analyzer::FillLatErrorBand_ProtonEnergy(std::string err_name)
             double Delta_pi_theta_shift = Delta_pi_theta_i - Delta_pi_theta_reco;
             double Delta_pi_phi_shift = Delta_pi_phi_i - Delta_pi_phi_reco;
 
-            //-----------------------------------------------------------------
-            // pi0_P
-            //-----------------------------------------------------------------
-            FillLatErrorBand_SingleUniverse(pi0.pi0_P_mc_reco_all, err_name, i, pi0_P * MeV_to_GeV, 0.0);
-            if (truth_isSignal){
-                FillLatErrorBand_SingleUniverse(pi0.pi0_P_mc_truth_signal, err_name, i, truth_pi0_P * MeV_to_GeV, 0.0);
-                FillLatErrorBand_SingleUniverse(pi0.pi0_P_mc_reco_signal, err_name, i, pi0_P * MeV_to_GeV, 0.0);
-                FillLatErrorBand_SingleUniverse(pi0.pi0_P_response, err_name, i, pi0_P * MeV_to_GeV, truth_pi0_P * MeV_to_GeV, 0.0, 0.0);
-            }else{
-                FillLatErrorBand_SingleUniverse(pi0.pi0_P_mc_reco_bckg, err_name, i, pi0_P * MeV_to_GeV, 0.0);
-            }
-            //-----------------------------------------------------------------
-            // pi0_KE
-            //-----------------------------------------------------------------
-            FillLatErrorBand_SingleUniverse(pi0.pi0_KE_mc_reco_all, err_name, i, pi0_KE * MeV_to_GeV, 0.0);
-            if (truth_isSignal){
-                FillLatErrorBand_SingleUniverse(pi0.pi0_KE_mc_truth_signal, err_name, i, truth_pi0_KE * MeV_to_GeV, 0.0);
-                FillLatErrorBand_SingleUniverse(pi0.pi0_KE_mc_reco_signal, err_name, i, pi0_KE * MeV_to_GeV, 0.0);
-                FillLatErrorBand_SingleUniverse(pi0.pi0_KE_response, err_name, i, pi0_KE * MeV_to_GeV, truth_pi0_KE * MeV_to_GeV, 0.0, 0.0);
-            }else{
-                FillLatErrorBand_SingleUniverse(pi0.pi0_KE_mc_reco_bckg, err_name, i, pi0_KE * MeV_to_GeV, 0.0);
-            }
-            //-----------------------------------------------------------------
-            // pi0_theta
-            //-----------------------------------------------------------------
-            FillLatErrorBand_SingleUniverse(pi0.pi0_theta_mc_reco_all, err_name, i, pi0_theta * TMath::RadToDeg(), 0.0);
-            if (truth_isSignal){
-                FillLatErrorBand_SingleUniverse(pi0.pi0_theta_mc_truth_signal, err_name, i, truth_pi0_theta * TMath::RadToDeg(), 0.0);
-                FillLatErrorBand_SingleUniverse(pi0.pi0_theta_mc_reco_signal, err_name, i, pi0_theta * TMath::RadToDeg(), 0.0);
-                FillLatErrorBand_SingleUniverse(pi0.pi0_theta_response, err_name, i, pi0_theta * TMath::RadToDeg(), truth_pi0_theta * TMath::RadToDeg(), 0.0, 0.0);
-            }else{
-                FillLatErrorBand_SingleUniverse(pi0.pi0_theta_mc_reco_bckg, err_name, i, pi0_theta * TMath::RadToDeg(), 0.0);
-            }
-            //-----------------------------------------------------------------
-            // muon_P
-            //-----------------------------------------------------------------
-            FillLatErrorBand_SingleUniverse(muon.muon_P_mc_reco_all, err_name, i, muon_P * MeV_to_GeV, 0.0);
-            if (truth_isSignal){
-                FillLatErrorBand_SingleUniverse(muon.muon_P_mc_truth_signal, err_name, i, truth_muon_P * MeV_to_GeV, 0.0);
-                FillLatErrorBand_SingleUniverse(muon.muon_P_mc_reco_signal, err_name, i, muon_P * MeV_to_GeV, 0.0);
-                FillLatErrorBand_SingleUniverse(muon.muon_P_response, err_name, i, muon_P * MeV_to_GeV, truth_muon_P * MeV_to_GeV, 0.0, 0.0);
-            }else{
-                FillLatErrorBand_SingleUniverse(muon.muon_P_mc_reco_bckg, err_name, i, muon_P * MeV_to_GeV, 0.0);
-            }
-            //-----------------------------------------------------------------
-            // muon_theta
-            //-----------------------------------------------------------------
-            FillLatErrorBand_SingleUniverse(muon.muon_theta_mc_reco_all, err_name, i, reco_muon_theta * TMath::RadToDeg(), 0.0);
-            if (truth_isSignal){
-                FillLatErrorBand_SingleUniverse(muon.muon_theta_mc_truth_signal, err_name, i, truth_muon_theta * TMath::RadToDeg(), 0.0);
-                FillLatErrorBand_SingleUniverse(muon.muon_theta_mc_reco_signal, err_name, i, reco_muon_theta * TMath::RadToDeg(), 0.0);
-                FillLatErrorBand_SingleUniverse(muon.muon_theta_response, err_name, i, reco_muon_theta * TMath::RadToDeg(), truth_muon_theta * TMath::RadToDeg(), 0.0, 0.0);
-            }else{
-                FillLatErrorBand_SingleUniverse(muon.muon_theta_mc_reco_bckg, err_name, i, reco_muon_theta * TMath::RadToDeg(), 0.0);
-            }
-            //-----------------------------------------------------------------
-            // QSq
-            //-----------------------------------------------------------------
-            FillLatErrorBand_SingleUniverse(interaction.QSq_mc_reco_all, err_name, i, m_QSq * MeVSq_to_GeVSq, QSq_shift);
-            if (truth_isSignal){
-                FillLatErrorBand_SingleUniverse(interaction.QSq_mc_truth_signal, err_name, i, m_QSq_Truth * MeVSq_to_GeVSq, 0.0);
-                FillLatErrorBand_SingleUniverse(interaction.QSq_mc_reco_signal, err_name, i, m_QSq * MeVSq_to_GeVSq, QSq_shift);
-                FillLatErrorBand_SingleUniverse(interaction.QSq_response, err_name, i, m_QSq * MeVSq_to_GeVSq, m_QSq_Truth * MeVSq_to_GeVSq, QSq_shift, 0.0);
-            }else{
-                FillLatErrorBand_SingleUniverse(interaction.QSq_mc_reco_bckg, err_name, i, m_QSq * MeVSq_to_GeVSq, QSq_shift);
-            }
-            //-----------------------------------------------------------------
-            // W
-            //-----------------------------------------------------------------
-            FillLatErrorBand_SingleUniverse(interaction.W_mc_reco_all, err_name, i, m_W * MeV_to_GeV, W_shift);
-            if (truth_isSignal){
-                FillLatErrorBand_SingleUniverse(interaction.W_mc_truth_signal, err_name, i, m_W_Truth * MeV_to_GeV, 0.0);
-                FillLatErrorBand_SingleUniverse(interaction.W_mc_reco_signal, err_name, i, m_W * MeV_to_GeV, W_shift);
-                FillLatErrorBand_SingleUniverse(interaction.W_response, err_name, i, m_W * MeV_to_GeV, m_W_Truth * MeV_to_GeV, W_shift, 0.0);
-            }else{
-                FillLatErrorBand_SingleUniverse(interaction.W_mc_reco_bckg, err_name, i, m_W * MeV_to_GeV, W_shift);
-            }
-            //-----------------------------------------------------------------
-            // Enu
-            //-----------------------------------------------------------------
-            FillLatErrorBand_SingleUniverse(interaction.Enu_mc_reco_all, err_name, i, m_Enu * MeV_to_GeV, Enu_shift);
-            if (truth_isSignal){
-                FillLatErrorBand_SingleUniverse(interaction.Enu_mc_truth_signal, err_name, i, m_Enu_Truth * MeV_to_GeV, 0.0);
-                FillLatErrorBand_SingleUniverse(interaction.Enu_mc_reco_signal, err_name, i, m_Enu * MeV_to_GeV, Enu_shift);
-                FillLatErrorBand_SingleUniverse(interaction.Enu_response, err_name, i, m_Enu * MeV_to_GeV, m_Enu_Truth * MeV_to_GeV, Enu_shift, 0.0);
-            }else{
-                FillLatErrorBand_SingleUniverse(interaction.Enu_mc_reco_bckg, err_name, i, m_Enu * MeV_to_GeV, Enu_shift);
-            }
-            //-----------------------------------------------------------------
-            // deltaInvMass 
-            //-----------------------------------------------------------------
-            FillLatErrorBand_SingleUniverse(interaction.deltaInvMass_mc_reco_all, err_name, i, deltaInvMass_reco, deltaInvMass_shift);
-            if (truth_isSignal){
-                FillLatErrorBand_SingleUniverse(interaction.deltaInvMass_mc_truth_signal, err_name, i, deltaInvMass_true, 0.0);
-                FillLatErrorBand_SingleUniverse(interaction.deltaInvMass_mc_reco_signal, err_name, i, deltaInvMass_reco, deltaInvMass_shift);
-                FillLatErrorBand_SingleUniverse(interaction.deltaInvMass_response, err_name, i, deltaInvMass_reco, deltaInvMass_true, deltaInvMass_shift, 0.0);
-            }else{
-                FillLatErrorBand_SingleUniverse(interaction.deltaInvMass_mc_reco_bckg, err_name, i, deltaInvMass_reco, deltaInvMass_shift);
-            }
-            //-----------------------------------------------------------------
-            // Delta_pi_theta 
-            //-----------------------------------------------------------------
-            FillLatErrorBand_SingleUniverse(interaction.Delta_pi_theta_mc_reco_all, err_name, i, Delta_pi_theta_reco, Delta_pi_theta_shift);
-            if (truth_isSignal){
-                FillLatErrorBand_SingleUniverse(interaction.Delta_pi_theta_mc_truth_signal, err_name, i, Delta_pi_theta_true, 0.0);
-                FillLatErrorBand_SingleUniverse(interaction.Delta_pi_theta_mc_reco_signal, err_name, i, Delta_pi_theta_reco, Delta_pi_theta_shift);
-                FillLatErrorBand_SingleUniverse(interaction.Delta_pi_theta_response, err_name, i, Delta_pi_theta_reco, Delta_pi_theta_true, Delta_pi_theta_shift, 0.0);
-            }else{
-                FillLatErrorBand_SingleUniverse(interaction.Delta_pi_theta_mc_reco_bckg, err_name, i, Delta_pi_theta_reco, Delta_pi_theta_shift);
-            }
-            //-----------------------------------------------------------------
-            // Delta_pi_phi 
-            //-----------------------------------------------------------------
-            FillLatErrorBand_SingleUniverse(interaction.Delta_pi_phi_mc_reco_all, err_name, i, Delta_pi_phi_reco, Delta_pi_phi_shift);
-            if (truth_isSignal){
-                FillLatErrorBand_SingleUniverse(interaction.Delta_pi_phi_mc_truth_signal, err_name, i, Delta_pi_phi_true, 0.0);
-                FillLatErrorBand_SingleUniverse(interaction.Delta_pi_phi_mc_reco_signal, err_name, i, Delta_pi_phi_reco, Delta_pi_phi_shift);
-                FillLatErrorBand_SingleUniverse(interaction.Delta_pi_phi_response, err_name, i, Delta_pi_phi_reco, Delta_pi_phi_true, Delta_pi_phi_shift, 0.0);
-            }else{
-                FillLatErrorBand_SingleUniverse(interaction.Delta_pi_phi_mc_reco_bckg, err_name, i, Delta_pi_phi_reco, Delta_pi_phi_shift);
-            }
+            FillLatErrorBand_SingleUniverse(bands.pi0_P, i, pi0_P * MeV_to_GeV, truth_pi0_P * MeV_to_GeV, 0.0);
+            FillLatErrorBand_SingleUniverse(bands.pi0_KE, i, pi0_KE * MeV_to_GeV, truth_pi0_KE * MeV_to_GeV, 0.0);
+            FillLatErrorBand_SingleUniverse(bands.pi0_theta, i, pi0_theta * TMath::RadToDeg(), truth_pi0_theta * TMath::RadToDeg(), 0.0);
+            FillLatErrorBand_SingleUniverse(bands.muon_P, i, muon_P * MeV_to_GeV, truth_muon_P * MeV_to_GeV, 0.0);
+            FillLatErrorBand_SingleUniverse(bands.muon_theta, i, reco_muon_theta * TMath::RadToDeg(), truth_muon_theta * TMath::RadToDeg(), 0.0);
+            FillLatErrorBand_SingleUniverse(bands.QSq, i, m_QSq * MeVSq_to_GeVSq, m_QSq_Truth * MeVSq_to_GeVSq, QSq_shift);
+            FillLatErrorBand_SingleUniverse(bands.W, i, m_W * MeV_to_GeV, m_W_Truth * MeV_to_GeV, W_shift);
+            FillLatErrorBand_SingleUniverse(bands.Enu, i, m_Enu * MeV_to_GeV, m_Enu_Truth * MeV_to_GeV, Enu_shift);
+            FillLatErrorBand_SingleUniverse(bands.deltaInvMass, i, deltaInvMass_reco, deltaInvMass_true, deltaInvMass_shift);
+            FillLatErrorBand_SingleUniverse(bands.Delta_pi_theta, i, Delta_pi_theta_reco, Delta_pi_theta_true, Delta_pi_theta_shift);
+            FillLatErrorBand_SingleUniverse(bands.Delta_pi_phi, i, Delta_pi_phi_reco, Delta_pi_phi_true, Delta_pi_phi_shift);
         }else{
             // Did not passed cuts
         }
@@ -1066,6 +958,7 @@ void CCProtonPi0_Analyzer::FillLatErrorBand_ProtonEnergy(std::string err_name)
 void CCProtonPi0_Analyzer::FillLatErrorBand_ProtonEnergy_Birks()
 {
     std::string err_name = "ProtonEnergy_Birks";
+    LatErrorBand_XSecVars& bands = GetLatErrorBand_XSecVars(err_name);
     double reco_muon_theta = GetCorrectedMuonTheta();
 
     bool PassedCuts;
@@ -1132,310 +1025,335 @@ void CCProtonPi0_Analyzer::FillLatErrorBand_ProtonEnergy_Birks()
             double Delta_pi_theta_shift = Delta_pi_theta_i - Delta_pi_theta_reco;
             double Delta_pi_phi_shift = Delta_pi_phi_i - Delta_pi_phi_reco;
 
-            //-----------------------------------------------------------------
-            // pi0_P
-            //-----------------------------------------------------------------
-            FillLatErrorBand_SingleUniverse(pi0.pi0_P_mc_reco_all, err_name, i, pi0_P * MeV_to_GeV, 0.0);
-            if (truth_isSignal){
-                FillLatErrorBand_SingleUniverse(pi0.pi0_P_mc_truth_signal, err_name, i, truth_pi0_P * MeV_to_GeV, 0.0);
-                FillLatErrorBand_SingleUniverse(pi0.pi0_P_mc_reco_signal, err_name, i, pi0_P * MeV_to_GeV, 0.0);
-                FillLatErrorBand_SingleUniverse(pi0.pi0_P_response, err_name, i, pi0_P * MeV_to_GeV, truth_pi0_P * MeV_to_GeV, 0.0, 0.0);
-            }else{
-                FillLatErrorBand_SingleUniverse(pi0.pi0_P_mc_reco_bckg, err_name, i, pi0_P * MeV_to_GeV, 0.0);
-            }
-            //-----------------------------------------------------------------
-            // pi0_KE
-            //-----------------------------------------------------------------
-            FillLatErrorBand_SingleUniverse(pi0.pi0_KE_mc_reco_all, err_name, i, pi0_KE * MeV_to_GeV, 0.0);
-            if (truth_isSignal){
-                FillLatErrorBand_SingleUniverse(pi0.pi0_KE_mc_truth_signal, err_name, i, truth_pi0_KE * MeV_to_GeV, 0.0);
-                FillLatErrorBand_SingleUniverse(pi0.pi0_KE_mc_reco_signal, err_name, i, pi0_KE * MeV_to_GeV, 0.0);
-                FillLatErrorBand_SingleUniverse(pi0.pi0_KE_response, err_name, i, pi0_KE * MeV_to_GeV, truth_pi0_KE * MeV_to_GeV, 0.0, 0.0);
-            }else{
-                FillLatErrorBand_SingleUniverse(pi0.pi0_KE_mc_reco_bckg, err_name, i, pi0_KE * MeV_to_GeV, 0.0);
-            }
-            //-----------------------------------------------------------------
-            // pi0_theta
-            //-----------------------------------------------------------------
-            FillLatErrorBand_SingleUniverse(pi0.pi0_theta_mc_reco_all, err_name, i, pi0_theta * TMath::RadToDeg(), 0.0);
-            if (truth_isSignal){
-                FillLatErrorBand_SingleUniverse(pi0.pi0_theta_mc_truth_signal, err_name, i, truth_pi0_theta * TMath::RadToDeg(), 0.0);
-                FillLatErrorBand_SingleUniverse(pi0.pi0_theta_mc_reco_signal, err_name, i, pi0_theta * TMath::RadToDeg(), 0.0);
-                FillLatErrorBand_SingleUniverse(pi0.pi0_theta_response, err_name, i, pi0_theta * TMath::RadToDeg(), truth_pi0_theta * TMath::RadToDeg(), 0.0, 0.0);
-            }else{
-                FillLatErrorBand_SingleUniverse(pi0.pi0_theta_mc_reco_bckg, err_name, i, pi0_theta * TMath::RadToDeg(), 0.0);
-            }
-            //-----------------------------------------------------------------
-            // muon_P
-            //-----------------------------------------------------------------
-            FillLatErrorBand_SingleUniverse(muon.muon_P_mc_reco_all, err_name, i, muon_P * MeV_to_GeV, 0.0);
-            if (truth_isSignal){
-                FillLatErrorBand_SingleUniverse(muon.muon_P_mc_truth_signal, err_name, i, truth_muon_P * MeV_to_GeV, 0.0);
-                FillLatErrorBand_SingleUniverse(muon.muon_P_mc_reco_signal, err_name, i, muon_P * MeV_to_GeV, 0.0);
-                FillLatErrorBand_SingleUniverse(muon.muon_P_response, err_name, i, muon_P * MeV_to_GeV, truth_muon_P * MeV_to_GeV, 0.0, 0.0);
-            }else{
-                FillLatErrorBand_SingleUniverse(muon.muon_P_mc_reco_bckg, err_name, i, muon_P * MeV_to_GeV, 0.0);
-            }
-            //-----------------------------------------------------------------
-            // muon_theta
-            //-----------------------------------------------------------------
-            FillLatErrorBand_SingleUniverse(muon.muon_theta_mc_reco_all, err_name, i, reco_muon_theta * TMath::RadToDeg(), 0.0);
-            if (truth_isSignal){
-                FillLatErrorBand_SingleUniverse(muon.muon_theta_mc_truth_signal, err_name, i, truth_muon_theta * TMath::RadToDeg(), 0.0);
-                FillLatErrorBand_SingleUniverse(muon.muon_theta_mc_reco_signal, err_name, i, reco_muon_theta * TMath::RadToDeg(), 0.0);
-                FillLatErrorBand_SingleUniverse(muon.muon_theta_response, err_name, i, reco_muon_theta * TMath::RadToDeg(), truth_muon_theta * TMath::RadToDeg(), 0.0, 0.0);
-            }else{
-                FillLatErrorBand_SingleUniverse(muon.muon_theta_mc_reco_bckg, err_name, i, reco_muon_theta * TMath::RadToDeg(), 0.0);
-            }
-            //-----------------------------------------------------------------
-            // QSq
-            //-----------------------------------------------------------------
-            FillLatErrorBand_SingleUniverse(interaction.QSq_mc_reco_all, err_name, i, m_QSq * MeVSq_to_GeVSq, QSq_shift);
-            if (truth_isSignal){
-                FillLatErrorBand_SingleUniverse(interaction.QSq_mc_truth_signal, err_name, i, m_QSq_Truth * MeVSq_to_GeVSq, 0.0);
-                FillLatErrorBand_SingleUniverse(interaction.QSq_mc_reco_signal, err_name, i, m_QSq * MeVSq_to_GeVSq, QSq_shift);
-                FillLatErrorBand_SingleUniverse(interaction.QSq_response, err_name, i, m_QSq * MeVSq_to_GeVSq, m_QSq_Truth * MeVSq_to_GeVSq, QSq_shift, 0.0);
-            }else{
-                FillLatErrorBand_SingleUniverse(interaction.QSq_mc_reco_bckg, err_name, i, m_QSq * MeVSq_to_GeVSq, QSq_shift);
-            }
-            //-----------------------------------------------------------------
-            // W
-            //-----------------------------------------------------------------
-            FillLatErrorBand_SingleUniverse(interaction.W_mc_reco_all, err_name, i, m_W * MeV_to_GeV, W_shift);
-            if (truth_isSignal){
-                FillLatErrorBand_SingleUniverse(interaction.W_mc_truth_signal, err_name, i, m_W_Truth * MeV_to_GeV, 0.0);
-                FillLatErrorBand_SingleUniverse(interaction.W_mc_reco_signal, err_name, i, m_W * MeV_to_GeV, W_shift);
-                FillLatErrorBand_SingleUniverse(interaction.W_response, err_name, i, m_W * MeV_to_GeV, m_W_Truth * MeV_to_GeV, W_shift, 0.0);
-            }else{
-                FillLatErrorBand_SingleUniverse(interaction.W_mc_reco_bckg, err_name, i, m_W * MeV_to_GeV, W_shift);
-            }
-            //-----------------------------------------------------------------
-            // Enu
-            //-----------------------------------------------------------------
-            FillLatErrorBand_SingleUniverse(interaction.Enu_mc_reco_all, err_name, i, m_Enu * MeV_to_GeV, Enu_shift);
-            if (truth_isSignal){
-                FillLatErrorBand_SingleUniverse(interaction.Enu_mc_truth_signal, err_name, i, m_Enu_Truth * MeV_to_GeV, 0.0);
-                FillLatErrorBand_SingleUniverse(interaction.Enu_mc_reco_signal, err_name, i, m_Enu * MeV_to_GeV, Enu_shift);
-                FillLatErrorBand_SingleUniverse(interaction.Enu_response, err_name, i, m_Enu * MeV_to_GeV, m_Enu_Truth * MeV_to_GeV, Enu_shift, 0.0);
-            }else{
-                FillLatErrorBand_SingleUniverse(interaction.Enu_mc_reco_bckg, err_name, i, m_Enu * MeV_to_GeV, Enu_shift);
-            }
-            //-----------------------------------------------------------------
-            // deltaInvMass 
-            //-----------------------------------------------------------------
-            FillLatErrorBand_SingleUniverse(interaction.deltaInvMass_mc_reco_all, err_name, i, deltaInvMass_reco, deltaInvMass_shift);
-            if (truth_isSignal){
-                FillLatErrorBand_SingleUniverse(interaction.deltaInvMass_mc_truth_signal, err_name, i, deltaInvMass_true, 0.0);
-                FillLatErrorBand_SingleUniverse(interaction.deltaInvMass_mc_reco_signal, err_name, i, deltaInvMass_reco, deltaInvMass_shift);
-                FillLatErrorBand_SingleUniverse(interaction.deltaInvMass_response, err_name, i, deltaInvMass_reco, deltaInvMass_true, deltaInvMass_shift, 0.0);
-            }else{
-                FillLatErrorBand_SingleUniverse(interaction.deltaInvMass_mc_reco_bckg, err_name, i, deltaInvMass_reco, deltaInvMass_shift);
-            }
-            //-----------------------------------------------------------------
-            // Delta_pi_theta 
-            //-----------------------------------------------------------------
-            FillLatErrorBand_SingleUniverse(interaction.Delta_pi_theta_mc_reco_all, err_name, i, Delta_pi_theta_reco, Delta_pi_theta_shift);
-            if (truth_isSignal){
-                FillLatErrorBand_SingleUniverse(interaction.Delta_pi_theta_mc_truth_signal, err_name, i, Delta_pi_theta_true, 0.0);
-                FillLatErrorBand_SingleUniverse(interaction.Delta_pi_theta_mc_reco_signal, err_name, i, Delta_pi_theta_reco, Delta_pi_theta_shift);
-                FillLatErrorBand_SingleUniverse(interaction.Delta_pi_theta_response, err_name, i, Delta_pi_theta_reco, Delta_pi_theta_true, Delta_pi_theta_shift, 0.0);
-            }else{
-                FillLatErrorBand_SingleUniverse(interaction.Delta_pi_theta_mc_reco_bckg, err_name, i, Delta_pi_theta_reco, Delta_pi_theta_shift);
-            }
-            //-----------------------------------------------------------------
-            // Delta_pi_phi 
-            //-----------------------------------------------------------------
-            FillLatErrorBand_SingleUniverse(interaction.Delta_pi_phi_mc_reco_all, err_name, i, Delta_pi_phi_reco, Delta_pi_phi_shift);
-            if (truth_isSignal){
-                FillLatErrorBand_SingleUniverse(interaction.Delta_pi_phi_mc_truth_signal, err_name, i, Delta_pi_phi_true, 0.0);
-                FillLatErrorBand_SingleUniverse(interaction.Delta_pi_phi_mc_reco_signal, err_name, i, Delta_pi_phi_reco, Delta_pi_phi_shift);
-                FillLatErrorBand_SingleUniverse(interaction.Delta_pi_phi_response, err_name, i, Delta_pi_phi_reco, Delta_pi_phi_true, Delta_pi_phi_shift, 0.0);
-            }else{
-                FillLatErrorBand_SingleUniverse(interaction.Delta_pi_phi_mc_reco_bckg, err_name, i, Delta_pi_phi_reco, Delta_pi_phi_shift);
-            }
+            FillLatErrorBand_SingleUniverse(bands.pi0_P, i, pi0_P * MeV_to_GeV, truth_pi0_P * MeV_to_GeV, 0.0);
+            FillLatErrorBand_SingleUniverse(bands.pi0_KE, i, pi0_KE * MeV_to_GeV, truth_pi0_KE * MeV_to_GeV, 0.0);
+            FillLatErrorBand_SingleUniverse(bands.pi0_theta, i, pi0_theta * TMath::RadToDeg(), truth_pi0_theta * TMath::RadToDeg(), 0.0);
+            FillLatErrorBand_SingleUniverse(bands.muon_P, i, muon_P * MeV_to_GeV, truth_muon_P * MeV_to_GeV, 0.0);
+            FillLatErrorBand_SingleUniverse(bands.muon_theta, i, reco_muon_theta * TMath::RadToDeg(), truth_muon_theta * TMath::RadToDeg(), 0.0);
+            FillLatErrorBand_SingleUniverse(bands.QSq, i, m_QSq * MeVSq_to_GeVSq, m_QSq_Truth * MeVSq_to_GeVSq, QSq_shift);
+            FillLatErrorBand_SingleUniverse(bands.W, i, m_W * MeV_to_GeV, m_W_Truth * MeV_to_GeV, W_shift);
+            FillLatErrorBand_SingleUniverse(bands.Enu, i, m_Enu * MeV_to_GeV, m_Enu_Truth * MeV_to_GeV, Enu_shift);
+            FillLatErrorBand_SingleUniverse(bands.deltaInvMass, i, deltaInvMass_reco, deltaInvMass_true, deltaInvMass_shift);
+            FillLatErrorBand_SingleUniverse(bands.Delta_pi_theta, i, Delta_pi_theta_reco, Delta_pi_theta_true, Delta_pi_theta_shift);
+            FillLatErrorBand_SingleUniverse(bands.Delta_pi_phi, i, Delta_pi_phi_reco, Delta_pi_phi_true, Delta_pi_phi_shift);
         }else{
             // Did not passed cuts
         }
     }
 }
 
-void CCProtonPi0_Analyzer::FillLatErrorBand_EM_EnergyScale()
+// Delta Rest Frame Polarization Angles using plain doubles
+//  Same algebra as Calc_Delta_pi_angles() without TLorentzVector temporaries
+//  so that it can be inlined into the lateral universe loops
+static inline void Boost_4P(double& x, double& y, double& z, double& t, double bx, double by, double bz)
 {
-    std::string err_name = "EM_EnergyScale";
-    double reco_muon_theta = GetCorrectedMuonTheta();
+    const double b2 = bx*bx + by*by + bz*bz;
+    const double gamma = 1.0 / sqrt(1.0 - b2);
+    const double bp = bx*x + by*y + bz*z;
+    const double gamma2 = b2 > 0 ? (gamma - 1.0)/b2 : 0.0;
 
-    double deltaInvMass_i;
-    double Delta_pi_theta_i;
-    double Delta_pi_phi_i;
+    x = x + gamma2*bp*bx + gamma*bx*t;
+    y = y + gamma2*bp*by + gamma*by*t;
+    z = z + gamma2*bp*bz + gamma*bz*t;
+    t = gamma*(t + bp);
+}
 
-    for (int i = 0; i < n_lateral_universes; ++i){
+static inline void Unit_3P(double& x, double& y, double& z)
+{
+    const double mag2 = x*x + y*y + z*z;
+    const double inv_mag = (mag2 > 0) ? 1.0/sqrt(mag2) : 1.0;
+    x *= inv_mag;
+    y *= inv_mag;
+    z *= inv_mag;
+}
 
-        // EM Energy Dependent Variables
-        double gamma1_E_i = (1.0 + em_energy_random_shifts[i]) * gamma1_E;
-        double gamma2_E_i = (1.0 + em_energy_random_shifts[i]) * gamma2_E;
-        double pi0_invMass_i = std::sqrt(2*gamma1_E_i*gamma2_E_i*(1-pi0_cos_openingAngle));
-        double pi0_px_i = (1.0 + em_energy_random_shifts[i]) * pi0_px;
-        double pi0_py_i = (1.0 + em_energy_random_shifts[i]) * pi0_py;
-        double pi0_pz_i = (1.0 + em_energy_random_shifts[i]) * pi0_pz;
-        double pi0_P_i = (1.0 + em_energy_random_shifts[i]) * pi0_P;
-        double pi0_E_i = sqrt(pi0_P_i*pi0_P_i + pi0_mass*pi0_mass);
-        double pi0_KE_i = pi0_E_i - pi0_mass;
-        double Enu_i = Calc_Enu_shifted(muon_E, pi0_E_i, m_total_proton_KE); // Use actual muon energy and shifted pi0 energy
-        double QSq_i = Calc_QSq(Enu_i, muon_E, muon_P, reco_muon_theta); // Use actual muon energy
-        double WSq_i = Calc_WSq(Enu_i, QSq_i, muon_E); // Use actual muon energy
-        double W_i = (WSq_i > 0) ? sqrt(WSq_i) : -1; 
+static inline void Calc_Delta_pi_angles_Fast( double proton_px, double proton_py, double proton_pz, double proton_E,
+                                                double pi0_px, double pi0_py, double pi0_pz, double pi0_E,
+                                                double muon_px, double muon_py, double muon_pz, double muon_E,
+                                                double beam_px, double beam_py, double beam_pz, double beam_E,
+                                                double& cos_theta_z, double& phi)
+{
+    // Find Boost from LAB Frame to Delta Rest Frame
+    const double delta_px = proton_px + pi0_px;
+    const double delta_py = proton_py + pi0_py;
+    const double delta_pz = proton_pz + pi0_pz;
+    const double delta_E = proton_E + pi0_E;
+    const double delta_P2 = delta_px*delta_px + delta_py*delta_py + delta_pz*delta_pz;
+    const double delta_M2 = delta_E*delta_E - delta_P2;
+    const double M_delta = (delta_M2 < 0) ? -sqrt(-delta_M2) : sqrt(delta_M2);
+    const double gamma = 1.0 / sqrt(1.0 - delta_P2/(delta_E*delta_E));
+    const double boost_x = -(delta_px / (gamma*M_delta));
+    const double boost_y = -(delta_py / (gamma*M_delta));
+    const double boost_z = -(delta_pz / (gamma*M_delta));
 
-        if (nProtonCandidates > 0 ){
-            // deltaInvMass
-            TLorentzVector proton_4P_i(proton_px, proton_py, proton_pz, proton_E);
-            TLorentzVector pi0_4P_i(pi0_px_i, pi0_py_i, pi0_pz_i, pi0_E_i);
-            deltaInvMass_i = calcDeltaInvariantMass(proton_4P_i, pi0_4P_i) * MeV_to_GeV; 
+    // Boost All 4-Momentums to Delta Rest Frame
+    Boost_4P(beam_px, beam_py, beam_pz, beam_E, boost_x, boost_y, boost_z);
+    Boost_4P(muon_px, muon_py, muon_pz, muon_E, boost_x, boost_y, boost_z);
+    Boost_4P(pi0_px, pi0_py, pi0_pz, pi0_E, boost_x, boost_y, boost_z);
 
-            // Polarization Angles
-            TLorentzVector muon_4P_i(muon_px, muon_py, muon_pz, muon_E);
-            TLorentzVector beam_4P_i = Get_Neutrino_4P(Enu_i);
-            std::vector<double> pol_angles = Calc_Delta_pi_angles(proton_4P_i, pi0_4P_i, muon_4P_i, beam_4P_i);
-            Delta_pi_theta_i = pol_angles[0];
-            Delta_pi_phi_i = pol_angles[1];
-        }else{
-            deltaInvMass_i = deltaInvMass_reco;
-            Delta_pi_theta_i = Delta_pi_theta_reco;
-            Delta_pi_phi_i = Delta_pi_phi_reco;
+    // Z Axis -- Momentum Transfer Axis
+    double axis_z_x = beam_px - muon_px;
+    double axis_z_y = beam_py - muon_py;
+    double axis_z_z = beam_pz - muon_pz;
+
+    // Y Axis -- Beam x Muon
+    double axis_y_x = beam_py*muon_pz - beam_pz*muon_py;
+    double axis_y_y = beam_pz*muon_px - beam_px*muon_pz;
+    double axis_y_z = beam_px*muon_py - beam_py*muon_px;
+
+    // X Axis -- Right Handed Coordinate System y_axis x z_axis = x_axis
+    double axis_x_x = axis_y_y*axis_z_z - axis_y_z*axis_z_y;
+    double axis_x_y = axis_y_z*axis_z_x - axis_y_x*axis_z_z;
+    double axis_x_z = axis_y_x*axis_z_y - axis_y_y*axis_z_x;
+
+    Unit_3P(axis_x_x, axis_x_y, axis_x_z);
+    Unit_3P(axis_y_x, axis_y_y, axis_y_z);
+    Unit_3P(axis_z_x, axis_z_y, axis_z_z);
+
+    // Calculate Angles
+    const double pion_P = sqrt(pi0_px*pi0_px + pi0_py*pi0_py + pi0_pz*pi0_pz);
+    Unit_3P(pi0_px, pi0_py, pi0_pz);
+
+    cos_theta_z = pi0_px*axis_z_x + pi0_py*axis_z_y + pi0_pz*axis_z_z;
+
+    const double theta_x = acos(pi0_px*axis_x_x + pi0_py*axis_x_y + pi0_pz*axis_x_z);
+    const double theta_y = acos(pi0_px*axis_y_x + pi0_py*axis_y_y + pi0_pz*axis_y_z);
+    const double theta_z = acos(cos_theta_z);
+
+    const double Px = pion_P*cos(theta_x);
+    const double Py = pion_P*cos(theta_y);
+
+    const double phi_x = acos(Px/(pion_P*sin(theta_z)));
+    phi = phi_x * TMath::RadToDeg();
+
+    // Convert to 360
+    if (Py < 0) phi = 360 - phi;
+}
+
+void CCProtonPi0_Analyzer::Calc_LatUniverse_DeltaKinematics(LatUniverseKinematics& kin)
+{
+    if (nProtonCandidates == 0){
+        for (int i = 0; i < n_lateral_universes; ++i){
+            kin.deltaInvMass[i] = deltaInvMass_reco;
+            kin.Delta_pi_theta[i] = Delta_pi_theta_reco;
+            kin.Delta_pi_phi[i] = Delta_pi_phi_reco;
         }
+        return;
+    }
 
-        bool PassedCuts = IsEnuInRange(Enu_i) && IsWInRange(W_i) && IsInvMassInRange(pi0_invMass_i) && !IsOpeningAngleSmallAndEnergyLow(gamma1_E_i, gamma2_E_i);
+    const double beam_theta = -0.05887; // Same as Get_Neutrino_4P()
+    const double beam_sin = sin(beam_theta);
+    const double beam_cos = cos(beam_theta);
 
-        if (PassedCuts){
-            double pi0_P_shift = (pi0_P_i - pi0_P) * MeV_to_GeV;
-            double pi0_KE_shift = (pi0_KE_i - pi0_KE) * MeV_to_GeV;
-            double Enu_shift = (Enu_i - m_Enu) * MeV_to_GeV;
-            double QSq_shift = (QSq_i - m_QSq) * MeVSq_to_GeVSq;
-            double W_shift = (W_i - m_W) * MeV_to_GeV;
-            double deltaInvMass_shift = deltaInvMass_i - deltaInvMass_reco;
-            double Delta_pi_theta_shift = Delta_pi_theta_i - Delta_pi_theta_reco;
-            double Delta_pi_phi_shift = Delta_pi_phi_i - Delta_pi_phi_reco;
+    for (int i = 0; i < n_lateral_universes; ++i){
+        // deltaInvMass
+        const double delta_px = proton_px + kin.pi0_px[i];
+        const double delta_py = proton_py + kin.pi0_py[i];
+        const double delta_pz = proton_pz + kin.pi0_pz[i];
+        const double delta_E = proton_E + kin.pi0_E[i];
+        const double delta_M2 = delta_E*delta_E - (delta_px*delta_px + delta_py*delta_py + delta_pz*delta_pz);
+        kin.deltaInvMass[i] = ((delta_M2 < 0) ? -sqrt(-delta_M2) : sqrt(delta_M2)) * MeV_to_GeV;
+
+        // Polarization Angles
+        const double Enu_i = kin.Enu[i];
+        Calc_Delta_pi_angles_Fast(  proton_px, proton_py, proton_pz, proton_E,
+                                    kin.pi0_px[i], kin.pi0_py[i], kin.pi0_pz[i], kin.pi0_E[i],
+                                    kin.muon_px[i], kin.muon_py[i], kin.muon_pz[i], kin.muon_E[i],
+                                    0.0, Enu_i*beam_sin, Enu_i*beam_cos, Enu_i,
+                                    kin.Delta_pi_theta[i], kin.Delta_pi_phi[i]);
+    }
+}
 
-            //-----------------------------------------------------------------
-            // pi0_P
-            //-----------------------------------------------------------------
-            FillLatErrorBand_SingleUniverse(pi0.pi0_P_mc_reco_all, err_name, i, pi0_P * MeV_to_GeV, pi0_P_shift);
-            if (truth_isSignal){
-                FillLatErrorBand_SingleUniverse(pi0.pi0_P_mc_truth_signal, err_name, i, truth_pi0_P * MeV_to_GeV, 0.0);
-                FillLatErrorBand_SingleUniverse(pi0.pi0_P_mc_reco_signal, err_name, i, pi0_P * MeV_to_GeV, pi0_P_shift);
-                FillLatErrorBand_SingleUniverse(pi0.pi0_P_response, err_name, i, pi0_P * MeV_to_GeV, truth_pi0_P * MeV_to_GeV, pi0_P_shift, 0.0);
-            }else{
-                FillLatErrorBand_SingleUniverse(pi0.pi0_P_mc_reco_bckg, err_name, i, pi0_P * MeV_to_GeV, pi0_P_shift);
-            }
-            //-----------------------------------------------------------------
-            // pi0_KE
-            //-----------------------------------------------------------------
-            FillLatErrorBand_SingleUniverse(pi0.pi0_KE_mc_reco_all, err_name, i, pi0_KE * MeV_to_GeV, pi0_KE_shift);
-            if (truth_isSignal){
-                FillLatErrorBand_SingleUniverse(pi0.pi0_KE_mc_truth_signal, err_name, i, truth_pi0_KE * MeV_to_GeV, 0.0);
-                FillLatErrorBand_SingleUniverse(pi0.pi0_KE_mc_reco_signal, err_name, i, pi0_KE * MeV_to_GeV, pi0_KE_shift);
-                FillLatErrorBand_SingleUniverse(pi0.pi0_KE_response, err_name, i, pi0_KE * MeV_to_GeV, truth_pi0_KE * MeV_to_GeV, pi0_KE_shift, 0.0);
-            }else{
-                FillLatErrorBand_SingleUniverse(pi0.pi0_KE_mc_reco_bckg, err_name, i, pi0_KE * MeV_to_GeV, pi0_KE_shift);
-            }
-            //-----------------------------------------------------------------
-            // pi0_theta
-            //-----------------------------------------------------------------
-            FillLatErrorBand_SingleUniverse(pi0.pi0_theta_mc_reco_all, err_name, i, pi0_theta * TMath::RadToDeg(), 0.0);
-            if (truth_isSignal){
-                FillLatErrorBand_SingleUniverse(pi0.pi0_theta_mc_truth_signal, err_name, i, truth_pi0_theta * TMath::RadToDeg(), 0.0);
-                FillLatErrorBand_SingleUniverse(pi0.pi0_theta_mc_reco_signal, err_name, i, pi0_theta * TMath::RadToDeg(), 0.0);
-                FillLatErrorBand_SingleUniverse(pi0.pi0_theta_response, err_name, i, pi0_theta * TMath::RadToDeg(), truth_pi0_theta * TMath::RadToDeg(), 0.0, 0.0);
-            }else{
-                FillLatErrorBand_SingleUniverse(pi0.pi0_theta_mc_reco_bckg, err_name, i, pi0_theta * TMath::RadToDeg(), 0.0);
-            }
-            //-----------------------------------------------------------------
-            // muon_P
-            //-----------------------------------------------------------------
-            FillLatErrorBand_SingleUniverse(muon.muon_P_mc_reco_all, err_name, i, muon_P * MeV_to_GeV, 0.0);
-            if (truth_isSignal){
-                FillLatErrorBand_SingleUniverse(muon.muon_P_mc_truth_signal, err_name, i, truth_muon_P * MeV_to_GeV, 0.0);
-                FillLatErrorBand_SingleUniverse(muon.muon_P_mc_reco_signal, err_name, i, muon_P * MeV_to_GeV, 0.0);
-                FillLatErrorBand_SingleUniverse(muon.muon_P_response, err_name, i, muon_P * MeV_to_GeV, truth_muon_P * MeV_to_GeV, 0.0, 0.0);
-            }else{
-                FillLatErrorBand_SingleUniverse(muon.muon_P_mc_reco_bckg, err_name, i, muon_P * MeV_to_GeV, 0.0);
-            }
-            //-----------------------------------------------------------------
-            // muon_theta
-            //-----------------------------------------------------------------
-            FillLatErrorBand_SingleUniverse(muon.muon_theta_mc_reco_all, err_name, i, reco_muon_theta * TMath::RadToDeg(), 0.0);
-            if (truth_isSignal){
-                FillLatErrorBand_SingleUniverse(muon.muon_theta_mc_truth_signal, err_name, i, truth_muon_theta * TMath::RadToDeg(), 0.0);
-                FillLatErrorBand_SingleUniverse(muon.muon_theta_mc_reco_signal, err_name, i, reco_muon_theta * TMath::RadToDeg(), 0.0);
-                FillLatErrorBand_SingleUniverse(muon.muon_theta_response, err_name, i, reco_muon_theta * TMath::RadToDeg(), truth_muon_theta * TMath::RadToDeg(), 0.0, 0.0);
-            }else{
-                FillLatErrorBand_SingleUniverse(muon.muon_theta_mc_reco_bckg, err_name, i, reco_muon_theta * TMath::RadToDeg(), 0.0);
-            }
-            //-----------------------------------------------------------------
-            // QSq
-            //-----------------------------------------------------------------
-            FillLatErrorBand_SingleUniverse(interaction.QSq_mc_reco_all, err_name, i, m_QSq * MeVSq_to_GeVSq, QSq_shift);
-            if (truth_isSignal){
-                FillLatErrorBand_SingleUniverse(interaction.QSq_mc_truth_signal, err_name, i, m_QSq_Truth * MeVSq_to_GeVSq, 0.0);
-                FillLatErrorBand_SingleUniverse(interaction.QSq_mc_reco_signal, err_name, i, m_QSq * MeVSq_to_GeVSq, QSq_shift);
-                FillLatErrorBand_SingleUniverse(interaction.QSq_response, err_name, i, m_QSq * MeVSq_to_GeVSq, m_QSq_Truth * MeVSq_to_GeVSq, QSq_shift, 0.0);
-            }else{
-                FillLatErrorBand_SingleUniverse(interaction.QSq_mc_reco_bckg, err_name, i, m_QSq * MeVSq_to_GeVSq, QSq_shift);
-            }
-            //-----------------------------------------------------------------
-            // W
-            //-----------------------------------------------------------------
-            FillLatErrorBand_SingleUniverse(interaction.W_mc_reco_all, err_name, i, m_W * MeV_to_GeV, W_shift);
-            if (truth_isSignal){
-                FillLatErrorBand_SingleUniverse(interaction.W_mc_truth_signal, err_name, i, m_W_Truth * MeV_to_GeV, 0.0);
-                FillLatErrorBand_SingleUniverse(interaction.W_mc_reco_signal, err_name, i, m_W * MeV_to_GeV, W_shift);
-                FillLatErrorBand_SingleUniverse(interaction.W_response, err_name, i, m_W * MeV_to_GeV, m_W_Truth * MeV_to_GeV, W_shift, 0.0);
-            }else{
-                FillLatErrorBand_SingleUniverse(interaction.W_mc_reco_bckg, err_name, i, m_W * MeV_to_GeV, W_shift);
-            }
-            //-----------------------------------------------------------------
-            // Enu
-            //-----------------------------------------------------------------
-            FillLatErrorBand_SingleUniverse(interaction.Enu_mc_reco_all, err_name, i, m_Enu * MeV_to_GeV, Enu_shift);
-            if (truth_isSignal){
-                FillLatErrorBand_SingleUniverse(interaction.Enu_mc_truth_signal, err_name, i, m_Enu_Truth * MeV_to_GeV, 0.0);
-                FillLatErrorBand_SingleUniverse(interaction.Enu_mc_reco_signal, err_name, i, m_Enu * MeV_to_GeV, Enu_shift);
-                FillLatErrorBand_SingleUniverse(interaction.Enu_response, err_name, i, m_Enu * MeV_to_GeV, m_Enu_Truth * MeV_to_GeV, Enu_shift, 0.0);
-            }else{
-                FillLatErrorBand_SingleUniverse(interaction.Enu_mc_reco_bckg, err_name, i, m_Enu * MeV_to_GeV, Enu_shift);
-            }
-            //-----------------------------------------------------------------
-            // deltaInvMass 
-            //-----------------------------------------------------------------
-            FillLatErrorBand_SingleUniverse(interaction.deltaInvMass_mc_reco_all, err_name, i, deltaInvMass_reco, deltaInvMass_shift);
-            if (truth_isSignal){
-                FillLatErrorBand_SingleUniverse(interaction.deltaInvMass_mc_truth_signal, err_name, i, deltaInvMass_true, 0.0);
-                FillLatErrorBand_SingleUniverse(interaction.deltaInvMass_mc_reco_signal, err_name, i, deltaInvMass_reco, deltaInvMass_shift);
-                FillLatErrorBand_SingleUniverse(interaction.deltaInvMass_response, err_name, i, deltaInvMass_reco, deltaInvMass_true, deltaInvMass_shift, 0.0);
-            }else{
-                FillLatErrorBand_SingleUniverse(interaction.deltaInvMass_mc_reco_bckg, err_name, i, deltaInvMass_reco, deltaInvMass_shift);
-            }
-            //-----------------------------------------------------------------
-            // Delta_pi_theta 
-            //-----------------------------------------------------------------
-            FillLatErrorBand_SingleUniverse(interaction.Delta_pi_theta_mc_reco_all, err_name, i, Delta_pi_theta_reco, Delta_pi_theta_shift);
-            if (truth_isSignal){
-                FillLatErrorBand_SingleUniverse(interaction.Delta_pi_theta_mc_truth_signal, err_name, i, Delta_pi_theta_true, 0.0);
-                FillLatErrorBand_SingleUniverse(interaction.Delta_pi_theta_mc_reco_signal, err_name, i, Delta_pi_theta_reco, Delta_pi_theta_shift);
-                FillLatErrorBand_SingleUniverse(interaction.Delta_pi_theta_response, err_name, i, Delta_pi_theta_reco, Delta_pi_theta_true, Delta_pi_theta_shift, 0.0);
-            }else{
-                FillLatErrorBand_SingleUniverse(interaction.Delta_pi_theta_mc_reco_bckg, err_name, i, Delta_pi_theta_reco, Delta_pi_theta_shift);
-            }
-            //-----------------------------------------------------------------
-            // Delta_pi_phi 
-            //-----------------------------------------------------------------
-            FillLatErrorBand_SingleUniverse(interaction.Delta_pi_phi_mc_reco_all, err_name, i, Delta_pi_phi_reco, Delta_pi_phi_shift);
-            if (truth_isSignal){
-                FillLatErrorBand_SingleUniverse(interaction.Delta_pi_phi_mc_truth_signal, err_name, i, Delta_pi_phi_true, 0.0);
-                FillLatErrorBand_SingleUniverse(interaction.Delta_pi_phi_mc_reco_signal, err_name, i, Delta_pi_phi_reco, Delta_pi_phi_shift);
-                FillLatErrorBand_SingleUniverse(interaction.Delta_pi_phi_response, err_name, i, Delta_pi_phi_reco, Delta_pi_phi_true, Delta_pi_phi_shift, 0.0);
-            }else{
-                FillLatErrorBand_SingleUniverse(interaction.Delta_pi_phi_mc_reco_bckg, err_name, i, Delta_pi_phi_reco, Delta_pi_phi_shift);
-            }
+// Calc_LatUniverseKinematics_*()
+//  The universe loops only do arithmetic and sqrt() so they are vectorized
+//  with -O2 -fno-math-errno (see Makefile). Members are copied to locals and
+//  kin, shifts are __restrict, otherwise every store to kin may overwrite a
+//  member or a shift and the compiler gives up. Sums keep the order of the
+//  scalar code so the results do not change.
+void CCProtonPi0_Analyzer::Calc_LatUniverseKinematics_EM_EnergyScale(LatUniverseKinematics& __restrict kin, const double* __restrict shifts, double reco_muon_theta)
+{
+    const double muon_cos = cos(reco_muon_theta);
+    const double total_proton_KE = (nProtonCandidates == 0) ? 0.0 : m_total_proton_KE; // Same as Calc_Enu_shifted()
+
+    const double gamma1_E_cv = gamma1_E;
+    const double gamma2_E_cv = gamma2_E;
+    const double pi0_cos_openingAngle_cv = pi0_cos_openingAngle;
+    const double pi0_px_cv = pi0_px;
+    const double pi0_py_cv = pi0_py;
+    const double pi0_pz_cv = pi0_pz;
+    const double pi0_P_cv = pi0_P;
+    const double muon_px_cv = muon_px;
+    const double muon_py_cv = muon_py;
+    const double muon_pz_cv = muon_pz;
+    const double muon_E_cv = muon_E;
+    const double muon_P_cv = muon_P;
+    const double vertex_blob_energy_cv = vertex_blob_energy;
+    const double Extra_Energy_Total_cv = Extra_Energy_Total;
+
+    for (int i = 0; i < n_lateral_universes; ++i){
+        const double scale = 1.0 + shifts[i];
+        const double gamma1_E_i = scale * gamma1_E_cv;
+        const double gamma2_E_i = scale * gamma2_E_cv;
+        const double pi0_P_i = scale * pi0_P_cv;
+        const double pi0_E_i = sqrt(pi0_P_i*pi0_P_i + pi0_mass*pi0_mass);
+        const double Enu_i = muon_E_cv + total_proton_KE + pi0_E_i + vertex_blob_energy_cv + Extra_Energy_Total_cv;
+        const double QSq_i = 2*Enu_i*(muon_E_cv - muon_P_cv*muon_cos) - (muon_mass*muon_mass);
+        const double WSq = neutron_mass*neutron_mass + 2*neutron_mass*(Enu_i - muon_E_cv) - QSq_i;
+        kin.gamma1_E[i] = gamma1_E_i;
+        kin.gamma2_E[i] = gamma2_E_i;
+        kin.pi0_invMass[i] = sqrt(2*gamma1_E_i*gamma2_E_i*(1-pi0_cos_openingAngle_cv));
+        kin.pi0_px[i] = scale * pi0_px_cv;
+        kin.pi0_py[i] = scale * pi0_py_cv;
+        kin.pi0_pz[i] = scale * pi0_pz_cv;
+        kin.pi0_P[i] = pi0_P_i;
+        kin.pi0_E[i] = pi0_E_i;
+        kin.pi0_KE[i] = pi0_E_i - pi0_mass;
+        kin.muon_px[i] = muon_px_cv;
+        kin.muon_py[i] = muon_py_cv;
+        kin.muon_pz[i] = muon_pz_cv;
+        kin.muon_E[i] = muon_E_cv;
+        kin.Enu[i] = Enu_i;
+        kin.QSq[i] = QSq_i;
+        kin.W[i] = (WSq > 0) ? sqrt(WSq) : -1;
+    }
+
+    Calc_LatUniverse_DeltaKinematics(kin);
+
+    for (int i = 0; i < n_lateral_universes; ++i){
+        kin.PassedCuts[i] = IsEnuInRange(kin.Enu[i]) && IsWInRange(kin.W[i]) && IsInvMassInRange(kin.pi0_invMass[i]) && !IsOpeningAngleSmallAndEnergyLow(kin.gamma1_E[i], kin.gamma2_E[i]);
+    }
+}
+
+void CCProtonPi0_Analyzer::Calc_LatUniverseKinematics_MuonMomentum(LatUniverseKinematics& __restrict kin, const double* __restrict shifts, double reco_muon_theta)
+{
+    const double muon_cos = cos(reco_muon_theta);
+    const double total_proton_KE = (nProtonCandidates == 0) ? 0.0 : m_total_proton_KE; // Same as Calc_Enu_shifted()
+
+    // Muon Direction -- Same as GetEnergyShiftedMuon4P()
+    double muon_ux = muon_px;
+    double muon_uy = muon_py;
+    double muon_uz = muon_pz;
+    Unit_3P(muon_ux, muon_uy, muon_uz);
+
+    const double muon_P_cv = muon_P;
+    const double pi0_px_cv = pi0_px;
+    const double pi0_py_cv = pi0_py;
+    const double pi0_pz_cv = pi0_pz;
+    const double pi0_E_cv = pi0_E;
+    const double vertex_blob_energy_cv = vertex_blob_energy;
+    const double Extra_Energy_Total_cv = Extra_Energy_Total;
+
+    for (int i = 0; i < n_lateral_universes; ++i){
+        const double muon_P_i = (1.0 + shifts[i]) * muon_P_cv;
+        const double muon_E_i = sqrt(muon_P_i * muon_P_i + muon_mass * muon_mass);
+        const double muon_3P_i = sqrt(muon_E_i*muon_E_i - muon_mass*muon_mass);
+        const double Enu_i = muon_E_i + total_proton_KE + pi0_E_cv + vertex_blob_energy_cv + Extra_Energy_Total_cv;
+        const double QSq_i = 2*Enu_i*(muon_E_i - muon_P_i*muon_cos) - (muon_mass*muon_mass);
+        const double WSq = neutron_mass*neutron_mass + 2*neutron_mass*(Enu_i - muon_E_i) - QSq_i;
+        kin.muon_P[i] = muon_P_i;
+        kin.muon_E[i] = muon_E_i;
+        kin.muon_px[i] = muon_ux * muon_3P_i;
+        kin.muon_py[i] = muon_uy * muon_3P_i;
+        kin.muon_pz[i] = muon_uz * muon_3P_i;
+        kin.pi0_px[i] = pi0_px_cv;
+        kin.pi0_py[i] = pi0_py_cv;
+        kin.pi0_pz[i] = pi0_pz_cv;
+        kin.pi0_E[i] = pi0_E_cv;
+        kin.Enu[i] = Enu_i;
+        kin.QSq[i] = QSq_i;
+        kin.W[i] = (WSq > 0) ? sqrt(WSq) : -1;
+    }
+
+    Calc_LatUniverse_DeltaKinematics(kin);
+
+    for (int i = 0; i < n_lateral_universes; ++i){
+        kin.PassedCuts[i] = IsEnuInRange(kin.Enu[i]) && IsWInRange(kin.W[i]);
+    }
+}
+
+void CCProtonPi0_Analyzer::Calc_LatUniverseKinematics_MuonTheta(LatUniverseKinematics& __restrict kin, const double* __restrict shifts, double reco_muon_theta)
+{
+    // Muon Direction -- Same as GetThetaShiftedMuon4P()
+    const double muon_3P = sqrt(muon_px*muon_px + muon_py*muon_py + muon_pz*muon_pz);
+    const double muon_phi = (muon_px == 0.0 && muon_py == 0.0) ? 0.0 : atan2(muon_py, muon_px);
+    const double muon_cos_phi = cos(muon_phi);
+    const double muon_sin_phi = sin(muon_phi);
+
+    const double muon_E_cv = muon_E;
+    const double muon_P_cv = muon_P;
+    const double pi0_px_cv = pi0_px;
+    const double pi0_py_cv = pi0_py;
+    const double pi0_pz_cv = pi0_pz;
+    const double pi0_E_cv = pi0_E;
+    const double Enu_cv = m_Enu; // Use actual neutrino energy
+
+    // sin() and cos() are libm calls, the loop calling them stays scalar
+    // Keep them in muon_theta and muon_px, muon_pz until the next loop
+    for (int i = 0; i < n_lateral_universes; ++i){
+        const double muon_theta_i = (1.0 + shifts[i]) * reco_muon_theta;
+        kin.muon_theta[i] = muon_theta_i;
+        kin.muon_px[i] = sin(muon_theta_i);
+        kin.muon_pz[i] = cos(muon_theta_i);
+    }
+
+    for (int i = 0; i < n_lateral_universes; ++i){
+        const double sin_theta_i = kin.muon_px[i];
+        const double cos_theta_i = kin.muon_pz[i];
+        const double QSq_i = 2*Enu_cv*(muon_E_cv - muon_P_cv*cos_theta_i) - (muon_mass*muon_mass);
+        const double WSq = neutron_mass*neutron_mass + 2*neutron_mass*(Enu_cv - muon_E_cv) - QSq_i;
+        kin.muon_E[i] = muon_E_cv;
+        kin.muon_px[i] = muon_3P * sin_theta_i * muon_cos_phi;
+        kin.muon_py[i] = muon_3P * sin_theta_i * muon_sin_phi;
+        kin.muon_pz[i] = muon_3P * cos_theta_i;
+        kin.pi0_px[i] = pi0_px_cv;
+        kin.pi0_py[i] = pi0_py_cv;
+        kin.pi0_pz[i] = pi0_pz_cv;
+        kin.pi0_E[i] = pi0_E_cv;
+        kin.Enu[i] = Enu_cv;
+        kin.QSq[i] = QSq_i;
+        kin.W[i] = (WSq > 0) ? sqrt(WSq) : -1;
+    }
+
+    Calc_LatUniverse_DeltaKinematics(kin);
+
+    for (int i = 0; i < n_lateral_universes; ++i){
+        kin.PassedCuts[i] = IsWInRange(kin.W[i]);
+    }
+}
+
+void CCProtonPi0_Analyzer::FillLatErrorBand_EM_EnergyScale()
+{
+    std::string err_name = "EM_EnergyScale";
+    LatErrorBand_XSecVars& bands = GetLatErrorBand_XSecVars(err_name);
+    double reco_muon_theta = GetCorrectedMuonTheta();
+
+    // Shifted Kinematics for All Universes
+    LatUniverseKinematics& kin = latUniverseKinematics;
+    Calc_LatUniverseKinematics_EM_EnergyScale(kin, &em_energy_random_shifts[0], reco_muon_theta);
+
+    for (int i = 0; i < n_lateral_universes; ++i){
+
+        if (kin.PassedCuts[i]){
+            double pi0_P_shift = (kin.pi0_P[i] - pi0_P) * MeV_to_GeV;
+            double pi0_KE_shift = (kin.pi0_KE[i] - pi0_KE) * MeV_to_GeV;
+            double Enu_shift = (kin.Enu[i] - m_Enu) * MeV_to_GeV;
+            double QSq_shift = (kin.QSq[i] - m_QSq) * MeVSq_to_GeVSq;
+            double W_shift = (kin.W[i] - m_W) * MeV_to_GeV;
+            double deltaInvMass_shift = kin.deltaInvMass[i] - deltaInvMass_reco;
+            double Delta_pi_theta_shift = kin.Delta_pi_theta[i] - Delta_pi_theta_reco;
+            double Delta_pi_phi_shift = kin.Delta_pi_phi[i] - Delta_pi_phi_reco;
+
+            FillLatErrorBand_SingleUniverse(bands.pi0_P, i, pi0_P * MeV_to_GeV, truth_pi0_P * MeV_to_GeV, pi0_P_shift);
+            FillLatErrorBand_SingleUniverse(bands.pi0_KE, i, pi0_KE * MeV_to_GeV, truth_pi0_KE * MeV_to_GeV, pi0_KE_shift);
+            FillLatErrorBand_SingleUniverse(bands.pi0_theta, i, pi0_theta * TMath::RadToDeg(), truth_pi0_theta * TMath::RadToDeg(), 0.0);
+            FillLatErrorBand_SingleUniverse(bands.muon_P, i, muon_P * MeV_to_GeV, truth_muon_P * MeV_to_GeV, 0.0);
+            FillLatErrorBand_SingleUniverse(bands.muon_theta, i, reco_muon_theta * TMath::RadToDeg(), truth_muon_theta * TMath::RadToDeg(), 0.0);
+            FillLatErrorBand_SingleUniverse(bands.QSq, i, m_QSq * MeVSq_to_GeVSq, m_QSq_Truth * MeVSq_to_GeVSq, QSq_shift);
+            FillLatErrorBand_SingleUniverse(bands.W, i, m_W * MeV_to_GeV, m_W_Truth * MeV_to_GeV, W_shift);
+            FillLatErrorBand_SingleUniverse(bands.Enu, i, m_Enu * MeV_to_GeV, m_Enu_Truth * MeV_to_GeV, Enu_shift);
+            FillLatErrorBand_SingleUniverse(bands.deltaInvMass, i, deltaInvMass_reco, deltaInvMass_true, deltaInvMass_shift);
+            FillLatErrorBand_SingleUniverse(bands.Delta_pi_theta, i, Delta_pi_theta_reco, Delta_pi_theta_true, Delta_pi_theta_shift);
+            FillLatErrorBand_SingleUniverse(bands.Delta_pi_phi, i, Delta_pi_phi_reco, Delta_pi_phi_true, Delta_pi_phi_shift);
         }else{
             // Does not satisfy cuts
         }
@@ -1445,168 +1363,38 @@ void CCProtonPi0_Analyzer::FillLatErrorBand_EM_EnergyScale()
 void CCProtonPi0_Analyzer::FillLatErrorBand_MuonMomentum()
 {
     std::string err_name = "MuonMomentum";
+    LatErrorBand_XSecVars& bands = GetLatErrorBand_XSecVars(err_name);
     double reco_muon_theta = GetCorrectedMuonTheta();
 
-    double Delta_pi_theta_i;
-    double Delta_pi_phi_i;
-
     // For each event muonP_random_shifts is different
     Calc_muonP_random_shifts();
-    for (int i = 0; i < n_lateral_universes; ++i){
 
-        // Muon Variables
-        double muon_P_i = (1.0 + muonP_random_shifts[i]) * muon_P;
-        double muon_E_i = sqrt(muon_P_i * muon_P_i + muon_mass * muon_mass);
-        double Enu_i = Calc_Enu_shifted(muon_E_i, pi0_E, m_total_proton_KE); // Use shifted muon energy and actual pi0 energy
-        double QSq_i = Calc_QSq(Enu_i, muon_E_i, muon_P_i, reco_muon_theta); // Use shifted muon energy
-        double WSq_i = Calc_WSq(Enu_i, QSq_i, muon_E_i); // Use shifted muon energy
-        double W_i = (WSq_i > 0) ? sqrt(WSq_i) : -1; 
-
-        if (nProtonCandidates > 0 ){
-            TLorentzVector proton_4P_i(proton_px, proton_py, proton_pz, proton_E);
-            TLorentzVector pi0_4P_i(pi0_px, pi0_py, pi0_pz, pi0_E);
-            TLorentzVector muon_4P_i = GetEnergyShiftedMuon4P(muon_E_i);
-            TLorentzVector beam_4P_i = Get_Neutrino_4P(Enu_i);
-            std::vector<double> pol_angles = Calc_Delta_pi_angles(proton_4P_i, pi0_4P_i, muon_4P_i, beam_4P_i);
-            Delta_pi_theta_i = pol_angles[0];
-            Delta_pi_phi_i = pol_angles[1];
-        }else{
-            Delta_pi_theta_i = Delta_pi_theta_reco;
-            Delta_pi_phi_i = Delta_pi_phi_reco;
-        }
-
-        bool PassedCuts = IsEnuInRange(Enu_i) && IsWInRange(W_i);
-
-        if (PassedCuts){
-            double muon_P_shift = (muon_P_i - muon_P) * MeV_to_GeV;
-            double Enu_shift = (Enu_i - m_Enu) * MeV_to_GeV;
-            double QSq_shift = (QSq_i - m_QSq) * MeVSq_to_GeVSq;
-            double W_shift = (W_i - m_W) * MeV_to_GeV;
-            double Delta_pi_theta_shift = Delta_pi_theta_i - Delta_pi_theta_reco;
-            double Delta_pi_phi_shift = Delta_pi_phi_i - Delta_pi_phi_reco;
+    // Shifted Kinematics for All Universes
+    LatUniverseKinematics& kin = latUniverseKinematics;
+    Calc_LatUniverseKinematics_MuonMomentum(kin, &muonP_random_shifts[0], reco_muon_theta);
 
-            //-----------------------------------------------------------------
-            // muon_P
-            //-----------------------------------------------------------------
-            FillLatErrorBand_SingleUniverse(muon.muon_P_mc_reco_all, err_name, i, muon_P * MeV_to_GeV, muon_P_shift);
-            if (truth_isSignal){
-                FillLatErrorBand_SingleUniverse(muon.muon_P_mc_truth_signal, err_name, i, truth_muon_P * MeV_to_GeV, 0.0);
-                FillLatErrorBand_SingleUniverse(muon.muon_P_mc_reco_signal, err_name, i, muon_P * MeV_to_GeV, muon_P_shift);
-                FillLatErrorBand_SingleUniverse(muon.muon_P_response, err_name, i, muon_P * MeV_to_GeV, truth_muon_P * MeV_to_GeV, muon_P_shift, 0.0);
-            }else{
-                FillLatErrorBand_SingleUniverse(muon.muon_P_mc_reco_bckg, err_name, i, muon_P * MeV_to_GeV, muon_P_shift);
-            }
-            //-----------------------------------------------------------------
-            // muon_theta
-            //-----------------------------------------------------------------
-            FillLatErrorBand_SingleUniverse(muon.muon_theta_mc_reco_all, err_name, i, reco_muon_theta * TMath::RadToDeg(), 0.0);
-            if (truth_isSignal){
-                FillLatErrorBand_SingleUniverse(muon.muon_theta_mc_truth_signal, err_name, i, truth_muon_theta * TMath::RadToDeg(), 0.0);
-                FillLatErrorBand_SingleUniverse(muon.muon_theta_mc_reco_signal, err_name, i, reco_muon_theta * TMath::RadToDeg(), 0.0);
-                FillLatErrorBand_SingleUniverse(muon.muon_theta_response, err_name, i, reco_muon_theta * TMath::RadToDeg(), truth_muon_theta * TMath::RadToDeg(), 0.0, 0.0);
-            }else{
-                FillLatErrorBand_SingleUniverse(muon.muon_theta_mc_reco_bckg, err_name, i, reco_muon_theta * TMath::RadToDeg(), 0.0);
-            }
-            //-----------------------------------------------------------------
-            // pi0_P
-            //-----------------------------------------------------------------
-            FillLatErrorBand_SingleUniverse(pi0.pi0_P_mc_reco_all, err_name, i, pi0_P * MeV_to_GeV, 0.0);
-            if (truth_isSignal){
-                FillLatErrorBand_SingleUniverse(pi0.pi0_P_mc_truth_signal, err_name, i, truth_pi0_P * MeV_to_GeV, 0.0);
-                FillLatErrorBand_SingleUniverse(pi0.pi0_P_mc_reco_signal, err_name, i, pi0_P * MeV_to_GeV, 0.0);
-                FillLatErrorBand_SingleUniverse(pi0.pi0_P_response, err_name, i, pi0_P * MeV_to_GeV, truth_pi0_P * MeV_to_GeV, 0.0, 0.0);
-            }else{
-                FillLatErrorBand_SingleUniverse(pi0.pi0_P_mc_reco_bckg, err_name, i, pi0_P * MeV_to_GeV, 0.0);
-            }
-            //-----------------------------------------------------------------
-            // pi0_KE
-            //-----------------------------------------------------------------
-            FillLatErrorBand_SingleUniverse(pi0.pi0_KE_mc_reco_all, err_name, i, pi0_KE * MeV_to_GeV, 0.0);
-            if (truth_isSignal){
-                FillLatErrorBand_SingleUniverse(pi0.pi0_KE_mc_truth_signal, err_name, i, truth_pi0_KE * MeV_to_GeV, 0.0);
-                FillLatErrorBand_SingleUniverse(pi0.pi0_KE_mc_reco_signal, err_name, i, pi0_KE * MeV_to_GeV, 0.0);
-                FillLatErrorBand_SingleUniverse(pi0.pi0_KE_response, err_name, i, pi0_KE * MeV_to_GeV, truth_pi0_KE * MeV_to_GeV, 0.0, 0.0);
-            }else{
-                FillLatErrorBand_SingleUniverse(pi0.pi0_KE_mc_reco_bckg, err_name, i, pi0_KE * MeV_to_GeV, 0.0);
-            }
-            //-----------------------------------------------------------------
-            // pi0_theta
-            //-----------------------------------------------------------------
-            FillLatErrorBand_SingleUniverse(pi0.pi0_theta_mc_reco_all, err_name, i, pi0_theta * TMath::RadToDeg(), 0.0);
-            if (truth_isSignal){
-                FillLatErrorBand_SingleUniverse(pi0.pi0_theta_mc_truth_signal, err_name, i, truth_pi0_theta * TMath::RadToDeg(), 0.0);
-                FillLatErrorBand_SingleUniverse(pi0.pi0_theta_mc_reco_signal, err_name, i, pi0_theta * TMath::RadToDeg(), 0.0);
-                FillLatErrorBand_SingleUniverse(pi0.pi0_theta_response, err_name, i, pi0_theta * TMath::RadToDeg(), truth_pi0_theta * TMath::RadToDeg(), 0.0, 0.0);
-            }else{
-                FillLatErrorBand_SingleUniverse(pi0.pi0_theta_mc_reco_bckg, err_name, i, pi0_theta * TMath::RadToDeg(), 0.0);
-            }
-            //-----------------------------------------------------------------
-            // QSq
-            //-----------------------------------------------------------------
-            FillLatErrorBand_SingleUniverse(interaction.QSq_mc_reco_all, err_name, i, m_QSq * MeVSq_to_GeVSq, QSq_shift);
-            if (truth_isSignal){
-                FillLatErrorBand_SingleUniverse(interaction.QSq_mc_truth_signal, err_name, i, m_QSq_Truth * MeVSq_to_GeVSq, 0.0);
-                FillLatErrorBand_SingleUniverse(interaction.QSq_mc_reco_signal, err_name, i, m_QSq * MeVSq_to_GeVSq, QSq_shift);
-                FillLatErrorBand_SingleUniverse(interaction.QSq_response, err_name, i, m_QSq * MeVSq_to_GeVSq, m_QSq_Truth * MeVSq_to_GeVSq, QSq_shift, 0.0);
-            }else{
-                FillLatErrorBand_SingleUniverse(interaction.QSq_mc_reco_bckg, err_name, i, m_QSq * MeVSq_to_GeVSq, QSq_shift);
-            }
-            //-----------------------------------------------------------------
-            // W
-            //-----------------------------------------------------------------
-            FillLatErrorBand_SingleUniverse(interaction.W_mc_reco_all, err_name, i, m_W * MeV_to_GeV, W_shift);
-            if (truth_isSignal){
-                FillLatErrorBand_SingleUniverse(interaction.W_mc_truth_signal, err_name, i, m_W_Truth * MeV_to_GeV, 0.0);
-                FillLatErrorBand_SingleUniverse(interaction.W_mc_reco_signal, err_name, i, m_W * MeV_to_GeV, W_shift);
-                FillLatErrorBand_SingleUniverse(interaction.W_response, err_name, i, m_W * MeV_to_GeV, m_W_Truth * MeV_to_GeV, W_shift, 0.0);
-            }else{
-                FillLatErrorBand_SingleUniverse(interaction.W_mc_reco_bckg, err_name, i, m_W * MeV_to_GeV, W_shift);
-            }
-            //-----------------------------------------------------------------
-            // Enu
-            //-----------------------------------------------------------------
-            FillLatErrorBand_SingleUniverse(interaction.Enu_mc_reco_all, err_name, i, m_Enu * MeV_to_GeV, Enu_shift);
-            if (truth_isSignal){
-                FillLatErrorBand_SingleUniverse(interaction.Enu_mc_truth_signal, err_name, i, m_Enu_Truth * MeV_to_GeV, 0.0);
-                FillLatErrorBand_SingleUniverse(interaction.Enu_mc_reco_signal, err_name, i, m_Enu * MeV_to_GeV, Enu_shift);
-                FillLatErrorBand_SingleUniverse(interaction.Enu_response, err_name, i, m_Enu * MeV_to_GeV, m_Enu_Truth * MeV_to_GeV, Enu_shift, 0.0);
-            }else{
-                FillLatErrorBand_SingleUniverse(interaction.Enu_mc_reco_bckg, err_name, i, m_Enu * MeV_to_GeV, Enu_shift);
-            }
+    for (int i = 0; i < n_lateral_universes; ++i){
 
-            //-----------------------------------------------------------------
-            // deltaInvMass 
-            //-----------------------------------------------------------------
-            FillLatErrorBand_SingleUniverse(interaction.deltaInvMass_mc_reco_all, err_name, i, deltaInvMass_reco, 0.0);
-            if (truth_isSignal){
-                FillLatErrorBand_SingleUniverse(interaction.deltaInvMass_mc_truth_signal, err_name, i, deltaInvMass_true, 0.0);
-                FillLatErrorBand_SingleUniverse(interaction.deltaInvMass_mc_reco_signal, err_name, i, deltaInvMass_reco, 0.0);
-                FillLatErrorBand_SingleUniverse(interaction.deltaInvMass_response, err_name, i, deltaInvMass_reco, deltaInvMass_true, 0.0, 0.0);
-            }else{
-                FillLatErrorBand_SingleUniverse(interaction.deltaInvMass_mc_reco_bckg, err_name, i, deltaInvMass_reco, 0.0);
-            }
-            //-----------------------------------------------------------------
-            // Delta_pi_theta 
-            //-----------------------------------------------------------------
-            FillLatErrorBand_SingleUniverse(interaction.Delta_pi_theta_mc_reco_all, err_name, i, Delta_pi_theta_reco, Delta_pi_theta_shift);
-            if (truth_isSignal){
-                FillLatErrorBand_SingleUniverse(interaction.Delta_pi_theta_mc_truth_signal, err_name, i, Delta_pi_theta_true, 0.0);
-                FillLatErrorBand_SingleUniverse(interaction.Delta_pi_theta_mc_reco_signal, err_name, i, Delta_pi_theta_reco, Delta_pi_theta_shift);
-                FillLatErrorBand_SingleUniverse(interaction.Delta_pi_theta_response, err_name, i, Delta_pi_theta_reco, Delta_pi_theta_true, Delta_pi_theta_shift, 0.0);
-            }else{
-                FillLatErrorBand_SingleUniverse(interaction.Delta_pi_theta_mc_reco_bckg, err_name, i, Delta_pi_theta_reco, Delta_pi_theta_shift);
-            }
-            //-----------------------------------------------------------------
-            // Delta_pi_phi 
-            //-----------------------------------------------------------------
-            FillLatErrorBand_SingleUniverse(interaction.Delta_pi_phi_mc_reco_all, err_name, i, Delta_pi_phi_reco, Delta_pi_phi_shift);
-            if (truth_isSignal){
-                FillLatErrorBand_SingleUniverse(interaction.Delta_pi_phi_mc_truth_signal, err_name, i, Delta_pi_phi_true, 0.0);
-                FillLatErrorBand_SingleUniverse(interaction.Delta_pi_phi_mc_reco_signal, err_name, i, Delta_pi_phi_reco, Delta_pi_phi_shift);
-                FillLatErrorBand_SingleUniverse(interaction.Delta_pi_phi_response, err_name, i, Delta_pi_phi_reco, Delta_pi_phi_true, Delta_pi_phi_shift, 0.0);
-            }else{
-                FillLatErrorBand_SingleUniverse(interaction.Delta_pi_phi_mc_reco_bckg, err_name, i, Delta_pi_phi_reco, Delta_pi_phi_shift);
-            }
+        if (kin.PassedCuts[i]){
+            double muon_P_shift = (kin.muon_P[i] - muon_P) * MeV_to_GeV;
+            double Enu_shift = (kin.Enu[i] - m_Enu) * MeV_to_GeV;
+            double QSq_shift = (kin.QSq[i] - m_QSq) * MeVSq_to_GeVSq;
+            double W_shift = (kin.W[i] - m_W) * MeV_to_GeV;
+            double Delta_pi_theta_shift = kin.Delta_pi_theta[i] - Delta_pi_theta_reco;
+            double Delta_pi_phi_shift = kin.Delta_pi_phi[i] - Delta_pi_phi_reco;
+
+            FillLatErrorBand_SingleUniverse(bands.muon_P, i, muon_P * MeV_to_GeV, truth_muon_P * MeV_to_GeV, muon_P_shift);
+            FillLatErrorBand_SingleUniverse(bands.muon_theta, i, reco_muon_theta * TMath::RadToDeg(), truth_muon_theta * TMath::RadToDeg(), 0.0);
+            FillLatErrorBand_SingleUniverse(bands.pi0_P, i, pi0_P * MeV_to_GeV, truth_pi0_P * MeV_to_GeV, 0.0);
+            FillLatErrorBand_SingleUniverse(bands.pi0_KE, i, pi0_KE * MeV_to_GeV, truth_pi0_KE * MeV_to_GeV, 0.0);
+            FillLatErrorBand_SingleUniverse(bands.pi0_theta, i, pi0_theta * TMath::RadToDeg(), truth_pi0_theta * TMath::RadToDeg(), 0.0);
+            FillLatErrorBand_SingleUniverse(bands.QSq, i, m_QSq * MeVSq_to_GeVSq, m_QSq_Truth * MeVSq_to_GeVSq, QSq_shift);
+            FillLatErrorBand_SingleUniverse(bands.W, i, m_W * MeV_to_GeV, m_W_Truth * MeV_to_GeV, W_shift);
+            FillLatErrorBand_SingleUniverse(bands.Enu, i, m_Enu * MeV_to_GeV, m_Enu_Truth * MeV_to_GeV, Enu_shift);
+
+            FillLatErrorBand_SingleUniverse(bands.deltaInvMass, i, deltaInvMass_reco, deltaInvMass_true, 0.0);
+            FillLatErrorBand_SingleUniverse(bands.Delta_pi_theta, i, Delta_pi_theta_reco, Delta_pi_theta_true, Delta_pi_theta_shift);
+            FillLatErrorBand_SingleUniverse(bands.Delta_pi_phi, i, Delta_pi_phi_reco, Delta_pi_phi_true, Delta_pi_phi_shift);
         }else{
             // Does not satisfy cuts
         }
@@ -1616,163 +1404,35 @@ void CCProtonPi0_Analyzer::FillLatErrorBand_MuonMomentum()
 void CCProtonPi0_Analyzer::FillLatErrorBand_MuonTheta()
 {
     std::string err_name = "MuonTheta";
+    LatErrorBand_XSecVars& bands = GetLatErrorBand_XSecVars(err_name);
     double reco_muon_theta = GetCorrectedMuonTheta();
 
-    double Delta_pi_theta_i;
-    double Delta_pi_phi_i;
+    // Shifted Kinematics for All Universes
+    LatUniverseKinematics& kin = latUniverseKinematics;
+    Calc_LatUniverseKinematics_MuonTheta(kin, &muon_theta_random_shifts[0], reco_muon_theta);
 
     for (int i = 0; i < n_lateral_universes; ++i){
 
-        double muon_theta_i = (1.0 + muon_theta_random_shifts[i]) * reco_muon_theta;
-        double QSq_i = Calc_QSq(m_Enu, muon_E, muon_P, muon_theta_i); // Use actual neutrino energy and shifted muon theta
-        double WSq_i = Calc_WSq(m_Enu, QSq_i, muon_E); // Use shifted QSq 
-        double W_i = (WSq_i > 0) ? sqrt(WSq_i) : -1; 
-
-        if (nProtonCandidates > 0 ){
-            TLorentzVector proton_4P_i(proton_px, proton_py, proton_pz, proton_E);
-            TLorentzVector pi0_4P_i(pi0_px, pi0_py, pi0_pz, pi0_E);
-            TLorentzVector muon_4P_i = GetThetaShiftedMuon4P(muon_theta_i);
-            TLorentzVector beam_4P_i = Get_Neutrino_4P(m_Enu);
-            std::vector<double> pol_angles = Calc_Delta_pi_angles(proton_4P_i, pi0_4P_i, muon_4P_i, beam_4P_i);
-            Delta_pi_theta_i = pol_angles[0];
-            Delta_pi_phi_i = pol_angles[1];
-        }else{
-            Delta_pi_theta_i = Delta_pi_theta_reco;
-            Delta_pi_phi_i = Delta_pi_phi_reco;
-        }
-
-        bool PassedCuts =  IsWInRange(W_i);
+        if (kin.PassedCuts[i]){
 
-        if (PassedCuts){
-
-            double muon_theta_shift = (muon_theta_i - reco_muon_theta) * TMath::RadToDeg();
-            double QSq_shift = (QSq_i - m_QSq) * MeVSq_to_GeVSq;
-            double W_shift = (W_i - m_W) * MeV_to_GeV;
-            double Delta_pi_theta_shift = Delta_pi_theta_i - Delta_pi_theta_reco;
-            double Delta_pi_phi_shift = Delta_pi_phi_i - Delta_pi_phi_reco;
+            double muon_theta_shift = (kin.muon_theta[i] - reco_muon_theta) * TMath::RadToDeg();
+            double QSq_shift = (kin.QSq[i] - m_QSq) * MeVSq_to_GeVSq;
+            double W_shift = (kin.W[i] - m_W) * MeV_to_GeV;
+            double Delta_pi_theta_shift = kin.Delta_pi_theta[i] - Delta_pi_theta_reco;
+            double Delta_pi_phi_shift = kin.Delta_pi_phi[i] - Delta_pi_phi_reco;
             
-            //-----------------------------------------------------------------
-            // muon_P
-            //-----------------------------------------------------------------
-            FillLatErrorBand_SingleUniverse(muon.muon_P_mc_reco_all, err_name, i, muon_P * MeV_to_GeV, 0.0);
-            if (truth_isSignal){
-                FillLatErrorBand_SingleUniverse(muon.muon_P_mc_truth_signal, err_name, i, truth_muon_P * MeV_to_GeV, 0.0);
-                FillLatErrorBand_SingleUniverse(muon.muon_P_mc_reco_signal, err_name, i, muon_P * MeV_to_GeV, 0.0);
-                FillLatErrorBand_SingleUniverse(muon.muon_P_response, err_name, i, muon_P * MeV_to_GeV, truth_muon_P * MeV_to_GeV, 0.0, 0.0);
-            }else{
-                FillLatErrorBand_SingleUniverse(muon.muon_P_mc_reco_bckg, err_name, i, muon_P * MeV_to_GeV, 0.0);
-            }
-            //-----------------------------------------------------------------
-            // muon_theta
-            //-----------------------------------------------------------------
-            FillLatErrorBand_SingleUniverse(muon.muon_theta_mc_reco_all, err_name, i, reco_muon_theta * TMath::RadToDeg(), muon_theta_shift);
-            if (truth_isSignal){
-                FillLatErrorBand_SingleUniverse(muon.muon_theta_mc_truth_signal, err_name, i, truth_muon_theta * TMath::RadToDeg(), 0.0);
-                FillLatErrorBand_SingleUniverse(muon.muon_theta_mc_reco_signal, err_name, i, reco_muon_theta * TMath::RadToDeg(), muon_theta_shift);
-                FillLatErrorBand_SingleUniverse(muon.muon_theta_response, err_name, i, reco_muon_theta * TMath::RadToDeg(), truth_muon_theta * TMath::RadToDeg(), muon_theta_shift, 0.0);
-            }else{
-                FillLatErrorBand_SingleUniverse(muon.muon_theta_mc_reco_bckg, err_name, i, reco_muon_theta * TMath::RadToDeg(), muon_theta_shift);
-            }
-            //-----------------------------------------------------------------
-            // pi0_P
-            //-----------------------------------------------------------------
-            FillLatErrorBand_SingleUniverse(pi0.pi0_P_mc_reco_all, err_name, i, pi0_P * MeV_to_GeV, 0.0);
-            if (truth_isSignal){
-                FillLatErrorBand_SingleUniverse(pi0.pi0_P_mc_truth_signal, err_name, i, truth_pi0_P * MeV_to_GeV, 0.0);
-                FillLatErrorBand_SingleUniverse(pi0.pi0_P_mc_reco_signal, err_name, i, pi0_P * MeV_to_GeV, 0.0);
-                FillLatErrorBand_SingleUniverse(pi0.pi0_P_response, err_name, i, pi0_P * MeV_to_GeV, truth_pi0_P * MeV_to_GeV, 0.0, 0.0);
-            }else{
-                FillLatErrorBand_SingleUniverse(pi0.pi0_P_mc_reco_bckg, err_name, i, pi0_P * MeV_to_GeV, 0.0);
-            }
-            //-----------------------------------------------------------------
-            // pi0_KE
-            //-----------------------------------------------------------------
-            FillLatErrorBand_SingleUniverse(pi0.pi0_KE_mc_reco_all, err_name, i, pi0_KE * MeV_to_GeV, 0.0);
-            if (truth_isSignal){
-                FillLatErrorBand_SingleUniverse(pi0.pi0_KE_mc_truth_signal, err_name, i, truth_pi0_KE * MeV_to_GeV, 0.0);
-                FillLatErrorBand_SingleUniverse(pi0.pi0_KE_mc_reco_signal, err_name, i, pi0_KE * MeV_to_GeV, 0.0);
-                FillLatErrorBand_SingleUniverse(pi0.pi0_KE_response, err_name, i, pi0_KE * MeV_to_GeV, truth_pi0_KE * MeV_to_GeV, 0.0, 0.0);
-            }else{
-                FillLatErrorBand_SingleUniverse(pi0.pi0_KE_mc_reco_bckg, err_name, i, pi0_KE * MeV_to_GeV, 0.0);
-            }
-            //-----------------------------------------------------------------
-            // pi0_theta
-            //-----------------------------------------------------------------
-            FillLatErrorBand_SingleUniverse(pi0.pi0_theta_mc_reco_all, err_name, i, pi0_theta * TMath::RadToDeg(), 0.0);
-            if (truth_isSignal){
-                FillLatErrorBand_SingleUniverse(pi0.pi0_theta_mc_truth_signal, err_name, i, truth_pi0_theta * TMath::RadToDeg(), 0.0);
-                FillLatErrorBand_SingleUniverse(pi0.pi0_theta_mc_reco_signal, err_name, i, pi0_theta * TMath::RadToDeg(), 0.0);
-                FillLatErrorBand_SingleUniverse(pi0.pi0_theta_response, err_name, i, pi0_theta * TMath::RadToDeg(), truth_pi0_theta * TMath::RadToDeg(), 0.0, 0.0);
-            }else{
-                FillLatErrorBand_SingleUniverse(pi0.pi0_theta_mc_reco_bckg, err_name, i, pi0_theta * TMath::RadToDeg(), 0.0);
-            }
-            //-----------------------------------------------------------------
-            // QSq
-            //-----------------------------------------------------------------
-            FillLatErrorBand_SingleUniverse(interaction.QSq_mc_reco_all, err_name, i, m_QSq * MeVSq_to_GeVSq, QSq_shift);
-            if (truth_isSignal){
-                FillLatErrorBand_SingleUniverse(interaction.QSq_mc_truth_signal, err_name, i, m_QSq_Truth * MeVSq_to_GeVSq, 0.0);
-                FillLatErrorBand_SingleUniverse(interaction.QSq_mc_reco_signal, err_name, i, m_QSq * MeVSq_to_GeVSq, QSq_shift);
-                FillLatErrorBand_SingleUniverse(interaction.QSq_response, err_name, i, m_QSq * MeVSq_to_GeVSq, m_QSq_Truth * MeVSq_to_GeVSq, QSq_shift, 0.0);
-            }else{
-                FillLatErrorBand_SingleUniverse(interaction.QSq_mc_reco_bckg, err_name, i, m_QSq * MeVSq_to_GeVSq, QSq_shift);
-            }
-            //-----------------------------------------------------------------
-            // W
-            //-----------------------------------------------------------------
-            FillLatErrorBand_SingleUniverse(interaction.W_mc_reco_all, err_name, i, m_W * MeV_to_GeV, W_shift);
-            if (truth_isSignal){
-                FillLatErrorBand_SingleUniverse(interaction.W_mc_truth_signal, err_name, i, m_W_Truth * MeV_to_GeV, 0.0);
-                FillLatErrorBand_SingleUniverse(interaction.W_mc_reco_signal, err_name, i, m_W * MeV_to_GeV, W_shift);
-                FillLatErrorBand_SingleUniverse(interaction.W_response, err_name, i, m_W * MeV_to_GeV, m_W_Truth * MeV_to_GeV, W_shift, 0.0);
-            }else{
-                FillLatErrorBand_SingleUniverse(interaction.W_mc_reco_bckg, err_name, i, m_W * MeV_to_GeV, W_shift);
-            }
-            //-----------------------------------------------------------------
-            // Enu
-            //-----------------------------------------------------------------
-            FillLatErrorBand_SingleUniverse(interaction.Enu_mc_reco_all, err_name, i, m_Enu * MeV_to_GeV, 0.0);
-            if (truth_isSignal){
-                FillLatErrorBand_SingleUniverse(interaction.Enu_mc_truth_signal, err_name, i, m_Enu_Truth * MeV_to_GeV, 0.0);
-                FillLatErrorBand_SingleUniverse(interaction.Enu_mc_reco_signal, err_name, i, m_Enu * MeV_to_GeV, 0.0);
-                FillLatErrorBand_SingleUniverse(interaction.Enu_response, err_name, i, m_Enu * MeV_to_GeV, m_Enu_Truth * MeV_to_GeV, 0.0, 0.0);
-            }else{
-                FillLatErrorBand_SingleUniverse(interaction.Enu_mc_reco_bckg, err_name, i, m_Enu * MeV_to_GeV, 0.0);
-            }
-
-            //-----------------------------------------------------------------
-            // deltaInvMass 
-            //-----------------------------------------------------------------
-            FillLatErrorBand_SingleUniverse(interaction.deltaInvMass_mc_reco_all, err_name, i, deltaInvMass_reco, 0.0);
-            if (truth_isSignal){
-                FillLatErrorBand_SingleUniverse(interaction.deltaInvMass_mc_truth_signal, err_name, i, deltaInvMass_true, 0.0);
-                FillLatErrorBand_SingleUniverse(interaction.deltaInvMass_mc_reco_signal, err_name, i, deltaInvMass_reco, 0.0);
-                FillLatErrorBand_SingleUniverse(interaction.deltaInvMass_response, err_name, i, deltaInvMass_reco, deltaInvMass_true, 0.0, 0.0);
-            }else{
-                FillLatErrorBand_SingleUniverse(interaction.deltaInvMass_mc_reco_bckg, err_name, i, deltaInvMass_reco, 0.0);
-            }
-            //-----------------------------------------------------------------
-            // Delta_pi_theta 
-            //-----------------------------------------------------------------
-            FillLatErrorBand_SingleUniverse(interaction.Delta_pi_theta_mc_reco_all, err_name, i, Delta_pi_theta_reco, Delta_pi_theta_shift);
-            if (truth_isSignal){
-                FillLatErrorBand_SingleUniverse(interaction.Delta_pi_theta_mc_truth_signal, err_name, i, Delta_pi_theta_true, 0.0);
-                FillLatErrorBand_SingleUniverse(interaction.Delta_pi_theta_mc_reco_signal, err_name, i, Delta_pi_theta_reco, Delta_pi_theta_shift);
-                FillLatErrorBand_SingleUniverse(interaction.Delta_pi_theta_response, err_name, i, Delta_pi_theta_reco, Delta_pi_theta_true, Delta_pi_theta_shift, 0.0);
-            }else{
-                FillLatErrorBand_SingleUniverse(interaction.Delta_pi_theta_mc_reco_bckg, err_name, i, Delta_pi_theta_reco, Delta_pi_theta_shift);
-            }
-            //-----------------------------------------------------------------
-            // Delta_pi_phi 
-            //-----------------------------------------------------------------
-            FillLatErrorBand_SingleUniverse(interaction.Delta_pi_phi_mc_reco_all, err_name, i, Delta_pi_phi_reco, Delta_pi_phi_shift);
-            if (truth_isSignal){
-                FillLatErrorBand_SingleUniverse(interaction.Delta_pi_phi_mc_truth_signal, err_name, i, Delta_pi_phi_true, 0.0);
-                FillLatErrorBand_SingleUniverse(interaction.Delta_pi_phi_mc_reco_signal, err_name, i, Delta_pi_phi_reco, Delta_pi_phi_shift);
-                FillLatErrorBand_SingleUniverse(interaction.Delta_pi_phi_response, err_name, i, Delta_pi_phi_reco, Delta_pi_phi_true, Delta_pi_phi_shift, 0.0);
-            }else{
-                FillLatErrorBand_SingleUniverse(interaction.Delta_pi_phi_mc_reco_bckg, err_name, i, Delta_pi_phi_reco, Delta_pi_phi_shift);
-            }
+            FillLatErrorBand_SingleUniverse(bands.muon_P, i, muon_P * MeV_to_GeV, truth_muon_P * MeV_to_GeV, 0.0);
+            FillLatErrorBand_SingleUniverse(bands.muon_theta, i, reco_muon_theta * TMath::RadToDeg(), truth_muon_theta * TMath::RadToDeg(), muon_theta_shift);
+            FillLatErrorBand_SingleUniverse(bands.pi0_P, i, pi0_P * MeV_to_GeV, truth_pi0_P * MeV_to_GeV, 0.0);
+            FillLatErrorBand_SingleUniverse(bands.pi0_KE, i, pi0_KE * MeV_to_GeV, truth_pi0_KE * MeV_to_GeV, 0.0);
+            FillLatErrorBand_SingleUniverse(bands.pi0_theta, i, pi0_theta * TMath::RadToDeg(), truth_pi0_theta * TMath::RadToDeg(), 0.0);
+            FillLatErrorBand_SingleUniverse(bands.QSq, i, m_QSq * MeVSq_to_GeVSq, m_QSq_Truth * MeVSq_to_GeVSq, QSq_shift);
+            FillLatErrorBand_SingleUniverse(bands.W, i, m_W * MeV_to_GeV, m_W_Truth * MeV_to_GeV, W_shift);
+            FillLatErrorBand_SingleUniverse(bands.Enu, i, m_Enu * MeV_to_GeV, m_Enu_Truth * MeV_to_GeV, 0.0);
+
+            FillLatErrorBand_SingleUniverse(bands.deltaInvMass, i, deltaInvMass_reco, deltaInvMass_true, 0.0);
+            FillLatErrorBand_SingleUniverse(bands.Delta_pi_theta, i, Delta_pi_theta_reco, Delta_pi_theta_true, Delta_pi_theta_shift);
+            FillLatErrorBand_SingleUniverse(bands.Delta_pi_phi, i, Delta_pi_phi_reco, Delta_pi_phi_true, Delta_pi_phi_shift);
         }else{
             // Did NOT passed Cuts!
         }
@@ -1784,6 +1444,7 @@ void CCProtonPi0_Analyzer::FillLatErrorBand_ProtonEnergy_invMass(std::string err
     bool PassedCuts;
     double reco_muon_theta = GetCorrectedMuonTheta();
 
+    LatErrorBand_InvMass& bands = GetLatErrorBand_InvMass(err_name);
     for (int i = 0; i < 2; ++i){
         if (nProtonCandidates > 0){
             std::vector<double> proton_energy_shifts = GetProtonEnergyShifts(err_name, i);
@@ -1811,12 +1472,7 @@ void CCProtonPi0_Analyzer::FillLatErrorBand_ProtonEnergy_invMass(std::string err
         }
 
         if (PassedCuts){
-            FillLatErrorBand_SingleUniverse(cutList.invMass_mc_reco_all, err_name, i, pi0_invMass, 0.0);
-            if (truth_isSignal){
-                FillLatErrorBand_SingleUniverse(cutList.invMass_mc_reco_signal, err_name, i, pi0_invMass, 0.0);
-            }else{
-                FillLatErrorBand_SingleUniverse(cutList.invMass_mc_reco_bckg, err_name, i, pi0_invMass, 0.0);
-            }
+            FillLatErrorBand_SingleUniverse(bands, i, pi0_invMass, 0.0);
         }else{
             // Did Not passed cuts
         }
@@ -1833,6 +1489,7 @@ void CCProtonPi0_Analyzer::FillLatErrorBand_ProtonEnergy_Birks_invMass()
     Calc_Birks_random_shifts();
     double reco_muon_theta = GetCorrectedMuonTheta();
 
+    LatErrorBand_InvMass& bands = GetLatErrorBand_InvMass(err_name);
     for (int i = 0; i < n_lateral_universes; ++i){
 
         if (nProtonCandidates > 0){
@@ -1859,12 +1516,7 @@ void CCProtonPi0_Analyzer::FillLatErrorBand_ProtonEnergy_Birks_invMass()
         }
 
         if (PassedCuts){
-            FillLatErrorBand_SingleUniverse(cutList.invMass_mc_reco_all, err_name, i, pi0_invMass, 0.0);
-            if (truth_isSignal){
-                FillLatErrorBand_SingleUniverse(cutList.invMass_mc_reco_signal, err_name, i, pi0_invMass, 0.0);
-            }else{
-                FillLatErrorBand_SingleUniverse(cutList.invMass_mc_reco_bckg, err_name, i, pi0_invMass, 0.0);
-            }
+            FillLatErrorBand_SingleUniverse(bands, i, pi0_invMass, 0.0);
         }else{
             // Did Not passed cuts
         }
@@ -1876,6 +1528,7 @@ void CCProtonPi0_Analyzer::FillLatErrorBand_EM_EnergyScale_invMass()
     std::string err_name = "EM_EnergyScale";
 
     double reco_muon_theta = GetCorrectedMuonTheta();
+    LatErrorBand_InvMass& bands = GetLatErrorBand_InvMass(err_name);
     for (int i = 0; i < n_lateral_universes; ++i){
 
         double gamma1_E_i = (1.0 + em_energy_random_shifts[i]) * gamma1_E;
@@ -1892,12 +1545,7 @@ void CCProtonPi0_Analyzer::FillLatErrorBand_EM_EnergyScale_invMass()
 
         if (PassedCuts){
             double pi0_invMass_shift = pi0_invMass_i - pi0_invMass;
-            FillLatErrorBand_SingleUniverse(cutList.invMass_mc_reco_all, err_name, i, pi0_invMass, pi0_invMass_shift);
-            if (truth_isSignal){
-                FillLatErrorBand_SingleUniverse(cutList.invMass_mc_reco_signal, err_name, i, pi0_invMass, pi0_invMass_shift);
-            }else{
-                FillLatErrorBand_SingleUniverse(cutList.invMass_mc_reco_bckg, err_name, i, pi0_invMass, pi0_invMass_shift);
-            }
+            FillLatErrorBand_SingleUniverse(bands, i, pi0_invMass, pi0_invMass_shift);
         }else{
             // Does not satisfy cuts
         }
@@ -1912,6 +1560,7 @@ void CCProtonPi0_Analyzer::FillLatErrorBand_MuonMomentum_invMass()
     Calc_muonP_random_shifts();
     double reco_muon_theta = GetCorrectedMuonTheta();
 
+    LatErrorBand_InvMass& bands = GetLatErrorBand_InvMass(err_name);
     for (int i = 0; i < n_lateral_universes; ++i){
 
         // Muon Variables
@@ -1925,12 +1574,7 @@ void CCProtonPi0_Analyzer::FillLatErrorBand_MuonMomentum_invMass()
         bool PassedCuts = IsEnuInRange(Enu_i) && IsWInRange(W_i);
 
         if (PassedCuts){
-            FillLatErrorBand_SingleUniverse(cutList.invMass_mc_reco_all, err_name, i, pi0_invMass, 0.0);
-            if (truth_isSignal){
-                FillLatErrorBand_SingleUniverse(cutList.invMass_mc_reco_signal, err_name, i, pi0_invMass, 0.0);
-            }else{
-                FillLatErrorBand_SingleUniverse(cutList.invMass_mc_reco_bckg, err_name, i, pi0_invMass, 0.0);
-            }
+            FillLatErrorBand_SingleUniverse(bands, i, pi0_invMass, 0.0);
         }else{
             // Does not satisfy cuts
         }
@@ -1942,6 +1586,7 @@ void CCProtonPi0_Analyzer::FillLatErrorBand_MuonTheta_invMass()
     std::string err_name = "MuonTheta";
     double reco_muon_theta = GetCorrectedMuonTheta();
 
+    LatErrorBand_InvMass& bands = GetLatErrorBand_InvMass(err_name);
     for (int i = 0; i < n_lateral_universes; ++i){
 
         double muon_theta_i = (1.0 + muon_theta_random_shifts[i]) * reco_muon_theta;
@@ -1952,12 +1597,7 @@ void CCProtonPi0_Analyzer::FillLatErrorBand_MuonTheta_invMass()
         bool PassedCuts = IsWInRange(W_i);
 
         if (PassedCuts){
-            FillLatErrorBand_SingleUniverse(cutList.invMass_mc_reco_all, err_name, i, pi0_invMass, 0.0);
-            if (truth_isSignal){
-                FillLatErrorBand_SingleUniverse(cutList.invMass_mc_reco_signal, err_name, i, pi0_invMass, 0.0);
-            }else{
-                FillLatErrorBand_SingleUniverse(cutList.invMass_mc_reco_bckg, err_name, i, pi0_invMass, 0.0);
-            }
+            FillLatErrorBand_SingleUniverse(bands, i, pi0_invMass, 0.0);
         }else{
             // Not satisfied cuts
         }
@@ -1970,6 +1610,7 @@ void CCProtonPi0_Analyzer::FillLatErrorBand_ProtonEnergy_SideBand_invMass(std::s
     bool PassedCuts;
     double reco_muon_theta = GetCorrectedMuonTheta();
 
+    LatErrorBand_SideBand& bands = GetLatErrorBand_SideBand(err_name);
     for (int i = 0; i < 2; ++i){
         if (nProtonCandidates > 0){
             std::vector<double> proton_energy_shifts = GetProtonEnergyShifts(err_name, i);
@@ -1992,19 +1633,8 @@ void CCProtonPi0_Analyzer::FillLatErrorBand_ProtonEnergy_SideBand_invMass(std::s
         }
 
         if (PassedCuts){
-            // Fill All Events on [0]
-            FillLatErrorBand_SingleUniverse(cutList.hCut_pi0invMass[0], err_name, i, pi0_invMass, 0.0);
-            if (truth_isSignal){
-                // Fill Signal Events on [1]
-                FillLatErrorBand_SingleUniverse(cutList.hCut_pi0invMass[1], err_name, i, pi0_invMass, 0.0);
-            }else{
-                // Fill All Background on [2]
-                FillLatErrorBand_SingleUniverse(cutList.hCut_pi0invMass[2], err_name, i, pi0_invMass, 0.0);
-
-                // Fill Background Type on [ind]
-                int ind = GetBackgroundTypeInd();
-                FillLatErrorBand_SingleUniverse(cutList.hCut_pi0invMass[ind], err_name, i, pi0_invMass, 0.0);
-            }
+            // Fill All Events on [0], Signal on [1], Background on [2] and Background Type on [ind]
+            FillLatErrorBand_SingleUniverse(bands, i, pi0_invMass, 0.0);
         }
     }
 }
@@ -2019,6 +1649,7 @@ void CCProtonPi0_Analyzer::FillLatErrorBand_ProtonEnergy_Birks_SideBand_invMass(
     // For each event Birks_random_shifts is different
     Calc_Birks_random_shifts();
 
+    LatErrorBand_SideBand& bands = GetLatErrorBand_SideBand(err_name);
     for (int i = 0; i < n_lateral_universes; ++i){
 
         if (nProtonCandidates > 0){
@@ -2040,19 +1671,8 @@ void CCProtonPi0_Analyzer::FillLatErrorBand_ProtonEnergy_Birks_SideBand_invMass(
         }
 
         if (PassedCuts){
-            // Fill All Events on [0]
-            FillLatErrorBand_SingleUniverse(cutList.hCut_pi0invMass[0], err_name, i, pi0_invMass, 0.0);
-            if (truth_isSignal){
-                // Fill Signal Events on [1]
-                FillLatErrorBand_SingleUniverse(cutList.hCut_pi0invMass[1], err_name, i, pi0_invMass, 0.0);
-            }else{
-                // Fill All Background on [2]
-                FillLatErrorBand_SingleUniverse(cutList.hCut_pi0invMass[2], err_name, i, pi0_invMass, 0.0);
-
-                // Fill Background Type on [ind]
-                int ind = GetBackgroundTypeInd();
-                FillLatErrorBand_SingleUniverse(cutList.hCut_pi0invMass[ind], err_name, i, pi0_invMass, 0.0);
-            }
+            // Fill All Events on [0], Signal on [1], Background on [2] and Background Type on [ind]
+            FillLatErrorBand_SingleUniverse(bands, i, pi0_invMass, 0.0);
         }
     }
 }
@@ -2062,6 +1682,7 @@ void CCProtonPi0_Analyzer::FillLatErrorBand_EM_EnergyScale_SideBand_invMass()
     std::string err_name = "EM_EnergyScale";
     double reco_muon_theta = GetCorrectedMuonTheta();
 
+    LatErrorBand_SideBand& bands = GetLatErrorBand_SideBand(err_name);
     for (int i = 0; i < n_lateral_universes; ++i){
 
         // EM Energy Dependent Variables
@@ -2080,19 +1701,8 @@ void CCProtonPi0_Analyzer::FillLatErrorBand_EM_EnergyScale_SideBand_invMass()
         if (PassedCuts){
             double pi0_invMass_shift = pi0_invMass_i - pi0_invMass;
 
-            // Fill All Events on [0]
-            FillLatErrorBand_SingleUniverse(cutList.hCut_pi0invMass[0], err_name, i, pi0_invMass, pi0_invMass_shift);
-            if (truth_isSignal){
-                // Fill All Signal on [1]
-                FillLatErrorBand_SingleUniverse(cutList.hCut_pi0invMass[1], err_name, i, pi0_invMass, pi0_invMass_shift);
-            }else{
-                // Fill All Background on [2]
-                FillLatErrorBand_SingleUniverse(cutList.hCut_pi0invMass[2], err_name, i, pi0_invMass, pi0_invMass_shift);
-
-                // Fill Background Type on [ind]
-                int ind = GetBackgroundTypeInd();
-                FillLatErrorBand_SingleUniverse(cutList.hCut_pi0invMass[ind], err_name, i, pi0_invMass, pi0_invMass_shift);
-            }
+            // Fill All Events on [0], Signal on [1], Background on [2] and Background Type on [ind]
+            FillLatErrorBand_SingleUniverse(bands, i, pi0_invMass, pi0_invMass_shift);
         }
     }
 }
@@ -2105,6 +1715,7 @@ void CCProtonPi0_Analyzer::FillLatErrorBand_MuonMomentum_SideBand_invMass()
     Calc_muonP_random_shifts();
     double reco_muon_theta = GetCorrectedMuonTheta();
 
+    LatErrorBand_SideBand& bands = GetLatErrorBand_SideBand(err_name);
     for (int i = 0; i < n_lateral_universes; ++i){
 
         double muon_P_i = (1.0 + muonP_random_shifts[i]) * muon_P;
@@ -2117,19 +1728,8 @@ void CCProtonPi0_Analyzer::FillLatErrorBand_MuonMomentum_SideBand_invMass()
         bool PassedCuts = IsEnuInRange(Enu_i) && IsWInRange(W_i);
 
         if (PassedCuts){
-            // Fill All Events on [0]
-            FillLatErrorBand_SingleUniverse(cutList.hCut_pi0invMass[0], err_name, i, pi0_invMass, 0.0);
-            if (truth_isSignal){
-                // Fill Signal Events on [1]
-                FillLatErrorBand_SingleUniverse(cutList.hCut_pi0invMass[1], err_name, i, pi0_invMass, 0.0);
-            }else{
-                // Fill All Background on [2]
-                FillLatErrorBand_SingleUniverse(cutList.hCut_pi0invMass[2], err_name, i, pi0_invMass, 0.0);
-
-                // Fill Background Type on [ind]
-                int ind = GetBackgroundTypeInd();
-                FillLatErrorBand_SingleUniverse(cutList.hCut_pi0invMass[ind], err_name, i, pi0_invMass, 0.0);
-            }
+            // Fill All Events on [0], Signal on [1], Background on [2] and Background Type on [ind]
+            FillLatErrorBand_SingleUniverse(bands, i, pi0_invMass, 0.0);
         }
     }
 }
@@ -2140,6 +1740,7 @@ void CCProtonPi0_Analyzer::FillLatErrorBand_MuonTheta_SideBand_invMass()
 
     double reco_muon_theta = GetCorrectedMuonTheta();
 
+    LatErrorBand_SideBand& bands = GetLatErrorBand_SideBand(err_name);
     for (int i = 0; i < n_lateral_universes; ++i){
 
         double muon_theta_i = (1.0 + muon_theta_random_shifts[i]) * reco_muon_theta;
@@ -2150,32 +1751,188 @@ void CCProtonPi0_Analyzer::FillLatErrorBand_MuonTheta_SideBand_invMass()
         bool PassedCuts = IsWInRange(W_i);
 
         if (PassedCuts){
-            // Fill All Events on [0]
-            FillLatErrorBand_SingleUniverse(cutList.hCut_pi0invMass[0], err_name, i, pi0_invMass, 0.0);
-            if (truth_isSignal){
-                // Fill Signal Events on [1]
-                FillLatErrorBand_SingleUniverse(cutList.hCut_pi0invMass[1], err_name, i, pi0_invMass, 0.0);
-            }else{
-                // Fill All Background on [2]
-                FillLatErrorBand_SingleUniverse(cutList.hCut_pi0invMass[2], err_name, i, pi0_invMass, 0.0);
-
-                // Fill Background Type on [ind]
-                int ind = GetBackgroundTypeInd();
-                FillLatErrorBand_SingleUniverse(cutList.hCut_pi0invMass[ind], err_name, i, pi0_invMass, 0.0);
-            }
+            // Fill All Events on [0], Signal on [1], Background on [2] and Background Type on [ind]
+            FillLatErrorBand_SingleUniverse(bands, i, pi0_invMass, 0.0);
         }else{
             // Does NOT satisfy cuts
         }
     }
 }
 
-void CCProtonPi0_Analyzer::FillLatErrorBand_SingleUniverse(MnvH1D* hist, std::string err_name, int unv, double var, double shift)
+void CCProtonPi0_Analyzer::initLatErrorBandHandles()
+{
+    const std::string err_names[] = {"EM_EnergyScale", "MuonMomentum", "MuonTheta", 
+                                     "ProtonEnergy_MassModel", "ProtonEnergy_MEU", "ProtonEnergy_BetheBloch", 
+                                     "ProtonEnergy_Birks"};
+    const int nErrNames = sizeof(err_names) / sizeof(err_names[0]);
+
+    for (int i = 0; i < nErrNames; ++i){
+        const std::string& err_name = err_names[i];
+        LatErrorBand_XSecVars& bands = latErrorBands_XSec[err_name];
+
+        initLatErrorBand_XSecVar(bands.pi0_P, err_name, pi0.pi0_P_mc_reco_all, pi0.pi0_P_mc_truth_signal, pi0.pi0_P_mc_reco_signal, pi0.pi0_P_mc_reco_bckg, pi0.pi0_P_response);
+        initLatErrorBand_XSecVar(bands.pi0_KE, err_name, pi0.pi0_KE_mc_reco_all, pi0.pi0_KE_mc_truth_signal, pi0.pi0_KE_mc_reco_signal, pi0.pi0_KE_mc_reco_bckg, pi0.pi0_KE_response);
+        initLatErrorBand_XSecVar(bands.pi0_theta, err_name, pi0.pi0_theta_mc_reco_all, pi0.pi0_theta_mc_truth_signal, pi0.pi0_theta_mc_reco_signal, pi0.pi0_theta_mc_reco_bckg, pi0.pi0_theta_response);
+        initLatErrorBand_XSecVar(bands.muon_P, err_name, muon.muon_P_mc_reco_all, muon.muon_P_mc_truth_signal, muon.muon_P_mc_reco_signal, muon.muon_P_mc_reco_bckg, muon.muon_P_response);
+        initLatErrorBand_XSecVar(bands.muon_theta, err_name, muon.muon_theta_mc_reco_all, muon.muon_theta_mc_truth_signal, muon.muon_theta_mc_reco_signal, muon.muon_theta_mc_reco_bckg, muon.muon_theta_response);
+        initLatErrorBand_XSecVar(bands.QSq, err_name, interaction.QSq_mc_reco_all, interaction.QSq_mc_truth_signal, interaction.QSq_mc_reco_signal, interaction.QSq_mc_reco_bckg, interaction.QSq_response);
+        initLatErrorBand_XSecVar(bands.W, err_name, interaction.W_mc_reco_all, interaction.W_mc_truth_signal, interaction.W_mc_reco_signal, interaction.W_mc_reco_bckg, interaction.W_response);
+        initLatErrorBand_XSecVar(bands.Enu, err_name, interaction.Enu_mc_reco_all, interaction.Enu_mc_truth_signal, interaction.Enu_mc_reco_signal, interaction.Enu_mc_reco_bckg, interaction.Enu_response);
+        initLatErrorBand_XSecVar(bands.deltaInvMass, err_name, interaction.deltaInvMass_mc_reco_all, interaction.deltaInvMass_mc_truth_signal, interaction.deltaInvMass_mc_reco_signal, interaction.deltaInvMass_mc_reco_bckg, interaction.deltaInvMass_response);
+        initLatErrorBand_XSecVar(bands.Delta_pi_theta, err_name, interaction.Delta_pi_theta_mc_reco_all, interaction.Delta_pi_theta_mc_truth_signal, interaction.Delta_pi_theta_mc_reco_signal, interaction.Delta_pi_theta_mc_reco_bckg, interaction.Delta_pi_theta_response);
+        initLatErrorBand_XSecVar(bands.Delta_pi_phi, err_name, interaction.Delta_pi_phi_mc_reco_all, interaction.Delta_pi_phi_mc_truth_signal, interaction.Delta_pi_phi_mc_reco_signal, interaction.Delta_pi_phi_mc_reco_bckg, interaction.Delta_pi_phi_response);
+    }
+}
+
+void CCProtonPi0_Analyzer::initLatErrorBandHandles_invMass()
 {
+    const std::string err_names[] = {"EM_EnergyScale", "MuonMomentum", "MuonTheta", 
+                                     "ProtonEnergy_MassModel", "ProtonEnergy_MEU", "ProtonEnergy_BetheBloch", 
+                                     "ProtonEnergy_Birks"};
+    const int nErrNames = sizeof(err_names) / sizeof(err_names[0]);
+
+    for (int i = 0; i < nErrNames; ++i){
+        const std::string& err_name = err_names[i];
+
+        LatErrorBand_InvMass& bands = latErrorBands_invMass[err_name];
+        bands.mc_reco_all = GetLatErrorBandHandle(cutList.invMass_mc_reco_all, err_name);
+        bands.mc_reco_signal = GetLatErrorBandHandle(cutList.invMass_mc_reco_signal, err_name);
+        bands.mc_reco_bckg = GetLatErrorBandHandle(cutList.invMass_mc_reco_bckg, err_name);
+
+        LatErrorBand_SideBand& sideBands = latErrorBands_SideBand[err_name];
+        sideBands.clear();
+        for (unsigned int j = 0; j < cutList.hCut_pi0invMass.size(); ++j){
+            sideBands.push_back(GetLatErrorBandHandle(cutList.hCut_pi0invMass[j], err_name));
+        }
+    }
+}
+
+void CCProtonPi0_Analyzer::initLatErrorBand_XSecVar(LatErrorBand_XSecVar& band, std::string err_name, MnvH1D* mc_reco_all, MnvH1D* mc_truth_signal, MnvH1D* mc_reco_signal, MnvH1D* mc_reco_bckg, MnvH2D* response)
+{
+    band.mc_reco_all = GetLatErrorBandHandle(mc_reco_all, err_name);
+    band.mc_truth_signal = GetLatErrorBandHandle(mc_truth_signal, err_name);
+    band.mc_reco_signal = GetLatErrorBandHandle(mc_reco_signal, err_name);
+    band.mc_reco_bckg = GetLatErrorBandHandle(mc_reco_bckg, err_name);
+    band.response = GetLatErrorBandHandle(response, err_name);
+}
+
+LatErrorBandHandle* CCProtonPi0_Analyzer::GetLatErrorBandHandle(MnvH1D* hist, std::string err_name)
+{
+    std::pair<MnvH1D*, std::string> key(hist, err_name);
+    std::map< std::pair<MnvH1D*, std::string>, LatErrorBandHandle >::iterator it = latErrorBandHandles.find(key);
+    if (it != latErrorBandHandles.end()) return &(it->second);
+
     // Get a Pointer to Error Band
-    MnvLatErrorBand* err_band =  hist->GetLatErrorBand(err_name);
+    MnvLatErrorBand* err_band = hist->GetLatErrorBand(err_name);
+    if (err_band == NULL){
+        RunTimeError("Lateral Error Band " + err_name + " does NOT exist for " + std::string(hist->GetName()));
+    }
 
-    // Get a Pointer to Histograms 
-    std::vector<TH1D*> err_hists = err_band->GetHists();
+    LatErrorBandHandle handle;
+    handle.err_name = err_name;
+    handle.bckg_err_id = BckgConstrainer.GetErrorBandID(err_name);
+    handle.err_band = err_band;
+    handle.err_hists = err_band->GetHists();
+    handle.nbins = err_band->GetNbinsX();
+    handle.isCVBinSet = false;
+    handle.cv_var = 0.0;
+    handle.cvbin = 0;
+    handle.cvBinLowEdge = 0.0;
+    handle.cvBinHighEdge = 0.0;
+
+    return &(latErrorBandHandles[key] = handle);
+}
+
+LatErrorBandHandle2D* CCProtonPi0_Analyzer::GetLatErrorBandHandle(MnvH2D* hist, std::string err_name)
+{
+    std::pair<MnvH2D*, std::string> key(hist, err_name);
+    std::map< std::pair<MnvH2D*, std::string>, LatErrorBandHandle2D >::iterator it = latErrorBandHandles2D.find(key);
+    if (it != latErrorBandHandles2D.end()) return &(it->second);
+
+    // Get a Pointer to Error Band
+    MnvLatErrorBand2D* err_band = hist->GetLatErrorBand(err_name);
+    if (err_band == NULL){
+        RunTimeError("Lateral Error Band " + err_name + " does NOT exist for " + std::string(hist->GetName()));
+    }
+
+    LatErrorBandHandle2D handle;
+    handle.err_name = err_name;
+    handle.bckg_err_id = BckgConstrainer.GetErrorBandID(err_name);
+    handle.hist = hist;
+    handle.err_band = err_band;
+    handle.err_hists = err_band->GetHists();
+
+    return &(latErrorBandHandles2D[key] = handle);
+}
+
+LatErrorBand_XSecVars& CCProtonPi0_Analyzer::GetLatErrorBand_XSecVars(std::string err_name)
+{
+    std::map<std::string, LatErrorBand_XSecVars>::iterator it = latErrorBands_XSec.find(err_name);
+    if (it == latErrorBands_XSec.end()){
+        RunTimeError("Lateral Error Band Handles NOT initialized for " + err_name);
+    }
+    return it->second;
+}
+
+LatErrorBand_InvMass& CCProtonPi0_Analyzer::GetLatErrorBand_InvMass(std::string err_name)
+{
+    std::map<std::string, LatErrorBand_InvMass>::iterator it = latErrorBands_invMass.find(err_name);
+    if (it == latErrorBands_invMass.end()){
+        RunTimeError("Lateral Error Band Handles NOT initialized for invMass " + err_name);
+    }
+    return it->second;
+}
+
+LatErrorBand_SideBand& CCProtonPi0_Analyzer::GetLatErrorBand_SideBand(std::string err_name)
+{
+    std::map<std::string, LatErrorBand_SideBand>::iterator it = latErrorBands_SideBand.find(err_name);
+    if (it == latErrorBands_SideBand.end()){
+        RunTimeError("Lateral Error Band Handles NOT initialized for SideBand " + err_name);
+    }
+    return it->second;
+}
+
+void CCProtonPi0_Analyzer::FillLatErrorBand_SingleUniverse(LatErrorBand_InvMass& band, int unv, double var, double shift)
+{
+    FillLatErrorBand_SingleUniverse(band.mc_reco_all, unv, var, shift);
+    if (truth_isSignal){
+        FillLatErrorBand_SingleUniverse(band.mc_reco_signal, unv, var, shift);
+    }else{
+        FillLatErrorBand_SingleUniverse(band.mc_reco_bckg, unv, var, shift);
+    }
+}
+
+void CCProtonPi0_Analyzer::FillLatErrorBand_SingleUniverse(LatErrorBand_SideBand& band, int unv, double var, double shift)
+{
+    // Fill All Events on [0]
+    FillLatErrorBand_SingleUniverse(band[0], unv, var, shift);
+
+    if (truth_isSignal){
+        // Fill Signal on [1]
+        FillLatErrorBand_SingleUniverse(band[1], unv, var, shift);
+    }else{
+        // Fill Background on [2] and Background Type
+        FillLatErrorBand_SingleUniverse(band[2], unv, var, shift);
+        int ind = GetBackgroundTypeInd();
+        FillLatErrorBand_SingleUniverse(band[ind], unv, var, shift);
+    }
+}
+
+void CCProtonPi0_Analyzer::FillLatErrorBand_SingleUniverse(LatErrorBand_XSecVar& band, int unv, double reco, double truth, double shift)
+{
+    FillLatErrorBand_SingleUniverse(band.mc_reco_all, unv, reco, shift);
+    if (truth_isSignal){
+        FillLatErrorBand_SingleUniverse(band.mc_truth_signal, unv, truth, 0.0);
+        FillLatErrorBand_SingleUniverse(band.mc_reco_signal, unv, reco, shift);
+        FillLatErrorBand_SingleUniverse(band.response, unv, reco, truth, shift, 0.0);
+    }else{
+        FillLatErrorBand_SingleUniverse(band.mc_reco_bckg, unv, reco, shift);
+    }
+}
+
+void CCProtonPi0_Analyzer::FillLatErrorBand_SingleUniverse(LatErrorBandHandle* handle, int unv, double var, double shift)
+{
+    MnvLatErrorBand* err_band = handle->err_band;
 
     // Fill Error Band Base Histogram with Default cvweight
     // Fill Only once with Universe 0
@@ -2183,23 +1940,28 @@ void CCProtonPi0_Analyzer::FillLatErrorBand_SingleUniverse(MnvH1D* hist, std::st
         err_band->TH1D::Fill(var, cvweight);
     }
 
-    int cvbin = err_band->FindBin(var);
-
-    const int nbins = err_band->GetNbinsX();
-    const double cvBinLowEdge  = (cvbin < err_band->GetNbinsX()+1) ? err_band->GetBinLowEdge( cvbin )  : err_band->GetBinLowEdge(cvbin-1) + err_band->GetBinWidth(cvbin-1);
-    const double cvBinHighEdge = (cvbin < err_band->GetNbinsX()+1) ? err_band->GetBinLowEdge( cvbin+1) : cvBinLowEdge + err_band->GetBinWidth(cvbin-1);
+    // CV Bin depends only on var -- reuse it for all universes of the same event
+    if (!handle->isCVBinSet || handle->cv_var != var){
+        const int cvbin = err_band->FindBin(var);
+        handle->cvbin = cvbin;
+        handle->cvBinLowEdge  = (cvbin < handle->nbins+1) ? err_band->GetBinLowEdge( cvbin )  : err_band->GetBinLowEdge(cvbin-1) + err_band->GetBinWidth(cvbin-1);
+        handle->cvBinHighEdge = (cvbin < handle->nbins+1) ? err_band->GetBinLowEdge( cvbin+1) : handle->cvBinLowEdge + err_band->GetBinWidth(cvbin-1);
+        handle->cv_var = var;
+        handle->isCVBinSet = true;
+    }
 
     // Do not Fill Error Band if Shift is NOT Physical
     if( MnvHist::IsNotPhysicalShift(shift) ) return;
 
+    const int nbins = handle->nbins;
     const double shiftVal = var + shift;
-    int bin = cvbin;
-    if (shiftVal < var && shiftVal < cvBinLowEdge && bin>0)  {
+    int bin = handle->cvbin;
+    if (shiftVal < var && shiftVal < handle->cvBinLowEdge && bin>0)  {
         for( ; bin != 0; --bin )
             if( err_band->GetBinLowEdge( bin ) < shiftVal )
                 break;
     }  
-    else if (shiftVal > var && shiftVal > cvBinHighEdge && bin < err_band->GetNbinsX()+1) {
+    else if (shiftVal > var && shiftVal > handle->cvBinHighEdge && bin < nbins+1) {
         for( ; bin != nbins+1; ++bin )
             if( shiftVal <  (err_band->GetBinLowEdge( bin ) + err_band->GetBinWidth( bin ) ) )
                 break;
@@ -2207,30 +1969,25 @@ void CCProtonPi0_Analyzer::FillLatErrorBand_SingleUniverse(MnvH1D* hist, std::st
 
     // Get Weight for the specific universe
     // wgt_bckg is universe_wgt / cv_wgt
-    double wgt_bckg = applyBckgConstraints_Unv ? GetBckgConstraint(err_name, unv) : 1.0;
+    double wgt_bckg = applyBckgConstraints_Unv ? GetBckgConstraint(handle->bckg_err_id, unv) : 1.0;
     double wgtU = cvweight * wgt_bckg;
-    err_hists[unv]->AddBinContent( bin, wgtU );
+    TH1D* unv_hist = handle->err_hists[unv];
+    unv_hist->AddBinContent( bin, wgtU );
 
     // Update Bin Error
-    const double err = err_hists[unv]->GetBinError(bin);
+    const double err = unv_hist->GetBinError(bin);
     const double newerr2 = err*err + wgtU*wgtU;
     const double newerr = (0.<newerr2) ? sqrt(newerr2) : 0.;
-    err_hists[unv]->SetBinError( bin, newerr );
+    unv_hist->SetBinError( bin, newerr );
 
 }
 
-void CCProtonPi0_Analyzer::FillLatErrorBand_SingleUniverse(MnvH2D* hist, std::string err_name, int unv, double xval, double yval, double x_shift, double y_shift)
+void CCProtonPi0_Analyzer::FillLatErrorBand_SingleUniverse(LatErrorBandHandle2D* handle, int unv, double xval, double yval, double x_shift, double y_shift)
 {
-    // Get a Pointer to Error Band
-    MnvLatErrorBand2D* err_band =  hist->GetLatErrorBand(err_name);
-
-    // Get a Pointer to Histograms 
-    std::vector<TH2D*> err_hists = err_band->GetHists();
-
     // Fill Error Band Base Histogram with Default cvweight
     // Fill Only once with Universe 0
     if (unv == 0){ 
-        err_band->TH2D::Fill(xval, yval, cvweight);
+        handle->err_band->TH2D::Fill(xval, yval, cvweight);
     }
 
     // Do not Fill Error Band if Shift is NOT Physical
@@ -2238,12 +1995,12 @@ void CCProtonPi0_Analyzer::FillLatErrorBand_SingleUniverse(MnvH2D* hist, std::st
 
     const double x_shiftVal = xval + x_shift;
     const double y_shiftVal = yval + y_shift;
-    int bin = hist->FindBin( x_shiftVal, y_shiftVal );
+    int bin = handle->hist->FindBin( x_shiftVal, y_shiftVal );
 
     // wgt_bckg is universe_wgt / cv_wgt
-    double wgt_bckg = applyBckgConstraints_Unv ? GetBckgConstraint(err_name, unv) : 1.0;
+    double wgt_bckg = applyBckgConstraints_Unv ? GetBckgConstraint(handle->bckg_err_id, unv) : 1.0;
     double wgtU = cvweight * wgt_bckg;
-    err_hists[unv]->AddBinContent( bin, wgtU );
+    handle->err_hists[unv]->AddBinContent( bin, wgtU );
 
     //    const double err = err_hists[unv]->GetBinError(bin);
     //    const double newerr2 = err*err + wgtU*wgtU;
@@ -2252,21 +2009,10 @@ void CCProtonPi0_Analyzer::FillLatErrorBand_SingleUniverse(MnvH2D* hist, std::st
 
 }
 
-double CCProtonPi0_Analyzer::GetBckgConstraint(std::string error_name, int hist_ind)
+double CCProtonPi0_Analyzer::GetBckgConstraint(int bckg_err_id, int hist_ind)
 {
-    // Find the Bckg Constraint if it is one of the constrained events
-    if (truth_isBckg_Compact_SinglePiPlus){
-        double bckg_wgt_SinglePiPlus = BckgConstrainer.GetBckgConstraint(error_name, hist_ind, "SinglePiPlus");
-        return bckg_wgt_SinglePiPlus / cv_wgt_SinglePiPlus;
-    }else if (truth_isBckg_Compact_QELike){
-        double bckg_wgt_QELike = BckgConstrainer.GetBckgConstraint(error_name, hist_ind, "QELike");
-        return bckg_wgt_QELike / cv_wgt_QELike;
-    }else if (truth_isBckg_Compact_WithPi0){
-        double bckg_wgt_WithPi0 = BckgConstrainer.GetBckgConstraint(error_name, hist_ind, "WithPi0");
-        return bckg_wgt_WithPi0 / cv_wgt_WithPi0;
-    }else{
-        return 1.0;
-    }
+    const std::vector<double>* bckg_wgts = GetBckgConstraintWeights(bckg_err_id);
+    return bckg_wgts ? (*bckg_wgts)[hist_ind] : 1.0;
 }
 
 double CCProtonPi0_Analyzer::GetNeutronResponseErr()
@@ -251,6 +251,82 @@ void CCProtonPi0_BackgroundTool::writeBackgroundTable()
     writeBackgroundTableRows(BackgroundTypeVector);
 }
 
+vector< vector<Background>* > CCProtonPi0_BackgroundTool::GetAllBackgrounds()
+{
+    vector< vector<Background>* > all;
+
+    all.push_back(&bckg_NoPi0);
+    all.push_back(&bckg_SinglePi0);
+    all.push_back(&bckg_MultiPi0);
+    all.push_back(&bckg_Total_WithPi0);
+
+    all.push_back(&bckg_compact_WithPi0);
+    all.push_back(&bckg_compact_QELike);
+    all.push_back(&bckg_compact_SinglePiPlus);
+    all.push_back(&bckg_compact_Other);
+    all.push_back(&bckg_compact_Total);
+
+    all.push_back(&bckg_NC);
+    all.push_back(&bckg_AntiNeutrino);
+    all.push_back(&bckg_QELike);
+    all.push_back(&bckg_SingleChargedPion);
+    all.push_back(&bckg_SingleChargedPion_ChargeExchanged);
+    all.push_back(&bckg_DoublePionWithPi0);
+    all.push_back(&bckg_DoublePionWithoutPi0);
+    all.push_back(&bckg_MultiPionWithPi0);
+    all.push_back(&bckg_MultiPionWithoutPi0);
+    all.push_back(&bckg_Other);
+    all.push_back(&bckg_Total);
+
+    return all;
+}
+
+void CCProtonPi0_BackgroundTool::writeBackgroundCounts(ofstream &file)
+{
+    // Full precision -- Merged Tables must match the serial run
+    file<<std::setprecision(17);
+
+    vector< vector<Background>* > all = GetAllBackgrounds();
+    for (unsigned int i = 0; i < all.size(); ++i){
+        for (int j = 0; j < nTables; ++j){
+            file<<(*all[i])[j].nAll<<" "<<(*all[i])[j].nWithMichel<<endl;
+        }
+    }
+}
+
+void CCProtonPi0_BackgroundTool::addBackgroundCounts(ifstream &file, vector<double> &comp)
+{
+    double nAll;
+    double nWithMichel;
+
+    // Rounding Errors -- nAll and nWithMichel of every Background and Table
+    vector< vector<Background>* > all = GetAllBackgrounds();
+    comp.resize(all.size() * nTables * 2, 0.0);
+
+    unsigned int ind = 0;
+    for (unsigned int i = 0; i < all.size(); ++i){
+        for (int j = 0; j < nTables; ++j){
+            if (!(file>>nAll>>nWithMichel)) RunTimeError("Cannot read Background Counts for " + (*all[i])[j].name);
+            Data_Functions::compensatedAdd((*all[i])[j].nAll, comp[ind++], nAll);
+            Data_Functions::compensatedAdd((*all[i])[j].nWithMichel, comp[ind++], nWithMichel);
+        }
+    }
+}
+
+void CCProtonPi0_BackgroundTool::addBackgroundCompensation(const vector<double> &comp)
+{
+    vector< vector<Background>* > all = GetAllBackgrounds();
+    if (comp.size() != all.size() * nTables * 2) return;
+
+    unsigned int ind = 0;
+    for (unsigned int i = 0; i < all.size(); ++i){
+        for (int j = 0; j < nTables; ++j){
+            (*all[i])[j].nAll += comp[ind++];
+            (*all[i])[j].nWithMichel += comp[ind++];
+        }
+    }
+}
+
 void CCProtonPi0_BackgroundTool::OpenTextFiles()
 {
     // Open Background Files
@@ -33,6 +33,9 @@ class CCProtonPi0_BackgroundTool : public CCProtonPi0_NTupleAnalysis
         
         void set_nTracks(int input);
         void writeBackgroundTable();
+        void writeBackgroundCounts(ofstream &file);
+        void addBackgroundCounts(ifstream &file, vector<double> &comp);
+        void addBackgroundCompensation(const vector<double> &comp);
         void fillBackgroundWithPi0(bool NoPi0, bool SinglePi0, bool MultiPi0, bool withMichel, double wgt = 1.0);
         void fillBackgroundCompact(bool WithPi0, bool QELike, bool SinglePiPlus, bool Other, double wgt = 1.0);
         
@@ -87,6 +90,7 @@ class CCProtonPi0_BackgroundTool : public CCProtonPi0_NTupleAnalysis
         void updateBackground(Background &b, bool withMichel = false, double wgt = 1.0);
         double calcPercent(double nEvents, double nBase);
         void formBackgroundVectors();
+        vector< vector<Background>* > GetAllBackgrounds();
         void initBackgrounds();
         void initSingleBackground(vector<Background> &b, string name);
         void writeBackgroundTableHeader();
@@ -0,0 +1,313 @@
+/*
+   See CCProtonPi0_BayesUnfold.h header for Class Information
+   */
+#ifndef CCProtonPi0_BayesUnfold_cpp
+#define CCProtonPi0_BayesUnfold_cpp
+
+#include "CCProtonPi0_BayesUnfold.h"
+
+using namespace std;
+
+const double CCProtonPi0_BayesUnfold::parityTolerance = 1.0e-6;
+
+CCProtonPi0_BayesUnfold::CCProtonPi0_BayesUnfold()
+{
+    // Do Nothing -- Work Space is allocated on first use
+}
+
+MnvH1D* CCProtonPi0_BayesUnfold::UnfoldHisto(MnvH2D* response, MnvH1D* data, int nIter)
+{
+    const int nMeas = response->GetNbinsX();
+    const int nTrue = response->GetNbinsY();
+    const int nCause = GetNCause(response);
+
+    if (data->GetNbinsX() != nMeas){
+        cout<<"BayesUnfold: Data and Response have different number of reco bins! Exiting!..."<<endl;
+        exit(1);
+    }
+
+    // CV with Covariance
+    vector<double> r(nMeas*nCause);
+    vector<double> t(nCause);
+    vector<double> d(nMeas);
+    vector<double> d_var(nMeas);
+    vector<double> u(nCause);
+    vector<double> cov(nCause*nCause);
+    FillProblem(response, data, &r[0], &t[0], &d[0]);
+    for (int j = 0; j < nMeas; ++j){
+        d_var[j] = data->GetBinError(j+1) * data->GetBinError(j+1);
+    }
+    Unfold_Covariance(nMeas, nCause, &r[0], &t[0], &d[0], &d_var[0], &u[0], &cov[0], nIter);
+
+    // Unfolded Histogram has the true binning of the Response
+    TH1D* h_cv = response->TH2::ProjectionY("h_bayes_unfolded_cv");
+    MnvH1D* unfolded = new MnvH1D(*h_cv);
+    delete h_cv;
+    unfolded->Reset();
+    for (int i = 0; i < nTrue; ++i){
+        unfolded->SetBinContent(i+1, u[i]);
+        unfolded->SetBinError(i+1, sqrt(cov[i*nCause+i]));
+    }
+
+    // Vertical Error Bands
+    vector<string> vert_names = GetBandNames(response->GetVertErrorBandNames(), data->GetVertErrorBandNames());
+    for (unsigned int b = 0; b < vert_names.size(); ++b){
+        const string& name = vert_names[b];
+        bool isResponseBand = response->HasVertErrorBand(name);
+        bool isDataBand = data->HasVertErrorBand(name);
+        int nUniv = isResponseBand ? response->GetVertErrorBand(name)->GetNHists() : data->GetVertErrorBand(name)->GetNHists();
+        if (isResponseBand && isDataBand && data->GetVertErrorBand(name)->GetNHists() != nUniv){
+            cout<<"BayesUnfold: Different number of universes for "<<name<<"! Exiting!..."<<endl;
+            exit(1);
+        }
+
+        vector<TH2D*> band_response(nUniv);
+        vector<TH1D*> band_data(nUniv);
+        for (int i = 0; i < nUniv; ++i){
+            band_response[i] = isResponseBand ? response->GetVertErrorBand(name)->GetHist(i) : (TH2D*)response;
+            band_data[i] = isDataBand ? data->GetVertErrorBand(name)->GetHist(i) : (TH1D*)data;
+        }
+
+        unfolded->AddVertErrorBand(name, nUniv);
+        vector<TH1*> band_unfolded(nUniv);
+        for (int i = 0; i < nUniv; ++i) band_unfolded[i] = unfolded->GetVertErrorBand(name)->GetHist(i);
+        UnfoldUniverses(band_response, band_data, band_unfolded, nIter);
+    }
+
+    // Lateral Error Bands
+    vector<string> lat_names = GetBandNames(response->GetLatErrorBandNames(), data->GetLatErrorBandNames());
+    for (unsigned int b = 0; b < lat_names.size(); ++b){
+        const string& name = lat_names[b];
+        bool isResponseBand = response->HasLatErrorBand(name);
+        bool isDataBand = data->HasLatErrorBand(name);
+        int nUniv = isResponseBand ? response->GetLatErrorBand(name)->GetNHists() : data->GetLatErrorBand(name)->GetNHists();
+        if (isResponseBand && isDataBand && data->GetLatErrorBand(name)->GetNHists() != nUniv){
+            cout<<"BayesUnfold: Different number of universes for "<<name<<"! Exiting!..."<<endl;
+            exit(1);
+        }
+
+        vector<TH2D*> band_response(nUniv);
+        vector<TH1D*> band_data(nUniv);
+        for (int i = 0; i < nUniv; ++i){
+            band_response[i] = isResponseBand ? response->GetLatErrorBand(name)->GetHist(i) : (TH2D*)response;
+            band_data[i] = isDataBand ? data->GetLatErrorBand(name)->GetHist(i) : (TH1D*)data;
+        }
+
+        unfolded->AddLatErrorBand(name, nUniv);
+        vector<TH1*> band_unfolded(nUniv);
+        for (int i = 0; i < nUniv; ++i) band_unfolded[i] = unfolded->GetLatErrorBand(name)->GetHist(i);
+        UnfoldUniverses(band_response, band_data, band_unfolded, nIter);
+    }
+
+    return unfolded;
+}
+
+void CCProtonPi0_BayesUnfold::Unfold(int nBatch, int nMeas, int nCause, const double* response, const double* truth, const double* data, double* unfolded, int nIter)
+{
+    SetProbabilities(nBatch, nMeas, nCause, response, truth);
+
+    if (nIter < 1) nIter = 1;
+    for (int iter = 0; iter < nIter; ++iter){
+        Iterate(nBatch, nMeas, nCause, data, unfolded);
+        // Unfolded distribution is the prior of the next iteration
+        prior.assign(unfolded, unfolded + nBatch*nCause);
+    }
+}
+
+void CCProtonPi0_BayesUnfold::Unfold_Covariance(int nMeas, int nCause, const double* response, const double* truth, const double* data, const double* data_var, double* unfolded, double* cov, int nIter)
+{
+    SetProbabilities(1, nMeas, nCause, response, truth);
+
+    if (nIter < 1) nIter = 1;
+    for (int iter = 0; iter < nIter; ++iter){
+        Iterate(1, nMeas, nCause, data, unfolded);
+        Propagate(nMeas, nCause, data, unfolded, iter == 0);
+        prior.assign(unfolded, unfolded + nCause);
+    }
+
+    // V = D * V(data) * D^T -- Data bins are uncorrelated
+    for (int a = 0; a < nCause; ++a){
+        const double* D_a = &deriv[a*nMeas];
+        for (int b = 0; b <= a; ++b){
+            const double* D_b = &deriv[b*nMeas];
+            double sum = 0.0;
+            for (int j = 0; j < nMeas; ++j) sum += D_a[j] * data_var[j] * D_b[j];
+            cov[a*nCause+b] = sum;
+            cov[b*nCause+a] = sum;
+        }
+    }
+}
+
+void CCProtonPi0_BayesUnfold::SetProbabilities(int nBatch, int nMeas, int nCause, const double* response, const double* truth)
+{
+    prob.resize(nBatch*nMeas*nCause);
+    eff.assign(nBatch*nCause, 0.0);
+    prior.assign(truth, truth + nBatch*nCause);
+
+    for (int b = 0; b < nBatch; ++b){
+        const double* t = &truth[b*nCause];
+        double* e = &eff[b*nCause];
+        for (int j = 0; j < nMeas; ++j){
+            const double* r = &response[(b*nMeas+j)*nCause];
+            double* p = &prob[(b*nMeas+j)*nCause];
+            for (int c = 0; c < nCause; ++c){
+                p[c] = t[c] > 0.0 ? r[c] / t[c] : 0.0;
+                e[c] += p[c];
+            }
+        }
+    }
+}
+
+void CCProtonPi0_BayesUnfold::Iterate(int nBatch, int nMeas, int nCause, const double* data, double* unfolded)
+{
+    fold.resize(nBatch*nMeas);
+    unfold.resize(nCause*nMeas);
+
+    for (int b = 0; b < nBatch; ++b){
+        const double* n0 = &prior[b*nCause];
+        const double* e = &eff[b*nCause];
+        const double* n = &data[b*nMeas];
+        double* f = &fold[b*nMeas];
+        double* nbar = &unfolded[b*nCause];
+
+        double ntrue = 0.0;
+        for (int c = 0; c < nCause; ++c) ntrue += n0[c];
+        const double norm = ntrue > 0.0 ? 1.0 / ntrue : 0.0;
+
+        // f_j = sum_i P(E_j|C_i) P0(C_i)
+        for (int j = 0; j < nMeas; ++j){
+            const double* p = &prob[(b*nMeas+j)*nCause];
+            double sum = 0.0;
+            for (int c = 0; c < nCause; ++c) sum += p[c] * n0[c];
+            f[j] = sum * norm;
+        }
+
+        // M_ij = P(E_j|C_i) P0(C_i) / (f_j eff_i)
+        for (int c = 0; c < nCause; ++c) nbar[c] = 0.0;
+        for (int j = 0; j < nMeas; ++j){
+            const double* p = &prob[(b*nMeas+j)*nCause];
+            const double inv_f = f[j] > 0.0 ? norm / f[j] : 0.0;
+            for (int c = 0; c < nCause; ++c){
+                double M = e[c] > 0.0 ? p[c] * n0[c] * inv_f / e[c] : 0.0;
+                unfold[c*nMeas+j] = M;
+                nbar[c] += M * n[j];
+            }
+        }
+    }
+}
+
+/*
+ *  Error propagation for Iterative Bayesian Unfolding, T. Adye, arXiv:1105.1160
+ *      dn(C_i)/dn(E_j) = M_ij + n(C_i)/n0(C_i) dn0(C_i)/dn(E_j)
+ *                      - sum_kl n(E_k) eff_l/n0(C_l) M_ik M_lk dn0(C_l)/dn(E_j)
+ */
+void CCProtonPi0_BayesUnfold::Propagate(int nMeas, int nCause, const double* data, const double* unfolded, bool isFirst)
+{
+    // Prior of the first iteration does not depend on data
+    if (isFirst){
+        deriv = unfold;
+        return;
+    }
+
+    feedback.resize(nCause*nCause);
+    for (int i = 0; i < nCause; ++i){
+        const double* M_i = &unfold[i*nMeas];
+        for (int l = 0; l < nCause; ++l){
+            if (prior[l] <= 0.0){
+                feedback[i*nCause+l] = 0.0;
+                continue;
+            }
+            const double* M_l = &unfold[l*nMeas];
+            double sum = 0.0;
+            for (int k = 0; k < nMeas; ++k) sum += data[k] * M_i[k] * M_l[k];
+            feedback[i*nCause+l] = sum * eff[l] / prior[l];
+        }
+    }
+
+    deriv_new.resize(nCause*nMeas);
+    for (int i = 0; i < nCause; ++i){
+        const double ratio = prior[i] > 0.0 ? unfolded[i] / prior[i] : 0.0;
+        for (int j = 0; j < nMeas; ++j){
+            double sum = unfold[i*nMeas+j] + ratio * deriv[i*nMeas+j];
+            for (int l = 0; l < nCause; ++l) sum -= feedback[i*nCause+l] * deriv[l*nMeas+j];
+            deriv_new[i*nMeas+j] = sum;
+        }
+    }
+    deriv.swap(deriv_new);
+}
+
+int CCProtonPi0_BayesUnfold::GetNCause(const MnvH2D* response) const
+{
+    // True bins + Fakes
+    return response->GetNbinsY() + 1;
+}
+
+void CCProtonPi0_BayesUnfold::FillProblem(const TH2D* response, const TH1D* data, double* r, double* t, double* d) const
+{
+    const int nMeas = response->GetNbinsX();
+    const int nTrue = response->GetNbinsY();
+    const int nCause = nTrue + 1;
+
+    // Truth includes events reconstructed out of range (misses)
+    for (int i = 0; i < nTrue; ++i){
+        double sum = 0.0;
+        for (int j = 0; j <= nMeas+1; ++j) sum += response->GetBinContent(j, i+1);
+        t[i] = sum;
+    }
+
+    // Reco events with true value out of range are the fakes
+    double fakes = 0.0;
+    for (int j = 0; j < nMeas; ++j){
+        for (int i = 0; i < nTrue; ++i) r[j*nCause+i] = response->GetBinContent(j+1, i+1);
+        r[j*nCause+nTrue] = response->GetBinContent(j+1, 0) + response->GetBinContent(j+1, nTrue+1);
+        fakes += r[j*nCause+nTrue];
+        d[j] = data->GetBinContent(j+1);
+    }
+    t[nTrue] = fakes;
+}
+
+void CCProtonPi0_BayesUnfold::UnfoldUniverses(const std::vector<TH2D*>& responses, const std::vector<TH1D*>& data, std::vector<TH1*>& unfolded, int nIter)
+{
+    const int nBatch = responses.size();
+    if (nBatch == 0) return;
+
+    const int nMeas = responses[0]->GetNbinsX();
+    const int nTrue = responses[0]->GetNbinsY();
+    const int nCause = nTrue + 1;
+
+    m_response.resize(nBatch*nMeas*nCause);
+    m_truth.resize(nBatch*nCause);
+    m_data.resize(nBatch*nMeas);
+    m_unfolded.resize(nBatch*nCause);
+    for (int b = 0; b < nBatch; ++b){
+        FillProblem(responses[b], data[b], &m_response[b*nMeas*nCause], &m_truth[b*nCause], &m_data[b*nMeas]);
+    }
+
+    Unfold(nBatch, nMeas, nCause, &m_response[0], &m_truth[0], &m_data[0], &m_unfolded[0], nIter);
+
+    for (int b = 0; b < nBatch; ++b){
+        unfolded[b]->Reset();
+        for (int i = 0; i < nTrue; ++i){
+            unfolded[b]->SetBinContent(i+1, m_unfolded[b*nCause+i]);
+        }
+    }
+}
+
+std::vector<std::string> CCProtonPi0_BayesUnfold::GetBandNames(const std::vector<std::string>& names_response, const std::vector<std::string>& names_data) const
+{
+    vector<string> names = names_data;
+    for (unsigned int i = 0; i < names_response.size(); ++i){
+        bool isFound = false;
+        for (unsigned int j = 0; j < names_data.size(); ++j){
+            if (names_response[i] == names_data[j]){
+                isFound = true;
+                break;
+            }
+        }
+        if (!isFound) names.push_back(names_response[i]);
+    }
+    return names;
+}
+
+#endif
+
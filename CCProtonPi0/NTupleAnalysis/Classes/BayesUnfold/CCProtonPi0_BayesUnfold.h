@@ -0,0 +1,84 @@
+/*
+================================================================================
+Class: CCProtonPi0_BayesUnfold
+    Iterative Bayesian (D'Agostini) Unfolding on dense matrices
+        Same algorithm as RooUnfoldBayes used by MnvUnfold (no smoothing)
+        CV statistical errors use the full error propagation of the iterations
+        All universes of an error band are unfolded together as a single batch
+
+    Main Directory:
+        Classes/BayesUnfold
+
+    Batch Layout (contiguous, row major):
+        response:   [batch][meas][cause]    Migration counts
+        truth:      [batch][cause]          All true events (includes misses)
+        data:       [batch][meas]
+        unfolded:   [batch][cause]
+
+    Last cause is the fakes (reco events with true value out of range)
+================================================================================
+*/
+#ifndef CCProtonPi0_BayesUnfold_h
+#define CCProtonPi0_BayesUnfold_h
+
+#include <iostream>
+#include <cstdlib>
+#include <cmath>
+#include <string>
+#include <vector>
+
+#include <PlotUtils/MnvH1D.h>
+#include <PlotUtils/MnvH2D.h>
+
+using namespace PlotUtils;
+
+class CCProtonPi0_BayesUnfold
+{
+    public:
+        CCProtonPi0_BayesUnfold();
+
+        // true: Cross Section and Unfolding Study use this instead of MnvUnfold
+        //      Keep false until the benchUnfold parity check passes on all variables
+        static const bool isDefault = false;
+
+        // Largest relative difference to MnvUnfold accepted by benchUnfold
+        //      Applies to CV, CV Errors and every universe of every Error Band
+        static const double parityTolerance;
+
+        // Same result as MnvUnfold::UnfoldHisto(..., RooUnfold::kBayes, nIter, true)
+        MnvH1D* UnfoldHisto(MnvH2D* response, MnvH1D* data, int nIter);
+
+        // Unfolds nBatch problems of the same shape
+        void Unfold(int nBatch, int nMeas, int nCause, const double* response, const double* truth, const double* data, double* unfolded, int nIter);
+
+        // Unfolds a single problem with the covariance from the data statistical errors
+        void Unfold_Covariance(int nMeas, int nCause, const double* response, const double* truth, const double* data, const double* data_var, double* unfolded, double* cov, int nIter);
+
+    private:
+        // Work Space -- Reused between calls
+        std::vector<double> prob;       // P(E_j|C_i)   [batch][meas][cause]
+        std::vector<double> eff;        // Efficiency   [batch][cause]
+        std::vector<double> prior;      // n0(C_i)      [batch][cause]
+        std::vector<double> fold;       // f_j          [batch][meas]
+        std::vector<double> unfold;     // M_ij         [cause][meas]
+        std::vector<double> deriv;      // dn(C_i)/dn(E_j) [cause][meas]
+        std::vector<double> deriv_new;
+        std::vector<double> feedback;   // [cause][cause]
+
+        std::vector<double> m_response;
+        std::vector<double> m_truth;
+        std::vector<double> m_data;
+        std::vector<double> m_unfolded;
+
+        void SetProbabilities(int nBatch, int nMeas, int nCause, const double* response, const double* truth);
+        void Iterate(int nBatch, int nMeas, int nCause, const double* data, double* unfolded);
+        void Propagate(int nMeas, int nCause, const double* data, const double* unfolded, bool isFirst);
+
+        int GetNCause(const MnvH2D* response) const;
+        void FillProblem(const TH2D* response, const TH1D* data, double* r, double* t, double* d) const;
+        void UnfoldUniverses(const std::vector<TH2D*>& responses, const std::vector<TH1D*>& data, std::vector<TH1*>& unfolded, int nIter);
+        std::vector<std::string> GetBandNames(const std::vector<std::string>& names_response, const std::vector<std::string>& names_data) const;
+};
+
+#endif
+
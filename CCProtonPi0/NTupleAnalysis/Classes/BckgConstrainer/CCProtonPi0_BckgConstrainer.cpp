@@ -17,42 +17,60 @@ CCProtonPi0_BckgConstrainer::~CCProtonPi0_BckgConstrainer()
     // Do Nothing
 }
 
-double CCProtonPi0_BckgConstrainer::GetBckgConstraint(std::string error_name, int hist_ind, std::string bckg_name)
+int CCProtonPi0_BckgConstrainer::GetErrorBandID(const std::string& error_name)
 {
-    map<string, vector<UniverseWeight> >::iterator it = BckgWeights.find(error_name);
+    map<string, int>::iterator it = ErrorBandIDs.find(error_name);
     
-    if (it == BckgWeights.end()){
+    if (it == ErrorBandIDs.end()){
         std::cout<<"Cannot find "<<error_name<<std::endl;
-    }else{
-        UniverseWeight unv_wgt = (it->second).at(hist_ind);
-   
-        if (bckg_name.compare("SinglePiPlus") == 0) return unv_wgt.wgt_SinglePiPlus;
-        else if (bckg_name.compare("QELike") == 0) return unv_wgt.wgt_QELike;
-        else if (bckg_name.compare("WithPi0") == 0) return unv_wgt.wgt_WithPi0;
-        else std::cout<<"Cannot find "<<bckg_name<<std::endl;
+        return -1;
     }
 
+    return it->second;
+}
+
+int CCProtonPi0_BckgConstrainer::GetBckgType(const std::string& bckg_name)
+{
+    if (bckg_name.compare("SinglePiPlus") == 0) return BCKG_SINGLEPIPLUS;
+    else if (bckg_name.compare("QELike") == 0) return BCKG_QELIKE;
+    else if (bckg_name.compare("WithPi0") == 0) return BCKG_WITHPI0;
+    else std::cout<<"Cannot find "<<bckg_name<<std::endl;
+
     return -1;
 }
 
-double CCProtonPi0_BckgConstrainer::GetBckgConstraintErr(std::string error_name, int hist_ind, std::string bckg_name)
+bool CCProtonPi0_BckgConstrainer::FindTableIndex(const std::string& error_name, int hist_ind, const std::string& bckg_name, int& ind)
 {
-    map<string, vector<UniverseWeight> >::iterator it = BckgWeights.find(error_name);
-    
-    if (it == BckgWeights.end()){
-        std::cout<<"Cannot find "<<error_name<<std::endl;
-    }else{
-        UniverseWeight unv_wgt = (it->second).at(hist_ind);
-   
-        if (bckg_name.compare("SinglePiPlus") == 0) return unv_wgt.err_SinglePiPlus;
-        else if (bckg_name.compare("QELike") == 0) return unv_wgt.err_QELike;
-        else if (bckg_name.compare("WithPi0") == 0) return unv_wgt.err_WithPi0;
-        else std::cout<<"Cannot find "<<bckg_name<<std::endl;
+    int err_id = GetErrorBandID(error_name);
+    if (err_id == -1) return false;
+
+    if (hist_ind < 0 || hist_ind >= ErrorBandNUniverses[err_id]){
+        std::cout<<"Cannot find "<<error_name<<" Universe "<<hist_ind<<std::endl;
+        return false;
     }
 
+    int bckg_type = GetBckgType(bckg_name);
+    if (bckg_type == -1) return false;
+
+    ind = GetTableIndex(err_id, hist_ind, bckg_type);
+    return true;
+}
+
+double CCProtonPi0_BckgConstrainer::GetBckgConstraint(std::string error_name, int hist_ind, std::string bckg_name)
+{
+    int ind;
+    if (FindTableIndex(error_name, hist_ind, bckg_name, ind)) return BckgWeightTable[ind];
+
     return -1;
 }
 
+double CCProtonPi0_BckgConstrainer::GetBckgConstraintErr(std::string error_name, int hist_ind, std::string bckg_name)
+{
+    int ind;
+    if (FindTableIndex(error_name, hist_ind, bckg_name, ind)) return BckgErrTable[ind];
+
+    return -1;
+}
 
 void CCProtonPi0_BckgConstrainer::ReadBckgConstraints()
 {
@@ -72,6 +90,7 @@ void CCProtonPi0_BckgConstrainer::ReadBckgConstraints()
     int hist_ind;
     UniverseWeight unv_wgt;
     double dummy;
+    map< string, vector<UniverseWeight> > BckgWeights;
 
     // Read Table
     while(!file.eof()){
@@ -83,25 +102,38 @@ void CCProtonPi0_BckgConstrainer::ReadBckgConstraints()
     } 
 
     file.close();
+
+    // Flatten into Dense Tables
+    map<string, vector<UniverseWeight> >::iterator iter;
+    for (iter = BckgWeights.begin(); iter != BckgWeights.end(); ++iter ){
+        const vector<UniverseWeight>& unv_wgts = iter->second;
+
+        ErrorBandIDs[iter->first] = ErrorBandNames.size();
+        ErrorBandNames.push_back(iter->first);
+        ErrorBandOffsets.push_back(BckgWeightTable.size() / N_BCKG_TYPES);
+        ErrorBandNUniverses.push_back(unv_wgts.size());
+
+        for (unsigned int i = 0; i < unv_wgts.size(); ++i){
+            BckgWeightTable.push_back(unv_wgts[i].wgt_SinglePiPlus);
+            BckgWeightTable.push_back(unv_wgts[i].wgt_QELike);
+            BckgWeightTable.push_back(unv_wgts[i].wgt_WithPi0);
+            BckgErrTable.push_back(unv_wgts[i].err_SinglePiPlus);
+            BckgErrTable.push_back(unv_wgts[i].err_QELike);
+            BckgErrTable.push_back(unv_wgts[i].err_WithPi0);
+        }
+    }
 }
 
 void CCProtonPi0_BckgConstrainer::PrintMap()
 {
-    map<string, vector<UniverseWeight> >::iterator iter;
-
-    for (iter = BckgWeights.begin(); iter != BckgWeights.end(); ++iter ){
-        string unv_name = iter->first;
+    for (unsigned int err_id = 0; err_id < ErrorBandNames.size(); ++err_id){
+        string unv_name = ErrorBandNames[err_id];
 
         // Print Values
-        vector<UniverseWeight> unv_wgt = iter->second;
-        for (unsigned int i = 0; i < unv_wgt.size(); ++i){
+        for (int i = 0; i < ErrorBandNUniverses[err_id]; ++i){
             cout<<unv_name<<" "<<i<<" ";
-            cout<<unv_wgt[i].wgt_SinglePiPlus<<" ";
-            cout<<unv_wgt[i].wgt_QELike<<" ";
-            cout<<unv_wgt[i].wgt_WithPi0<<" ";
-            cout<<unv_wgt[i].err_SinglePiPlus<<" ";
-            cout<<unv_wgt[i].err_QELike<<" ";
-            cout<<unv_wgt[i].err_WithPi0<<" ";
+            for (int j = 0; j < N_BCKG_TYPES; ++j) cout<<GetBckgConstraint(err_id, i, j)<<" ";
+            for (int j = 0; j < N_BCKG_TYPES; ++j) cout<<GetBckgConstraintErr(err_id, i, j)<<" ";
             cout<<endl;
         }
     }
@@ -12,6 +12,15 @@
 
 using namespace std;
 
+// Background Types -- Last index of the dense weight table
+enum BckgType
+{
+    BCKG_SINGLEPIPLUS = 0,
+    BCKG_QELIKE,
+    BCKG_WITHPI0,
+    N_BCKG_TYPES
+};
+
 struct UniverseWeight
 {
     double wgt_SinglePiPlus;
@@ -28,13 +37,32 @@ class CCProtonPi0_BckgConstrainer
         CCProtonPi0_BckgConstrainer(std::string in_file);
         ~CCProtonPi0_BckgConstrainer();
 
+        // Dense Table Access -- Resolve IDs once at init, use them for every event
+        int GetErrorBandID(const std::string& error_name);
+        int GetBckgType(const std::string& bckg_name);
+        int GetNErrorBands() const { return ErrorBandNames.size(); }
+        int GetNUniverses(int err_id) const { return ErrorBandNUniverses[err_id]; }
+        double GetBckgConstraint(int err_id, int hist_ind, int bckg_type) const { return BckgWeightTable[GetTableIndex(err_id, hist_ind, bckg_type)]; }
+        double GetBckgConstraintErr(int err_id, int hist_ind, int bckg_type) const { return BckgErrTable[GetTableIndex(err_id, hist_ind, bckg_type)]; }
+
+        // String Access -- Wrappers over the Dense Table
         double GetBckgConstraint(std::string error_name, int hist_ind, std::string bckg_name);
         double GetBckgConstraintErr(std::string error_name, int hist_ind, std::string bckg_name);
 
     private:
         void ReadBckgConstraints();
         void PrintMap();
-        map< string, vector<UniverseWeight> > BckgWeights;
+        bool FindTableIndex(const std::string& error_name, int hist_ind, const std::string& bckg_name, int& ind);
+        int GetTableIndex(int err_id, int hist_ind, int bckg_type) const { return (ErrorBandOffsets[err_id] + hist_ind) * N_BCKG_TYPES + bckg_type; }
+
+        // Dense [errorBandId][universe][bckgType] Tables
+        //  Error Bands have different number of universes -- ErrorBandOffsets holds the first universe of each band
+        map<string, int> ErrorBandIDs;
+        vector<string> ErrorBandNames;
+        vector<int> ErrorBandOffsets;
+        vector<int> ErrorBandNUniverses;
+        vector<double> BckgWeightTable;
+        vector<double> BckgErrTable;
 
         std::string input_file;
 };
@@ -0,0 +1,381 @@
+#ifndef CCProtonPi0_ColumnarNTuple_cpp
+#define CCProtonPi0_ColumnarNTuple_cpp
+
+#include "CCProtonPi0_ColumnarNTuple.h"
+
+using namespace std;
+
+CCProtonPi0_ColumnarNTuple::CCProtonPi0_ColumnarNTuple()
+{
+    isWriteMode = false;
+    isReadMode = false;
+    nEntries = 0;
+    entry_size = 0;
+    current_segment = 0;
+}
+
+CCProtonPi0_ColumnarNTuple::~CCProtonPi0_ColumnarNTuple()
+{
+    if (isWriteMode) Close();
+    if (isReadMode) UnmapAll();
+}
+
+std::string CCProtonPi0_ColumnarNTuple::GetColumnarDir(std::string rootFileName)
+{
+    size_t ext = rootFileName.rfind(".root");
+    if (ext != std::string::npos) rootFileName = rootFileName.substr(0, ext);
+    return rootFileName + "_Columnar/";
+}
+
+bool CCProtonPi0_ColumnarNTuple::IsLittleEndian()
+{
+    const unsigned short test = 1;
+    return *(reinterpret_cast<const unsigned char*>(&test)) == 1;
+}
+
+//------------------------------------------------------------------------------
+// Write Mode
+//------------------------------------------------------------------------------
+void CCProtonPi0_ColumnarNTuple::OpenWrite(std::string dir, TChain* fChain, const std::vector<std::string>& column_names)
+{
+    if (!IsLittleEndian()){
+        cout<<"Columnar NTuple requires a little-endian host! Exiting!..."<<endl;
+        exit(1);
+    }
+
+    cout<<"Writing Columnar NTuple"<<endl;
+    cout<<"\tDirectory: "<<dir<<endl;
+    gSystem->mkdir(dir.c_str(), kTRUE);
+
+    // Leaf types are taken from the first tree in the Chain
+    fChain->LoadTree(0);
+
+    segments.clear();
+    segments.resize(1);
+    ColumnarSegment& segment = segments[0];
+    segment.dir = dir;
+    segment.nEntries = 0;
+    segment.first_entry = 0;
+
+    for (unsigned int i = 0; i < column_names.size(); ++i){
+        if (fChain->GetBranch(column_names[i].c_str()) == NULL){
+            cout<<"WARNING! Column not found in Chain: "<<column_names[i]<<endl;
+            continue;
+        }
+        ColumnarColumn column;
+        SetColumn(column, fChain, column_names[i]);
+        segment.columns.push_back(column);
+    }
+    SetCountColumns(segment.columns);
+
+    for (unsigned int i = 0; i < segment.columns.size(); ++i){
+        ColumnarColumn& column = segment.columns[i];
+        std::string file_name = dir + column.name + ".col";
+        column.data_file = new std::ofstream(file_name.c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+        if (!column.data_file->is_open()){
+            cout<<"Cannot open Columnar NTuple file: "<<file_name<<endl;
+            exit(1);
+        }
+        if (column.count_column >= 0) column.offsets.push_back(0);
+    }
+
+    nEntries = 0;
+    isWriteMode = true;
+    cout<<"\tColumns = "<<segment.columns.size()<<endl;
+}
+
+void CCProtonPi0_ColumnarNTuple::Fill()
+{
+    if (!isWriteMode) return;
+
+    std::vector<ColumnarColumn>& columns = segments[0].columns;
+    for (unsigned int i = 0; i < columns.size(); ++i){
+        ColumnarColumn& column = columns[i];
+        Long64_t n = GetNElements(columns, column);
+        column.data_file->write(column.address, n * column.elem_size);
+        if (column.count_column >= 0) column.offsets.push_back(column.offsets.back() + n);
+    }
+
+    segments[0].nEntries++;
+    nEntries++;
+}
+
+void CCProtonPi0_ColumnarNTuple::Close()
+{
+    if (!isWriteMode) return;
+
+    ColumnarSegment& segment = segments[0];
+    for (unsigned int i = 0; i < segment.columns.size(); ++i){
+        ColumnarColumn& column = segment.columns[i];
+        column.data_file->close();
+        delete column.data_file;
+        column.data_file = NULL;
+
+        if (column.count_column < 0) continue;
+
+        std::string file_name = segment.dir + column.name + ".idx";
+        std::ofstream index_file(file_name.c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+        index_file.write(reinterpret_cast<const char*>(&column.offsets[0]), column.offsets.size() * sizeof(Long64_t));
+        index_file.close();
+    }
+
+    WriteSchema(segment);
+    isWriteMode = false;
+
+    cout<<"\tColumnar NTuple Entries = "<<nEntries<<endl;
+}
+
+void CCProtonPi0_ColumnarNTuple::WriteSchema(const ColumnarSegment& segment)
+{
+    std::string file_name = segment.dir + "Schema.txt";
+    std::ofstream schema(file_name.c_str());
+    if (!schema.is_open()){
+        cout<<"Cannot open Columnar NTuple Schema: "<<file_name<<endl;
+        exit(1);
+    }
+
+    schema<<"# CCProtonPi0 Columnar NTuple -- Little-endian flat arrays"<<endl;
+    schema<<"# name type elem_size len_static count_name"<<endl;
+    schema<<"nEntries "<<segment.nEntries<<endl;
+    schema<<"nColumns "<<segment.columns.size()<<endl;
+    for (unsigned int i = 0; i < segment.columns.size(); ++i){
+        const ColumnarColumn& column = segment.columns[i];
+        schema<<column.name<<" "<<column.type<<" "<<column.elem_size<<" "<<column.len_static<<" "<<column.count_name<<endl;
+    }
+    schema.close();
+}
+
+//------------------------------------------------------------------------------
+// Read Mode
+//------------------------------------------------------------------------------
+void CCProtonPi0_ColumnarNTuple::OpenRead(TChain* fChain)
+{
+    if (!IsLittleEndian()){
+        cout<<"Columnar NTuple requires a little-endian host! Exiting!..."<<endl;
+        exit(1);
+    }
+
+    cout<<"Reading Columnar NTuple"<<endl;
+
+    // Branch addresses are set by Init() on the first tree
+    fChain->LoadTree(0);
+
+    TObjArray* files = fChain->GetListOfFiles();
+    segments.clear();
+    segments.resize(files->GetEntries());
+    nEntries = 0;
+    for (int i = 0; i < files->GetEntries(); ++i){
+        TChainElement* element = (TChainElement*)files->At(i);
+        segments[i].dir = GetColumnarDir(element->GetTitle());
+        segments[i].first_entry = nEntries;
+        ReadSegment(segments[i], fChain);
+        nEntries += segments[i].nEntries;
+    }
+
+    current_segment = 0;
+    isReadMode = true;
+    cout<<"\tColumnar NTuple Entries = "<<nEntries<<endl;
+}
+
+void CCProtonPi0_ColumnarNTuple::ReadSegment(ColumnarSegment& segment, TChain* fChain)
+{
+    std::string file_name = segment.dir + "Schema.txt";
+    ifstream schema(file_name.c_str());
+    if (!schema.is_open()){
+        cout<<"Cannot open Columnar NTuple Schema: "<<file_name<<endl;
+        exit(1);
+    }
+    cout<<"\tDirectory: "<<segment.dir<<endl;
+
+    std::string line;
+    std::string key;
+    int nColumns = 0;
+    segment.nEntries = 0;
+    while (getline(schema, line)){
+        if (line.empty() || line[0] == '#') continue;
+        std::istringstream ss(line);
+        if (line.compare(0, 9, "nEntries ") == 0){
+            ss>>key>>segment.nEntries;
+            continue;
+        }
+        if (line.compare(0, 9, "nColumns ") == 0){
+            ss>>key>>nColumns;
+            continue;
+        }
+
+        ColumnarColumn schema_column;
+        ss>>schema_column.name>>schema_column.type>>schema_column.elem_size>>schema_column.len_static>>schema_column.count_name;
+
+        // Types must match the branches in the Analyzer
+        ColumnarColumn column;
+        SetColumn(column, fChain, schema_column.name);
+        if (column.type != schema_column.type || column.elem_size != schema_column.elem_size){
+            cout<<"Columnar NTuple type mismatch for "<<column.name<<": "<<schema_column.type<<" vs "<<column.type<<endl;
+            exit(1);
+        }
+        column.len_static = schema_column.len_static;
+        column.count_name = schema_column.count_name;
+        segment.columns.push_back(column);
+    }
+    schema.close();
+
+    if ((int)segment.columns.size() != nColumns){
+        cout<<"Columnar NTuple Schema is corrupted: "<<file_name<<endl;
+        exit(1);
+    }
+    SetCountColumns(segment.columns);
+
+    for (unsigned int i = 0; i < segment.columns.size(); ++i){
+        ColumnarColumn& column = segment.columns[i];
+        column.data = MapFile(segment.dir + column.name + ".col", column.data_size);
+
+        bool isSizeValid;
+        if (column.count_column < 0){
+            isSizeValid = column.data_size == (size_t)(segment.nEntries * column.len_static * column.elem_size);
+        }else{
+            column.index = reinterpret_cast<const Long64_t*>(MapFile(segment.dir + column.name + ".idx", column.index_size));
+            isSizeValid = column.index_size == (size_t)((segment.nEntries + 1) * sizeof(Long64_t)) &&
+                          column.data_size == (size_t)(column.index[segment.nEntries] * column.elem_size);
+        }
+
+        if (!isSizeValid){
+            cout<<"Columnar NTuple file size does not match the Schema: "<<column.name<<endl;
+            exit(1);
+        }
+    }
+}
+
+bool CCProtonPi0_ColumnarNTuple::LoadEntry(Long64_t entry)
+{
+    if (!isReadMode || entry < 0 || entry >= nEntries) return false;
+
+    // Entries are read in order -- Move forward to the segment of the entry
+    if (entry < segments[current_segment].first_entry) current_segment = 0;
+    while (entry >= segments[current_segment].first_entry + segments[current_segment].nEntries) current_segment++;
+
+    const ColumnarSegment& segment = segments[current_segment];
+    const Long64_t local_entry = entry - segment.first_entry;
+
+    entry_size = 0;
+    for (unsigned int i = 0; i < segment.columns.size(); ++i){
+        const ColumnarColumn& column = segment.columns[i];
+        const char* src;
+        size_t nBytes;
+        if (column.count_column < 0){
+            nBytes = column.len_static * column.elem_size;
+            src = column.data + local_entry * nBytes;
+        }else{
+            const Long64_t offset = column.index[local_entry];
+            nBytes = (column.index[local_entry + 1] - offset) * column.elem_size;
+            src = column.data + offset * column.elem_size;
+        }
+        if (nBytes > 0) memcpy(column.address, src, nBytes);
+        entry_size += nBytes;
+    }
+
+    return true;
+}
+
+const char* CCProtonPi0_ColumnarNTuple::MapFile(std::string file_name, size_t& size)
+{
+    int fd = open(file_name.c_str(), O_RDONLY);
+    if (fd < 0){
+        cout<<"Cannot open Columnar NTuple file: "<<file_name<<endl;
+        exit(1);
+    }
+
+    struct stat file_stat;
+    fstat(fd, &file_stat);
+    size = file_stat.st_size;
+
+    const char* data = NULL;
+    if (size > 0){
+        void* map = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (map == MAP_FAILED){
+            cout<<"Cannot map Columnar NTuple file: "<<file_name<<endl;
+            exit(1);
+        }
+        // Entries are read in order
+        madvise(map, size, MADV_SEQUENTIAL);
+        data = static_cast<const char*>(map);
+    }
+    close(fd);
+
+    return data;
+}
+
+void CCProtonPi0_ColumnarNTuple::UnmapAll()
+{
+    for (unsigned int s = 0; s < segments.size(); ++s){
+        for (unsigned int i = 0; i < segments[s].columns.size(); ++i){
+            ColumnarColumn& column = segments[s].columns[i];
+            if (column.data != NULL) munmap(const_cast<char*>(column.data), column.data_size);
+            if (column.index != NULL) munmap(const_cast<Long64_t*>(column.index), column.index_size);
+            column.data = NULL;
+            column.index = NULL;
+        }
+    }
+    isReadMode = false;
+}
+
+//------------------------------------------------------------------------------
+// Columns
+//------------------------------------------------------------------------------
+void CCProtonPi0_ColumnarNTuple::SetColumn(ColumnarColumn& column, TChain* fChain, std::string name)
+{
+    TBranch* branch = fChain->GetBranch(name.c_str());
+    TLeaf* leaf = fChain->GetLeaf(name.c_str());
+    if (branch == NULL || leaf == NULL || branch->GetAddress() == NULL){
+        cout<<"Columnar NTuple column has no branch address: "<<name<<endl;
+        exit(1);
+    }
+
+    column.name = name;
+    column.type = leaf->GetTypeName();
+    column.elem_size = leaf->GetLenType();
+    column.len_static = leaf->GetLenStatic();
+    column.count_name = leaf->GetLeafCount() ? leaf->GetLeafCount()->GetName() : "-";
+    column.count_column = -1;
+    column.address = branch->GetAddress();
+    column.data_file = NULL;
+    column.data = NULL;
+    column.index = NULL;
+    column.data_size = 0;
+    column.index_size = 0;
+}
+
+void CCProtonPi0_ColumnarNTuple::SetCountColumns(std::vector<ColumnarColumn>& columns)
+{
+    for (unsigned int i = 0; i < columns.size(); ++i){
+        if (columns[i].count_name == "-") continue;
+        for (unsigned int j = 0; j < columns.size(); ++j){
+            if (columns[j].name == columns[i].count_name){
+                columns[i].count_column = j;
+                break;
+            }
+        }
+        if (columns[i].count_column < 0){
+            cout<<"Columnar NTuple count column missing for "<<columns[i].name<<": "<<columns[i].count_name<<endl;
+            exit(1);
+        }
+    }
+}
+
+Long64_t CCProtonPi0_ColumnarNTuple::GetNElements(const std::vector<ColumnarColumn>& columns, const ColumnarColumn& column) const
+{
+    if (column.count_column < 0) return column.len_static;
+
+    // Count leaves are integers
+    const ColumnarColumn& count = columns[column.count_column];
+    Long64_t n = 0;
+    if (count.elem_size == 8) { Long64_t v; memcpy(&v, count.address, 8); n = v; }
+    else if (count.elem_size == 4) { Int_t v; memcpy(&v, count.address, 4); n = v; }
+    else if (count.elem_size == 2) { Short_t v; memcpy(&v, count.address, 2); n = v; }
+    else { Char_t v; memcpy(&v, count.address, 1); n = v; }
+
+    if (n < 0) n = 0;
+    return n * column.len_static;
+}
+
+#endif
+
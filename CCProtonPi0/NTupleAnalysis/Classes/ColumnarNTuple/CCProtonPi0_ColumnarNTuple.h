@@ -0,0 +1,95 @@
+#ifndef CCProtonPi0_ColumnarNTuple_h
+#define CCProtonPi0_ColumnarNTuple_h
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <TChain.h>
+#include <TChainElement.h>
+#include <TBranch.h>
+#include <TLeaf.h>
+#include <TSystem.h>
+
+// Single variable of the Columnar NTuple
+//      Data File:  <name>.col -- Flat little-endian array of all entries
+//      Index File: <name>.idx -- Element offsets (nEntries+1) for variable size arrays
+struct ColumnarColumn
+{
+    std::string name;
+    std::string type;
+    std::string count_name;     // Count leaf for variable size arrays, "-" otherwise
+    int elem_size;
+    int len_static;
+    int count_column;           // Index of the count column, -1 for fixed size
+    char* address;              // Branch address in the Analyzer
+
+    // Write Mode
+    std::ofstream* data_file;
+    std::vector<Long64_t> offsets;
+
+    // Read Mode
+    const char* data;
+    const Long64_t* index;
+    size_t data_size;
+    size_t index_size;
+};
+
+// Columns of a single Reduced NTuple
+struct ColumnarSegment
+{
+    std::string dir;
+    Long64_t nEntries;
+    Long64_t first_entry;       // Entry number in the Chain
+    std::vector<ColumnarColumn> columns;
+};
+
+class CCProtonPi0_ColumnarNTuple
+{
+    public:
+        CCProtonPi0_ColumnarNTuple();
+        ~CCProtonPi0_ColumnarNTuple();
+
+        // Columnar directory for a Reduced NTuple: X.root -> X_Columnar/
+        static std::string GetColumnarDir(std::string rootFileName);
+
+        // Write Mode -- Used in reduce()
+        void OpenWrite(std::string dir, TChain* fChain, const std::vector<std::string>& column_names);
+        void Fill();
+        void Close();
+
+        // Read Mode -- Used in analyze(), one segment for each file in the Chain
+        void OpenRead(TChain* fChain);
+        bool LoadEntry(Long64_t entry);
+        Long64_t GetEntries() const { return nEntries; }
+        Long64_t GetEntrySize() const { return entry_size; }
+
+    private:
+        bool isWriteMode;
+        bool isReadMode;
+        Long64_t nEntries;
+        Long64_t entry_size;    // Bytes copied for the last entry
+        int current_segment;
+        std::vector<ColumnarSegment> segments;
+
+        static bool IsLittleEndian();
+        void SetColumn(ColumnarColumn& column, TChain* fChain, std::string name);
+        void SetCountColumns(std::vector<ColumnarColumn>& columns);
+        Long64_t GetNElements(const std::vector<ColumnarColumn>& columns, const ColumnarColumn& column) const;
+        void WriteSchema(const ColumnarSegment& segment);
+        void ReadSegment(ColumnarSegment& segment, TChain* fChain);
+        const char* MapFile(std::string file_name, size_t& size);
+        void UnmapAll();
+};
+
+#endif
+
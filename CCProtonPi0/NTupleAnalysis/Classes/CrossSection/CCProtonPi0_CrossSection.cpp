@@ -14,6 +14,13 @@ CCProtonPi0_CrossSection::CCProtonPi0_CrossSection(bool isMC) : CCProtonPi0_NTup
     
     m_isMC = isMC;
 
+    // Native Unfolding unfolds all universes of an error band together
+    //      Default is MnvUnfold (RooUnfold) -- See CCProtonPi0_BayesUnfold::isDefault
+    isNativeUnfolding = CCProtonPi0_BayesUnfold::isDefault;
+
+    // Per universe details of the Background Subtraction in the Log File
+    isVerboseLog = false;
+
     // Open output Log File
     if (m_isMC){
         text_out_name = Folder_List::output + Folder_List::textOut + "CrossSection_Log_MC.txt";
@@ -29,10 +36,15 @@ CCProtonPi0_CrossSection::CCProtonPi0_CrossSection(bool isMC) : CCProtonPi0_NTup
     std::cout<<"Done!"<<std::endl;
 }
 
-void CCProtonPi0_CrossSection::Calc_CrossSections()
+void CCProtonPi0_CrossSection::Calc_CrossSections(int nWorkers)
 {
     Calc_Normalized_NBackground();
 
+    if (nWorkers > 1){
+        Calc_CrossSections_Parallel(nWorkers);
+        return;
+    }
+
     // Regular Cross Section Calculation
     Calc_CrossSection(muon_P);   
     Calc_CrossSection(muon_theta);   
@@ -101,6 +113,110 @@ void CCProtonPi0_CrossSection::Calc_CrossSections()
     writeHistograms();
 }
 
+std::vector<XSec*> CCProtonPi0_CrossSection::GetAllXSecs()
+{
+    std::vector<XSec*> all;
+    all.push_back(&muon_P);
+    all.push_back(&muon_theta);
+    all.push_back(&pi0_P);
+    all.push_back(&pi0_KE);
+    all.push_back(&pi0_theta);
+    all.push_back(&QSq);
+    all.push_back(&W);
+    all.push_back(&Enu);
+    all.push_back(&deltaInvMass);
+    all.push_back(&Delta_pi_theta);
+    all.push_back(&Delta_pi_phi);
+    return all;
+}
+
+/*
+ *  Variables are independent after N(Background) is estimated
+ *      Each worker is a forked process -- ROOT and MnvUnfold are not thread safe
+ *      All input histograms are in memory before the fork, workers do not read shared files
+ *      Workers write the task log and histograms to their own files
+ *      Logs and histograms are copied to the output in variable order
+ */
+void CCProtonPi0_CrossSection::Calc_CrossSections_Parallel(int nWorkers)
+{
+    std::vector<XSec*> all = GetAllXSecs();
+    int nTasks = all.size();
+    std::cout<<"Running "<<nTasks<<" Cross Section Tasks on "<<nWorkers<<" Workers"<<std::endl;
+
+    // Nothing buffered must be written twice by the workers
+    text_out.flush();
+    std::cout.flush();
+
+    std::map<pid_t, int> running;
+    int next_task = 0;
+    bool isFailed = false;
+    while (next_task < nTasks || !running.empty()){
+        // Start a new task whenever a worker is free
+        while (next_task < nTasks && (int)running.size() < nWorkers){
+            pid_t pid = fork();
+            if (pid < 0){
+                std::cout<<"Cannot start Cross Section Task "<<next_task<<"! Exiting!..."<<std::endl;
+                exit(1);
+            }
+            if (pid == 0){
+                Calc_CrossSection_Task(*all[next_task], next_task);
+                // Skip ROOT cleanup -- Parent owns the open output file
+                _exit(0);
+            }
+            running[pid] = next_task;
+            next_task++;
+        }
+
+        int status;
+        pid_t pid = wait(&status);
+        if (pid < 0) break;
+        if (!WIFEXITED(status) || WEXITSTATUS(status) != 0){
+            std::cout<<"Cross Section Task "<<running[pid]<<" Failed!"<<std::endl;
+            isFailed = true;
+        }
+        running.erase(pid);
+    }
+    if (isFailed) exit(1);
+
+    writeHistograms_Tasks(nTasks);
+}
+
+void CCProtonPi0_CrossSection::Calc_CrossSection_Task(XSec &var, int task_id)
+{
+    // Task Log -- Appended to the main log after all tasks finish
+    text_out.close();
+    std::string log_name = GetPartitionFileName(text_out_name, task_id);
+    text_out.open(log_name.c_str());
+    if (!text_out.is_open()){
+        std::cout<<"Cannot open task log: "<<log_name<<std::endl;
+        _exit(1);
+    }
+
+    Calc_CrossSection_AllTypes(var);
+
+    std::string task_file = GetPartitionFileName(rootDir_out, task_id);
+    TFile* f_task = new TFile(task_file.c_str(), "RECREATE");
+    if (f_task->IsZombie()){
+        std::cout<<"Cannot open task file: "<<task_file<<std::endl;
+        _exit(1);
+    }
+    f_task->cd();
+    writeHistograms(var);
+    f_task->Close();
+
+    text_out.close();
+    std::cout.flush();
+}
+
+void CCProtonPi0_CrossSection::Calc_CrossSection_AllTypes(XSec &var)
+{
+    Calc_CrossSection(var);
+    Calc_CrossSection_AfterFSI(var);
+    Calc_CrossSection_BeforeFSI(var);
+    Calc_CrossSection_FSIType(var);
+    Calc_CrossSection_IntType(var);
+}
+
 void CCProtonPi0_CrossSection::Calc_CrossSection(XSec &var)
 {
     std::cout<<"\n-----------------------------------------------------------------------"<<std::endl;
@@ -301,28 +417,107 @@ void CCProtonPi0_CrossSection::Calc_Normalized_NBackground()
 
 void CCProtonPi0_CrossSection::NormalizeHistogram(TH1D* h)
 {
-    text_out<<"\tNormalizing Background Shape on TH1D"<<std::endl;
     int NBins = h->GetNbinsX();
     double area = h->Integral();
     double nOverFlow = h->GetBinContent(NBins+1);
     double nUnderFlow = h->GetBinContent(0);
-    text_out<<"\t\tBefore Norm = "<<area<<std::endl;
     h->Scale(1/(area+nOverFlow+nUnderFlow));
-    text_out<<"\t\tAfter Norm = "<<h->Integral()<<std::endl;
-    text_out<<"\tDone!"<<std::endl;
+    if (isVerboseLog){
+        text_out<<"\tNormalizing Background Shape on TH1D"<<std::endl;
+        text_out<<"\t\tBefore Norm = "<<area<<std::endl;
+        text_out<<"\t\tAfter Norm = "<<h->Integral()<<std::endl;
+        text_out<<"\tDone!"<<std::endl;
+    }
 }
 
 void CCProtonPi0_CrossSection::NormalizeHistogram(MnvH1D* h)
 {
-    text_out<<"\tNormalizing Background Shape on MnvH1D"<<std::endl;
     int NBins = h->GetNbinsX();
     double area = h->Integral();
     double nOverFlow = h->GetBinContent(NBins+1);
     double nUnderFlow = h->GetBinContent(0);
-    text_out<<"\t\tBefore Norm = "<<area<<std::endl;
     h->Scale(1/(area+nOverFlow+nUnderFlow),"",false); // Scale only on CentralValue
-    text_out<<"\t\tAfter Norm = "<<h->Integral()<<std::endl;
-    text_out<<"\tDone!"<<std::endl;
+    if (isVerboseLog){
+        text_out<<"\tNormalizing Background Shape on MnvH1D"<<std::endl;
+        text_out<<"\t\tBefore Norm = "<<area<<std::endl;
+        text_out<<"\t\tAfter Norm = "<<h->Integral()<<std::endl;
+        text_out<<"\tDone!"<<std::endl;
+    }
+}
+
+/*
+ *  Universe Stack Operations
+ *      Bin contents and errors of all universes are packed as [universe][bin]
+ *      Bins include underflow and overflow
+ */
+void CCProtonPi0_CrossSection::PackUniverses(std::vector<TH1D*> &universes, int nBins, std::vector<double> &contents, std::vector<double> &err2)
+{
+    contents.resize(universes.size()*nBins);
+    err2.resize(universes.size()*nBins);
+    for (unsigned int i = 0; i < universes.size(); ++i){
+        // Same as TH1::Scale -- Errors are kept for all universes
+        if (universes[i]->GetSumw2N() == 0) universes[i]->Sumw2();
+        std::copy(universes[i]->GetArray(), universes[i]->GetArray() + nBins, &contents[i*nBins]);
+        std::copy(universes[i]->GetSumw2()->GetArray(), universes[i]->GetSumw2()->GetArray() + nBins, &err2[i*nBins]);
+    }
+}
+
+void CCProtonPi0_CrossSection::UnpackUniverses(std::vector<TH1D*> &universes, int nBins, const std::vector<double> &contents, const std::vector<double> &err2)
+{
+    for (unsigned int i = 0; i < universes.size(); ++i){
+        std::copy(&contents[i*nBins], &contents[i*nBins] + nBins, universes[i]->GetArray());
+        std::copy(&err2[i*nBins], &err2[i*nBins] + nBins, universes[i]->GetSumw2()->GetArray());
+    }
+}
+
+/*
+ *  Single pass over the packed universes, for each universe:
+ *      Normalize Background Shape (Unit Area including Overflow)
+ *      Scale to N(Background) in the universe
+ *      Subtract from Data
+ *  Same operations in the same order as NormalizeHistogram, TH1::Scale and TH1::Add
+ */
+void CCProtonPi0_CrossSection::Subtract_Background_Universes(int nUniverses, int nBins, const double* N_Bckg)
+{
+    for (int i = 0; i < nUniverses; ++i){
+        double* bckg = &unv_bckg[i*nBins];
+        double* bckg_err2 = &unv_bckg_err2[i*nBins];
+        double* subtracted = &unv_subtracted[i*nBins];
+        double* subtracted_err2 = &unv_subtracted_err2[i*nBins];
+
+        double area = 0.0;
+        for (int b = 1; b < nBins-1; ++b) area += bckg[b];
+        const double norm = 1/(area + bckg[nBins-1] + bckg[0]);
+        const double nBckg = N_Bckg[i];
+
+        for (int b = 0; b < nBins; ++b){
+            bckg[b] = (bckg[b] * norm) * nBckg;
+            bckg_err2[b] = (bckg_err2[b] * (norm*norm)) * (nBckg*nBckg);
+            subtracted[b] += -1 * bckg[b];
+            subtracted_err2[b] += bckg_err2[b];
+        }
+    }
+}
+
+void CCProtonPi0_CrossSection::GetUniverseNames(MnvH1D* hist, std::vector<std::string> &err_bands, std::vector<int> &hist_ind)
+{
+    std::vector<std::string> vert_errs = hist->GetVertErrorBandNames();
+    for (unsigned int i = 0; i < vert_errs.size(); ++i){
+        unsigned int nHists = hist->GetVertErrorBand(vert_errs[i])->GetNHists();
+        for (unsigned int j = 0; j < nHists; ++j){
+            err_bands.push_back(vert_errs[i]);
+            hist_ind.push_back(j);
+        }
+    }
+
+    std::vector<std::string> lat_errs = hist->GetLatErrorBandNames();
+    for (unsigned int i = 0; i < lat_errs.size(); ++i){
+        unsigned int nHists = hist->GetLatErrorBand(lat_errs[i])->GetNHists();
+        for (unsigned int j = 0; j < nHists; ++j){
+            err_bands.push_back(lat_errs[i]);
+            hist_ind.push_back(j);
+        }
+    }
 }
 
 MnvH1D* CCProtonPi0_CrossSection::Subtract_Background(MnvH1D* data, MnvH1D* mc_bckg, MnvH1D* &bckg_estimated, std::string var_name)
@@ -380,50 +575,54 @@ MnvH1D* CCProtonPi0_CrossSection::Subtract_Background(MnvH1D* data, MnvH1D* mc_b
     // ------------------------------------------------------------------------
     // >> These are "Pointers" NOT "new" histograms
     // >> This vector does "NOT" include Central Value Histogram
-    std::vector<TH1D*> data_all_universes;
     std::vector<TH1D*> bckg_subtracted_all_universes;
     std::vector<TH1D*> mc_bckg_all_universes;
     
-    GetPointersAllUniverses(data, data_all_universes);
     GetPointersAllUniverses(bckg_subtracted, bckg_subtracted_all_universes);
     GetPointersAllUniverses(mc_bckg, mc_bckg_all_universes);
 
-    text_out<<"N(Universes) = "<<data_all_universes.size()<<std::endl;
+    text_out<<"N(Universes) = "<<mc_bckg_all_universes.size()<<std::endl;
    
     // Sanity Check
     if ( bckg_subtracted_all_universes.size() != mc_bckg_all_universes.size()){
         text_out<<"WARNING! - Subtract Background N(Universes) NOT Same!"<<std::endl;
         exit(1);
     }
-    
-    // Get Universes Names  -- For Logging purposes only
-    std::vector<TH1D*> dummy_hists;
-    std::vector<std::string> err_bands;
-    std::vector<int> hist_ind;
 
-    GetAllUniverses(data, dummy_hists, err_bands, hist_ind);
-    ClearAllUniversesVector(dummy_hists);
+    // Background Subtracted Data Area before subtraction -- For Logging purposes only
+    std::vector<double> data_area;
+    if (isVerboseLog){
+        for (unsigned int i = 0; i < bckg_subtracted_all_universes.size(); ++i){
+            data_area.push_back(bckg_subtracted_all_universes[i]->Integral());
+        }
+    }
+
+    // Subtract Background in All Universes on the packed [universe][bin] buffers
+    const int nBins = mc_bckg->GetNbinsX() + 2;
+    PackUniverses(mc_bckg_all_universes, nBins, unv_bckg, unv_bckg_err2);
+    PackUniverses(bckg_subtracted_all_universes, nBins, unv_subtracted, unv_subtracted_err2);
+    Subtract_Background_Universes(mc_bckg_all_universes.size(), nBins, &N_Bckg[1]);
+    UnpackUniverses(mc_bckg_all_universes, nBins, unv_bckg, unv_bckg_err2);
+    UnpackUniverses(bckg_subtracted_all_universes, nBins, unv_subtracted, unv_subtracted_err2);
 
-    // Loop Over All Universes
+    // Number of Entries after subtraction, same as TH1::Add
     for (unsigned int i = 0; i < bckg_subtracted_all_universes.size(); ++i){
-        text_out<<"\tSubtracting Background in Error Band: "<<err_bands[i+1]<<" Universe = "<<hist_ind[i+1]<<std::endl;
-       
-        // Get Shape of Background
-        //      Unit area -- Including Overflow
-        //      After Normalization, Area MUST be less than 1
-        NormalizeHistogram(mc_bckg_all_universes[i]);
-
-        // Estimate N Background in Variable
-        mc_bckg_all_universes[i]->Scale(N_Bckg[i+1]);
-
-        text_out<<"\tBackground Subtracted Data = "<<bckg_subtracted_all_universes[i]->Integral()<<std::endl;
-        // Subtracted Background
-        bckg_subtracted_all_universes[i]->Add(mc_bckg_all_universes[i],-1);
-       
-        text_out<<"\tTotal Data Area = "<<data_all_universes[i]->Integral()<<std::endl;
-        text_out<<"\tEstimated Background in Data = "<<mc_bckg_all_universes[i]->Integral()<<std::endl;
-        text_out<<"\tBackground Subtracted Data = "<<bckg_subtracted_all_universes[i]->Integral()<<std::endl;
-        text_out<<std::endl;
+        double entries = bckg_subtracted_all_universes[i]->GetEntries() - mc_bckg_all_universes[i]->GetEntries();
+        bckg_subtracted_all_universes[i]->SetEntries(fabs(entries));
+    }
+
+    if (isVerboseLog){
+        std::vector<std::string> err_bands;
+        std::vector<int> hist_ind;
+        GetUniverseNames(data, err_bands, hist_ind);
+        for (unsigned int i = 0; i < bckg_subtracted_all_universes.size(); ++i){
+            text_out<<"\tSubtracting Background in Error Band: "<<err_bands[i]<<" Universe = "<<hist_ind[i]<<std::endl;
+            text_out<<"\tBackground Subtracted Data = "<<data_area[i]<<std::endl;
+            text_out<<"\tTotal Data Area = "<<data_area[i]<<std::endl;
+            text_out<<"\tEstimated Background in Data = "<<mc_bckg_all_universes[i]->Integral()<<std::endl;
+            text_out<<"\tBackground Subtracted Data = "<<bckg_subtracted_all_universes[i]->Integral()<<std::endl;
+            text_out<<std::endl;
+        }
     }
 
     // Correct MnvErrorBand Central Values -- Errors Calculated wrt ErrBand CV in Plotting
@@ -460,8 +659,12 @@ MnvH1D* CCProtonPi0_CrossSection::Unfold_Data(MnvH1D* bckg_subtracted, MnvH2D* r
 
     std::cout<<"\tNumber of iterations = "<<nIter<<std::endl;
 
-    // Use MnvUnfold to Unfold Data
-    MinervaUnfold::MnvUnfold::Get().UnfoldHisto(unfolded, response, bckg_subtracted, RooUnfold::kBayes, nIter, true);
+    if (isNativeUnfolding){
+        unfolded = bayesUnfold.UnfoldHisto(response, bckg_subtracted, nIter);
+    }else{
+        // Use MnvUnfold to Unfold Data
+        MinervaUnfold::MnvUnfold::Get().UnfoldHisto(unfolded, response, bckg_subtracted, RooUnfold::kBayes, nIter, true);
+    }
 
     // Set Name of the Histogram
     std::string hist_name = var_name + "_unfolded";
@@ -473,6 +676,123 @@ MnvH1D* CCProtonPi0_CrossSection::Unfold_Data(MnvH1D* bckg_subtracted, MnvH2D* r
     return unfolded;
 }
 
+/*
+ *  Unfolds MC Reco Signal of each variable with both methods
+ *      Reports the time per unfolding and the largest relative difference
+ *      in CV, CV Errors and all universes
+ *      A variable passes the parity check if all three differences are within
+ *      CCProtonPi0_BayesUnfold::parityTolerance
+ *      Results are also written to Unfolding_Parity_MC.txt (or _Data.txt)
+ *  Returns true if all variables pass
+ */
+bool CCProtonPi0_CrossSection::Benchmark_Unfolding(int nRepeat)
+{
+    std::vector<XSec*> all = GetAllXSecs();
+    bool isAllPassed = true;
+
+    std::string parity_name = Folder_List::output + Folder_List::textOut;
+    parity_name += m_isMC ? "Unfolding_Parity_MC.txt" : "Unfolding_Parity_Data.txt";
+    std::ofstream parity_out;
+    OpenTextFile(parity_name, parity_out);
+    parity_out<<"Native Bayesian Unfolding vs MnvUnfold -- Tolerance (max relative diff) = "<<CCProtonPi0_BayesUnfold::parityTolerance<<std::endl;
+    parity_out<<std::left;
+    parity_out<<std::setw(20)<<"Variable"<<std::setw(15)<<"Max Diff CV"<<std::setw(15)<<"Max Diff Err"<<std::setw(15)<<"Max Diff Unv"<<"Result"<<std::endl;
+
+    std::cout<<std::left;
+    std::cout<<std::setw(20)<<"Variable"<<std::setw(15)<<"MnvUnfold [s]"<<std::setw(15)<<"Native [s]"<<std::setw(10)<<"Speedup";
+    std::cout<<std::setw(15)<<"Max Diff CV"<<std::setw(15)<<"Max Diff Err"<<std::setw(15)<<"Max Diff Unv"<<"Result"<<std::endl;
+
+    for (unsigned int i = 0; i < all.size(); ++i){
+        XSec& var = *all[i];
+
+        TStopwatch timer;
+        MnvH1D* unfolded_mnv = NULL;
+        timer.Start();
+        for (int n = 0; n < nRepeat; ++n){
+            delete unfolded_mnv;
+            unfolded_mnv = NULL;
+            MinervaUnfold::MnvUnfold::Get().UnfoldHisto(unfolded_mnv, var.response, var.mc_reco_signal, RooUnfold::kBayes, var.nIterations, true);
+        }
+        timer.Stop();
+        double time_mnv = timer.RealTime() / nRepeat;
+
+        MnvH1D* unfolded_native = NULL;
+        timer.Start();
+        for (int n = 0; n < nRepeat; ++n){
+            delete unfolded_native;
+            unfolded_native = bayesUnfold.UnfoldHisto(var.response, var.mc_reco_signal, var.nIterations);
+        }
+        timer.Stop();
+        double time_native = timer.RealTime() / nRepeat;
+
+        double diff_cv = GetMaxRelativeDiff((TH1*)unfolded_native, (TH1*)unfolded_mnv);
+        double diff_err = GetMaxRelativeDiff((TH1*)unfolded_native, (TH1*)unfolded_mnv, true);
+        double diff_unv = GetMaxRelativeDiff(unfolded_native, unfolded_mnv);
+
+        // diff_unv < 0 : Native result is missing an Error Band
+        const double tolerance = CCProtonPi0_BayesUnfold::parityTolerance;
+        bool isPassed = diff_cv <= tolerance && diff_err <= tolerance && diff_unv >= 0.0 && diff_unv <= tolerance;
+        if (!isPassed) isAllPassed = false;
+        std::string result = isPassed ? "PASS" : "FAIL";
+
+        std::cout<<std::setw(20)<<var.name<<std::setw(15)<<time_mnv<<std::setw(15)<<time_native<<std::setw(10)<<time_mnv/time_native;
+        std::cout<<std::setw(15)<<diff_cv<<std::setw(15)<<diff_err<<std::setw(15)<<diff_unv<<result<<std::endl;
+        parity_out<<std::setw(20)<<var.name<<std::setw(15)<<diff_cv<<std::setw(15)<<diff_err<<std::setw(15)<<diff_unv<<result<<std::endl;
+
+        delete unfolded_mnv;
+        delete unfolded_native;
+    }
+
+    std::string summary = isAllPassed ? "Parity Check PASSED for all variables" : "Parity Check FAILED -- Keep MnvUnfold as the default";
+    std::cout<<summary<<std::endl;
+    parity_out<<summary<<std::endl;
+    parity_out.close();
+
+    return isAllPassed;
+}
+
+double CCProtonPi0_CrossSection::GetMaxRelativeDiff(MnvH1D* h1, MnvH1D* h2)
+{
+    double max_diff = 0.0;
+
+    std::vector<std::string> vert_names = h2->GetVertErrorBandNames();
+    for (unsigned int i = 0; i < vert_names.size(); ++i){
+        if (!h1->HasVertErrorBand(vert_names[i])) return -1.0;
+        MnvVertErrorBand* band1 = h1->GetVertErrorBand(vert_names[i]);
+        MnvVertErrorBand* band2 = h2->GetVertErrorBand(vert_names[i]);
+        for (unsigned int unv = 0; unv < band2->GetNHists(); ++unv){
+            double diff = GetMaxRelativeDiff(band1->GetHist(unv), band2->GetHist(unv));
+            if (diff > max_diff) max_diff = diff;
+        }
+    }
+
+    std::vector<std::string> lat_names = h2->GetLatErrorBandNames();
+    for (unsigned int i = 0; i < lat_names.size(); ++i){
+        if (!h1->HasLatErrorBand(lat_names[i])) return -1.0;
+        MnvLatErrorBand* band1 = h1->GetLatErrorBand(lat_names[i]);
+        MnvLatErrorBand* band2 = h2->GetLatErrorBand(lat_names[i]);
+        for (unsigned int unv = 0; unv < band2->GetNHists(); ++unv){
+            double diff = GetMaxRelativeDiff(band1->GetHist(unv), band2->GetHist(unv));
+            if (diff > max_diff) max_diff = diff;
+        }
+    }
+
+    return max_diff;
+}
+
+double CCProtonPi0_CrossSection::GetMaxRelativeDiff(TH1* h1, TH1* h2, bool isError)
+{
+    double max_diff = 0.0;
+    for (int i = 1; i <= h2->GetNbinsX(); ++i){
+        double v1 = isError ? h1->GetBinError(i) : h1->GetBinContent(i);
+        double v2 = isError ? h2->GetBinError(i) : h2->GetBinContent(i);
+        if (v2 == 0) continue;
+        double diff = fabs(v1 - v2) / fabs(v2);
+        if (diff > max_diff) max_diff = diff;
+    }
+    return max_diff;
+}
+
 MnvH1D* CCProtonPi0_CrossSection::Efficiency_Divide(MnvH1D* unfolded, MnvH1D* eff, std::string var_name)
 {
     std::cout<<"Efficiency Correction for "<<var_name<<std::endl;
@@ -615,18 +935,40 @@ void CCProtonPi0_CrossSection::initHistograms()
 
 void CCProtonPi0_CrossSection::initFluxHistograms()
 {
-    // Get Reweighted Flux Histogram
-    delete frw;
-    frw = new FluxReweighter(14, applyNuEConstraint, FluxReweighter::minervaLE_FHC, new_flux, old_flux);
-    h_flux_minervaLE_FHC = new MnvH1D (*(frw->GetFluxReweighted(14)));
-    h_flux_minervaLE_FHC->SetName("h_flux_minervaLE_FHC");
-    h_flux_minervaLE_FHC->Scale(1/mSq_to_cmSq); // Our measurement scale is cm2
-
-    // Flux Universes have different integrals -- We need to get them
-    IntegrateAllFluxUniverses();
+    // Flux Histograms change only if one of the inputs changes
+    //      FluxReweighter reads its flux files from $PLOTUTILSROOT/data/flux
+    CCProtonPi0_FluxCache fluxCache(rootDir_out);
+    std::string plotUtilsRoot = getenv("PLOTUTILSROOT") ? getenv("PLOTUTILSROOT") : "";
+    fluxCache.AddKey(plotUtilsRoot);
+    fluxCache.AddKeyDirectory(plotUtilsRoot + "/data/flux");
+    fluxCache.AddKey((double)applyNuEConstraint);
+    fluxCache.AddKey((double)new_flux);
+    fluxCache.AddKey((double)old_flux);
+    fluxCache.AddKey((double)FluxReweighter::minervaLE_FHC);
+    fluxCache.AddKey(mSq_to_cmSq);
+    fluxCache.AddKey(binList.a_Enu, binList.size_Enu+1);
+    fluxCache.AddKey(binList.a_Enu_Fine, binList.size_Enu_Fine+1);
+    fluxCache.AddKey((double)flux_integral_min_bin);
+    fluxCache.AddKey((double)flux_integral_max_bin);
+
+    if (!fluxCache.Load(h_flux_minervaLE_FHC, h_flux_rebinned, h_flux_rebinned_BeforeFSI, cv_flux_integral, unv_flux_integral)){
+        // Get Reweighted Flux Histogram
+        delete frw;
+        frw = new FluxReweighter(14, applyNuEConstraint, FluxReweighter::minervaLE_FHC, new_flux, old_flux);
+        h_flux_minervaLE_FHC = new MnvH1D (*(frw->GetFluxReweighted(14)));
+        h_flux_minervaLE_FHC->SetName("h_flux_minervaLE_FHC");
+        h_flux_minervaLE_FHC->Scale(1/mSq_to_cmSq); // Our measurement scale is cm2
+
+        // Flux Universes have different integrals -- We need to get them
+        IntegrateAllFluxUniverses();
+
+        // Rebin the Flux Histogram for Neutrino Energy Divide() Operation
+        RebinFluxHistogram();
+
+        fluxCache.Save(h_flux_minervaLE_FHC, h_flux_rebinned, h_flux_rebinned_BeforeFSI, cv_flux_integral, unv_flux_integral);
+    }
 
-    // Rebin the Flux Histogram for Neutrino Energy Divide() Operation
-    RebinFluxHistogram();
+    writeFluxIntegrals();
 
     // Add Missing Error Bands after rebinning
     AddErrorBands_FluxHistogram();
@@ -899,21 +1241,40 @@ void CCProtonPi0_CrossSection::AddErrorBands_FluxHistogram()
 void CCProtonPi0_CrossSection::IntegrateAllFluxUniverses()
 {
     // Integrate for Central Value
-    cv_flux_integral = h_flux_minervaLE_FHC->Integral(4,30,"width"); // Whole Range 1.5-20 GeV
-    //cv_flux_integral = h_flux_minervaLE_FHC->Integral(4,8,"width"); // Low Enu 1.5-4.0 GeV
-    //cv_flux_integral = h_flux_minervaLE_FHC->Integral(8,20,"width"); // High Enu 4.0-10 GeV
-    text_out<<"Signal Region Flux Integrals"<<std::endl;    
-    text_out<<"\tCentral Value = "<<cv_flux_integral<<std::endl;    
+    cv_flux_integral = h_flux_minervaLE_FHC->Integral(flux_integral_min_bin,flux_integral_max_bin,"width");
     
     // Integrate Flux Error Band Universes
     MnvVertErrorBand* flux_err_band = h_flux_minervaLE_FHC->GetVertErrorBand("Flux");
     const std::vector<TH1D*> flux_err_band_universes = flux_err_band->GetHists();
 
+    unv_flux_integral.clear();
     for (unsigned int i = 0; i < flux_err_band_universes.size(); ++i){
-        double temp_integral = flux_err_band_universes[i]->Integral(4,30,"width"); // Whole Range 1.5-20 GeV
-        //double temp_integral = flux_err_band_universes[i]->Integral(4,8,"width"); // Low Enu 1.5-4.0 GeV
-        //double temp_integral = flux_err_band_universes[i]->Integral(8,20,"width"); // High Enu 4.0-10 GeV
+        double temp_integral = flux_err_band_universes[i]->Integral(flux_integral_min_bin,flux_integral_max_bin,"width");
         unv_flux_integral.push_back(temp_integral);
+    }
+}
+
+void CCProtonPi0_CrossSection::writeFluxIntegrals()
+{
+    text_out<<"Signal Region Flux Integrals"<<std::endl;    
+    text_out<<"\tCentral Value = "<<cv_flux_integral<<std::endl;    
+    for (unsigned int i = 0; i < unv_flux_integral.size(); ++i){
+        text_out<<"\tFlux Unv "<<i<<" = "<<unv_flux_integral[i]<<std::endl;
+    }
+
+    // ------------------------------------------------------------------------
+    // Check Rebinned Flux Histogram Integrals -- For Testing
+    // ------------------------------------------------------------------------
+    text_out<<"Testing! -- Rebinned Flux Integrals"<<std::endl;
+    // Integrate for Central Value
+    text_out<<"Signal Region Flux Integrals"<<std::endl;    
+    text_out<<"\tCentral Value = "<<h_flux_rebinned->Integral(2,12,"width")<<std::endl;    
+    // Integrate Flux Error Band Universes
+    MnvVertErrorBand* flux_err_band = h_flux_rebinned->GetVertErrorBand("Flux");
+    const std::vector<TH1D*> flux_err_band_universes = flux_err_band->GetHists();
+
+    for (unsigned int i = 0; i < flux_err_band_universes.size(); ++i){
+        double temp_integral = flux_err_band_universes[i]->Integral(2,12,"width");
         text_out<<"\tFlux Unv "<<i<<" = "<<temp_integral<<std::endl;
     }
 }
@@ -950,22 +1311,6 @@ void CCProtonPi0_CrossSection::RebinFluxHistogram()
         RebinFluxHistogram(rebinned_flux_err_unv[unv], reference_flux_err_unv[unv]); 
     }
 
-    // ------------------------------------------------------------------------
-    // Check Rebinned Flux Histogram Integrals -- For Testing
-    // ------------------------------------------------------------------------
-    text_out<<"Testing! -- Rebinned Flux Integrals"<<std::endl;
-    // Integrate for Central Value
-    text_out<<"Signal Region Flux Integrals"<<std::endl;    
-    text_out<<"\tCentral Value = "<<h_flux_rebinned->Integral(2,12,"width")<<std::endl;    
-    // Integrate Flux Error Band Universes
-    MnvVertErrorBand* flux_err_band = h_flux_rebinned->GetVertErrorBand("Flux");
-    const std::vector<TH1D*> flux_err_band_universes = flux_err_band->GetHists();
-
-    for (unsigned int i = 0; i < flux_err_band_universes.size(); ++i){
-        double temp_integral = flux_err_band_universes[i]->Integral(2,12,"width");
-        text_out<<"\tFlux Unv "<<i<<" = "<<temp_integral<<std::endl;
-    }
-
     // ------------------------------------------------------------------------
     // Before and After FSI -- Fine Binned Simulation
     // ------------------------------------------------------------------------
@@ -1080,12 +1425,66 @@ void CCProtonPi0_CrossSection::writeHistograms(XSec &var)
     var.response->Write();
 }
 
+void CCProtonPi0_CrossSection::writeHistograms_Tasks(int nTasks)
+{
+    std::cout<<">> Writing "<<rootDir_out<<" ("<<nTasks<<" Tasks)"<<std::endl;
+
+    f_out->cd();
+    writeHistograms_Common();
+
+    for (int task_id = 0; task_id < nTasks; ++task_id){
+        // Task Log
+        std::string log_name = GetPartitionFileName(text_out_name, task_id);
+        std::ifstream task_log(log_name.c_str());
+        if (!task_log.is_open()) RunTimeError("Cannot open task log " + log_name);
+        if (task_log.peek() != std::ifstream::traits_type::eof()) text_out<<task_log.rdbuf();
+        task_log.close();
+        remove(log_name.c_str());
+
+        // Task Histograms -- Copied in the order they were written
+        std::string task_file = GetPartitionFileName(rootDir_out, task_id);
+        TFile* f_task = new TFile(task_file.c_str());
+        if (f_task->IsZombie()) RunTimeError("Cannot open task file " + task_file);
+
+        TIter next(f_task->GetListOfKeys());
+        TKey* key;
+        while ((key = (TKey*)next())){
+            TObject* obj = key->ReadObj();
+            f_out->cd();
+            obj->Write();
+        }
+        f_task->Close();
+        delete f_task;
+        remove(task_file.c_str());
+    }
+
+    f_out->Close();
+}
+
 void CCProtonPi0_CrossSection::writeHistograms()
 {
     std::cout<<">> Writing "<<rootDir_out<<std::endl;
    
     f_out->cd();
+    writeHistograms_Common();
 
+    writeHistograms(muon_P);
+    writeHistograms(muon_theta);
+    writeHistograms(pi0_P);
+    writeHistograms(pi0_KE);
+    writeHistograms(pi0_theta);
+    writeHistograms(QSq);
+    writeHistograms(W);
+    writeHistograms(Enu);
+    writeHistograms(deltaInvMass);
+    writeHistograms(Delta_pi_theta);
+    writeHistograms(Delta_pi_phi);
+
+    f_out->Close();
+}
+
+void CCProtonPi0_CrossSection::writeHistograms_Common()
+{
     h_flux_minervaLE_FHC->Write();
     h_flux_rebinned->Write();
     h_flux_rebinned_BeforeFSI->Write();
@@ -1106,20 +1505,6 @@ void CCProtonPi0_CrossSection::writeHistograms()
     NuWro_deltaInvMass->Write();
     NuWro_Delta_pi_theta->Write();
     NuWro_Delta_pi_phi->Write();
-
-    writeHistograms(muon_P);
-    writeHistograms(muon_theta);
-    writeHistograms(pi0_P);
-    writeHistograms(pi0_KE);
-    writeHistograms(pi0_theta);
-    writeHistograms(QSq);
-    writeHistograms(W);
-    writeHistograms(Enu);
-    writeHistograms(deltaInvMass);
-    writeHistograms(Delta_pi_theta);
-    writeHistograms(Delta_pi_phi);
-
-    f_out->Close();
 }
 
 #endif
@@ -15,10 +15,16 @@
 // Classes
 #include "../NTupleAnalysis/CCProtonPi0_NTupleAnalysis.h"
 #include "../BinList/CCProtonPi0_BinList.h"
+#include "../BayesUnfold/CCProtonPi0_BayesUnfold.h"
+#include "../FluxCache/CCProtonPi0_FluxCache.h"
 #include "TObjArray.h"
 #include "TFractionFitter.h"
 #include <MinervaUnfold/MnvUnfold.h>
 #include <PlotUtils/TargetUtils.h>
+#include <TStopwatch.h>
+
+#include <unistd.h>
+#include <sys/wait.h>
 
 using namespace PlotUtils;
 
@@ -82,10 +88,23 @@ class CCProtonPi0_CrossSection : public CCProtonPi0_NTupleAnalysis
 {
     public:
         CCProtonPi0_CrossSection(bool isMC);
-        void Calc_CrossSections();
+        void Calc_CrossSections(int nWorkers = 1);
+
+        // Compares the native Bayesian Unfolding with MnvUnfold (Time and Result)
+        //      Returns true if the results agree within CCProtonPi0_BayesUnfold::parityTolerance
+        bool Benchmark_Unfolding(int nRepeat = 10);
     
     private:
         CCProtonPi0_BinList binList;
+        CCProtonPi0_BayesUnfold bayesUnfold;
+        bool isNativeUnfolding;
+        bool isVerboseLog;
+
+        // Packed Universes [universe][bin] for Background Subtraction
+        std::vector<double> unv_bckg;
+        std::vector<double> unv_bckg_err2;
+        std::vector<double> unv_subtracted;
+        std::vector<double> unv_subtracted_err2;
 
         bool m_isMC;
         double min_invMass;
@@ -100,6 +119,13 @@ class CCProtonPi0_CrossSection : public CCProtonPi0_NTupleAnalysis
         double cv_flux_integral;
         std::vector<double> unv_flux_integral;
 
+        // Flux Integral Range in h_flux_minervaLE_FHC bins
+        //      Whole Range 1.5-20 GeV:  4-30
+        //      Low Enu 1.5-4.0 GeV:     4-8
+        //      High Enu 4.0-10 GeV:     8-20
+        static const int flux_integral_min_bin = 4;
+        static const int flux_integral_max_bin = 30;
+
         //NuWro Predictions
         MnvH1D* NuWro_muon_P;
         MnvH1D* NuWro_muon_theta;
@@ -141,8 +167,18 @@ class CCProtonPi0_CrossSection : public CCProtonPi0_NTupleAnalysis
         
         std::string rootDir_out;
         
+        // Parallel Calculation -- Each variable is a separate task run by a worker process
+        //      Task outputs are written in variable order, same as the serial run
+        std::vector<XSec*> GetAllXSecs();
+        void Calc_CrossSections_Parallel(int nWorkers);
+        void Calc_CrossSection_Task(XSec &var, int task_id);
+        void Calc_CrossSection_AllTypes(XSec &var);
+        void writeHistograms_Tasks(int nTasks);
+        void writeHistograms_Common();
+
         // Functions
         void IntegrateAllFluxUniverses();
+        void writeFluxIntegrals();
         void AddErrorBands_FluxHistogram();
         void RebinFluxHistogram();
         void RebinFluxHistogram(TH1* rebinned, TH1* reference);
@@ -157,6 +193,10 @@ class CCProtonPi0_CrossSection : public CCProtonPi0_NTupleAnalysis
         void Calc_Normalized_NBackground();
         void NormalizeHistogram(TH1D* h);
         void NormalizeHistogram(MnvH1D* h);
+        void PackUniverses(std::vector<TH1D*> &universes, int nBins, std::vector<double> &contents, std::vector<double> &err2);
+        void UnpackUniverses(std::vector<TH1D*> &universes, int nBins, const std::vector<double> &contents, const std::vector<double> &err2);
+        void Subtract_Background_Universes(int nUniverses, int nBins, const double* N_Bckg);
+        void GetUniverseNames(MnvH1D* hist, std::vector<std::string> &err_bands, std::vector<int> &hist_ind);
         double GetFluxHistContent(TH1* hist, double low1, double low2);
         double GetSmallestBinWidth(MnvH1D* hist);
         void OpenRootFiles();
@@ -181,6 +221,8 @@ class CCProtonPi0_CrossSection : public CCProtonPi0_NTupleAnalysis
         void init_Delta_pi_phi();
         MnvH1D* Subtract_Background(MnvH1D* data, MnvH1D* mc_bckg, MnvH1D* &bckg_estimated, std::string var_name);
         MnvH1D* Unfold_Data(MnvH1D* bckg_subtracted, MnvH2D* response, std::string var_name, int nIter);
+        double GetMaxRelativeDiff(MnvH1D* h1, MnvH1D* h2);
+        double GetMaxRelativeDiff(TH1* h1, TH1* h2, bool isError = false);
         MnvH1D* Efficiency_Divide(MnvH1D* unfolded, MnvH1D* eff, std::string var_name);
         MnvH1D* Integrate_Flux(MnvH1D* data_efficiency_corrected, std::string var_name, std::string hist_name);
         MnvH1D* Calc_FinalCrossSection(MnvH1D* flux_integrated, std::string var_name, std::string hist_name);
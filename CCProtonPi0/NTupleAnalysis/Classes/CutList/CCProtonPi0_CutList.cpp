@@ -22,7 +22,7 @@ CCProtonPi0_CutList::CCProtonPi0_CutList(bool isModeReduce, bool isMC) : CCProto
         std::cout<<"\tRoot File: "<<rootDir<<std::endl;
 
         // Create Root File 
-        f = new TFile(rootDir.c_str(),"RECREATE");
+        f = new TFile(GetOutputFileName(rootDir).c_str(),"RECREATE");
         //f = new TFile(rootDir.c_str(),"CREATE");
         if (!f->IsOpen()){
             std::cout<<"File already exists! Exiting!..."<<std::endl;
@@ -820,6 +820,98 @@ void CCProtonPi0_CutList::writeSingleRow(ofstream &file, CCProtonPi0_Cut& curren
     file<<std::endl;
 }
 
+std::vector<CCProtonPi0_Cut*> CCProtonPi0_CutList::GetAllCuts()
+{
+    std::vector<CCProtonPi0_Cut*> all;
+    all.push_back(&nCut_All);
+    all.push_back(&nCut_Vertex_None);
+    all.push_back(&nCut_Vertex_Not_Reconstructable); 
+    all.push_back(&nCut_Vertex_Not_Fiducial);
+    all.push_back(&nCut_Muon_None);              
+    all.push_back(&nCut_Muon_Angle);
+    all.push_back(&nCut_Muon_Charge);
+    all.push_back(&nCut_Vertex_Michel_Exist); 
+    all.push_back(&nCut_EndPoint_Michel_Exist);
+    all.push_back(&nCut_secEndPoint_Michel_Exist);
+    all.push_back(&nCut_Particle_None);
+    all.push_back(&nCut_Proton_None);            
+    all.push_back(&nCut_Proton_Bad);            
+    all.push_back(&nCut_ProtonScore);
+    all.push_back(&nCut_PreFilter_Pi0);
+    all.push_back(&nCut_ConeBlobs);
+    all.push_back(&nCut_BlobDirectionBad);
+    all.push_back(&nCut_Pi0_Bad);
+    all.push_back(&nCut_Shower_Michel_Exist);
+    all.push_back(&nCut_Photon1DistanceLow);
+    all.push_back(&nCut_Photon2DistanceLow);
+    all.push_back(&nCut_LowE_SmallAngle);
+    all.push_back(&nCut_Pi0_invMass);
+    all.push_back(&nCut_beamEnergy);
+    all.push_back(&nCut_W);
+
+    // 1 Track
+    all.push_back(&nCut_1Track_All);
+    all.push_back(&nCut_1Track_PreFilter_Pi0);
+    all.push_back(&nCut_1Track_ConeBlobs);
+    all.push_back(&nCut_1Track_BlobDirectionBad);
+    all.push_back(&nCut_1Track_Pi0_Bad);
+    all.push_back(&nCut_1Track_Photon1DistanceLow);
+    all.push_back(&nCut_1Track_Photon2DistanceLow);
+    all.push_back(&nCut_1Track_Pi0_invMass);
+    all.push_back(&nCut_1Track_beamEnergy);
+    all.push_back(&nCut_1Track_W);
+
+    // 2 Track
+    all.push_back(&nCut_2Track_All);
+    all.push_back(&nCut_2Track_ProtonScore);
+    all.push_back(&nCut_2Track_PreFilter_Pi0);
+    all.push_back(&nCut_2Track_ConeBlobs);
+    all.push_back(&nCut_2Track_BlobDirectionBad);
+    all.push_back(&nCut_2Track_Pi0_Bad);
+    all.push_back(&nCut_2Track_Photon1DistanceLow);
+    all.push_back(&nCut_2Track_Photon2DistanceLow);
+    all.push_back(&nCut_2Track_Pi0_invMass);
+    all.push_back(&nCut_2Track_beamEnergy);
+    all.push_back(&nCut_2Track_W);
+
+    return all;
+}
+
+void CCProtonPi0_CutList::writeCutCounts(ofstream &file)
+{
+    // Full precision -- Accumulated Cut Table must match a single reduce
+    file<<std::setprecision(17);
+
+    std::vector<CCProtonPi0_Cut*> all = GetAllCuts();
+    for (unsigned int i = 0; i < all.size(); ++i){
+        file<<all[i]->nEvent.getCount()<<" ";
+        file<<all[i]->nSignal.getCount()<<" ";
+        file<<all[i]->nStudy1.getCount()<<" ";
+        file<<all[i]->nStudy2.getCount()<<std::endl;
+    }
+}
+
+void CCProtonPi0_CutList::addCutCounts(ifstream &file)
+{
+    double nEvent, nSignal, nStudy1, nStudy2;
+
+    std::vector<CCProtonPi0_Cut*> all = GetAllCuts();
+    for (unsigned int i = 0; i < all.size(); ++i){
+        if (!(file>>nEvent>>nSignal>>nStudy1>>nStudy2)) RunTimeError("Cannot read Cut Counts for " + all[i]->get_Name());
+        all[i]->nEvent.increment(nEvent);
+        all[i]->nSignal.increment(nSignal);
+        all[i]->nStudy1.increment(nStudy1);
+        all[i]->nStudy2.increment(nStudy2);
+    }
+}
+
+void CCProtonPi0_CutList::mergeHistograms(const std::vector<int>& chunk_ids)
+{
+    // Chunk files already include the Data Error Bands and the difference histograms
+    MergePartitionFiles(f, rootDir, chunk_ids);
+    f->Close();
+}
+
 CCProtonPi0_CutList::~CCProtonPi0_CutList()
 {
     cutText_All.close();
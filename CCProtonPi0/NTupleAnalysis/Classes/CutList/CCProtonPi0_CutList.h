@@ -31,6 +31,12 @@ class CCProtonPi0_CutList : public CCProtonPi0_NTupleAnalysis
         
         void writeCutTable();
         void writeHistograms();
+
+        // Incremental Reduce -- Each chunk keeps its own Cut Counts and Histograms
+        std::vector<CCProtonPi0_Cut*> GetAllCuts();
+        void writeCutCounts(ofstream &file);
+        void addCutCounts(ifstream &file);
+        void mergeHistograms(const std::vector<int>& chunk_ids);
         // -------------------------------------------------------------------------
         // CCProtonPi0_Cut Numbers
         //--------------------------------------------------------------------------
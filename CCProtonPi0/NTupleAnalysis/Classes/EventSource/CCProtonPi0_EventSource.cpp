@@ -0,0 +1,127 @@
+#ifndef CCProtonPi0_EventSource_cpp
+#define CCProtonPi0_EventSource_cpp
+
+#include "CCProtonPi0_EventSource.h"
+
+using namespace std;
+
+CCProtonPi0_EventSource::CCProtonPi0_EventSource(TChain* chain, Long64_t first_entry, Long64_t last_entry)
+{
+    fChain = chain;
+    fColumnar = NULL;
+    next_entry = first_entry;
+    this->last_entry = last_entry;
+    current_entry = -1;
+    local_entry = -1;
+    nBytes = 0;
+    nEntriesRead = 0;
+    countBranchBytes = false;
+    current_tree = -1;
+}
+
+void CCProtonPi0_EventSource::EnableAsyncPrefetching()
+{
+    // TTreeCache reads the next cluster on a separate thread
+    //      Baskets are still decompressed by GetEntry() on this thread
+    gEnv->SetValue("TFile.AsyncPrefetching", 1);
+}
+
+void CCProtonPi0_EventSource::SetColumnarNTuple(CCProtonPi0_ColumnarNTuple* columnar)
+{
+    fColumnar = columnar;
+}
+
+void CCProtonPi0_EventSource::CountBranchBytes(const std::vector<std::string>& branch_names)
+{
+    this->branch_names = branch_names;
+    branch_bytes.assign(branch_names.size(), 0);
+    branch_entries.assign(branch_names.size(), 0);
+    countBranchBytes = true;
+    current_tree = -1;
+}
+
+void CCProtonPi0_EventSource::UpdateTreeBranches()
+{
+    tree_branches.clear();
+    tree_branch_ind.clear();
+
+    TTree* tree = fChain->GetTree();
+    if (tree == NULL) return;
+
+    // Same order as TTree::GetEntry() -- count Branches are read before the arrays
+    TObjArray* branches = tree->GetListOfBranches();
+    for (int i = 0; i < branches->GetEntriesFast(); ++i){
+        TBranch* branch = (TBranch*)branches->UncheckedAt(i);
+        if (branch->TestBit(kDoNotProcess)) continue;
+        for (unsigned int j = 0; j < branch_names.size(); ++j){
+            if (branch_names[j] == branch->GetName()){
+                tree_branches.push_back(branch);
+                tree_branch_ind.push_back(j);
+                break;
+            }
+        }
+    }
+    current_tree = fChain->GetTreeNumber();
+}
+
+Int_t CCProtonPi0_EventSource::GetEntryByBranch(Long64_t ientry)
+{
+    if (fChain->GetTreeNumber() != current_tree) UpdateTreeBranches();
+
+    Int_t nb = 0;
+    for (unsigned int i = 0; i < tree_branches.size(); ++i){
+        Int_t nb_branch = tree_branches[i]->GetEntry(ientry);
+        if (nb_branch < 0) return nb_branch;
+        branch_bytes[tree_branch_ind[i]] += nb_branch;
+        branch_entries[tree_branch_ind[i]]++;
+        nb += nb_branch;
+    }
+    return nb;
+}
+
+bool CCProtonPi0_EventSource::Next()
+{
+    if (next_entry >= last_entry) return false;
+
+    if (fColumnar != NULL){
+        if (!fColumnar->LoadEntry(next_entry)) return false;
+        nBytes += fColumnar->GetEntrySize();
+        nEntriesRead++;
+        current_entry = next_entry;
+        local_entry = next_entry;
+        next_entry++;
+        return true;
+    }
+
+    if (fChain == NULL) return false;
+
+    // LoadTree fails at the end of the Chain
+    Long64_t ientry = fChain->LoadTree(next_entry);
+    if (ientry < 0) return false;
+
+    // Single read of the entry -- Fills all active Branch addresses
+    Int_t nb = countBranchBytes ? GetEntryByBranch(ientry) : fChain->GetEntry(next_entry);
+    if (nb <= 0) {
+        cout<<"\tGetEntry failure "<<next_entry<<endl;
+        return false;
+    }
+
+    nBytes += nb;
+    nEntriesRead++;
+    current_entry = next_entry;
+    local_entry = ientry;
+    next_entry++;
+
+    return true;
+}
+
+void CCProtonPi0_EventSource::PrintSummary() const
+{
+    cout<<"\tEntries Read = "<<nEntriesRead<<" Bytes Read = "<<nBytes/1000000<<" MB"<<endl;
+    if (fColumnar == NULL){
+        cout<<"\tPrefetch: I/O only -- Baskets decompressed on the analysis thread"<<endl;
+    }
+}
+
+#endif
+
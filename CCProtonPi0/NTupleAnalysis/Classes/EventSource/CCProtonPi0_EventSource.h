@@ -0,0 +1,70 @@
+#ifndef CCProtonPi0_EventSource_h
+#define CCProtonPi0_EventSource_h
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <TBranch.h>
+#include <TChain.h>
+#include <TEnv.h>
+
+#include "../ColumnarNTuple/CCProtonPi0_ColumnarNTuple.h"
+
+// Reads each entry of the Chain only once
+//      Only I/O is prefetched: the TTreeCache reads the compressed baskets of
+//      the next cluster on a background thread (TFile.AsyncPrefetching)
+//      Decompression and deserialization stay on the analysis thread in
+//      GetEntry(), because ROOT 5 unpacks the baskets directly into the
+//      makeClass Branch addresses shared with the analysis code
+class CCProtonPi0_EventSource
+{
+    public:
+        CCProtonPi0_EventSource(TChain* chain, Long64_t first_entry, Long64_t last_entry);
+
+        // Background read of the next cluster, no background decompression
+        //      Must be called before the TTreeCache is created
+        static void EnableAsyncPrefetching();
+
+        // Entries are copied from the memory-mapped columns instead of the Chain
+        void SetColumnarNTuple(CCProtonPi0_ColumnarNTuple* columnar);
+
+        // Active Branches are read one by one to count the bytes of each Branch
+        //      Branches must be active and have their addresses set
+        void CountBranchBytes(const std::vector<std::string>& branch_names);
+        const std::vector<std::string>& GetBranchNames() const { return branch_names; }
+        Long64_t GetBranchBytes(unsigned int i) const { return branch_bytes[i]; }
+        Long64_t GetBranchEntries(unsigned int i) const { return branch_entries[i]; }
+
+        bool Next();
+        Long64_t GetEntryNumber() const { return current_entry; }
+        Long64_t GetLocalEntryNumber() const { return local_entry; }
+        Long64_t GetBytesRead() const { return nBytes; }
+        Long64_t GetNEntriesRead() const { return nEntriesRead; }
+        void PrintSummary() const;
+
+    private:
+        TChain* fChain;
+        CCProtonPi0_ColumnarNTuple* fColumnar;
+        Long64_t next_entry;
+        Long64_t last_entry;
+        Long64_t current_entry;
+        Long64_t local_entry;
+        Long64_t nBytes;
+        Long64_t nEntriesRead;
+
+        // Per Branch Counters -- Branches of the current Tree in Tree order
+        bool countBranchBytes;
+        int current_tree;
+        std::vector<std::string> branch_names;
+        std::vector<Long64_t> branch_bytes;
+        std::vector<Long64_t> branch_entries;
+        std::vector<TBranch*> tree_branches;
+        std::vector<unsigned int> tree_branch_ind;
+
+        void UpdateTreeBranches();
+        Int_t GetEntryByBranch(Long64_t ientry);
+};
+
+#endif
+
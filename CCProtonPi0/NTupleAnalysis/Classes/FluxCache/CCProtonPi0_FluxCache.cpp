@@ -0,0 +1,197 @@
+/*
+   See CCProtonPi0_FluxCache.h header for Class Information
+   */
+#ifndef CCProtonPi0_FluxCache_cpp
+#define CCProtonPi0_FluxCache_cpp
+
+#include "CCProtonPi0_FluxCache.h"
+
+using namespace std;
+
+CCProtonPi0_FluxCache::CCProtonPi0_FluxCache(std::string output_file)
+{
+    // Cache is in the same directory with the output file
+    size_t pos = output_file.rfind('/');
+    if (pos == string::npos) dir = "";
+    else dir = output_file.substr(0, pos+1);
+
+    // FNV-1a 64 bit offset basis
+    key = 14695981039346656037ULL;
+    AddKey((double)version);
+}
+
+void CCProtonPi0_FluxCache::AddKey(const char* data, size_t size)
+{
+    // FNV-1a 64 bit
+    for (size_t i = 0; i < size; ++i){
+        key ^= (unsigned char)data[i];
+        key *= 1099511628211ULL;
+    }
+}
+
+void CCProtonPi0_FluxCache::AddKey(const std::string& value)
+{
+    AddKey(value.c_str(), value.size() + 1);
+}
+
+void CCProtonPi0_FluxCache::AddKey(double value)
+{
+    AddKey((const char*)&value, sizeof(value));
+}
+
+void CCProtonPi0_FluxCache::AddKey(const double* values, int n)
+{
+    AddKey((double)n);
+    AddKey((const char*)values, n*sizeof(double));
+}
+
+void CCProtonPi0_FluxCache::AddKeyFile(const std::string& file_name)
+{
+    AddKey(file_name);
+
+    ifstream file(file_name.c_str(), ios::binary);
+    if (!file.is_open()){
+        cout<<"WARNING! Flux Cache: Cannot read "<<file_name<<" -- Only file name is used in the key"<<endl;
+        return;
+    }
+
+    // File content
+    std::vector<char> buffer(1 << 20);
+    while (file){
+        file.read(&buffer[0], buffer.size());
+        AddKey(&buffer[0], file.gcount());
+    }
+    file.close();
+}
+
+void CCProtonPi0_FluxCache::AddKeyDirectory(const std::string& dir_name)
+{
+    AddKey(dir_name);
+
+    DIR* d = opendir(dir_name.c_str());
+    if (d == NULL){
+        cout<<"WARNING! Flux Cache: Cannot read "<<dir_name<<" -- Only directory name is used in the key"<<endl;
+        return;
+    }
+
+    // Sorted -- Key does not depend on the directory order
+    std::vector<std::string> names;
+    struct dirent* entry;
+    while ((entry = readdir(d)) != NULL){
+        std::string name = entry->d_name;
+        if (name == "." || name == "..") continue;
+        names.push_back(name);
+    }
+    closedir(d);
+    std::sort(names.begin(), names.end());
+
+    for (unsigned int i = 0; i < names.size(); ++i){
+        std::string path = dir_name + "/" + names[i];
+        struct stat file_stat;
+        if (stat(path.c_str(), &file_stat) != 0) continue;
+
+        if (S_ISDIR(file_stat.st_mode)){
+            AddKeyDirectory(path);
+        }else{
+            AddKey(names[i]);
+            AddKey((double)file_stat.st_size);
+            AddKey((double)file_stat.st_mtime);
+        }
+    }
+}
+
+std::string CCProtonPi0_FluxCache::GetFileName() const
+{
+    std::stringstream name;
+    name<<dir<<"FluxCache_"<<std::hex<<std::setw(16)<<std::setfill('0')<<key<<".root";
+    return name.str();
+}
+
+bool CCProtonPi0_FluxCache::IsCached() const
+{
+    ifstream file(GetFileName().c_str());
+    return file.good();
+}
+
+bool CCProtonPi0_FluxCache::Load(MnvH1D* &flux, MnvH1D* &flux_rebinned, MnvH1D* &flux_rebinned_BeforeFSI, double &cv_integral, std::vector<double> &unv_integral)
+{
+    if (!IsCached()) return false;
+
+    std::string file_name = GetFileName();
+    TFile* f = new TFile(file_name.c_str());
+    if (f->IsZombie()){
+        cout<<"WARNING! Flux Cache: Cannot open "<<file_name<<endl;
+        delete f;
+        return false;
+    }
+
+    TVectorD* integrals = dynamic_cast<TVectorD*>(f->Get("flux_integrals"));
+    if (integrals == NULL || integrals->GetNrows() < 1){
+        cout<<"WARNING! Flux Cache: Corrupted "<<file_name<<endl;
+        f->Close();
+        delete f;
+        return false;
+    }
+
+    // [0] is for CV Value
+    cv_integral = (*integrals)[0];
+    unv_integral.clear();
+    for (int i = 1; i < integrals->GetNrows(); ++i) unv_integral.push_back((*integrals)[i]);
+
+    flux = GetMnvH1D(f, "h_flux_minervaLE_FHC");
+    flux_rebinned = GetMnvH1D(f, "h_flux_rebinned");
+    flux_rebinned_BeforeFSI = GetMnvH1D(f, "h_flux_rebinned_BeforeFSI");
+
+    f->Close();
+    delete f;
+
+    cout<<"Flux Cache Loaded: "<<file_name<<endl;
+    return true;
+}
+
+void CCProtonPi0_FluxCache::Save(MnvH1D* flux, MnvH1D* flux_rebinned, MnvH1D* flux_rebinned_BeforeFSI, double cv_integral, const std::vector<double> &unv_integral)
+{
+    // Write to a temporary file first -- Cache is never left half written
+    std::string file_name = GetFileName();
+    std::string temp_file = file_name + ".tmp";
+    TFile* f = new TFile(temp_file.c_str(), "RECREATE");
+    if (f->IsZombie()){
+        cout<<"WARNING! Flux Cache: Cannot write "<<temp_file<<endl;
+        delete f;
+        return;
+    }
+
+    TVectorD integrals(unv_integral.size() + 1);
+    integrals[0] = cv_integral;
+    for (unsigned int i = 0; i < unv_integral.size(); ++i) integrals[i+1] = unv_integral[i];
+
+    f->cd();
+    integrals.Write("flux_integrals");
+    flux->Write();
+    flux_rebinned->Write();
+    flux_rebinned_BeforeFSI->Write();
+    f->Close();
+    delete f;
+
+    if (rename(temp_file.c_str(), file_name.c_str()) != 0){
+        cout<<"WARNING! Flux Cache: Cannot rename "<<temp_file<<endl;
+        return;
+    }
+
+    cout<<"Flux Cache Saved: "<<file_name<<endl;
+}
+
+MnvH1D* CCProtonPi0_FluxCache::GetMnvH1D(TFile* f, std::string name)
+{
+    MnvH1D* h = dynamic_cast<MnvH1D*>(f->Get(name.c_str()));
+    if (h == NULL){
+        cout<<"Flux Cache: No "<<name<<" in "<<f->GetName()<<"! Exiting!..."<<endl;
+        exit(1);
+    }
+    h = new MnvH1D(*h);
+    h->SetDirectory(NULL);
+    return h;
+}
+
+#endif
+
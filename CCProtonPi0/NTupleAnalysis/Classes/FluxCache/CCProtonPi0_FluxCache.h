@@ -0,0 +1,66 @@
+/*
+================================================================================
+Class: CCProtonPi0_FluxCache
+    Content addressed cache for the Flux Histograms used in Cross Section
+        Rebinned Flux Histograms and Flux Integrals of all universes
+        Cache Key is a hash of all inputs (PlotUtils flux files, bin edges, integral range)
+            Any change in the inputs gives a new key -- Old cache is never used
+
+    Main Directory:
+        Classes/FluxCache
+
+    Cache File:
+        Next to the Cross Section output: FluxCache_<key>.root
+================================================================================
+*/
+#ifndef CCProtonPi0_FluxCache_h
+#define CCProtonPi0_FluxCache_h
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <dirent.h>
+#include <sys/stat.h>
+
+#include <TFile.h>
+#include <TVectorD.h>
+#include <PlotUtils/MnvH1D.h>
+
+using namespace PlotUtils;
+
+class CCProtonPi0_FluxCache
+{
+    public:
+        CCProtonPi0_FluxCache(std::string output_file);
+
+        // Cache Key
+        void AddKey(const std::string& value);
+        void AddKey(double value);
+        void AddKey(const double* values, int n);
+        void AddKeyFile(const std::string& file_name);
+        // Name, size and mtime of every file under the directory (recursive)
+        void AddKeyDirectory(const std::string& dir_name);
+
+        std::string GetFileName() const;
+        bool IsCached() const;
+
+        bool Load(MnvH1D* &flux, MnvH1D* &flux_rebinned, MnvH1D* &flux_rebinned_BeforeFSI, double &cv_integral, std::vector<double> &unv_integral);
+        void Save(MnvH1D* flux, MnvH1D* flux_rebinned, MnvH1D* flux_rebinned_BeforeFSI, double cv_integral, const std::vector<double> &unv_integral);
+
+    private:
+        static const int version = 1;   // Increase if the cache content changes
+        std::string dir;
+        ULong64_t key;
+
+        void AddKey(const char* data, size_t size);
+        MnvH1D* GetMnvH1D(TFile* f, std::string name);
+};
+
+#endif
+
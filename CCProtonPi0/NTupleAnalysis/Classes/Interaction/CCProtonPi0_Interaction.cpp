@@ -20,10 +20,10 @@ CCProtonPi0_Interaction::CCProtonPi0_Interaction(bool isModeReduce, bool isMC)
         if (isMC) rootDir = Folder_List::rootDir_Interaction_mc;
         else rootDir = Folder_List::rootDir_Interaction_data;
         
-        std::cout<<"\tRoot File: "<<rootDir<<std::endl;
+        std::cout<<"\tRoot File: "<<GetOutputFileName(rootDir)<<std::endl;
  
         // Create Root File 
-        f = new TFile(rootDir.c_str(),"RECREATE");
+        f = new TFile(GetOutputFileName(rootDir).c_str(),"RECREATE");
         
         initHistograms();
     }
@@ -1147,6 +1147,11 @@ void CCProtonPi0_Interaction::initHistograms()
     }
 }
 
+void CCProtonPi0_Interaction::mergePartitions()
+{
+    MergePartitionFiles(f, rootDir);
+}
+
 void CCProtonPi0_Interaction::writeHistograms()
 {
     std::cout<<">> Writing "<<rootDir<<std::endl;
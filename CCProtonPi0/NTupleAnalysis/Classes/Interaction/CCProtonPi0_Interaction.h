@@ -24,6 +24,7 @@ class CCProtonPi0_Interaction : public CCProtonPi0_NTupleAnalysis
     public:
         CCProtonPi0_Interaction(bool isModeReduce, bool isMC);
         void writeHistograms();
+        void mergePartitions();
        
         bool isErrHistFilled_NeutronResponse;
         bool isErrHistFilled_PionResponse;
@@ -19,10 +19,10 @@ CCProtonPi0_Muon::CCProtonPi0_Muon(bool isModeReduce, bool isMC) : CCProtonPi0_P
         if (isMC) rootDir = Folder_List::rootDir_Muon_mc;
         else rootDir = Folder_List::rootDir_Muon_data;
 
-        std::cout<<"\tRoot File: "<<rootDir<<std::endl;
+        std::cout<<"\tRoot File: "<<GetOutputFileName(rootDir)<<std::endl;
         
         // Create Root File 
-        f = new TFile(rootDir.c_str(),"RECREATE");
+        f = new TFile(GetOutputFileName(rootDir).c_str(),"RECREATE");
 
         // Initialize Bins
         bin_E.setBin(10,0.0,10.0);
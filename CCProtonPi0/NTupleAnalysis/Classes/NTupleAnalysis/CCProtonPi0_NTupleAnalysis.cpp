@@ -8,6 +8,15 @@ using namespace PlotUtils;
 // Initialize Constants
 const std::string CCProtonPi0_NTupleAnalysis::version = "RevisedSignal";
 
+// Workers sum their own events in plain double precision, the serial run sums
+//  all events in one order -- Both carry rounding of O(sqrt(nEvents)) ulps
+//  Synthetic sums of up to 3x10^7 weighted events differ by < 1e-13
+const double CCProtonPi0_NTupleAnalysis::partitionTolerance = 1.0e-12;
+
+// Serial Run by default -- See SetPartition()
+int CCProtonPi0_NTupleAnalysis::nPartitions = 1;
+int CCProtonPi0_NTupleAnalysis::partitionID = -1;
+
 const double CCProtonPi0_NTupleAnalysis::EPSILON = 1.0e-1; 
 
 const double CCProtonPi0_NTupleAnalysis::data_POT = 3.33153e+20;
@@ -99,9 +108,24 @@ CCProtonPi0_NTupleAnalysis::CCProtonPi0_NTupleAnalysis()
     processed_minerva13E = false;
     processed_2p2h = false;
 
+    frw_run = -1;
+    frw_is2p2h = false;
+    minos_normalizer = NULL;
+
     init2p2hFitResults();
 }
 
+CCProtonPi0_NTupleAnalysis::~CCProtonPi0_NTupleAnalysis()
+{
+    // MnvNormalizers are owned by minos_normalizers, minos_normalizer only points to one of them
+    std::map<std::string, MnvNormalizer*>::iterator it;
+    for (it = minos_normalizers.begin(); it != minos_normalizers.end(); ++it){
+        delete it->second;
+    }
+    minos_normalizers.clear();
+    minos_normalizer = NULL;
+}
+
 void CCProtonPi0_NTupleAnalysis::InformSignalType()
 {
     std::cout<<"<><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><><>"<<std::endl;
@@ -116,6 +140,7 @@ void CCProtonPi0_NTupleAnalysis::InformSignalType()
 
 void CCProtonPi0_NTupleAnalysis::OpenTextFile(std::string file_name, std::ofstream &file)
 {
+    file_name = GetOutputFileName(file_name);
     file.open(file_name.c_str());
     if (!file.is_open()){
         std::cerr<<"Cannot open output text file: "<<file_name<<std::endl;
@@ -125,6 +150,369 @@ void CCProtonPi0_NTupleAnalysis::OpenTextFile(std::string file_name, std::ofstre
     }
 }
 
+void CCProtonPi0_NTupleAnalysis::SetPartition(int n, int id)
+{
+    nPartitions = n;
+    partitionID = id;
+}
+
+bool CCProtonPi0_NTupleAnalysis::IsPartitioned()
+{
+    return partitionID >= 0;
+}
+
+std::string CCProtonPi0_NTupleAnalysis::GetPartitionFileName(const std::string& file_name, int part_id)
+{
+    // Output.root --> Output_Part3.root
+    std::stringstream tag;
+    tag<<"Part"<<part_id;
+    return GetTaggedFileName(file_name, tag.str());
+}
+
+std::string CCProtonPi0_NTupleAnalysis::GetTaggedFileName(const std::string& file_name, const std::string& tag)
+{
+    // Output.root --> Output_Tag.root
+    std::string::size_type ext = file_name.rfind('.');
+    if (ext == std::string::npos) ext = file_name.size();
+
+    return file_name.substr(0, ext) + "_" + tag + file_name.substr(ext);
+}
+
+std::string CCProtonPi0_NTupleAnalysis::GetOutputFileName(const std::string& file_name)
+{
+    if (IsPartitioned()) return GetPartitionFileName(file_name, partitionID);
+    else return file_name;
+}
+
+void CCProtonPi0_NTupleAnalysis::GetPartitionRange(Long64_t nentries, Long64_t &first, Long64_t &last)
+{
+    // Contiguous ranges -- Concatenation of all partitions is the serial entry order
+    if (IsPartitioned()){
+        first = nentries * partitionID / nPartitions;
+        last = nentries * (partitionID+1) / nPartitions;
+    }else{
+        first = 0;
+        last = nentries;
+    }
+}
+
+void CCProtonPi0_NTupleAnalysis::MergePartitionFiles(TFile* f, const std::string& file_name)
+{
+    std::vector<int> part_ids;
+    for (int part_id = 0; part_id < nPartitions; ++part_id){
+        part_ids.push_back(part_id);
+    }
+    MergePartitionFiles(f, file_name, part_ids);
+}
+
+void CCProtonPi0_NTupleAnalysis::MergePartitionFiles(TFile* f, const std::string& file_name, const std::vector<int>& part_ids)
+{
+    std::vector<TObject*> merged;
+    std::map<std::string, unsigned int> merged_ind;
+
+    // Every TH1 of a merged object (CV and all Error Band Universes) with the
+    // Rounding Errors of its bins -- added once all partitions are summed
+    std::vector< std::vector<TH1*> > merged_hists;
+    std::vector< std::vector< std::vector<double> > > comp;
+    std::vector< std::vector< std::vector<double> > > comp_sumw2;
+    std::vector<TH1*> part_hists;
+
+    // Add Partitions in Order -- Result does not depend on which worker finished first
+    for (unsigned int i_part = 0; i_part < part_ids.size(); ++i_part){
+        int part_id = part_ids[i_part];
+        std::string part_file_name = GetPartitionFileName(file_name, part_id);
+        TFile* f_part = new TFile(part_file_name.c_str());
+        if (f_part->IsZombie()){
+            RunTimeError("Cannot open partition file " + part_file_name);
+        }
+
+        TIter next(f_part->GetListOfKeys());
+        TKey* key;
+        while ((key = (TKey*)next())){
+            TObject* obj = key->ReadObj();
+            std::string name = obj->GetName();
+
+            std::map<std::string, unsigned int>::iterator it = merged_ind.find(name);
+            if (it == merged_ind.end()){
+                TH1* h = dynamic_cast<TH1*>(obj);
+                if (h != NULL) h->SetDirectory(NULL);
+                merged_ind[name] = merged.size();
+                merged.push_back(obj);
+
+                merged_hists.push_back(std::vector<TH1*>());
+                GetPartitionMergeHists(obj, merged_hists.back());
+                comp.push_back(std::vector< std::vector<double> >(merged_hists.back().size()));
+                comp_sumw2.push_back(std::vector< std::vector<double> >(merged_hists.back().size()));
+                continue;
+            }
+
+            // Same as MnvH1D and MnvH2D Add -- CV and all Error Band Universes
+            const unsigned int ind = it->second;
+            GetPartitionMergeHists(obj, part_hists);
+            if (part_hists.size() != merged_hists[ind].size()){
+                RunTimeError("Error Bands of " + name + " are different in " + part_file_name);
+            }
+            for (unsigned int i = 0; i < part_hists.size(); ++i){
+                AddPartitionHist(merged_hists[ind][i], part_hists[i], comp[ind][i], comp_sumw2[ind][i]);
+            }
+            delete obj;
+        }
+
+        f_part->Close();
+        delete f_part;
+    }
+
+    std::cout<<">> Writing "<<file_name<<" ("<<part_ids.size()<<" Partitions)"<<std::endl;
+    f->cd();
+    for (unsigned int i = 0; i < merged.size(); ++i){
+        for (unsigned int j = 0; j < merged_hists[i].size(); ++j){
+            AddPartitionCompensation(merged_hists[i][j], comp[i][j], comp_sumw2[i][j]);
+        }
+        merged[i]->Write();
+    }
+}
+
+void CCProtonPi0_NTupleAnalysis::GetPartitionMergeHists(TObject* obj, std::vector<TH1*>& hists)
+{
+    hists.clear();
+
+    if (MnvH2D* mnv2D = dynamic_cast<MnvH2D*>(obj)){
+        hists.push_back(mnv2D);
+
+        std::vector<std::string> vert_names = mnv2D->GetVertErrorBandNames();
+        for (unsigned int i = 0; i < vert_names.size(); ++i){
+            MnvVertErrorBand2D* err_band = mnv2D->GetVertErrorBand(vert_names[i]);
+            std::vector<TH2D*> err_hists = err_band->GetHists();
+            hists.push_back(err_band);
+            hists.insert(hists.end(), err_hists.begin(), err_hists.end());
+        }
+
+        std::vector<std::string> lat_names = mnv2D->GetLatErrorBandNames();
+        for (unsigned int i = 0; i < lat_names.size(); ++i){
+            MnvLatErrorBand2D* err_band = mnv2D->GetLatErrorBand(lat_names[i]);
+            std::vector<TH2D*> err_hists = err_band->GetHists();
+            hists.push_back(err_band);
+            hists.insert(hists.end(), err_hists.begin(), err_hists.end());
+        }
+    }else if (MnvH1D* mnv1D = dynamic_cast<MnvH1D*>(obj)){
+        hists.push_back(mnv1D);
+
+        std::vector<std::string> vert_names = mnv1D->GetVertErrorBandNames();
+        for (unsigned int i = 0; i < vert_names.size(); ++i){
+            MnvVertErrorBand* err_band = mnv1D->GetVertErrorBand(vert_names[i]);
+            std::vector<TH1D*> err_hists = err_band->GetHists();
+            hists.push_back(err_band);
+            hists.insert(hists.end(), err_hists.begin(), err_hists.end());
+        }
+
+        std::vector<std::string> lat_names = mnv1D->GetLatErrorBandNames();
+        for (unsigned int i = 0; i < lat_names.size(); ++i){
+            MnvLatErrorBand* err_band = mnv1D->GetLatErrorBand(lat_names[i]);
+            std::vector<TH1D*> err_hists = err_band->GetHists();
+            hists.push_back(err_band);
+            hists.insert(hists.end(), err_hists.begin(), err_hists.end());
+        }
+    }else if (TH1* h = dynamic_cast<TH1*>(obj)){
+        hists.push_back(h);
+    }
+}
+
+void CCProtonPi0_NTupleAnalysis::AddPartitionHist(TH1* target, TH1* source, std::vector<double>& comp, std::vector<double>& comp_sumw2)
+{
+    // Only TH1D and TH2D keep the bins in a TArrayD
+    TArrayD* target_bins = dynamic_cast<TArrayD*>(target);
+    TArrayD* source_bins = dynamic_cast<TArrayD*>(source);
+    if (target_bins == NULL || source_bins == NULL || target_bins->GetSize() != source_bins->GetSize()){
+        target->Add(source);
+        return;
+    }
+
+    // Statistics and Entries -- Same as TH1::Add(), before the bins change
+    double target_stats[13]; // Max number of stats (TH3)
+    double source_stats[13];
+    for (int i = 0; i < 13; ++i){
+        target_stats[i] = 0.0;
+        source_stats[i] = 0.0;
+    }
+    double entries = target->GetEntries() + source->GetEntries();
+    target->GetStats(target_stats);
+    source->GetStats(source_stats);
+    for (int i = 0; i < 13; ++i){
+        target_stats[i] += source_stats[i];
+    }
+
+    if (target->GetSumw2N() == 0 && source->GetSumw2N() != 0) target->Sumw2();
+
+    // Bin Content
+    const int nCells = target_bins->GetSize();
+    double* sum = target_bins->GetArray();
+    const double* x = source_bins->GetArray();
+    comp.resize(nCells, 0.0);
+    for (int i = 0; i < nCells; ++i){
+        Data_Functions::compensatedAdd(sum[i], comp[i], x[i]);
+    }
+
+    // Bin Errors -- Source without Sumw2 has error^2 = |content| as in TH1::Add()
+    if (target->GetSumw2N() == nCells){
+        double* sumw2 = target->GetSumw2()->GetArray();
+        const double* x_sumw2 = (source->GetSumw2N() == nCells) ? source->GetSumw2()->GetArray() : NULL;
+        comp_sumw2.resize(nCells, 0.0);
+        for (int i = 0; i < nCells; ++i){
+            Data_Functions::compensatedAdd(sumw2[i], comp_sumw2[i], x_sumw2 ? x_sumw2[i] : fabs(x[i]));
+        }
+    }
+
+    target->PutStats(target_stats);
+    target->SetEntries(entries);
+}
+
+void CCProtonPi0_NTupleAnalysis::AddPartitionCompensation(TH1* target, const std::vector<double>& comp, const std::vector<double>& comp_sumw2)
+{
+    TArrayD* target_bins = dynamic_cast<TArrayD*>(target);
+    if (target_bins == NULL) return;
+
+    double* sum = target_bins->GetArray();
+    for (unsigned int i = 0; i < comp.size(); ++i){
+        sum[i] += comp[i];
+    }
+
+    if (!comp_sumw2.empty()){
+        double* sumw2 = target->GetSumw2()->GetArray();
+        for (unsigned int i = 0; i < comp_sumw2.size(); ++i){
+            sumw2[i] += comp_sumw2[i];
+        }
+    }
+}
+
+/*
+ *  Compares every histogram of a merged output file with the serial run
+ *      CV and all Error Band Universes: Entries, Bin Content and Sumw2 of all cells
+ *      Reports the number of identical cells and the largest relative difference
+ */
+bool CCProtonPi0_NTupleAnalysis::ComparePartitionedFile(const std::string& file_name, const std::string& ref_name)
+{
+    TFile* f = new TFile(file_name.c_str());
+    TFile* f_ref = new TFile(ref_name.c_str());
+    if (f->IsZombie() || f_ref->IsZombie()){
+        std::cout<<"Cannot open "<<file_name<<" or "<<ref_name<<std::endl;
+        return false;
+    }
+
+    bool isPassed = true;
+    int nObjects = 0;
+    long nCells = 0;
+    long nIdentical = 0;
+    double max_diff = 0.0;
+    std::string max_diff_name;
+
+    std::vector<TH1*> hists;
+    std::vector<TH1*> ref_hists;
+
+    TIter next(f_ref->GetListOfKeys());
+    TKey* key;
+    while ((key = (TKey*)next())){
+        TObject* ref_obj = key->ReadObj();
+        std::string name = ref_obj->GetName();
+        TObject* obj = f->Get(name.c_str());
+        if (obj == NULL){
+            std::cout<<"\t"<<name<<" is missing in "<<file_name<<std::endl;
+            isPassed = false;
+            delete ref_obj;
+            continue;
+        }
+
+        GetPartitionMergeHists(ref_obj, ref_hists);
+        GetPartitionMergeHists(obj, hists);
+        if (hists.size() != ref_hists.size()){
+            std::cout<<"\tError Bands of "<<name<<" are different"<<std::endl;
+            isPassed = false;
+        }else{
+            for (unsigned int i = 0; i < hists.size(); ++i){
+                // Entries are integer counts -- Must be identical
+                if (hists[i]->GetEntries() != ref_hists[i]->GetEntries() || hists[i]->GetNcells() != ref_hists[i]->GetNcells()){
+                    std::cout<<"\tEntries or Bins of "<<name<<" are different"<<std::endl;
+                    isPassed = false;
+                    continue;
+                }
+
+                const bool hasSumw2 = hists[i]->GetSumw2N() > 0 && ref_hists[i]->GetSumw2N() > 0;
+                for (int bin = 0; bin < ref_hists[i]->GetNcells(); ++bin){
+                    double diff = Data_Functions::getRelativeDiff(hists[i]->GetBinContent(bin), ref_hists[i]->GetBinContent(bin));
+                    if (hasSumw2){
+                        diff = std::max(diff, Data_Functions::getRelativeDiff(hists[i]->GetSumw2()->At(bin), ref_hists[i]->GetSumw2()->At(bin)));
+                    }
+                    ++nCells;
+                    if (diff == 0.0) ++nIdentical;
+                    if (diff > max_diff){
+                        max_diff = diff;
+                        max_diff_name = name;
+                    }
+                }
+            }
+        }
+
+        ++nObjects;
+        delete obj;
+        delete ref_obj;
+    }
+
+    f->Close();
+    f_ref->Close();
+    delete f;
+    delete f_ref;
+
+    if (max_diff > partitionTolerance) isPassed = false;
+
+    std::cout<<file_name<<std::endl;
+    std::cout<<"\tHistograms = "<<nObjects<<" Cells = "<<nCells<<" Identical = "<<nIdentical<<std::endl;
+    std::cout<<"\tMax Relative Diff = "<<max_diff;
+    if (max_diff > 0.0) std::cout<<" ("<<max_diff_name<<")";
+    std::cout<<(isPassed ? " PASS" : " FAIL")<<std::endl;
+
+    return isPassed;
+}
+
+/*
+ *  Compares the full precision Counters and Background Tables of a merged run
+ *      with the serial run -- See CCProtonPi0_Analyzer::writePartitionCounters()
+ */
+bool CCProtonPi0_NTupleAnalysis::ComparePartitionedCounters(const std::string& file_name, const std::string& ref_name)
+{
+    std::ifstream file(file_name.c_str());
+    std::ifstream ref_file(ref_name.c_str());
+    if (!file.is_open() || !ref_file.is_open()){
+        std::cout<<"Cannot open "<<file_name<<" or "<<ref_name<<std::endl;
+        return false;
+    }
+
+    bool isPassed = true;
+    int nCounters = 0;
+    int nIdentical = 0;
+    double max_diff = 0.0;
+
+    double count;
+    double ref_count;
+    while (ref_file>>ref_count){
+        if (!(file>>count)){
+            std::cout<<"\t"<<file_name<<" has fewer Counters"<<std::endl;
+            isPassed = false;
+            break;
+        }
+        double diff = Data_Functions::getRelativeDiff(count, ref_count);
+        ++nCounters;
+        if (diff == 0.0) ++nIdentical;
+        if (diff > max_diff) max_diff = diff;
+    }
+
+    if (max_diff > partitionTolerance) isPassed = false;
+
+    std::cout<<file_name<<std::endl;
+    std::cout<<"\tCounters = "<<nCounters<<" Identical = "<<nIdentical<<std::endl;
+    std::cout<<"\tMax Relative Diff = "<<max_diff<<(isPassed ? " PASS" : " FAIL")<<std::endl;
+
+    return isPassed;
+}
+
 TH1D* CCProtonPi0_NTupleAnalysis::GetTH1D(TFile* f, std::string var_name)
 {
     TH1D* h = new TH1D( * dynamic_cast<TH1D*>(f->Get(var_name.c_str())) );
@@ -805,7 +1193,16 @@ std::string CCProtonPi0_NTupleAnalysis::GetPlaylist(const int run, int type)
 
 void CCProtonPi0_NTupleAnalysis::UpdateFluxReweighter(int run, int type)
 {
-    std::string playlist = GetPlaylist(run, type);
+    // Playlist changes only with the run -- No need to check every event
+    bool is2p2h = IsEvent2p2h(type);
+    if (run == frw_run && is2p2h == frw_is2p2h) return;
+
+    frw_run = run;
+    frw_is2p2h = is2p2h;
+    frw_playlist = GetPlaylist(run, type);
+    UpdateMINOSNormalizer(frw_playlist);
+
+    const std::string& playlist = frw_playlist;
 
     if (!processed_minerva1 && playlist.compare("minerva1") == 0){
         std::cout<<"Playlist: minerva1"<<std::endl;
@@ -848,6 +1245,20 @@ void CCProtonPi0_NTupleAnalysis::UpdateFluxReweighter(int run, int type)
     }
 }
 
+void CCProtonPi0_NTupleAnalysis::UpdateMINOSNormalizer(const std::string& playlist)
+{
+    // 2p2h Sample uses minerva13C MINOS Efficiency Correction
+    std::string norm_playlist = playlist.compare("minerva_2p2h") == 0 ? "minerva13C" : playlist;
+
+    std::map<std::string, MnvNormalizer*>::iterator it = minos_normalizers.find(norm_playlist);
+    if (it == minos_normalizers.end()){
+        minos_normalizer = new MnvNormalizer("Eroica", norm_playlist);
+        minos_normalizers[norm_playlist] = minos_normalizer;
+    }else{
+        minos_normalizer = it->second;
+    }
+}
+
 void CCProtonPi0_NTupleAnalysis::ReInitFluxReweighter(enum FluxReweighter::EPlaylist playlist)
 {
     if(frw != NULL || frw_DefaultInit){
@@ -12,9 +12,11 @@ Author:        Ozgur Altinok  - ozgur.altinok@tufts.edu
 #include <iostream>
 #include <iomanip>
 #include <fstream>
+#include <sstream>
 #include <cstdlib>
 #include <string>
 #include <vector>
+#include <map>
 #include <unordered_map>
 
 #include "Cintex/Cintex.h"
@@ -24,9 +26,11 @@ Author:        Ozgur Altinok  - ozgur.altinok@tufts.edu
 #include <TH2.h>
 #include <TH3.h>
 #include <TFile.h>
+#include <TKey.h>
 #include <PlotUtils/MnvH1D.h>
 #include <PlotUtils/MnvH2D.h>
 #include <PlotUtils/FluxReweighter.h>
+#include <PlotUtils/MnvNormalization.h>
 
 // Libraries
 #include "../../Libraries/PDG_List.h"
@@ -40,6 +44,7 @@ class CCProtonPi0_NTupleAnalysis
 {
     public:
         CCProtonPi0_NTupleAnalysis();
+        ~CCProtonPi0_NTupleAnalysis();
 
         std::string ana_folder;
         // Constants 
@@ -147,12 +152,45 @@ class CCProtonPi0_NTupleAnalysis
         bool processed_minerva13E;
         bool processed_2p2h;
 
+        // Playlist of the last UpdateFluxReweighter() call -- Same for all events in a run
+        int frw_run;
+        bool frw_is2p2h;
+        std::string frw_playlist;
+
+        // MINOS Efficiency Correction -- One MnvNormalizer per Playlist
+        std::map<std::string, MnvNormalizer*> minos_normalizers;
+        MnvNormalizer* minos_normalizer;
+        void UpdateMINOSNormalizer(const std::string& playlist);
+
         void UpdateFluxReweighter(const int run, int type);
         void ReInitFluxReweighter(enum FluxReweighter::EPlaylist playlist);
         double GetFluxWeight(double Enu, int nuPDG);
         std::vector<double> GetFluxError(double Enu, int nuPDG);
 
         void OpenTextFile(std::string file_name, std::ofstream &file);
+
+        // Partitioned Runs -- Each worker process analyzes one contiguous entry range 
+        //  and writes its own copy of the output files, merged in partition order
+        static int nPartitions;
+        static int partitionID;
+        static void SetPartition(int n, int id);
+        static bool IsPartitioned();
+        static std::string GetPartitionFileName(const std::string& file_name, int part_id);
+        static std::string GetTaggedFileName(const std::string& file_name, const std::string& tag);
+        std::string GetOutputFileName(const std::string& file_name);
+        void GetPartitionRange(Long64_t nentries, Long64_t &first, Long64_t &last);
+        void MergePartitionFiles(TFile* f, const std::string& file_name);
+        void MergePartitionFiles(TFile* f, const std::string& file_name, const std::vector<int>& part_ids);
+        static void GetPartitionMergeHists(TObject* obj, std::vector<TH1*>& hists);
+        void AddPartitionHist(TH1* target, TH1* source, std::vector<double>& comp, std::vector<double>& comp_sumw2);
+        void AddPartitionCompensation(TH1* target, const std::vector<double>& comp, const std::vector<double>& comp_sumw2);
+
+        // Serial vs Partitioned Run (checkRun) -- Merged outputs are not bit identical
+        //  to the serial run, the largest relative difference accepted in any
+        //  bin content, Sumw2 or weighted counter is partitionTolerance
+        static const double partitionTolerance;
+        static bool ComparePartitionedFile(const std::string& file_name, const std::string& ref_name);
+        static bool ComparePartitionedCounters(const std::string& file_name, const std::string& ref_name);
         std::string GetPlaylist(const int run, int type);
         void printBins(const TH1* hist, const std::string var_name, bool useLowEdge = false);
         void printBins(const TH2* hist, const std::string var_name);
@@ -19,6 +19,11 @@ CCProtonPi0_Particle::~CCProtonPi0_Particle()
 {    
     // Do Nothing!
 }
+
+void CCProtonPi0_Particle::mergePartitions()
+{
+    MergePartitionFiles(f, rootDir);
+}
 #endif
 
 
@@ -50,6 +50,7 @@ class CCProtonPi0_Particle : public CCProtonPi0_NTupleAnalysis
         CCProtonPi0_Particle();
         ~CCProtonPi0_Particle();
         virtual void writeHistograms() = 0;
+        void mergePartitions();
         virtual void initHistograms() = 0; 
 };
 
@@ -19,10 +19,10 @@ CCProtonPi0_Pi0Blob::CCProtonPi0_Pi0Blob(bool isModeReduce, bool isMC) : CCProto
         if (isMC) rootDir = Folder_List::rootDir_Pi0Blob_mc;
         else rootDir = Folder_List::rootDir_Pi0Blob_data;
 
-        std::cout<<"\tRoot File: "<<rootDir<<std::endl;
+        std::cout<<"\tRoot File: "<<GetOutputFileName(rootDir)<<std::endl;
      
         // Create Root File 
-        f = new TFile(rootDir.c_str(),"RECREATE");
+        f = new TFile(GetOutputFileName(rootDir).c_str(),"RECREATE");
 
         initBins();
         initHistograms();
@@ -231,6 +231,11 @@ void CCProtonPi0_Pi0Blob::initBins()
     bin_blob_energy.setBin(100,0.0,0.7);
 }
 
+void CCProtonPi0_Pi0Blob::mergePartitions()
+{
+    MergePartitionFiles(f, rootDir);
+}
+
 void CCProtonPi0_Pi0Blob::writeHistograms()
 {
     std::cout<<">> Writing "<<rootDir<<std::endl;
@@ -21,6 +21,7 @@ class CCProtonPi0_Pi0Blob : public CCProtonPi0_NTupleAnalysis
         CCProtonPi0_Pi0Blob(bool isModeReduce, bool isMC);
 
         void writeHistograms();
+        void mergePartitions();
 
         // Histograms
 
@@ -61,7 +61,9 @@ void CCProtonPi0_Plotter::plotHistograms()
     //DeltaRes_Studies();
     //PlotFluxHistograms();
     //XSec_Tables();
-    
+
+    // Cached ROOT files and histograms are not used after plotting
+    ClearHistCache();
 }
 
 void CCProtonPi0_Plotter::plotPaperPlots()
@@ -167,6 +169,14 @@ CCProtonPi0_Plotter::CCProtonPi0_Plotter() : CCProtonPi0_NTupleAnalysis()
     setRootDirs(); 
     Systematics_SetErrorSummaryGroups();
 
+    // Unfolding Study uses the same method as the Cross Section
+    isNativeUnfolding = CCProtonPi0_BayesUnfold::isDefault;
+
+}
+
+void CCProtonPi0_Plotter::SetNWorkers(int n)
+{
+    QSqFitter.SetNWorkers(n);
 }
 
 void CCProtonPi0_Plotter::CheckAllUniverses(std::string test_name, MnvH1D* data, MnvH1D* mc)
@@ -359,7 +369,7 @@ void CCProtonPi0_Plotter::plotOtherStudies()
    
     std::string root_dir_data = Folder_List::rootDir_Signal_NoWLimit_Original_Data;
 
-    TFile* f_data = new TFile(root_dir_data.c_str());
+    TFile* f_data = GetCachedFile(root_dir_data);
 
     std::string var_name = "W";
     std::string data_var = var_name + "_xsec";
@@ -454,14 +464,14 @@ void CCProtonPi0_Plotter::PlotTotalEnuXSec()
     std::string rootDir_MC_W1400 = Folder_List::rootOut + Folder_List::MC + Folder_List::analyzed + "CrossSection_v2_81_W1400.root";
 
     // Get Histograms
-    TFile* f_data_All = new TFile(rootDir_data_All.c_str());
-    TFile* f_MC_All = new TFile(rootDir_MC_All.c_str());
+    TFile* f_data_All = GetCachedFile(rootDir_data_All);
+    TFile* f_MC_All = GetCachedFile(rootDir_MC_All);
 
-    TFile* f_data_W1800 = new TFile(rootDir_data_W1800.c_str());
-    TFile* f_MC_W1800 = new TFile(rootDir_MC_W1800.c_str());
+    TFile* f_data_W1800 = GetCachedFile(rootDir_data_W1800);
+    TFile* f_MC_W1800 = GetCachedFile(rootDir_MC_W1800);
 
-    TFile* f_data_W1400 = new TFile(rootDir_data_W1400.c_str());
-    TFile* f_MC_W1400 = new TFile(rootDir_MC_W1400.c_str());
+    TFile* f_data_W1400 = GetCachedFile(rootDir_data_W1400);
+    TFile* f_MC_W1400 = GetCachedFile(rootDir_MC_W1400);
 
     MnvH1D* data_All = GetMnvH1D(f_data_All, "Enu_xsec");
     MnvH1D* data_W1800 = GetMnvH1D(f_data_W1800, "Enu_xsec");
@@ -968,13 +978,12 @@ void CCProtonPi0_Plotter::plotFluxIntegrated()
         PlotXSecVar("Enu", "flux_integrated", "flux_integrated", plotDir, "flux_integrated_data_MC" );
         
         // Plot Used Flux Histogram
-        TFile* f_xsec_mc = new TFile(rootDir_CrossSection.mc.c_str());
+        TFile* f_xsec_mc = GetCachedFile(rootDir_CrossSection.mc);
         MnvH1D* h_flux_original = GetMnvH1D(f_xsec_mc, "h_flux_minervaLE_FHC");
         MnvH1D* h_flux_rebinned = GetMnvH1D(f_xsec_mc, "h_flux_rebinned");
         PlotFluxRebinned(h_flux_original, h_flux_rebinned, plotDir);
         delete h_flux_original;
         delete h_flux_rebinned;
-        delete f_xsec_mc;
     }
 
     if (plot_deltaInvMass){
@@ -2446,7 +2455,7 @@ void CCProtonPi0_Plotter::PlotFluxRebinned(std::string plotDir)
     MnvH1D* h_flux_minervaLE_FHC = new MnvH1D (*(frw->GetFluxReweighted(14)));
     
     std::string root_dir = rootDir_Interaction.data;
-    TFile* f_Root = new TFile(root_dir.c_str());
+    TFile* f_Root = GetCachedFile(root_dir);
     MnvH1D* h_flux_rebinned = GetMnvH1D(f_Root, "Enu_all");
     h_flux_rebinned->Reset(); 
   
@@ -2572,11 +2581,11 @@ void CCProtonPi0_Plotter::PlotXSecVar(std::string var_name, std::string data_var
     //std::string data_final = "/minerva/data/users/oaltinok/NTupleAnalysis_Final_XSecs/Data/Analyzed/CrossSection.root";
     //std::string mc_final = "/minerva/data/users/oaltinok/NTupleAnalysis_Final_XSecs/MC/Analyzed/CrossSection.root";
 
-    //TFile* f_xsec_data = new TFile(data_final.c_str());
-    //TFile* f_xsec_mc = new TFile(mc_final.c_str());
+    //TFile* f_xsec_data = GetCachedFile(data_final);
+    //TFile* f_xsec_mc = GetCachedFile(mc_final);
 
-    TFile* f_xsec_mc = new TFile(rootDir_CrossSection.mc.c_str());
-    TFile* f_xsec_data = new TFile(rootDir_CrossSection.data.c_str());
+    TFile* f_xsec_mc = GetCachedFile(rootDir_CrossSection.mc);
+    TFile* f_xsec_data = GetCachedFile(rootDir_CrossSection.data);
 
     bool isXSec;
     if (data_var.compare("xsec") == 0 ) isXSec = true;
@@ -2610,14 +2619,12 @@ void CCProtonPi0_Plotter::PlotXSecVar(std::string var_name, std::string data_var
 
     delete data;
     delete mc;
-    delete f_xsec_mc;
-    delete f_xsec_data;
 }
 
 void CCProtonPi0_Plotter::PlotXSecVar_BeforeFSI(std::string var_name, std::string plotDir)
 {
-    TFile* f_xsec_mc = new TFile(rootDir_CrossSection.mc.c_str());
-    TFile* f_xsec_data = new TFile(rootDir_CrossSection.data.c_str());
+    TFile* f_xsec_mc = GetCachedFile(rootDir_CrossSection.mc);
+    TFile* f_xsec_data = GetCachedFile(rootDir_CrossSection.data);
 
     std::string data_var = var_name + "_xsec";
     std::string mc_var = var_name + "_xsec_AfterFSI";
@@ -2637,14 +2644,12 @@ void CCProtonPi0_Plotter::PlotXSecVar_BeforeFSI(std::string var_name, std::strin
     delete data;
     delete mc;
     delete mc_BeforeFSI;
-    delete f_xsec_mc;
-    delete f_xsec_data;
 }
 
 void CCProtonPi0_Plotter::PlotXSecVar_IntType(std::string var_name, std::string plotDir)
 {
-    TFile* f_xsec_mc = new TFile(rootDir_CrossSection.mc.c_str());
-    TFile* f_xsec_data = new TFile(rootDir_CrossSection.data.c_str());
+    TFile* f_xsec_mc = GetCachedFile(rootDir_CrossSection.mc);
+    TFile* f_xsec_data = GetCachedFile(rootDir_CrossSection.data);
 
     std::string data_var = var_name + "_xsec";
     std::string mc_var = var_name + "_xsec";
@@ -2672,14 +2677,12 @@ void CCProtonPi0_Plotter::PlotXSecVar_IntType(std::string var_name, std::string
 
     delete data;
     delete mc;
-    delete f_xsec_mc;
-    delete f_xsec_data;
 }
 
 void CCProtonPi0_Plotter::PlotXSecVar_FSIType(std::string var_name, std::string plotDir)
 {
-    TFile* f_xsec_mc = new TFile(rootDir_CrossSection.mc.c_str());
-    TFile* f_xsec_data = new TFile(rootDir_CrossSection.data.c_str());
+    TFile* f_xsec_mc = GetCachedFile(rootDir_CrossSection.mc);
+    TFile* f_xsec_data = GetCachedFile(rootDir_CrossSection.data);
 
     std::string data_var = var_name + "_xsec";
     std::string mc_var = var_name + "_xsec";
@@ -2704,14 +2707,12 @@ void CCProtonPi0_Plotter::PlotXSecVar_FSIType(std::string var_name, std::string
 
     delete data;
     delete mc;
-    delete f_xsec_mc;
-    delete f_xsec_data;
 }
 
 void CCProtonPi0_Plotter::PlotXSecVar_WithMiniBoone(std::string var_name, std::string plotDir)
 {
-    TFile* f_xsec_mc = new TFile(rootDir_CrossSection.mc.c_str());
-    TFile* f_xsec_data = new TFile(rootDir_CrossSection.data.c_str());
+    TFile* f_xsec_mc = GetCachedFile(rootDir_CrossSection.mc);
+    TFile* f_xsec_data = GetCachedFile(rootDir_CrossSection.data);
 
     std::string data_var = var_name + "_xsec";
     std::string mc_var = var_name + "_xsec";
@@ -2731,8 +2732,6 @@ void CCProtonPi0_Plotter::PlotXSecVar_WithMiniBoone(std::string var_name, std::s
   
     delete data;
     delete mc;
-    delete f_xsec_mc;
-    delete f_xsec_data;
 }
 
 void CCProtonPi0_Plotter::plotCrossSection()
@@ -2808,8 +2807,8 @@ void CCProtonPi0_Plotter::PlotDelta()
 {
     std::string plotDir = Folder_List::plotDir_Interaction;
     
-    TFile* f_data = new TFile(rootDir_Interaction.data.c_str());
-    TFile* f_mc = new TFile(rootDir_Interaction.mc.c_str());
+    TFile* f_data = GetCachedFile(rootDir_Interaction.data);
+    TFile* f_mc = GetCachedFile(rootDir_Interaction.mc);
  
     MnvH1D* data = GetMnvH1D(f_data, "DeltaTransverse_data");
     MnvH1D* mc = GetMnvH1D(f_mc, "DeltaTransverse_mc");
@@ -2872,8 +2871,8 @@ void CCProtonPi0_Plotter::Draw_W_Shift(bool isSignal)
 {
     std::string plotDir = Folder_List::plotDir_OtherStudies;
 
-    TFile* f_data = new TFile(rootDir_Interaction.data.c_str());
-    TFile* f_mc = new TFile(rootDir_Interaction.mc.c_str());
+    TFile* f_data = GetCachedFile(rootDir_Interaction.data);
+    TFile* f_mc = GetCachedFile(rootDir_Interaction.mc);
 
     // --------------------------------------------------------------------
     // Get Histograms 
@@ -2891,7 +2890,6 @@ void CCProtonPi0_Plotter::Draw_W_Shift(bool isSignal)
     MnvH1D* mc_cv = isSignal ? GetMnvH1D(f_mc, "W_Shift_Signal_0") : GetMnvH1D(f_mc, "W_Shift_0");
  
     // Best Fit -- Lowest ChiSq 
-    CCProtonPi0_QSqFitter QSqFitter;
     int ind = QSqFitter.GetMinChiSq_W_Shift(isSignal);
 
     MnvH1D* mc_Best = isSignal ? GetMnvH1D(f_mc, Form("%s_%d","W_Shift_Signal",ind)) : GetMnvH1D(f_mc, Form("%s_%d","W_Shift",ind));
@@ -2987,8 +2985,6 @@ void CCProtonPi0_Plotter::Draw_W_Shift(bool isSignal)
     delete mc_cv;
     delete mc_Best;
     delete c;
-    delete f_data;
-    delete f_mc;
 }
 
 void CCProtonPi0_Plotter::BckgSubtraction_Studies()
@@ -3014,8 +3010,8 @@ double CCProtonPi0_Plotter::Calc_Normalized_NBackground(std::string var_name)
 {
     std::string var;
 
-    TFile* f_data = new TFile(Folder_List::rootDir_Interaction_data.c_str());
-    TFile* f_mc = new TFile(Folder_List::rootDir_Interaction_mc.c_str());
+    TFile* f_data = GetCachedFile(Folder_List::rootDir_Interaction_data);
+    TFile* f_mc = GetCachedFile(Folder_List::rootDir_Interaction_mc);
 
     var = var_name + "_0"; 
     MnvH1D* h_data = GetMnvH1D(f_data, var);
@@ -3031,8 +3027,6 @@ double CCProtonPi0_Plotter::Calc_Normalized_NBackground(std::string var_name)
 
     delete h_data;
     delete h_mc_bckg;
-    delete f_data;
-    delete f_mc;
 
     std::cout<<"Background Calculated for "<<var_name<<std::endl;
     std::cout<<"\tAll = "<<nAll<<std::endl;
@@ -3263,7 +3257,7 @@ void CCProtonPi0_Plotter::Polarization_FSI_2D()
 {
     std::string plotDir = Folder_List::plotDir_OtherStudies;
 
-    TFile* f = new TFile(rootDir_Truth.mc.c_str());
+    TFile* f = GetCachedFile(rootDir_Truth.mc);
     MnvH2D* Delta_pi_theta_pi_P_all_signal = GetMnvH2D(f, "Delta_pi_theta_pi_P_all_signal");
     MnvH2D* Delta_pi_theta_pi_P_delta_res= GetMnvH2D(f, "Delta_pi_theta_pi_P_delta_res");
     MnvH2D* Delta_pi_theta_pi_P_other_res = GetMnvH2D(f, "Delta_pi_theta_pi_P_other_res");
@@ -3278,7 +3272,6 @@ void CCProtonPi0_Plotter::Polarization_FSI_2D()
     delete Delta_pi_theta_pi_P_delta_res;
     delete Delta_pi_theta_pi_P_other_res;
     delete Delta_pi_theta_pi_P_non_res;
-    delete f;
 
 }
 
@@ -3339,8 +3332,8 @@ void CCProtonPi0_Plotter::Get_2p2h_UpperLimit()
     //std::string rootDir_data = rootDir_Interaction.data;
     std::string rootDir_mc = rootDir_Interaction.mc;
     
-    //TFile* f_data = new TFile(rootDir_data.c_str());
-    TFile* f_mc = new TFile(rootDir_mc.c_str());
+    //TFile* f_data = GetCachedFile(rootDir_data);
+    TFile* f_mc = GetCachedFile(rootDir_mc);
 
     MnvH2D* data = GetBckgSubtractedData_2D(rootDir_Interaction, "q3_q0", 2994.54);
     MnvH2D* mc = GetMnvH2D(f_mc, "q3_q0_mc_reco_signal");
@@ -3419,7 +3412,6 @@ void CCProtonPi0_Plotter::Get_2p2h_UpperLimit()
         }
     }
 
-    delete f_mc;
 
 }
 
@@ -3487,7 +3479,7 @@ void CCProtonPi0_Plotter::XSec_Tables()
 
 void CCProtonPi0_Plotter::Single_XSec_Table(std::string root_dir, std::string var_name, std::string xsec_type)
 {
-    TFile* f = new TFile(root_dir.c_str());
+    TFile* f = GetCachedFile(root_dir);
 
     MnvH1D* hist = GetMnvH1D(f, var_name);
     std::string var = var_name + "_" + xsec_type;
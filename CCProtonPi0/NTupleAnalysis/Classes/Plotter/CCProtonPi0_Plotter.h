@@ -19,9 +19,11 @@ Author:        Ozgur Altinok  - ozgur.altinok@tufts.edu
 #ifndef CCProtonPi0_Plotter_H
 #define CCProtonPi0_Plotter_H
 #include <numeric>
+#include <map>
 
 #include "Cintex/Cintex.h"
 #include <MinervaUnfold/MnvUnfold.h>
+#include "../BayesUnfold/CCProtonPi0_BayesUnfold.h"
 #include <PlotUtils/MnvFluxConstraint.h>
 #include <PlotUtils/MnvPlotter.h>
 #include <PlotUtils/POTCounter.h>
@@ -48,6 +50,7 @@ Author:        Ozgur Altinok  - ozgur.altinok@tufts.edu
 #include "../NTupleAnalysis/CCProtonPi0_NTupleAnalysis.h"
 #include "../BinList/CCProtonPi0_BinList.h"
 #include "../QSqFitter/CCProtonPi0_QSqFitter.h"
+#include "../WFitModel/CCProtonPi0_WFitModel.h"
 
 using namespace PlotUtils;
 
@@ -77,9 +80,17 @@ class CCProtonPi0_Plotter : public CCProtonPi0_NTupleAnalysis
         CCProtonPi0_Plotter();
         void plotHistograms();
 
+        // MaRES and W Shift ChiSq scans run on nWorkers processes
+        void SetNWorkers(int n);
+
     private:
         bool thesisStyle;
         bool isPaperComparison;
+        bool isNativeUnfolding;
+        CCProtonPi0_BayesUnfold bayesUnfold;
+
+        // Shared by all MaRES and W Shift fits -- Inputs are loaded once
+        CCProtonPi0_QSqFitter QSqFitter;
 
         rootDir rootDir_PC;
         rootDir rootDir_GENIEXSec;
@@ -451,6 +462,25 @@ class CCProtonPi0_Plotter : public CCProtonPi0_NTupleAnalysis
         void Supplement_Correlation_CSV();
         void Supplement_Correlation_CSV(std::string var_name, std::string root_dir, std::string bin_name);
         void Supplement_Flux_CSV();
+
+        // Histogram Cache -- Process-wide and read-only
+        //      Each ROOT file is opened once and each histogram is read once
+        //      Cached files are owned by the cache -- Do NOT delete them
+        static std::map<std::string, TFile*> cached_files;
+        static std::map<std::pair<TFile*, std::string>, TH1*> cached_hists;
+        TFile* GetCachedFile(const std::string& file_name);
+        bool IsCachedFile(TFile* f);
+        TH1* GetCachedHist(TFile* f, const std::string& var_name);
+        // Read-only plots use the cached histogram directly -- No copy
+        const MnvH1D& GetCachedMnvH1D(const std::string& file_name, const std::string& var_name);
+        const MnvH2D& GetCachedMnvH2D(const std::string& file_name, const std::string& var_name);
+        // Called at the end of plotHistograms()
+        void ClearHistCache();
+
+        // Returns a "new" copy -- Histograms in a cached file are read from the cache
+        TH1D* GetTH1D(TFile* f, std::string var_name);
+        MnvH1D* GetMnvH1D(TFile* f, std::string var_name);
+        MnvH2D* GetMnvH2D(TFile* f, std::string var_name);
 };
 
 #endif
@@ -42,11 +42,11 @@ void CCProtonPi0_Plotter::Draw_Comparison_DeltaFactor(std::string var_name)
     std::string deltafactor_data_dir = "/minerva/data/users/oaltinok/NTupleAnalysis_DeltaFactor_Applied/Data/Analyzed/CrossSection.root";
     std::string deltafactor_mc_dir = "/minerva/data/users/oaltinok/NTupleAnalysis_DeltaFactor_Applied/MC/Analyzed/CrossSection.root";
 
-    TFile* f_data_final = new TFile(final_data_dir.c_str());
-    TFile* f_mc_final = new TFile(final_mc_dir.c_str());
+    TFile* f_data_final = GetCachedFile(final_data_dir);
+    TFile* f_mc_final = GetCachedFile(final_mc_dir);
 
-    TFile* f_data_deltafactor = new TFile(deltafactor_data_dir.c_str());
-    TFile* f_mc_deltafactor = new TFile(deltafactor_mc_dir.c_str());
+    TFile* f_data_deltafactor = GetCachedFile(deltafactor_data_dir);
+    TFile* f_mc_deltafactor = GetCachedFile(deltafactor_mc_dir);
 
     // --------------------------------------------------------------------
     // Get Histograms 
@@ -146,10 +146,6 @@ void CCProtonPi0_Plotter::Draw_Comparison_DeltaFactor(std::string var_name)
     delete mc_deltafactor;
     delete h_mc_final;
     delete c;
-    delete f_data_deltafactor;
-    delete f_data_final;
-    delete f_mc_deltafactor;
-    delete f_mc_final;
 }
 
 void CCProtonPi0_Plotter::Draw_Comparison_Nominal(std::string var_name)
@@ -165,11 +161,11 @@ void CCProtonPi0_Plotter::Draw_Comparison_Nominal(std::string var_name)
     std::string nominal_data_dir = "/minerva/data/users/oaltinok/NTupleAnalysis_Nominal/Data/Analyzed/CrossSection.root";
     std::string nominal_mc_dir = "/minerva/data/users/oaltinok/NTupleAnalysis_Nominal/MC/Analyzed/CrossSection.root";
 
-    TFile* f_data_final = new TFile(final_data_dir.c_str());
-    TFile* f_mc_final = new TFile(final_mc_dir.c_str());
+    TFile* f_data_final = GetCachedFile(final_data_dir);
+    TFile* f_mc_final = GetCachedFile(final_mc_dir);
 
-    TFile* f_data_nominal = new TFile(nominal_data_dir.c_str());
-    TFile* f_mc_nominal = new TFile(nominal_mc_dir.c_str());
+    TFile* f_data_nominal = GetCachedFile(nominal_data_dir);
+    TFile* f_mc_nominal = GetCachedFile(nominal_mc_dir);
     
     // --------------------------------------------------------------------
     // Get Histograms 
@@ -276,10 +272,6 @@ void CCProtonPi0_Plotter::Draw_Comparison_Nominal(std::string var_name)
     delete mc_nominal;
     delete h_mc_final;
     delete c;
-    delete f_data_nominal;
-    delete f_data_final;
-    delete f_mc_nominal;
-    delete f_mc_final;
 }
 
 // Returns "new" TH1D's
@@ -295,13 +287,13 @@ void CCProtonPi0_Plotter::GENIE_Tuning_GetHistograms(std::string var_name, std::
     //std::string mc_dir_tuned_best = "/minerva/data/users/oaltinok/NTupleAnalysis_Only2p2h/MC/Analyzed/CrossSection.root";
     std::string mc_dir_tuned_best = "/minerva/data/users/oaltinok/NTupleAnalysis_Best/MC/Analyzed/CrossSection.root";
 
-    TFile* f_data_nominal = new TFile(data_dir_nominal.c_str());
-    TFile* f_data_tuned_test = new TFile(data_dir_tuned_test.c_str());
-    TFile* f_data_tuned_best = new TFile(data_dir_tuned_best.c_str());
+    TFile* f_data_nominal = GetCachedFile(data_dir_nominal);
+    TFile* f_data_tuned_test = GetCachedFile(data_dir_tuned_test);
+    TFile* f_data_tuned_best = GetCachedFile(data_dir_tuned_best);
 
-    TFile* f_mc_nominal = new TFile(mc_dir_nominal.c_str());
-    TFile* f_mc_tuned_test = new TFile(mc_dir_tuned_test.c_str());
-    TFile* f_mc_tuned_best = new TFile(mc_dir_tuned_best.c_str());
+    TFile* f_mc_nominal = GetCachedFile(mc_dir_nominal);
+    TFile* f_mc_tuned_test = GetCachedFile(mc_dir_tuned_test);
+    TFile* f_mc_tuned_best = GetCachedFile(mc_dir_tuned_best);
 
     MnvH1D* temp = NULL;
 
@@ -335,12 +327,6 @@ void CCProtonPi0_Plotter::GENIE_Tuning_GetHistograms(std::string var_name, std::
     mc_tuned_best = GetBinNormalizedTH1D(temp);
     delete temp;
 
-    delete f_data_nominal;
-    delete f_data_tuned_test;
-    delete f_data_tuned_best;
-    delete f_mc_nominal;
-    delete f_mc_tuned_test;
-    delete f_mc_tuned_best;
 }
 
 void CCProtonPi0_Plotter::GENIE_Tuning_DataMC_Ratio(std::string var_name, std::string data_var, std::string mc_var)
@@ -0,0 +1,127 @@
+#ifndef CCProtonPi0_Plotter_HistCache_cpp
+#define CCProtonPi0_Plotter_HistCache_cpp
+
+#include "CCProtonPi0_Plotter.h"
+
+using namespace PlotUtils;
+
+std::map<std::string, TFile*> CCProtonPi0_Plotter::cached_files;
+std::map<std::pair<TFile*, std::string>, TH1*> CCProtonPi0_Plotter::cached_hists;
+
+TFile* CCProtonPi0_Plotter::GetCachedFile(const std::string& file_name)
+{
+    std::map<std::string, TFile*>::iterator it = cached_files.find(file_name);
+    if (it != cached_files.end()) return it->second;
+
+    // Opening a file changes the current directory -- Histograms created by
+    // the plotting functions must not be attached to a cached file
+    TDirectory* current_dir = gDirectory;
+    TFile* f = new TFile(file_name.c_str());
+    if (current_dir != NULL) current_dir->cd();
+
+    if (f->IsZombie()){
+        delete f;
+        RunTimeError("Cannot open ROOT file " + file_name);
+    }
+
+    cached_files[file_name] = f;
+    return f;
+}
+
+bool CCProtonPi0_Plotter::IsCachedFile(TFile* f)
+{
+    std::map<std::string, TFile*>::iterator it;
+    for (it = cached_files.begin(); it != cached_files.end(); ++it){
+        if (it->second == f) return true;
+    }
+    return false;
+}
+
+TH1* CCProtonPi0_Plotter::GetCachedHist(TFile* f, const std::string& var_name)
+{
+    std::pair<TFile*, std::string> key(f, var_name);
+    std::map<std::pair<TFile*, std::string>, TH1*>::iterator it = cached_hists.find(key);
+    if (it != cached_hists.end()) return it->second;
+
+    TH1* hist = dynamic_cast<TH1*>(f->Get(var_name.c_str()));
+    if (hist == NULL){
+        RunTimeError("Cannot find " + var_name + " in " + f->GetName());
+    }
+
+    // Cache owns the histogram -- Detach it from the file
+    hist->SetDirectory(NULL);
+    cached_hists[key] = hist;
+    return hist;
+}
+
+const MnvH1D& CCProtonPi0_Plotter::GetCachedMnvH1D(const std::string& file_name, const std::string& var_name)
+{
+    MnvH1D* hist = dynamic_cast<MnvH1D*>(GetCachedHist(GetCachedFile(file_name), var_name));
+    if (hist == NULL){
+        RunTimeError(var_name + " in " + file_name + " is not a MnvH1D");
+    }
+    return *hist;
+}
+
+const MnvH2D& CCProtonPi0_Plotter::GetCachedMnvH2D(const std::string& file_name, const std::string& var_name)
+{
+    MnvH2D* hist = dynamic_cast<MnvH2D*>(GetCachedHist(GetCachedFile(file_name), var_name));
+    if (hist == NULL){
+        RunTimeError(var_name + " in " + file_name + " is not a MnvH2D");
+    }
+    return *hist;
+}
+
+void CCProtonPi0_Plotter::ClearHistCache()
+{
+    std::map<std::pair<TFile*, std::string>, TH1*>::iterator it_hist;
+    for (it_hist = cached_hists.begin(); it_hist != cached_hists.end(); ++it_hist){
+        delete it_hist->second;
+    }
+    cached_hists.clear();
+
+    std::map<std::string, TFile*>::iterator it_file;
+    for (it_file = cached_files.begin(); it_file != cached_files.end(); ++it_file){
+        delete it_file->second;
+    }
+    cached_files.clear();
+}
+
+TH1D* CCProtonPi0_Plotter::GetTH1D(TFile* f, std::string var_name)
+{
+    if (!IsCachedFile(f)) return CCProtonPi0_NTupleAnalysis::GetTH1D(f, var_name);
+
+    TH1D* cached = dynamic_cast<TH1D*>(GetCachedHist(f, var_name));
+    if (cached == NULL) RunTimeError(var_name + " is not a TH1D");
+
+    TH1D* h = new TH1D(*cached);
+    h->SetDirectory(NULL);
+    return h;
+}
+
+MnvH1D* CCProtonPi0_Plotter::GetMnvH1D(TFile* f, std::string var_name)
+{
+    if (!IsCachedFile(f)) return CCProtonPi0_NTupleAnalysis::GetMnvH1D(f, var_name);
+
+    MnvH1D* cached = dynamic_cast<MnvH1D*>(GetCachedHist(f, var_name));
+    if (cached == NULL) RunTimeError(var_name + " is not a MnvH1D");
+
+    MnvH1D* h = new MnvH1D(*cached);
+    h->SetDirectory(NULL);
+    return h;
+}
+
+MnvH2D* CCProtonPi0_Plotter::GetMnvH2D(TFile* f, std::string var_name)
+{
+    if (!IsCachedFile(f)) return CCProtonPi0_NTupleAnalysis::GetMnvH2D(f, var_name);
+
+    MnvH2D* cached = dynamic_cast<MnvH2D*>(GetCachedHist(f, var_name));
+    if (cached == NULL) RunTimeError(var_name + " is not a MnvH2D");
+
+    MnvH2D* h = new MnvH2D(*cached);
+    h->SetDirectory(NULL);
+    return h;
+}
+
+#endif
+
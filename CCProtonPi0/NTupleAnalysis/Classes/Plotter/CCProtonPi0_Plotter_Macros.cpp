@@ -589,7 +589,7 @@ void CCProtonPi0_Plotter::DrawDataMC_Unfolded(rootDir& dir, std::string var_name
     std::string rootDir_mc = dir.mc;
     std::string rootDir_data = dir.data;
 
-    TFile* f_mc = new TFile(rootDir_mc.c_str());
+    TFile* f_mc = GetCachedFile(rootDir_mc);
 
     MnvH1D* data = GetBckgSubtractedData(dir, var_name, nBckg);
     MnvH1D* mc = GetMnvH1D(f_mc, Form("%s_%d",var_name.c_str(),1));
@@ -611,7 +611,6 @@ void CCProtonPi0_Plotter::DrawDataMC_Unfolded(rootDir& dir, std::string var_name
     delete data;
     delete mc;
     delete response;
-    delete f_mc;
 }
 
 void CCProtonPi0_Plotter::DrawDataMC_EffCorrected(rootDir& dir, std::string var_name, std::string plotDir, double nBckg)
@@ -619,7 +618,7 @@ void CCProtonPi0_Plotter::DrawDataMC_EffCorrected(rootDir& dir, std::string var_
     std::string rootDir_mc = dir.mc;
     std::string rootDir_data = dir.data;
 
-    TFile* f_mc = new TFile(rootDir_mc.c_str());
+    TFile* f_mc = GetCachedFile(rootDir_mc);
 
     // Background Subtraction
     MnvH1D* data = GetBckgSubtractedData(dir, var_name, nBckg);
@@ -635,7 +634,7 @@ void CCProtonPi0_Plotter::DrawDataMC_EffCorrected(rootDir& dir, std::string var_
     // Efficiency Correction
     MnvH1D* mc = GetMnvH1D(f_mc, Form("%s_%d",var_name.c_str(),1));
 
-    TFile* f_truth = new TFile(rootDir_Truth.mc.c_str()); 
+    TFile* f_truth = GetCachedFile(rootDir_Truth.mc); 
     var = var_name + "_all_signal";
     MnvH1D* mc_all_signal = GetMnvH1D(f_truth, var);
 
@@ -658,8 +657,6 @@ void CCProtonPi0_Plotter::DrawDataMC_EffCorrected(rootDir& dir, std::string var_
     delete mc_all_signal;
     delete eff_curve;
     delete data_eff_corrected;
-    delete f_truth;
-    delete f_mc;
 }
 
 void CCProtonPi0_Plotter::DrawDataMC_EffCorrected_Stacked(rootDir& dir, std::string var_name, std::string plotDir, double nBckg)
@@ -667,7 +664,7 @@ void CCProtonPi0_Plotter::DrawDataMC_EffCorrected_Stacked(rootDir& dir, std::str
     std::string rootDir_mc = dir.mc;
     std::string rootDir_data = dir.data;
 
-    TFile* f_mc = new TFile(rootDir_mc.c_str());
+    TFile* f_mc = GetCachedFile(rootDir_mc);
 
     // Background Subtraction
     MnvH1D* data = GetBckgSubtractedData(dir, var_name, nBckg);
@@ -685,7 +682,7 @@ void CCProtonPi0_Plotter::DrawDataMC_EffCorrected_Stacked(rootDir& dir, std::str
     // ------------------------------------------------------------------------
     MnvH1D* mc = GetMnvH1D(f_mc, Form("%s_%s",var_name.c_str(),"mc_reco_signal"));
 
-    TFile* f_truth = new TFile(rootDir_Truth.mc.c_str()); 
+    TFile* f_truth = GetCachedFile(rootDir_Truth.mc); 
     var = var_name + "_all_signal";
     MnvH1D* mc_all_signal = GetMnvH1D(f_truth, var);
 
@@ -722,8 +719,6 @@ void CCProtonPi0_Plotter::DrawDataMC_EffCorrected_Stacked(rootDir& dir, std::str
     delete mc_all_signal;
     delete eff_curve;
     delete data_eff_corrected;
-    delete f_truth;
-    delete f_mc;
 }
 void CCProtonPi0_Plotter::DrawDataMC_Thesis(rootDir& dir, std::string var_name, std::string plotDir)
 {
@@ -745,8 +740,8 @@ void CCProtonPi0_Plotter::DrawDataMC_WithBackground(std::string var_name, std::s
 {
     std::cout<<"Plotting for "<<var_name<<std::endl;
 
-    TFile* f_xsec_data = new TFile(rootDir_CrossSection.data.c_str());
-    TFile* f_xsec_mc = new TFile(rootDir_CrossSection.mc.c_str());
+    TFile* f_xsec_data = GetCachedFile(rootDir_CrossSection.data);
+    TFile* f_xsec_mc = GetCachedFile(rootDir_CrossSection.mc);
 
     std::string data_var = var_name + "_all";
     std::string mc_var = var_name + "_mc_reco_all";
@@ -1013,7 +1008,7 @@ void CCProtonPi0_Plotter::DrawDataMC_Signal(rootDir& dir, std::string var_name,
     std::string rootDir_mc = dir.mc;
     std::string rootDir_data = dir.data;
 
-    TFile* f_mc = new TFile(rootDir_mc.c_str());
+    TFile* f_mc = GetCachedFile(rootDir_mc);
 
     std::string var = Form("%s_%d",var_name.c_str(),1);
 
@@ -1023,7 +1018,6 @@ void CCProtonPi0_Plotter::DrawDataMC_Signal(rootDir& dir, std::string var_name,
 
     delete data;
     delete mc;
-    delete f_mc;
 }
 
 void CCProtonPi0_Plotter::DrawDataMC(MnvH1D* data, MnvH1D* mc, std::string var_name, std::string plotDir, bool isXSec)
@@ -1842,16 +1836,15 @@ void CCProtonPi0_Plotter::DrawMnvH2D_Signal(rootDir root_dir, std::string var_na
     MnvH2D* hist2D;
 
     if (isMC){
-        f = new TFile(root_dir.mc.c_str());
+        f = GetCachedFile(root_dir.mc);
         var_name = var_name + "_mc_reco_signal";
         hist2D = GetMnvH2D(f, var_name);
     }else{
-        f = new TFile(root_dir.data.c_str());
+        f = GetCachedFile(root_dir.data);
         hist2D = GetBckgSubtractedData_2D(root_dir, var_name, nBckg);
     }
     DrawMnvH2D(hist2D, var_name, plotDir, isMC);
 
-    delete f;
     delete hist2D;
 }
 
@@ -1861,12 +1854,11 @@ void CCProtonPi0_Plotter::DrawMnvH2D(std::string root_dir, std::string var_name,
     
     bool isMC = (found == std::string::npos) ? true : false;
 
-    TFile* f = new TFile(root_dir.c_str());
+    TFile* f = GetCachedFile(root_dir);
     MnvH2D* hist2D = GetMnvH2D(f, var_name);
 
     DrawMnvH2D(hist2D, var_name, plotDir, isMC);
 
-    delete f;
     delete hist2D;
 }
 
@@ -2687,9 +2679,8 @@ void CCProtonPi0_Plotter::DrawNormalizedMigrationHistogram(rootDir &dir, std::st
 {
     std::string root_dir = dir.mc;
 
-    // Get Histogram
-    TFile* f = new TFile(root_dir.c_str());
-    MnvH2D* hist2D = (MnvH2D*)f->Get(var_name.c_str());
+    // Get Histogram -- Read Only, Cached histogram is not copied
+    const MnvH2D& hist2D = GetCachedMnvH2D(root_dir, var_name);
 
     // Canvas
     Double_t w = 800; 
@@ -2701,13 +2692,12 @@ void CCProtonPi0_Plotter::DrawNormalizedMigrationHistogram(rootDir &dir, std::st
     // ------------------------------------------------------------------------
     MnvPlotter* plotter = new MnvPlotter();
     //ApplyStyle(plotter);
-    plotter->DrawNormalizedMigrationHistogram(hist2D, true, false, false);
+    plotter->DrawNormalizedMigrationHistogram(&hist2D, true, false, false);
 
     c->Print(Form("%s%s%s",plotDir.c_str(),var_name.c_str(),"_migration.pdf"), "pdf");
 
     delete c;
     delete plotter;
-    delete f;
 }
 
 void CCProtonPi0_Plotter::DrawTGraph(rootDir &dir, std::string var_name, std::string plotDir)
@@ -2873,8 +2863,8 @@ void CCProtonPi0_Plotter::DrawDataStackedMC_WithSignalTypes(rootDir &dir, std::s
     double mc_ratio = POT_ratio;
 
     // Open ROOT Files
-    TFile* f_data = new TFile(dir.data.c_str());
-    TFile* f_mc = new TFile(dir.mc.c_str());
+    TFile* f_data = GetCachedFile(dir.data);
+    TFile* f_mc = GetCachedFile(dir.mc);
 
     // Get Data Histogram
     var = var_name + "_0";
@@ -3027,15 +3017,13 @@ void CCProtonPi0_Plotter::DrawDataStackedMC_WithSignalTypes(rootDir &dir, std::s
     delete legend;
     delete c;
 
-    delete f_data;
-    delete f_mc;
 }
 
 // Returns a "new" MnvH1D -- Do not forget to delete
 MnvH1D* CCProtonPi0_Plotter::GetBckgSubtractedData(rootDir& dir, std::string var_name, double nBckg)
 {
-    TFile* f_data = new TFile(dir.data.c_str());
-    TFile* f_mc  = new TFile(dir.mc.c_str());
+    TFile* f_data = GetCachedFile(dir.data);
+    TFile* f_mc  = GetCachedFile(dir.mc);
 
     // Get Data Histogram
     std::string var = var_name + "_all";
@@ -3051,8 +3039,6 @@ MnvH1D* CCProtonPi0_Plotter::GetBckgSubtractedData(rootDir& dir, std::string var
     h_data->Add(h_mc_bckg, -1);
 
     delete h_mc_bckg;
-    delete f_data;
-    delete f_mc;
 
     return h_data;
 }
@@ -3060,8 +3046,8 @@ MnvH1D* CCProtonPi0_Plotter::GetBckgSubtractedData(rootDir& dir, std::string var
 // Returns a "new" MnvH2D -- Do not forget to delete
 MnvH2D* CCProtonPi0_Plotter::GetBckgSubtractedData_2D(rootDir& dir, std::string var_name, double nBckg)
 {
-    TFile* f_data = new TFile(dir.data.c_str());
-    TFile* f_mc  = new TFile(dir.mc.c_str());
+    TFile* f_data = GetCachedFile(dir.data);
+    TFile* f_mc  = GetCachedFile(dir.mc);
 
     // Get Data Histogram
     std::string var = var_name + "_all";
@@ -3077,8 +3063,6 @@ MnvH2D* CCProtonPi0_Plotter::GetBckgSubtractedData_2D(rootDir& dir, std::string
     h_data->Add(h_mc_bckg, -1);
 
     delete h_mc_bckg;
-    delete f_data;
-    delete f_mc;
 
     return h_data;
 }
@@ -3090,8 +3074,8 @@ void CCProtonPi0_Plotter::DrawDataStackedMC_Signal(rootDir &dir, std::string var
     double mc_ratio = POT_ratio;
 
     // Open ROOT Files
-    TFile* f_data = new TFile(dir.data.c_str());
-    TFile* f_mc = new TFile(dir.mc.c_str());
+    TFile* f_data = GetCachedFile(dir.data);
+    TFile* f_mc = GetCachedFile(dir.mc);
 
     // Get Bckg Subtracted Data Histogram
     MnvH1D* h_data = GetBckgSubtractedData(dir, var_name, nBckg); 
@@ -3182,8 +3166,6 @@ void CCProtonPi0_Plotter::DrawDataStackedMC_Signal(rootDir &dir, std::string var
     delete legend;
     delete c;
 
-    delete f_data;
-    delete f_mc;
 }
 
 void CCProtonPi0_Plotter::DrawDataMCSignal_Diff(rootDir& dir, std::string var_name, std::string plotDir, double nBckg)
@@ -3191,7 +3173,7 @@ void CCProtonPi0_Plotter::DrawDataMCSignal_Diff(rootDir& dir, std::string var_na
     std::string rootDir_mc = dir.mc;
     std::string rootDir_data = dir.data;
 
-    TFile* f_mc = new TFile(rootDir_mc.c_str());
+    TFile* f_mc = GetCachedFile(rootDir_mc);
 
     std::string var = Form("%s_%d",var_name.c_str(),1);
 
@@ -3226,7 +3208,6 @@ void CCProtonPi0_Plotter::DrawDataMCSignal_Diff(rootDir& dir, std::string var_na
     delete mc;
     delete ratio;
     delete diff;
-    delete f_mc;
 }
 
 void CCProtonPi0_Plotter::DrawDataMCSignal_Diff_2D(rootDir& dir, std::string var_name, std::string plotDir, double nBckg)
@@ -3234,7 +3215,7 @@ void CCProtonPi0_Plotter::DrawDataMCSignal_Diff_2D(rootDir& dir, std::string var
     std::string rootDir_mc = dir.mc;
     std::string rootDir_data = dir.data;
 
-    TFile* f_mc = new TFile(rootDir_mc.c_str());
+    TFile* f_mc = GetCachedFile(rootDir_mc);
 
     std::string var = Form("%s_%s",var_name.c_str(),"mc_reco_signal");
 
@@ -3271,7 +3252,6 @@ void CCProtonPi0_Plotter::DrawDataMCSignal_Diff_2D(rootDir& dir, std::string var
     delete data;
     delete errors;
     delete mc;
-    delete f_mc;
 }
 
 double CCProtonPi0_Plotter::Get2DTotalFlow(MnvH2D* h)
@@ -8,7 +8,7 @@ using namespace PlotUtils;
 void CCProtonPi0_Plotter::DrawPaper_Error_pi0_KE()
 {
     std::string root_dir_data = Folder_List::rootDir_Signal_Original_Data;
-    TFile* f_data = new TFile(root_dir_data.c_str());
+    TFile* f_data = GetCachedFile(root_dir_data);
 
     std::string var_name = "pi0_KE_xsec";
 
@@ -150,7 +150,7 @@ void CCProtonPi0_Plotter::DrawPaper_Error_pi0_KE()
 void CCProtonPi0_Plotter::DrawPaper_Error_muon_P()
 {
     std::string root_dir_data = Folder_List::rootDir_Signal_Original_Data;
-    TFile* f_data = new TFile(root_dir_data.c_str());
+    TFile* f_data = GetCachedFile(root_dir_data);
 
     std::string var_name = "muon_P_xsec";
 
@@ -294,8 +294,8 @@ void CCProtonPi0_Plotter::DrawPaper_Enu(bool is1Track)
     std::string root_dir_data = Folder_List::rootDir_Interaction_Signal_Original_Data;
     std::string root_dir_mc = Folder_List::rootDir_Interaction_Signal_Original_MC;
 
-    TFile* f_data = new TFile(root_dir_data.c_str());
-    TFile* f_mc = new TFile(root_dir_mc.c_str());
+    TFile* f_data = GetCachedFile(root_dir_data);
+    TFile* f_mc = GetCachedFile(root_dir_mc);
 
     std::string var = is1Track ? "Enu_1Track_0" : "Enu_2Track_0";
 
@@ -443,8 +443,8 @@ void CCProtonPi0_Plotter::DrawPaper_extra_total_energy(bool is1Track)
     std::string root_dir_data = Folder_List::rootDir_Interaction_Signal_Original_Data;
     std::string root_dir_mc = Folder_List::rootDir_Interaction_Signal_Original_MC;
 
-    TFile* f_data = new TFile(root_dir_data.c_str());
-    TFile* f_mc = new TFile(root_dir_mc.c_str());
+    TFile* f_data = GetCachedFile(root_dir_data);
+    TFile* f_mc = GetCachedFile(root_dir_mc);
 
     std::string var = is1Track ? "extra_total_energy_1Track_0" : "extra_total_energy_2Track_0";
 
@@ -591,8 +591,8 @@ void CCProtonPi0_Plotter::DrawPaper_vertex_energy(bool is1Track)
     std::string root_dir_data = Folder_List::rootDir_Interaction_Signal_Original_Data;
     std::string root_dir_mc = Folder_List::rootDir_Interaction_Signal_Original_MC;
 
-    TFile* f_data = new TFile(root_dir_data.c_str());
-    TFile* f_mc = new TFile(root_dir_mc.c_str());
+    TFile* f_data = GetCachedFile(root_dir_data);
+    TFile* f_mc = GetCachedFile(root_dir_mc);
 
     std::string var = is1Track ? "vertex_energy_1Track_0" : "vertex_energy_2Track_0";
 
@@ -739,8 +739,8 @@ void CCProtonPi0_Plotter::DrawPaper_xsec_Enu_IntType()
     std::string root_dir_data = Folder_List::rootDir_Signal_Original_Data;
     std::string root_dir_mc = Folder_List::rootDir_Signal_Original_MC;
 
-    TFile* f_data = new TFile(root_dir_data.c_str());
-    TFile* f_mc = new TFile(root_dir_mc.c_str());
+    TFile* f_data = GetCachedFile(root_dir_data);
+    TFile* f_mc = GetCachedFile(root_dir_mc);
 
     std::string var_name = "Enu";
     std::string data_var = var_name + "_xsec";
@@ -900,8 +900,8 @@ void CCProtonPi0_Plotter::DrawPaper_xsec_Delta_pi_phi_2Bin_IntType()
     std::string root_dir_data = Folder_List::rootDir_Signal_2Bin_DeltaRich_Data;
     std::string root_dir_mc = Folder_List::rootDir_Signal_2Bin_DeltaRich_MC;
 
-    TFile* f_data = new TFile(root_dir_data.c_str());
-    TFile* f_mc = new TFile(root_dir_mc.c_str());
+    TFile* f_data = GetCachedFile(root_dir_data);
+    TFile* f_mc = GetCachedFile(root_dir_mc);
 
     std::string var_name = "Delta_pi_phi";
     std::string data_var = var_name + "_xsec";
@@ -1096,8 +1096,8 @@ void CCProtonPi0_Plotter::DrawPaper_xsec_Delta_pi_phi_IntType()
     std::string root_dir_data = Folder_List::rootDir_Signal_DeltaRich_Data;
     std::string root_dir_mc = Folder_List::rootDir_Signal_DeltaRich_MC;
 
-    TFile* f_data = new TFile(root_dir_data.c_str());
-    TFile* f_mc = new TFile(root_dir_mc.c_str());
+    TFile* f_data = GetCachedFile(root_dir_data);
+    TFile* f_mc = GetCachedFile(root_dir_mc);
 
     std::string var_name = "Delta_pi_phi";
     std::string data_var = var_name + "_xsec";
@@ -1264,8 +1264,8 @@ void CCProtonPi0_Plotter::DrawPaper_xsec_Delta_pi_theta_IntType()
     std::string root_dir_data = Folder_List::rootDir_Signal_DeltaRich_Data;
     std::string root_dir_mc = Folder_List::rootDir_Signal_DeltaRich_MC;
 
-    TFile* f_data = new TFile(root_dir_data.c_str());
-    TFile* f_mc = new TFile(root_dir_mc.c_str());
+    TFile* f_data = GetCachedFile(root_dir_data);
+    TFile* f_mc = GetCachedFile(root_dir_mc);
 
     std::string var_name = "Delta_pi_theta";
     std::string data_var = var_name + "_xsec";
@@ -1445,8 +1445,8 @@ void CCProtonPi0_Plotter::DrawPaper_xsec_Delta_pi_theta_2Bin_IntType()
     std::string root_dir_data = Folder_List::rootDir_Signal_2Bin_DeltaRich_Data;
     std::string root_dir_mc = Folder_List::rootDir_Signal_2Bin_DeltaRich_MC;
 
-    TFile* f_data = new TFile(root_dir_data.c_str());
-    TFile* f_mc = new TFile(root_dir_mc.c_str());
+    TFile* f_data = GetCachedFile(root_dir_data);
+    TFile* f_mc = GetCachedFile(root_dir_mc);
 
     std::string var_name = "Delta_pi_theta";
     std::string data_var = var_name + "_xsec";
@@ -1654,8 +1654,8 @@ void CCProtonPi0_Plotter::DrawPaper_xsec_W_NoLimit_IntType()
     std::string root_dir_data = Folder_List::rootDir_Signal_NoWLimit_Original_Data;
     std::string root_dir_mc = Folder_List::rootDir_Signal_NoWLimit_Original_MC;
 
-    TFile* f_data = new TFile(root_dir_data.c_str());
-    TFile* f_mc = new TFile(root_dir_mc.c_str());
+    TFile* f_data = GetCachedFile(root_dir_data);
+    TFile* f_mc = GetCachedFile(root_dir_mc);
 
     std::string var_name = "W";
     std::string data_var = var_name + "_xsec";
@@ -1827,8 +1827,8 @@ void CCProtonPi0_Plotter::DrawPaper_xsec_W_IntType()
     std::string root_dir_data = Folder_List::rootDir_Signal_Original_Data;
     std::string root_dir_mc = Folder_List::rootDir_Signal_Original_MC;
 
-    TFile* f_data = new TFile(root_dir_data.c_str());
-    TFile* f_mc = new TFile(root_dir_mc.c_str());
+    TFile* f_data = GetCachedFile(root_dir_data);
+    TFile* f_mc = GetCachedFile(root_dir_mc);
 
     std::string var_name = "W";
     std::string data_var = var_name + "_xsec";
@@ -1989,8 +1989,8 @@ void CCProtonPi0_Plotter::DrawPaper_xsec_deltaInvMass2_IntType()
     std::string root_dir_data = Folder_List::rootDir_Signal_TwoTrack_Data;
     std::string root_dir_mc = Folder_List::rootDir_Signal_TwoTrack_MC;
 
-    TFile* f_data = new TFile(root_dir_data.c_str());
-    TFile* f_mc = new TFile(root_dir_mc.c_str());
+    TFile* f_data = GetCachedFile(root_dir_data);
+    TFile* f_mc = GetCachedFile(root_dir_mc);
 
     std::string var_name = "deltaInvMass";
     std::string data_var = var_name + "_xsec";
@@ -2173,8 +2173,8 @@ void CCProtonPi0_Plotter::DrawPaper_xsec_deltaInvMass_IntType()
     std::string root_dir_data = Folder_List::rootDir_Signal_DeltaRich_Data;
     std::string root_dir_mc = Folder_List::rootDir_Signal_DeltaRich_MC;
 
-    TFile* f_data = new TFile(root_dir_data.c_str());
-    TFile* f_mc = new TFile(root_dir_mc.c_str());
+    TFile* f_data = GetCachedFile(root_dir_data);
+    TFile* f_mc = GetCachedFile(root_dir_mc);
 
     std::string var_name = "deltaInvMass";
     std::string data_var = var_name + "_xsec";
@@ -2358,8 +2358,8 @@ void CCProtonPi0_Plotter::DrawPaper_xsec_QSq_IntType()
     std::string root_dir_data = Folder_List::rootDir_Signal_Original_Data;
     std::string root_dir_mc = Folder_List::rootDir_Signal_Original_MC;
 
-    TFile* f_data = new TFile(root_dir_data.c_str());
-    TFile* f_mc = new TFile(root_dir_mc.c_str());
+    TFile* f_data = GetCachedFile(root_dir_data);
+    TFile* f_mc = GetCachedFile(root_dir_mc);
 
     std::string var_name = "QSq";
     std::string data_var = var_name + "_xsec";
@@ -2519,8 +2519,8 @@ void CCProtonPi0_Plotter::DrawPaper_xsec_pi0_theta_IntType()
     std::string root_dir_data = Folder_List::rootDir_Signal_Original_Data;
     std::string root_dir_mc = Folder_List::rootDir_Signal_Original_MC;
 
-    TFile* f_data = new TFile(root_dir_data.c_str());
-    TFile* f_mc = new TFile(root_dir_mc.c_str());
+    TFile* f_data = GetCachedFile(root_dir_data);
+    TFile* f_mc = GetCachedFile(root_dir_mc);
 
     std::string var_name = "pi0_theta";
     std::string data_var = var_name + "_xsec";
@@ -2687,8 +2687,8 @@ void CCProtonPi0_Plotter::DrawPaper_xsec_pi0_KE_IntType()
     std::string root_dir_data = Folder_List::rootDir_Signal_Original_Data;
     std::string root_dir_mc = Folder_List::rootDir_Signal_Original_MC;
 
-    TFile* f_data = new TFile(root_dir_data.c_str());
-    TFile* f_mc = new TFile(root_dir_mc.c_str());
+    TFile* f_data = GetCachedFile(root_dir_data);
+    TFile* f_mc = GetCachedFile(root_dir_mc);
 
     std::string var_name = "pi0_KE";
     std::string data_var = var_name + "_xsec";
@@ -2848,8 +2848,8 @@ void CCProtonPi0_Plotter::DrawPaper_xsec_muon_theta_IntType()
     std::string root_dir_data = Folder_List::rootDir_Signal_Original_Data;
     std::string root_dir_mc = Folder_List::rootDir_Signal_Original_MC;
 
-    TFile* f_data = new TFile(root_dir_data.c_str());
-    TFile* f_mc = new TFile(root_dir_mc.c_str());
+    TFile* f_data = GetCachedFile(root_dir_data);
+    TFile* f_mc = GetCachedFile(root_dir_mc);
 
     std::string var_name = "muon_theta";
     std::string data_var = var_name + "_xsec";
@@ -3009,8 +3009,8 @@ void CCProtonPi0_Plotter::DrawPaper_xsec_muon_P_IntType()
     std::string root_dir_data = Folder_List::rootDir_Signal_Original_Data;
     std::string root_dir_mc = Folder_List::rootDir_Signal_Original_MC;
 
-    TFile* f_data = new TFile(root_dir_data.c_str());
-    TFile* f_mc = new TFile(root_dir_mc.c_str());
+    TFile* f_data = GetCachedFile(root_dir_data);
+    TFile* f_mc = GetCachedFile(root_dir_mc);
 
     std::string var_name = "muon_P";
     std::string data_var = var_name + "_xsec";
@@ -3171,8 +3171,8 @@ void CCProtonPi0_Plotter::DrawPaper_xsec_Enu_FSIType()
     std::string root_dir_data = Folder_List::rootDir_Signal_Original_Data;
     std::string root_dir_mc = Folder_List::rootDir_Signal_Original_MC;
 
-    TFile* f_data = new TFile(root_dir_data.c_str());
-    TFile* f_mc = new TFile(root_dir_mc.c_str());
+    TFile* f_data = GetCachedFile(root_dir_data);
+    TFile* f_mc = GetCachedFile(root_dir_mc);
 
     std::string var_name = "Enu";
     std::string data_var = var_name + "_xsec";
@@ -3376,8 +3376,6 @@ void CCProtonPi0_Plotter::DrawPaper_xsec_Enu_FSIType()
     delete legend;
     delete c;
     delete plotter;
-    delete f_mc;
-    delete f_data;
 }
 
 void CCProtonPi0_Plotter::DrawPaper_xsec_QSq_FSIType()
@@ -3385,8 +3383,8 @@ void CCProtonPi0_Plotter::DrawPaper_xsec_QSq_FSIType()
     std::string root_dir_data = Folder_List::rootDir_Signal_Original_Data;
     std::string root_dir_mc = Folder_List::rootDir_Signal_Original_MC;
 
-    TFile* f_data = new TFile(root_dir_data.c_str());
-    TFile* f_mc = new TFile(root_dir_mc.c_str());
+    TFile* f_data = GetCachedFile(root_dir_data);
+    TFile* f_mc = GetCachedFile(root_dir_mc);
 
     std::string var_name = "QSq";
     std::string data_var = var_name + "_xsec";
@@ -3592,8 +3590,6 @@ void CCProtonPi0_Plotter::DrawPaper_xsec_QSq_FSIType()
     delete legend;
     delete c;
     delete plotter;
-    delete f_mc;
-    delete f_data;
 }
 
 void CCProtonPi0_Plotter::DrawPaper_xsec_pi0_theta_FSIType()
@@ -3601,8 +3597,8 @@ void CCProtonPi0_Plotter::DrawPaper_xsec_pi0_theta_FSIType()
     std::string root_dir_data = Folder_List::rootDir_Signal_Original_Data;
     std::string root_dir_mc = Folder_List::rootDir_Signal_Original_MC;
 
-    TFile* f_data = new TFile(root_dir_data.c_str());
-    TFile* f_mc = new TFile(root_dir_mc.c_str());
+    TFile* f_data = GetCachedFile(root_dir_data);
+    TFile* f_mc = GetCachedFile(root_dir_mc);
 
     std::string var_name = "pi0_theta";
     std::string data_var = var_name + "_xsec";
@@ -3804,8 +3800,6 @@ void CCProtonPi0_Plotter::DrawPaper_xsec_pi0_theta_FSIType()
     delete legend;
     delete c;
     delete plotter;
-    delete f_mc;
-    delete f_data;
 }
 
 void CCProtonPi0_Plotter::DrawPaper_xsec_pi0_KE_FSIType()
@@ -3813,8 +3807,8 @@ void CCProtonPi0_Plotter::DrawPaper_xsec_pi0_KE_FSIType()
     std::string root_dir_data = Folder_List::rootDir_Signal_Original_Data;
     std::string root_dir_mc = Folder_List::rootDir_Signal_Original_MC;
 
-    TFile* f_data = new TFile(root_dir_data.c_str());
-    TFile* f_mc = new TFile(root_dir_mc.c_str());
+    TFile* f_data = GetCachedFile(root_dir_data);
+    TFile* f_mc = GetCachedFile(root_dir_mc);
 
     std::string var_name = "pi0_KE";
     std::string data_var = var_name + "_xsec";
@@ -4019,8 +4013,6 @@ void CCProtonPi0_Plotter::DrawPaper_xsec_pi0_KE_FSIType()
     delete legend;
     delete c;
     delete plotter;
-    delete f_mc;
-    delete f_data;
 }
 
 void CCProtonPi0_Plotter::DrawPaper_xsec_muon_theta_FSIType()
@@ -4028,8 +4020,8 @@ void CCProtonPi0_Plotter::DrawPaper_xsec_muon_theta_FSIType()
     std::string root_dir_data = Folder_List::rootDir_Signal_Original_Data;
     std::string root_dir_mc = Folder_List::rootDir_Signal_Original_MC;
 
-    TFile* f_data = new TFile(root_dir_data.c_str());
-    TFile* f_mc = new TFile(root_dir_mc.c_str());
+    TFile* f_data = GetCachedFile(root_dir_data);
+    TFile* f_mc = GetCachedFile(root_dir_mc);
 
     std::string var_name = "muon_theta";
     std::string data_var = var_name + "_xsec";
@@ -4233,8 +4225,6 @@ void CCProtonPi0_Plotter::DrawPaper_xsec_muon_theta_FSIType()
     delete legend;
     delete c;
     delete plotter;
-    delete f_mc;
-    delete f_data;
 }
 
 void CCProtonPi0_Plotter::DrawPaper_xsec_muon_P_FSIType()
@@ -4242,8 +4232,8 @@ void CCProtonPi0_Plotter::DrawPaper_xsec_muon_P_FSIType()
     std::string root_dir_data = Folder_List::rootDir_Signal_Original_Data;
     std::string root_dir_mc = Folder_List::rootDir_Signal_Original_MC;
 
-    TFile* f_data = new TFile(root_dir_data.c_str());
-    TFile* f_mc = new TFile(root_dir_mc.c_str());
+    TFile* f_data = GetCachedFile(root_dir_data);
+    TFile* f_mc = GetCachedFile(root_dir_mc);
 
     std::string var_name = "muon_P";
     std::string data_var = var_name + "_xsec";
@@ -4447,8 +4437,6 @@ void CCProtonPi0_Plotter::DrawPaper_xsec_muon_P_FSIType()
     delete legend;
     delete c;
     delete plotter;
-    delete f_mc;
-    delete f_data;
 }
 
 void CCProtonPi0_Plotter::DrawPaper_xsec_Enu10_BeforeFSI()
@@ -4456,8 +4444,8 @@ void CCProtonPi0_Plotter::DrawPaper_xsec_Enu10_BeforeFSI()
     std::string root_dir_data = Folder_List::rootDir_Signal_Original_Data;
     std::string root_dir_mc = Folder_List::rootDir_Signal_Original_MC;
 
-    TFile* f_data = new TFile(root_dir_data.c_str());
-    TFile* f_mc = new TFile(root_dir_mc.c_str());
+    TFile* f_data = GetCachedFile(root_dir_data);
+    TFile* f_mc = GetCachedFile(root_dir_mc);
 
     std::string var_name = "Enu";
     std::string data_var = var_name + "_xsec";
@@ -4574,8 +4562,6 @@ void CCProtonPi0_Plotter::DrawPaper_xsec_Enu10_BeforeFSI()
     delete data;
     delete mc;
     delete h_mc_BeforeFSI;
-    delete f_mc;
-    delete f_data;
 }
 
 void CCProtonPi0_Plotter::DrawPaper_xsec_Enu_BeforeFSI()
@@ -4583,8 +4569,8 @@ void CCProtonPi0_Plotter::DrawPaper_xsec_Enu_BeforeFSI()
     std::string root_dir_data = Folder_List::rootDir_Signal_Original_Data;
     std::string root_dir_mc = Folder_List::rootDir_Signal_Original_MC;
 
-    TFile* f_data = new TFile(root_dir_data.c_str());
-    TFile* f_mc = new TFile(root_dir_mc.c_str());
+    TFile* f_data = GetCachedFile(root_dir_data);
+    TFile* f_mc = GetCachedFile(root_dir_mc);
 
     std::string var_name = "Enu";
     std::string data_var = var_name + "_xsec";
@@ -4724,8 +4710,6 @@ void CCProtonPi0_Plotter::DrawPaper_xsec_Enu_BeforeFSI()
     delete mc;
     delete h_mc_BeforeFSI;
     delete mc_NuWro;
-    delete f_mc;
-    delete f_data;
 }
 
 
@@ -4734,8 +4718,8 @@ void CCProtonPi0_Plotter::DrawPaper_xsec_W_BeforeFSI()
     std::string root_dir_data = Folder_List::rootDir_Signal_Original_Data;
     std::string root_dir_mc = Folder_List::rootDir_Signal_Original_MC;
 
-    TFile* f_data = new TFile(root_dir_data.c_str());
-    TFile* f_mc = new TFile(root_dir_mc.c_str());
+    TFile* f_data = GetCachedFile(root_dir_data);
+    TFile* f_mc = GetCachedFile(root_dir_mc);
 
     std::string var_name = "W";
     std::string data_var = var_name + "_xsec";
@@ -4860,8 +4844,6 @@ void CCProtonPi0_Plotter::DrawPaper_xsec_W_BeforeFSI()
     delete mc;
     delete h_mc_BeforeFSI;
     delete mc_NuWro;
-    delete f_mc;
-    delete f_data;
 }
 
 void CCProtonPi0_Plotter::DrawPaper_xsec_QSq_BeforeFSI()
@@ -4869,8 +4851,8 @@ void CCProtonPi0_Plotter::DrawPaper_xsec_QSq_BeforeFSI()
     std::string root_dir_data = Folder_List::rootDir_Signal_Original_Data;
     std::string root_dir_mc = Folder_List::rootDir_Signal_Original_MC;
 
-    TFile* f_data = new TFile(root_dir_data.c_str());
-    TFile* f_mc = new TFile(root_dir_mc.c_str());
+    TFile* f_data = GetCachedFile(root_dir_data);
+    TFile* f_mc = GetCachedFile(root_dir_mc);
 
     std::string var_name = "QSq";
     std::string data_var = var_name + "_xsec";
@@ -4996,8 +4978,6 @@ void CCProtonPi0_Plotter::DrawPaper_xsec_QSq_BeforeFSI()
     delete mc;
     delete h_mc_BeforeFSI;
     delete mc_NuWro;
-    delete f_mc;
-    delete f_data;
 }
 
 void CCProtonPi0_Plotter::DrawPaper_xsec_Delta_pi_phi_BeforeFSI()
@@ -5005,8 +4985,8 @@ void CCProtonPi0_Plotter::DrawPaper_xsec_Delta_pi_phi_BeforeFSI()
     std::string root_dir_data = Folder_List::rootDir_Signal_DeltaRich_Data;
     std::string root_dir_mc = Folder_List::rootDir_Signal_DeltaRich_MC;
 
-    TFile* f_data = new TFile(root_dir_data.c_str());
-    TFile* f_mc = new TFile(root_dir_mc.c_str());
+    TFile* f_data = GetCachedFile(root_dir_data);
+    TFile* f_mc = GetCachedFile(root_dir_mc);
 
     std::string var_name = "Delta_pi_phi";
     std::string data_var = var_name + "_xsec";
@@ -5117,8 +5097,6 @@ void CCProtonPi0_Plotter::DrawPaper_xsec_Delta_pi_phi_BeforeFSI()
     delete data;
     delete mc;
     delete h_mc_BeforeFSI;
-    delete f_mc;
-    delete f_data;
 }
 
 void CCProtonPi0_Plotter::DrawPaper_xsec_Delta_pi_theta_BeforeFSI()
@@ -5126,8 +5104,8 @@ void CCProtonPi0_Plotter::DrawPaper_xsec_Delta_pi_theta_BeforeFSI()
     std::string root_dir_data = Folder_List::rootDir_Signal_DeltaRich_Data;
     std::string root_dir_mc = Folder_List::rootDir_Signal_DeltaRich_MC;
 
-    TFile* f_data = new TFile(root_dir_data.c_str());
-    TFile* f_mc = new TFile(root_dir_mc.c_str());
+    TFile* f_data = GetCachedFile(root_dir_data);
+    TFile* f_mc = GetCachedFile(root_dir_mc);
 
     std::string var_name = "Delta_pi_theta";
     std::string data_var = var_name + "_xsec";
@@ -5262,8 +5240,6 @@ void CCProtonPi0_Plotter::DrawPaper_xsec_Delta_pi_theta_BeforeFSI()
     delete data;
     delete mc;
     delete h_mc_BeforeFSI;
-    delete f_mc;
-    delete f_data;
 }
 
 void CCProtonPi0_Plotter::DrawPaper_xsec_pi0_theta_BeforeFSI()
@@ -5271,8 +5247,8 @@ void CCProtonPi0_Plotter::DrawPaper_xsec_pi0_theta_BeforeFSI()
     std::string root_dir_data = Folder_List::rootDir_Signal_Original_Data;
     std::string root_dir_mc = Folder_List::rootDir_Signal_Original_MC;
 
-    TFile* f_data = new TFile(root_dir_data.c_str());
-    TFile* f_mc = new TFile(root_dir_mc.c_str());
+    TFile* f_data = GetCachedFile(root_dir_data);
+    TFile* f_mc = GetCachedFile(root_dir_mc);
 
     std::string var_name = "pi0_theta";
     std::string data_var = var_name + "_xsec";
@@ -5391,8 +5367,6 @@ void CCProtonPi0_Plotter::DrawPaper_xsec_pi0_theta_BeforeFSI()
     delete data;
     delete mc;
     delete h_mc_BeforeFSI;
-    delete f_mc;
-    delete f_data;
 }
 
 void CCProtonPi0_Plotter::DrawPaper_xsec_deltaInvMass2_BeforeFSI()
@@ -5400,8 +5374,8 @@ void CCProtonPi0_Plotter::DrawPaper_xsec_deltaInvMass2_BeforeFSI()
     std::string root_dir_data = Folder_List::rootDir_Signal_TwoTrack_Data;
     std::string root_dir_mc = Folder_List::rootDir_Signal_TwoTrack_MC;
 
-    TFile* f_data = new TFile(root_dir_data.c_str());
-    TFile* f_mc = new TFile(root_dir_mc.c_str());
+    TFile* f_data = GetCachedFile(root_dir_data);
+    TFile* f_mc = GetCachedFile(root_dir_mc);
 
     std::string var_name = "deltaInvMass";
     std::string data_var = var_name + "_xsec";
@@ -5536,8 +5510,6 @@ void CCProtonPi0_Plotter::DrawPaper_xsec_deltaInvMass2_BeforeFSI()
     delete mc;
     delete h_mc_BeforeFSI;
     //delete mc_NuWro;
-    delete f_mc;
-    delete f_data;
 }
 
 
@@ -5546,8 +5518,8 @@ void CCProtonPi0_Plotter::DrawPaper_xsec_deltaInvMass_BeforeFSI()
     std::string root_dir_data = Folder_List::rootDir_Signal_DeltaRich_Data;
     std::string root_dir_mc = Folder_List::rootDir_Signal_DeltaRich_MC;
 
-    TFile* f_data = new TFile(root_dir_data.c_str());
-    TFile* f_mc = new TFile(root_dir_mc.c_str());
+    TFile* f_data = GetCachedFile(root_dir_data);
+    TFile* f_mc = GetCachedFile(root_dir_mc);
 
     std::string var_name = "deltaInvMass";
     std::string data_var = var_name + "_xsec";
@@ -5683,8 +5655,6 @@ void CCProtonPi0_Plotter::DrawPaper_xsec_deltaInvMass_BeforeFSI()
     delete mc;
     delete h_mc_BeforeFSI;
     delete mc_NuWro;
-    delete f_mc;
-    delete f_data;
 }
 
 void CCProtonPi0_Plotter::DrawPaper_xsec_pi0_KE_BeforeFSI()
@@ -5692,8 +5662,8 @@ void CCProtonPi0_Plotter::DrawPaper_xsec_pi0_KE_BeforeFSI()
     std::string root_dir_data = Folder_List::rootDir_Signal_Original_Data;
     std::string root_dir_mc = Folder_List::rootDir_Signal_Original_MC;
 
-    TFile* f_data = new TFile(root_dir_data.c_str());
-    TFile* f_mc = new TFile(root_dir_mc.c_str());
+    TFile* f_data = GetCachedFile(root_dir_data);
+    TFile* f_mc = GetCachedFile(root_dir_mc);
 
     std::string var_name = "pi0_KE";
     std::string data_var = var_name + "_xsec";
@@ -5813,8 +5783,6 @@ void CCProtonPi0_Plotter::DrawPaper_xsec_pi0_KE_BeforeFSI()
     delete mc;
     delete h_mc_BeforeFSI;
     delete mc_NuWro;
-    delete f_mc;
-    delete f_data;
 }
 
 void CCProtonPi0_Plotter::DrawPaper_xsec_muon_theta_BeforeFSI()
@@ -5822,8 +5790,8 @@ void CCProtonPi0_Plotter::DrawPaper_xsec_muon_theta_BeforeFSI()
     std::string root_dir_data = Folder_List::rootDir_Signal_Original_Data;
     std::string root_dir_mc = Folder_List::rootDir_Signal_Original_MC;
 
-    TFile* f_data = new TFile(root_dir_data.c_str());
-    TFile* f_mc = new TFile(root_dir_mc.c_str());
+    TFile* f_data = GetCachedFile(root_dir_data);
+    TFile* f_mc = GetCachedFile(root_dir_mc);
 
     std::string var_name = "muon_theta";
     std::string data_var = var_name + "_xsec";
@@ -5948,8 +5916,6 @@ void CCProtonPi0_Plotter::DrawPaper_xsec_muon_theta_BeforeFSI()
     delete mc;
     delete h_mc_BeforeFSI;
     delete mc_NuWro;
-    delete f_mc;
-    delete f_data;
 }
 
 void CCProtonPi0_Plotter::DrawPaper_xsec_muon_P_BeforeFSI()
@@ -5957,8 +5923,8 @@ void CCProtonPi0_Plotter::DrawPaper_xsec_muon_P_BeforeFSI()
     std::string root_dir_data = Folder_List::rootDir_Signal_Original_Data;
     std::string root_dir_mc = Folder_List::rootDir_Signal_Original_MC;
 
-    TFile* f_data = new TFile(root_dir_data.c_str());
-    TFile* f_mc = new TFile(root_dir_mc.c_str());
+    TFile* f_data = GetCachedFile(root_dir_data);
+    TFile* f_mc = GetCachedFile(root_dir_mc);
 
     std::string var_name = "muon_P";
     std::string data_var = var_name + "_xsec";
@@ -6083,8 +6049,6 @@ void CCProtonPi0_Plotter::DrawPaper_xsec_muon_P_BeforeFSI()
     delete mc;
     delete h_mc_BeforeFSI;
     delete mc_NuWro;
-    delete f_mc;
-    delete f_data;
 }
 
 void CCProtonPi0_Plotter::DrawPaper_xsec_Enu()
@@ -6092,8 +6056,8 @@ void CCProtonPi0_Plotter::DrawPaper_xsec_Enu()
     std::string root_dir_data = Folder_List::rootDir_Signal_Original_Data;
     std::string root_dir_mc = Folder_List::rootDir_Signal_Original_MC;
 
-    TFile* f_data = new TFile(root_dir_data.c_str());
-    TFile* f_mc = new TFile(root_dir_mc.c_str());
+    TFile* f_data = GetCachedFile(root_dir_data);
+    TFile* f_mc = GetCachedFile(root_dir_mc);
 
     std::string var = "Enu_xsec";
 
@@ -6209,8 +6173,6 @@ void CCProtonPi0_Plotter::DrawPaper_xsec_Enu()
 
     delete data;
     delete mc;
-    delete f_data;
-    delete f_mc;
 }
 
 void CCProtonPi0_Plotter::DrawPaper_xsec_W()
@@ -6218,8 +6180,8 @@ void CCProtonPi0_Plotter::DrawPaper_xsec_W()
     std::string root_dir_data = Folder_List::rootDir_Signal_Original_Data;
     std::string root_dir_mc = Folder_List::rootDir_Signal_Original_MC;
 
-    TFile* f_data = new TFile(root_dir_data.c_str());
-    TFile* f_mc = new TFile(root_dir_mc.c_str());
+    TFile* f_data = GetCachedFile(root_dir_data);
+    TFile* f_mc = GetCachedFile(root_dir_mc);
 
     std::string var = "W_xsec";
 
@@ -6335,8 +6297,6 @@ void CCProtonPi0_Plotter::DrawPaper_xsec_W()
 
     delete data;
     delete mc;
-    delete f_data;
-    delete f_mc;
 }
 
 void CCProtonPi0_Plotter::DrawPaper_xsec_QSq()
@@ -6344,8 +6304,8 @@ void CCProtonPi0_Plotter::DrawPaper_xsec_QSq()
     std::string root_dir_data = Folder_List::rootDir_Signal_Original_Data;
     std::string root_dir_mc = Folder_List::rootDir_Signal_Original_MC;
 
-    TFile* f_data = new TFile(root_dir_data.c_str());
-    TFile* f_mc = new TFile(root_dir_mc.c_str());
+    TFile* f_data = GetCachedFile(root_dir_data);
+    TFile* f_mc = GetCachedFile(root_dir_mc);
 
     std::string var = "QSq_xsec";
 
@@ -6458,8 +6418,6 @@ void CCProtonPi0_Plotter::DrawPaper_xsec_QSq()
 
     delete data;
     delete mc;
-    delete f_data;
-    delete f_mc;
 }
 
 void CCProtonPi0_Plotter::DrawPaper_xsec_pi0_theta()
@@ -6467,8 +6425,8 @@ void CCProtonPi0_Plotter::DrawPaper_xsec_pi0_theta()
     std::string root_dir_data = Folder_List::rootDir_Signal_Original_Data;
     std::string root_dir_mc = Folder_List::rootDir_Signal_Original_MC;
 
-    TFile* f_data = new TFile(root_dir_data.c_str());
-    TFile* f_mc = new TFile(root_dir_mc.c_str());
+    TFile* f_data = GetCachedFile(root_dir_data);
+    TFile* f_mc = GetCachedFile(root_dir_mc);
 
     std::string var = "pi0_theta_xsec";
 
@@ -6582,8 +6540,6 @@ void CCProtonPi0_Plotter::DrawPaper_xsec_pi0_theta()
 
     delete data;
     delete mc;
-    delete f_data;
-    delete f_mc;
 }
 
 void CCProtonPi0_Plotter::DrawPaper_xsec_pi0_KE()
@@ -6591,8 +6547,8 @@ void CCProtonPi0_Plotter::DrawPaper_xsec_pi0_KE()
     std::string root_dir_data = Folder_List::rootDir_Signal_Original_Data;
     std::string root_dir_mc = Folder_List::rootDir_Signal_Original_MC;
 
-    TFile* f_data = new TFile(root_dir_data.c_str());
-    TFile* f_mc = new TFile(root_dir_mc.c_str());
+    TFile* f_data = GetCachedFile(root_dir_data);
+    TFile* f_mc = GetCachedFile(root_dir_mc);
 
     std::string var = "pi0_KE_xsec";
 
@@ -6705,8 +6661,6 @@ void CCProtonPi0_Plotter::DrawPaper_xsec_pi0_KE()
 
     delete data;
     delete mc;
-    delete f_data;
-    delete f_mc;
 }
 
 void CCProtonPi0_Plotter::DrawPaper_xsec_muon_theta()
@@ -6714,8 +6668,8 @@ void CCProtonPi0_Plotter::DrawPaper_xsec_muon_theta()
     std::string root_dir_data = Folder_List::rootDir_Signal_Original_Data;
     std::string root_dir_mc = Folder_List::rootDir_Signal_Original_MC;
 
-    TFile* f_data = new TFile(root_dir_data.c_str());
-    TFile* f_mc = new TFile(root_dir_mc.c_str());
+    TFile* f_data = GetCachedFile(root_dir_data);
+    TFile* f_mc = GetCachedFile(root_dir_mc);
 
     std::string var = "muon_theta_xsec";
 
@@ -6831,8 +6785,6 @@ void CCProtonPi0_Plotter::DrawPaper_xsec_muon_theta()
 
     delete data;
     delete mc;
-    delete f_data;
-    delete f_mc;
 }
 
 void CCProtonPi0_Plotter::DrawPaper_xsec_muon_P()
@@ -6840,8 +6792,8 @@ void CCProtonPi0_Plotter::DrawPaper_xsec_muon_P()
     std::string root_dir_data = Folder_List::rootDir_Signal_Original_Data;
     std::string root_dir_mc = Folder_List::rootDir_Signal_Original_MC;
 
-    TFile* f_data = new TFile(root_dir_data.c_str());
-    TFile* f_mc = new TFile(root_dir_mc.c_str());
+    TFile* f_data = GetCachedFile(root_dir_data);
+    TFile* f_mc = GetCachedFile(root_dir_mc);
 
     std::string var = "muon_P_xsec";
 
@@ -6953,8 +6905,6 @@ void CCProtonPi0_Plotter::DrawPaper_xsec_muon_P()
 
     delete data;
     delete mc;
-    delete f_data;
-    delete f_mc;
 }
 
 void CCProtonPi0_Plotter::DrawPaper_InvMass_DataMC()
@@ -7224,8 +7174,8 @@ void CCProtonPi0_Plotter::DrawPaper_Delta_pi_phi_2Bin()
     std::string root_dir_data = Folder_List::rootDir_Signal_2Bin_DeltaRich_Data;
     std::string root_dir_mc = Folder_List::rootDir_Signal_2Bin_DeltaRich_MC;
 
-    TFile* f_data = new TFile(root_dir_data.c_str());
-    TFile* f_mc = new TFile(root_dir_mc.c_str());
+    TFile* f_data = GetCachedFile(root_dir_data);
+    TFile* f_mc = GetCachedFile(root_dir_mc);
 
     std::string var = "Delta_pi_phi_xsec";
 
@@ -7345,8 +7295,6 @@ void CCProtonPi0_Plotter::DrawPaper_Delta_pi_phi_2Bin()
     std::string out_name = plotDir + var + "_2Bin" + ".pdf"; 
     canvas->Print(out_name.c_str(),"pdf");
     
-    delete f_data;
-    delete f_mc;
     delete data;
     delete mc;
     delete canvas;
@@ -7358,8 +7306,8 @@ void CCProtonPi0_Plotter::DrawPaper_Delta_pi_theta_2Bin()
     std::string root_dir_data = Folder_List::rootDir_Signal_2Bin_DeltaRich_Data;
     std::string root_dir_mc = Folder_List::rootDir_Signal_2Bin_DeltaRich_MC;
 
-    TFile* f_data = new TFile(root_dir_data.c_str());
-    TFile* f_mc = new TFile(root_dir_mc.c_str());
+    TFile* f_data = GetCachedFile(root_dir_data);
+    TFile* f_mc = GetCachedFile(root_dir_mc);
 
     std::string var = "Delta_pi_theta_xsec";
 
@@ -7505,8 +7453,6 @@ void CCProtonPi0_Plotter::DrawPaper_Delta_pi_theta_2Bin()
 
     canvas->Print(out_name.c_str(),"pdf");
     
-    delete f_data;
-    delete f_mc;
     delete data;
     delete mc;
     delete legend;
@@ -7519,8 +7465,8 @@ void CCProtonPi0_Plotter::Delta_pi_theta_Fit()
     std::string root_dir_data = Folder_List::rootDir_Signal_DeltaRich_Data;
     std::string root_dir_mc = Folder_List::rootDir_Signal_DeltaRich_MC;
 
-    TFile* f_data = new TFile(root_dir_data.c_str());
-    TFile* f_mc = new TFile(root_dir_mc.c_str());
+    TFile* f_data = GetCachedFile(root_dir_data);
+    TFile* f_mc = GetCachedFile(root_dir_mc);
 
     std::string var = "Delta_pi_theta_xsec";
 
@@ -7714,8 +7660,6 @@ void CCProtonPi0_Plotter::Delta_pi_theta_Fit()
 
     canvas->Print(out_name.c_str(),"pdf");
     
-    delete f_data;
-    delete f_mc;
     delete data;
     delete mc;
     delete fit_y;
@@ -7731,8 +7675,8 @@ void CCProtonPi0_Plotter::Delta_pi_phi_Fit()
     std::string root_dir_data = Folder_List::rootDir_Signal_DeltaRich_Data;
     std::string root_dir_mc = Folder_List::rootDir_Signal_DeltaRich_MC;
 
-    TFile* f_data = new TFile(root_dir_data.c_str());
-    TFile* f_mc = new TFile(root_dir_mc.c_str());
+    TFile* f_data = GetCachedFile(root_dir_data);
+    TFile* f_mc = GetCachedFile(root_dir_mc);
 
     std::string var = "Delta_pi_phi_xsec";
 
@@ -7901,8 +7845,6 @@ void CCProtonPi0_Plotter::Delta_pi_phi_Fit()
 
     canvas->Print(out_name.c_str(),"pdf");
 
-    delete f_data;
-    delete f_mc;
     delete data;
     delete mc;
     delete fit_y;
@@ -7917,8 +7859,8 @@ void CCProtonPi0_Plotter::Delta_pi_theta_diff_Fit()
     std::string root_dir_data = Folder_List::rootDir_Signal_DeltaRich_Data;
     std::string root_dir_mc = Folder_List::rootDir_Signal_DeltaRich_MC;
 
-    TFile* f_data = new TFile(root_dir_data.c_str());
-    TFile* f_mc = new TFile(root_dir_mc.c_str());
+    TFile* f_data = GetCachedFile(root_dir_data);
+    TFile* f_mc = GetCachedFile(root_dir_mc);
 
     std::string var = "Delta_pi_theta_xsec";
 
@@ -8077,8 +8019,6 @@ void CCProtonPi0_Plotter::Delta_pi_theta_diff_Fit()
 
     canvas->Print(out_name.c_str(),"pdf");
 
-    delete f_data;
-    delete f_mc;
     delete data;
     delete mc;
     delete fit_y;
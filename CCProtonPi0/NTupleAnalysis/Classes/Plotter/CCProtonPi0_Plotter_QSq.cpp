@@ -47,8 +47,8 @@ void CCProtonPi0_Plotter::Draw_QSq_EnuFit(std::string data_dir, std::string mc_d
     // ------------------------------------------------------------------------
     // First Plot Data vs MC using MnvPlotter
     // ------------------------------------------------------------------------
-    TFile* f_data = new TFile(data_dir.c_str());
-    TFile* f_mc = new TFile(mc_dir.c_str());
+    TFile* f_data = GetCachedFile(data_dir);
+    TFile* f_mc = GetCachedFile(mc_dir);
 
     MnvH1D* h_data = GetMnvH1D(f_data,"QSq_xsec" );
     MnvH1D* h_mc = GetMnvH1D(f_mc, "QSq_xsec" );
@@ -130,8 +130,6 @@ void CCProtonPi0_Plotter::Draw_QSq_EnuFit(std::string data_dir, std::string mc_d
 
     delete h_data;
     delete h_mc;
-    delete f_data;
-    delete f_mc;
     delete fit_CV;
     delete fit_1Sigma_dn;
     delete fit_1Sigma_up;
@@ -163,17 +161,17 @@ void CCProtonPi0_Plotter::Draw_QSq_MaRES_Plots()
     std::string mc_dir_SB_HighInvMass = "/minerva/data/users/oaltinok/NTupleAnalysis/MC/Analyzed/CutHistograms_HighInvMass.root";
     std::string mc_dir = "/minerva/data/users/oaltinok/NTupleAnalysis/MC/Analyzed/Interaction.root";
    
-    TFile* f_data_SB_Michel = new TFile(data_dir_SB_Michel.c_str());
-    TFile* f_data_SB_pID = new TFile(data_dir_SB_pID.c_str());
-    TFile* f_data_SB_LowInvMass = new TFile(data_dir_SB_LowInvMass.c_str());
-    TFile* f_data_SB_HighInvMass = new TFile(data_dir_SB_HighInvMass.c_str());
-    TFile* f_data = new TFile(data_dir.c_str());
+    TFile* f_data_SB_Michel = GetCachedFile(data_dir_SB_Michel);
+    TFile* f_data_SB_pID = GetCachedFile(data_dir_SB_pID);
+    TFile* f_data_SB_LowInvMass = GetCachedFile(data_dir_SB_LowInvMass);
+    TFile* f_data_SB_HighInvMass = GetCachedFile(data_dir_SB_HighInvMass);
+    TFile* f_data = GetCachedFile(data_dir);
  
-    TFile* f_mc_SB_Michel = new TFile(mc_dir_SB_Michel.c_str());
-    TFile* f_mc_SB_pID = new TFile(mc_dir_SB_pID.c_str());
-    TFile* f_mc_SB_LowInvMass = new TFile(mc_dir_SB_LowInvMass.c_str());
-    TFile* f_mc_SB_HighInvMass = new TFile(mc_dir_SB_HighInvMass.c_str());
-    TFile* f_mc = new TFile(mc_dir.c_str());
+    TFile* f_mc_SB_Michel = GetCachedFile(mc_dir_SB_Michel);
+    TFile* f_mc_SB_pID = GetCachedFile(mc_dir_SB_pID);
+    TFile* f_mc_SB_LowInvMass = GetCachedFile(mc_dir_SB_LowInvMass);
+    TFile* f_mc_SB_HighInvMass = GetCachedFile(mc_dir_SB_HighInvMass);
+    TFile* f_mc = GetCachedFile(mc_dir);
 
 
     // Get Histograms
@@ -210,17 +208,7 @@ void CCProtonPi0_Plotter::Draw_QSq_MaRES_Plots()
     delete h_mc_SB_HighInvMass;
     delete h_mc;
 
-    delete f_data_SB_Michel;
-    delete f_data_SB_pID;
-    delete f_data_SB_LowInvMass;
-    delete f_data_SB_HighInvMass;
-    delete f_data;
-
-    delete f_mc_SB_Michel;
-    delete f_mc_SB_pID;
-    delete f_mc_SB_LowInvMass;
-    delete f_mc_SB_HighInvMass;
-    delete f_mc;
+
 }
 
 
@@ -229,7 +217,7 @@ void CCProtonPi0_Plotter::Draw_QSq_MaRES_AreaNorm()
 {
     std::string plotDir = Folder_List::plotDir_OtherStudies;
 
-    TFile* f_mc = new TFile(rootDir_Interaction.mc.c_str());
+    TFile* f_mc = GetCachedFile(rootDir_Interaction.mc);
 
     std::string var_name = "QSq_All";
     std::string var = Form("%s_%d",var_name.c_str(),1);
@@ -280,7 +268,6 @@ void CCProtonPi0_Plotter::Draw_QSq_MaRES_AreaNorm()
     delete c;
     delete data;
     delete mc;
-    delete f_mc;
 }
 
 void CCProtonPi0_Plotter::Draw_QSq_MaRES_Fit(bool isAreaNorm)
@@ -290,10 +277,9 @@ void CCProtonPi0_Plotter::Draw_QSq_MaRES_Fit(bool isAreaNorm)
     std::string data_dir = "/minerva/data/users/oaltinok/NTupleAnalysis_MaRES_Fit_XSecs/Data/Analyzed/CrossSection.root";
     std::string mc_dir = "/minerva/data/users/oaltinok/NTupleAnalysis_MaRES_Fit_XSecs/MC/Analyzed/CrossSection.root";
 
-    TFile* f_data = new TFile(data_dir.c_str());
-    TFile* f_mc = new TFile(mc_dir.c_str());
+    TFile* f_data = GetCachedFile(data_dir);
+    TFile* f_mc = GetCachedFile(mc_dir);
 
-    CCProtonPi0_QSqFitter QSqFitter;
     int ind = QSqFitter.GetMinChiSq(isAreaNorm);
 
     // --------------------------------------------------------------------
@@ -428,18 +414,15 @@ void CCProtonPi0_Plotter::Draw_QSq_MaRES_Fit(bool isAreaNorm)
     delete mc_cv;
     delete mc_best;
     delete c;
-    delete f_data;
-    delete f_mc;
 }
 
 void CCProtonPi0_Plotter::Draw_QSq_MaRES_Fit_SB()
 {
     std::string plotDir = Folder_List::plotDir_OtherStudies;
 
-    TFile* f_data = new TFile(Folder_List::rootDir_Interaction_data.c_str());
-    TFile* f_mc = new TFile(Folder_List::rootDir_Interaction_mc.c_str());
+    TFile* f_data = GetCachedFile(Folder_List::rootDir_Interaction_data);
+    TFile* f_mc = GetCachedFile(Folder_List::rootDir_Interaction_mc);
 
-    CCProtonPi0_QSqFitter QSqFitter;
     int ind = QSqFitter.GetMinChiSq(false);
 
     // --------------------------------------------------------------------
@@ -526,8 +509,6 @@ void CCProtonPi0_Plotter::Draw_QSq_MaRES_Fit_SB()
     delete mc_cv;
     delete mc_best;
     delete c;
-    delete f_data;
-    delete f_mc;
 }
 
 double CCProtonPi0_Plotter::user_expo(double* x, double* par)
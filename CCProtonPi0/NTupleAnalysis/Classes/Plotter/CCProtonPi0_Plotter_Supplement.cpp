@@ -93,10 +93,9 @@ void CCProtonPi0_Plotter::Supplement_Errors()
 
 void CCProtonPi0_Plotter::Supplement_Correlation(std::string var_name, std::string root_dir, std::ofstream& file, std::string bin_format, std::string bin_name)
 {
-    TFile* f_xsec_data = new TFile(root_dir.c_str());
-
-    MnvH1D* h = GetMnvH1D(f_xsec_data, var_name);
-    MnvH1D* hist = new MnvH1D(h->GetBinNormalizedCopy());
+    // Read Only -- Cached histogram is not copied
+    const MnvH1D& h = GetCachedMnvH1D(root_dir, var_name);
+    MnvH1D* hist = new MnvH1D(h.GetBinNormalizedCopy());
     TMatrixD matrix = hist->GetTotalCorrelationMatrix();
 
     file<<var_name<<std::endl;
@@ -135,18 +134,15 @@ void CCProtonPi0_Plotter::Supplement_Correlation(std::string var_name, std::stri
     file<<"---------------------------------------------"<<std::endl;
     file<<std::endl;
    
-    delete h;
     delete hist;
-    delete f_xsec_data;
 }
 
 
 void CCProtonPi0_Plotter::Supplement_XSec(std::string var_name, std::string root_dir, std::ofstream& file, std::string bin_format, std::string xsec_format)
 {
-    TFile* f_xsec_data = new TFile(root_dir.c_str());
-
-    MnvH1D* h = GetMnvH1D(f_xsec_data, var_name);
-    MnvH1D* hist = new MnvH1D(h->GetBinNormalizedCopy());
+    // Read Only -- Cached histogram is not copied
+    const MnvH1D& h = GetCachedMnvH1D(root_dir, var_name);
+    MnvH1D* hist = new MnvH1D(h.GetBinNormalizedCopy());
     TH1D* h_err_stat = new TH1D(hist->GetStatError(true));
     TH1D* h_err_syst = new TH1D(hist->GetTotalError(false,true));
     TH1D* h_err_total = new TH1D(hist->GetTotalError(true,true));
@@ -172,20 +168,17 @@ void CCProtonPi0_Plotter::Supplement_XSec(std::string var_name, std::string root
     file<<"---------------------------------------------"<<std::endl;
     file<<std::endl;
    
-    delete h;
     delete hist;
     delete h_err_stat;
     delete h_err_syst;
     delete h_err_total;
-    delete f_xsec_data;
 }
 
 void CCProtonPi0_Plotter::Supplement_Errors(std::string var_name, std::string root_dir, std::ofstream& file, std::string bin_format)
 {
-    TFile* f_xsec_data = new TFile(root_dir.c_str());
-
-    MnvH1D* h = GetMnvH1D(f_xsec_data, var_name);
-    MnvH1D* hist = new MnvH1D(h->GetBinNormalizedCopy());
+    // Read Only -- Cached histogram is not copied
+    const MnvH1D& h = GetCachedMnvH1D(root_dir, var_name);
+    MnvH1D* hist = new MnvH1D(h.GetBinNormalizedCopy());
 
     // Get Errors
     TH1D* h_err_total = new TH1D(hist->GetTotalError(false,true));
@@ -228,8 +221,6 @@ void CCProtonPi0_Plotter::Supplement_Errors(std::string var_name, std::string ro
     delete h_err_flux;
     delete h_err_other;
     delete hist;
-    delete h;
-    delete f_xsec_data;
 
 }
 
@@ -240,14 +231,13 @@ void CCProtonPi0_Plotter::Supplement_Flux()
     OpenTextFile(file_name, file);
 
     std::string root_file_Original = Folder_List::rootDir_Signal_Original_MC;
-    TFile* f_xsec_mc = new TFile(root_file_Original.c_str());
-    MnvH1D* hist = GetMnvH1D(f_xsec_mc, "h_flux_minervaLE_FHC");
+    const MnvH1D& hist = GetCachedMnvH1D(root_file_Original, "h_flux_minervaLE_FHC");
 
-    int nBins = hist->GetNbinsX();
+    int nBins = hist.GetNbinsX();
     for (int i = 1; i <= nBins; ++i){
-        double bin_min = hist->GetBinLowEdge(i);
-        double bin_width = hist->GetBinWidth(i);
-        double flux = hist->GetBinContent(i);
+        double bin_min = hist.GetBinLowEdge(i);
+        double bin_width = hist.GetBinWidth(i);
+        double flux = hist.GetBinContent(i);
         if (bin_min >= 20.0) break;
        
         file.precision(2);
@@ -322,10 +312,9 @@ void CCProtonPi0_Plotter::Supplement_XSec_CSV(std::string var_name, std::string
     ofstream file;
     OpenTextFile(file_name, file);
 
-    TFile* f_xsec_data = new TFile(root_dir.c_str());
-
-    MnvH1D* h = GetMnvH1D(f_xsec_data, var_name);
-    MnvH1D* hist = new MnvH1D(h->GetBinNormalizedCopy());
+    // Read Only -- Cached histogram is not copied
+    const MnvH1D& h = GetCachedMnvH1D(root_dir, var_name);
+    MnvH1D* hist = new MnvH1D(h.GetBinNormalizedCopy());
     TH1D* h_err_stat = new TH1D(hist->GetStatError(true));
     TH1D* h_err_syst = new TH1D(hist->GetTotalError(false,true));
     TH1D* h_err_total = new TH1D(hist->GetTotalError(true,true));
@@ -350,12 +339,10 @@ void CCProtonPi0_Plotter::Supplement_XSec_CSV(std::string var_name, std::string
         file<<std::endl;
     }
    
-    delete h;
     delete hist;
     delete h_err_stat;
     delete h_err_syst;
     delete h_err_total;
-    delete f_xsec_data;
 
     file.close();
 }
@@ -366,10 +353,9 @@ void CCProtonPi0_Plotter::Supplement_Errors_CSV(std::string var_name, std::strin
     ofstream file;
     OpenTextFile(file_name, file);
 
-    TFile* f_xsec_data = new TFile(root_dir.c_str());
-
-    MnvH1D* h = GetMnvH1D(f_xsec_data, var_name);
-    MnvH1D* hist = new MnvH1D(h->GetBinNormalizedCopy());
+    // Read Only -- Cached histogram is not copied
+    const MnvH1D& h = GetCachedMnvH1D(root_dir, var_name);
+    MnvH1D* hist = new MnvH1D(h.GetBinNormalizedCopy());
 
     // Get Errors
     TH1D* h_err_total = new TH1D(hist->GetTotalError(false,true));
@@ -411,8 +397,6 @@ void CCProtonPi0_Plotter::Supplement_Errors_CSV(std::string var_name, std::strin
     delete h_err_flux;
     delete h_err_other;
     delete hist;
-    delete h;
-    delete f_xsec_data;
 
     file.close();
 }
@@ -423,10 +407,9 @@ void CCProtonPi0_Plotter::Supplement_Correlation_CSV(std::string var_name, std::
     ofstream file;
     OpenTextFile(file_name, file);
 
-    TFile* f_xsec_data = new TFile(root_dir.c_str());
-
-    MnvH1D* h = GetMnvH1D(f_xsec_data, var_name);
-    MnvH1D* hist = new MnvH1D(h->GetBinNormalizedCopy());
+    // Read Only -- Cached histogram is not copied
+    const MnvH1D& h = GetCachedMnvH1D(root_dir, var_name);
+    MnvH1D* hist = new MnvH1D(h.GetBinNormalizedCopy());
     TMatrixD matrix = hist->GetTotalCorrelationMatrix();
 
     file<<var_name<<std::endl;
@@ -461,9 +444,7 @@ void CCProtonPi0_Plotter::Supplement_Correlation_CSV(std::string var_name, std::
         }
     }
    
-    delete h;
     delete hist;
-    delete f_xsec_data;
 
     file.close();
 }
@@ -475,15 +456,14 @@ void CCProtonPi0_Plotter::Supplement_Flux_CSV()
     OpenTextFile(file_name, file);
 
     std::string root_file_Original = Folder_List::rootDir_Signal_Original_MC;
-    TFile* f_xsec_mc = new TFile(root_file_Original.c_str());
-    MnvH1D* hist = GetMnvH1D(f_xsec_mc, "h_flux_minervaLE_FHC");
+    const MnvH1D& hist = GetCachedMnvH1D(root_file_Original, "h_flux_minervaLE_FHC");
 
     file<<"Bin Min, Bin Max,  Neutrino flux (nu/m^2/GeV/POT)"<<std::endl;
-    int nBins = hist->GetNbinsX();
+    int nBins = hist.GetNbinsX();
     for (int i = 1; i <= nBins; ++i){
-        double bin_min = hist->GetBinLowEdge(i);
-        double bin_width = hist->GetBinWidth(i);
-        double flux = hist->GetBinContent(i);
+        double bin_min = hist.GetBinLowEdge(i);
+        double bin_width = hist.GetBinWidth(i);
+        double flux = hist.GetBinContent(i);
         if (bin_min >= 20.0) break;
        
         file.precision(2);
@@ -5,7 +5,7 @@ using namespace PlotUtils;
 void CCProtonPi0_Plotter::Systematics_CheckErrorSummary(std::string root_dir, std::string var_name)
 {
     std::string plotDir = Folder_List::plotDir_Systematics_Summary;
-    TFile* f_mc = new TFile(root_dir.c_str());
+    TFile* f_mc = GetCachedFile(root_dir);
 
     MnvH1D* mc = GetMnvH1D(f_mc, var_name);
     
@@ -34,7 +34,7 @@ void CCProtonPi0_Plotter::Systematics_SingleUniverse(std::string var_name, std::
 {
     std::string plotDir = Folder_List::plotDir_OtherStudies;
 
-    TFile* f = new TFile(rootDir_CrossSection.data.c_str());
+    TFile* f = GetCachedFile(rootDir_CrossSection.data);
     std::string var = var_name + "_" + data_type;
 
     MnvH1D* hist = GetMnvH1D(f, var);
@@ -144,8 +144,8 @@ void CCProtonPi0_Plotter::Systematics_DrawErrorSummary(std::string data_var, std
     (void) mc_var;
     
     std::string plotDir = Folder_List::plotDir_Systematics_Summary;
-    TFile* f_xsec_data = new TFile(rootDir_CrossSection.data.c_str());
-    //TFile* f_xsec_mc = new TFile(rootDir_CrossSection.mc.c_str());
+    TFile* f_xsec_data = GetCachedFile(rootDir_CrossSection.data);
+    //TFile* f_xsec_mc = GetCachedFile(rootDir_CrossSection.mc);
 
     MnvH1D* data = GetMnvH1D(f_xsec_data, data_var);
     //MnvH1D* mc = GetMnvH1D(f_xsec_mc, mc_var);
@@ -165,7 +165,7 @@ void CCProtonPi0_Plotter::Systematics_DrawErrorSummary_Group(std::string data_va
     (void) mc_var;
  
     std::string plotDir = Folder_List::plotDir_Systematics_Summary;
-    TFile* f_xsec_data = new TFile(rootDir_CrossSection.data.c_str());
+    TFile* f_xsec_data = GetCachedFile(rootDir_CrossSection.data);
 
     MnvH1D* data = GetMnvH1D(f_xsec_data, data_var);
    
@@ -194,12 +194,11 @@ void CCProtonPi0_Plotter::Systematics_DrawErrorSummary_Group(std::string data_va
     DrawErrorSummary_PaperStyle(data, data_var, plotDir, false);
 
     delete data;
-    delete f_xsec_data;
 }
 
 void CCProtonPi0_Plotter::Systematics_DrawErrorBand_GENIE(std::string data_var)
 {
-    TFile* f_xsec_data = new TFile(rootDir_CrossSection.data.c_str());
+    TFile* f_xsec_data = GetCachedFile(rootDir_CrossSection.data);
 
     MnvH1D* data = GetMnvH1D(f_xsec_data, data_var);
 
@@ -289,7 +288,7 @@ void CCProtonPi0_Plotter::Systematics_WriteTables(std::string var_name)
 {
     std::string plotDir = Folder_List::plotDir_OtherStudies;
     std::string root_dir = "/minerva/data/users/oaltinok/NTupleAnalysis/Data/Analyzed/CrossSection.root";
-    TFile* f_data = new TFile(rootDir_CrossSection.data.c_str());
+    TFile* f_data = GetCachedFile(rootDir_CrossSection.data);
 
     std::string var;
     MnvH1D* hist = NULL;
@@ -336,7 +335,6 @@ void CCProtonPi0_Plotter::Systematics_WriteTables(std::string var_name)
     Systematics_WriteTable_BinByBin(hist, var);
     delete hist;
     
-    delete f_data;
 }
 
 void CCProtonPi0_Plotter::Systematics_WriteTable_Fraction(MnvH1D* hist, std::string var_name)
@@ -434,8 +434,12 @@ MnvH1D* CCProtonPi0_Plotter::CalcUnfoldingError(MnvH1D* unfolded, MnvH1D* truth)
 
 void CCProtonPi0_Plotter::FillUnfoldingHistograms(MnvH1D* &unfolded, MnvH1D* &error, MnvH1D* &diff, MnvH2D* response, MnvH1D* mc_reco, MnvH1D* mc_true, int niter)
 {
-    unfolded = NULL;
-    MinervaUnfold::MnvUnfold::Get().UnfoldHisto(unfolded, response, mc_reco, RooUnfold::kBayes, niter, true);
+    if (isNativeUnfolding){
+        unfolded = bayesUnfold.UnfoldHisto(response, mc_reco, niter);
+    }else{
+        unfolded = NULL;
+        MinervaUnfold::MnvUnfold::Get().UnfoldHisto(unfolded, response, mc_reco, RooUnfold::kBayes, niter, true);
+    }
     diff = CalcUnfoldingDiff(unfolded, mc_true);
     error = CalcUnfoldingError(unfolded, mc_true);
 }
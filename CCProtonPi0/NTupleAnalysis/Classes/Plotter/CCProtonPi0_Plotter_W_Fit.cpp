@@ -145,8 +145,8 @@ void CCProtonPi0_Plotter::printBins_W()
     std::string plotDir = Folder_List::plotDir_OtherStudies;
 
     // Print Data Bins for Fit
-    TFile* f_data = new TFile(rootDir_Interaction.data.c_str());
-    TFile* f_mc = new TFile(rootDir_Interaction.mc.c_str());
+    TFile* f_data = GetCachedFile(rootDir_Interaction.data);
+    TFile* f_mc = GetCachedFile(rootDir_Interaction.mc);
     MnvH1D* h_data_W_All = GetMnvH1D(f_data, "W_All_0");
     MnvH1D* h_mc_bckg_W_All = GetMnvH1D(f_mc, "W_All_2");
 
@@ -160,7 +160,6 @@ void CCProtonPi0_Plotter::printBins_W()
     
     delete h_mc_bckg_W_All;
     delete h_data_W_All;
-    delete f_data;
 
     // Print MC Bins for Fit
     MnvH1D* h_mc_W_All = GetMnvH1D(f_mc, "W_All_1");
@@ -196,7 +195,6 @@ void CCProtonPi0_Plotter::printBins_W()
     //delete h_mc_W_All_delta_res;
     //delete h_mc_W_1_delta_res;
     //delete h_mc_W_2_delta_res;
-    delete f_mc;
 }
 
 void CCProtonPi0_Plotter::W_Fit_Data(std::string fit_name, double* pars_deltaRES, double* pars_otherRES, double* pars_nonRES_G1, double* pars_nonRES_G2, int nPars)
@@ -207,8 +205,8 @@ void CCProtonPi0_Plotter::W_Fit_Data(std::string fit_name, double* pars_deltaRES
     // ------------------------------------------------------------------------
     // First Plot Data vs MC using MnvPlotter
     // ------------------------------------------------------------------------
-    TFile* f_data = new TFile(rootDir_Interaction.data.c_str());
-    TFile* f_mc = new TFile(rootDir_Interaction.mc.c_str());
+    TFile* f_data = GetCachedFile(rootDir_Interaction.data);
+    TFile* f_mc = GetCachedFile(rootDir_Interaction.mc);
 
     // Get Data Background Subtracted
     MnvH1D* h_data = GetMnvH1D(f_data, "W_All_0");
@@ -352,8 +350,6 @@ void CCProtonPi0_Plotter::W_Fit_Data(std::string fit_name, double* pars_deltaRES
     delete h_data;
     delete h_mc_signal;
     delete h_mc_bckg;
-    delete f_data;
-    delete f_mc;
     delete fit_deltaRES;
     delete fit_otherRES;
     delete fit_nonRES;
@@ -371,7 +367,7 @@ void CCProtonPi0_Plotter::W_Fit_MC_DeltaRES()
     // ------------------------------------------------------------------------
     // First Plot MC using MnvPlotter
     // ------------------------------------------------------------------------
-    TFile* f_mc = new TFile(rootDir_Interaction.mc.c_str());
+    TFile* f_mc = GetCachedFile(rootDir_Interaction.mc);
 
     // Get MC Signal deltaRES
     MnvH1D* h_mc_signal = GetMnvH1D(f_mc, "W_All_7");
@@ -448,7 +444,6 @@ void CCProtonPi0_Plotter::W_Fit_MC_DeltaRES()
     c->Print(Form("%s%s",plotDir.c_str(),"W_Fit_MC_deltaRES.png"), "png");
 
     delete h_mc_signal;
-    delete f_mc;
     delete fit_deltaRES;
     delete plotter;
     delete legend;
@@ -462,7 +457,7 @@ void CCProtonPi0_Plotter::W_Fit_MC_OtherRES()
     // ------------------------------------------------------------------------
     // First Plot MC using MnvPlotter
     // ------------------------------------------------------------------------
-    TFile* f_mc = new TFile(rootDir_Interaction.mc.c_str());
+    TFile* f_mc = GetCachedFile(rootDir_Interaction.mc);
 
     // Get MC Signal deltaRES
     MnvH1D* h_mc_signal = GetMnvH1D(f_mc, "W_All_8");
@@ -540,7 +535,6 @@ void CCProtonPi0_Plotter::W_Fit_MC_OtherRES()
     c->Print(Form("%s%s",plotDir.c_str(),"W_Fit_MC_otherRES.png"), "png");
 
     delete h_mc_signal;
-    delete f_mc;
     delete fit_otherRES;
     delete plotter;
     delete legend;
@@ -554,7 +548,7 @@ void CCProtonPi0_Plotter::W_Fit_MC_NonRES()
     // ------------------------------------------------------------------------
     // First Plot MC using MnvPlotter
     // ------------------------------------------------------------------------
-    TFile* f_mc = new TFile(rootDir_Interaction.mc.c_str());
+    TFile* f_mc = GetCachedFile(rootDir_Interaction.mc);
 
     // Get MC Signal deltaRES
     MnvH1D* h_mc_signal = GetMnvH1D(f_mc, "W_All_9");
@@ -647,7 +641,6 @@ void CCProtonPi0_Plotter::W_Fit_MC_NonRES()
     c->Print(Form("%s%s",plotDir.c_str(),"W_Fit_MC_nonRES.png"), "png");
 
     delete h_mc_signal;
-    delete f_mc;
     delete fit_nonRES;
     delete plotter;
     delete legend;
@@ -660,7 +653,7 @@ void CCProtonPi0_Plotter::W_Fit_MC()
     // ------------------------------------------------------------------------
     // First Plot MC using MnvPlotter
     // ------------------------------------------------------------------------
-    TFile* f_mc = new TFile(rootDir_Interaction.mc.c_str());
+    TFile* f_mc = GetCachedFile(rootDir_Interaction.mc);
 
     // Get MC Signal
     MnvH1D* h_mc_signal = GetMnvH1D(f_mc, "W_All_1");
@@ -781,7 +774,6 @@ void CCProtonPi0_Plotter::W_Fit_MC()
     c->Print(Form("%s%s",plotDir.c_str(),"W_Fit_MC.png"), "png");
 
     delete h_mc_signal;
-    delete f_mc;
     delete fit_deltaRES;
     delete fit_otherRES;
     delete fit_nonRES;
@@ -794,16 +786,12 @@ void CCProtonPi0_Plotter::W_Fit_MC()
 
 void CCProtonPi0_Plotter::Get_BreitWigner(double* pars, double* x, double* y, int nPoints)
 {
-    for (int i = 0; i < nPoints; ++i){  
-       y[i] = pars[0] * std::pow((x[i]/0.938), 3) * ( (pars[1]*pars[2]) / (std::pow((x[i]*x[i] - pars[1]*pars[1]), 2) + std::pow((pars[1]*pars[2]),2)));
-    }
+    CCProtonPi0_WFitModel::BreitWigner(pars, x, y, nPoints);
 }
 
 void CCProtonPi0_Plotter::Get_Gaussian(double* pars, double* x, double* y, int nPoints)
 {
-    for (int i = 0; i < nPoints; ++i){  
-        y[i] = pars[0] * std::exp(-(std::pow(((x[i]-pars[1])/pars[2]),2)));  
-    }
+    CCProtonPi0_WFitModel::Gaussian(pars, x, y, nPoints);
 }
 
 #endif
@@ -20,10 +20,10 @@ CCProtonPi0_Proton::CCProtonPi0_Proton(bool isModeReduce, bool isMC) : CCProtonP
         if (isMC) rootDir = Folder_List::rootDir_Proton_mc;
         else rootDir = Folder_List::rootDir_Proton_data;
         
-        std::cout<<"\tRoot File: "<<rootDir<<std::endl;
+        std::cout<<"\tRoot File: "<<GetOutputFileName(rootDir)<<std::endl;
         
         // Create Root File 
-        f = new TFile(rootDir.c_str(),"RECREATE");
+        f = new TFile(GetOutputFileName(rootDir).c_str(),"RECREATE");
 
         // Initialize Bins
         bin_E.setBin(25, 0.5 ,3.0);
@@ -12,10 +12,25 @@ const double CCProtonPi0_QSqFitter::x2_2sigma = 200.0;
 CCProtonPi0_QSqFitter::CCProtonPi0_QSqFitter()
 {
     isDebug = false;
+    nWorkers = 1;
     FillMaRESVector(MaRESVector_dn, 0.8, 0.6);
     FillMaRESVector(MaRESVector_up, 1.2, 1.4);
 }
 
+CCProtonPi0_QSqFitter::~CCProtonPi0_QSqFitter()
+{
+    std::map<std::string, TFile*>::iterator it;
+    for (it = files.begin(); it != files.end(); ++it){
+        it->second->Close();
+        delete it->second;
+    }
+}
+
+void CCProtonPi0_QSqFitter::SetNWorkers(int n)
+{
+    nWorkers = n < 1 ? 1 : n;
+}
+
 void CCProtonPi0_QSqFitter::FillMaRESVector(std::vector<double> &MaRESVector, double one_sigma, double two_sigma)
 {  
     double y1_1sigma = GENIE_MaRES; // CV 
@@ -167,141 +182,101 @@ int CCProtonPi0_QSqFitter::FindMinChiSq(std::vector<double> &ChiSqVector)
     return current_min_ind;
 }
 
-void CCProtonPi0_QSqFitter::NormalizeHistogram(MnvH1D* h)
+TFile* CCProtonPi0_QSqFitter::GetFile(const std::string& file_name)
 {
-    int NBins = h->GetNbinsX();
-    double area = h->Integral();
-    double nOverFlow = h->GetBinContent(NBins+1);
-    double nUnderFlow = h->GetBinContent(0);
-    h->Scale(1/(area+nOverFlow+nUnderFlow),"",false); // Scale only on CentralValue
+    std::map<std::string, TFile*>::iterator it = files.find(file_name);
+    if (it != files.end()) return it->second;
+
+    TFile* f = new TFile(file_name.c_str());
+    if (f->IsZombie()){
+        delete f;
+        RunTimeError("QSqFitter: Cannot open " + file_name);
+    }
+    files[file_name] = f;
+    return f;
 }
 
-void CCProtonPi0_QSqFitter::NormalizeHistogram(TH1D* h)
+void CCProtonPi0_QSqFitter::PackHist(QSqHistList& hist_list, TH1* hist)
 {
-    int NBins = h->GetNbinsX();
-    double area = h->Integral();
-    double nOverFlow = h->GetBinContent(NBins+1);
-    double nUnderFlow = h->GetBinContent(0);
-    h->Scale(1/(area+nOverFlow+nUnderFlow)); // Scale only on CentralValue
+    if (hist_list.nHists == 0){
+        hist_list.nBins = hist->GetNbinsX();
+        for (int i = 0; i <= hist_list.nBins+1; ++i) hist_list.widths.push_back(hist->GetBinWidth(i));
+    }else if (hist->GetNbinsX() != hist_list.nBins){
+        RunTimeError(std::string("QSqFitter: Different binning in ") + hist->GetName());
+    }
+
+    for (int i = 0; i <= hist_list.nBins+1; ++i){
+        hist_list.contents.push_back(hist->GetBinContent(i));
+        hist_list.errors.push_back(hist->GetBinError(i));
+    }
+    hist_list.nHists++;
 }
 
-void CCProtonPi0_QSqFitter::FillChiSqVector_SB(std::vector<double> &ChiSqVector, bool isUpShift)
+const QSqHistList& CCProtonPi0_QSqFitter::GetUniverses(const std::string& file_name, const std::string& hist_name, const std::string& err_name)
 {
-    // ------------------------------------------------------------------------
-    // Read Files
-    // ------------------------------------------------------------------------
-    std::string data_dir_SB_Michel = "/minerva/data/users/oaltinok/NTupleAnalysis/Data/Analyzed/CutHistograms_Michel.root";
-    std::string data_dir_SB_pID = "/minerva/data/users/oaltinok/NTupleAnalysis/Data/Analyzed/CutHistograms_pID.root";
-    std::string data_dir_SB_LowInvMass = "/minerva/data/users/oaltinok/NTupleAnalysis/Data/Analyzed/CutHistograms_LowInvMass.root";
-    std::string data_dir_SB_HighInvMass = "/minerva/data/users/oaltinok/NTupleAnalysis/Data/Analyzed/CutHistograms_HighInvMass.root";
-    std::string data_dir = "/minerva/data/users/oaltinok/NTupleAnalysis/Data/Analyzed/Interaction.root";
- 
-    std::string mc_dir_SB_Michel = "/minerva/data/users/oaltinok/NTupleAnalysis/MC/Analyzed/CutHistograms_Michel.root";
-    std::string mc_dir_SB_pID = "/minerva/data/users/oaltinok/NTupleAnalysis/MC/Analyzed/CutHistograms_pID.root";
-    std::string mc_dir_SB_LowInvMass = "/minerva/data/users/oaltinok/NTupleAnalysis/MC/Analyzed/CutHistograms_LowInvMass.root";
-    std::string mc_dir_SB_HighInvMass = "/minerva/data/users/oaltinok/NTupleAnalysis/MC/Analyzed/CutHistograms_HighInvMass.root";
-    std::string mc_dir = "/minerva/data/users/oaltinok/NTupleAnalysis/MC/Analyzed/Interaction.root";
-   
-    TFile* f_data_SB_Michel = new TFile(data_dir_SB_Michel.c_str());
-    TFile* f_data_SB_pID = new TFile(data_dir_SB_pID.c_str());
-    TFile* f_data_SB_LowInvMass = new TFile(data_dir_SB_LowInvMass.c_str());
-    TFile* f_data_SB_HighInvMass = new TFile(data_dir_SB_HighInvMass.c_str());
-    TFile* f_data = new TFile(data_dir.c_str());
- 
-    TFile* f_mc_SB_Michel = new TFile(mc_dir_SB_Michel.c_str());
-    TFile* f_mc_SB_pID = new TFile(mc_dir_SB_pID.c_str());
-    TFile* f_mc_SB_LowInvMass = new TFile(mc_dir_SB_LowInvMass.c_str());
-    TFile* f_mc_SB_HighInvMass = new TFile(mc_dir_SB_HighInvMass.c_str());
-    TFile* f_mc = new TFile(mc_dir.c_str());
+    std::string key = file_name + ":" + hist_name + ":" + err_name;
+    std::map<std::string, QSqHistList>::iterator it = hist_lists.find(key);
+    if (it != hist_lists.end()) return it->second;
 
-    // ------------------------------------------------------------------------
-    // Get Histograms
-    // ------------------------------------------------------------------------
-    MnvH1D* h_data_SB_Michel = GetMnvH1D(f_data_SB_Michel, "SideBand_QSq_0");
-    MnvH1D* h_data_SB_pID = GetMnvH1D(f_data_SB_pID, "SideBand_QSq_0");
-    MnvH1D* h_data_SB_LowInvMass = GetMnvH1D(f_data_SB_LowInvMass, "SideBand_QSq_0");
-    MnvH1D* h_data_SB_HighInvMass = GetMnvH1D(f_data_SB_HighInvMass, "SideBand_QSq_0");
-    MnvH1D* h_data = GetMnvH1D(f_data, "QSq_MaRES_0");
-
-    MnvH1D* h_mc_SB_Michel = GetMnvH1D(f_mc_SB_Michel, "SideBand_QSq_0");
-    MnvH1D* h_mc_SB_pID = GetMnvH1D(f_mc_SB_pID, "SideBand_QSq_0");
-    MnvH1D* h_mc_SB_LowInvMass = GetMnvH1D(f_mc_SB_LowInvMass, "SideBand_QSq_0");
-    MnvH1D* h_mc_SB_HighInvMass = GetMnvH1D(f_mc_SB_HighInvMass, "SideBand_QSq_0");
-    MnvH1D* h_mc = GetMnvH1D(f_mc, "QSq_MaRES_0");
+    QSqHistList& hist_list = hist_lists[key];
+    hist_list.nHists = 0;
+    hist_list.nBins = 0;
+
+    MnvH1D* h = GetMnvH1D(GetFile(file_name), hist_name);
+    MnvVertErrorBand* err_band = h->GetVertErrorBand(err_name);
+    if (err_band == NULL) RunTimeError("QSqFitter: No Error Band " + err_name + " in " + hist_name);
 
+    std::vector<TH1D*> universes = err_band->GetHists();
+    for (unsigned int i = 0; i < universes.size(); ++i) PackHist(hist_list, universes[i]);
+    delete h;
+
+    return hist_list;
+}
+
+const QSqHistList& CCProtonPi0_QSqFitter::GetHistSeries(const std::string& file_name, const std::string& hist_name, int nHists)
+{
+    std::string key = file_name + ":" + hist_name + ":Series";
+    std::map<std::string, QSqHistList>::iterator it = hist_lists.find(key);
+    if (it != hist_lists.end() && it->second.nHists >= nHists) return it->second;
+
+    QSqHistList& hist_list = hist_lists[key];
+    hist_list = QSqHistList();
+    hist_list.nHists = 0;
+    hist_list.nBins = 0;
+
+    TFile* f = GetFile(file_name);
+    for (int i = 0; i < nHists; ++i){
+        MnvH1D* h = GetMnvH1D(f, Form("%s_%d", hist_name.c_str(), i));
+        PackHist(hist_list, h);
+        delete h;
+    }
+
+    return hist_list;
+}
+
+void CCProtonPi0_QSqFitter::FillChiSqVector_SB(std::vector<double> &ChiSqVector, bool isUpShift)
+{
     // ------------------------------------------------------------------------
     // Get Universes
+    //      Side Band histograms (CutHistograms_<SideBand>.root, SideBand_QSq_0)
+    //      are not used in the Global ChiSq -- Only the Signal region
     // ------------------------------------------------------------------------
+    std::string data_dir = "/minerva/data/users/oaltinok/NTupleAnalysis/Data/Analyzed/Interaction.root";
+    std::string mc_dir = "/minerva/data/users/oaltinok/NTupleAnalysis/MC/Analyzed/Interaction.root";
     std::string err_name = isUpShift ? "HighMaRES" : "LowMaRES";
 
-    MnvVertErrorBand* err_data_SB_Michel = h_data_SB_Michel->GetVertErrorBand(err_name);
-    MnvVertErrorBand* err_data_SB_pID = h_data_SB_pID->GetVertErrorBand(err_name);
-    MnvVertErrorBand* err_data_SB_LowInvMass = h_data_SB_LowInvMass->GetVertErrorBand(err_name);
-    MnvVertErrorBand* err_data_SB_HighInvMass = h_data_SB_HighInvMass->GetVertErrorBand(err_name);
-    MnvVertErrorBand* err_data = h_data->GetVertErrorBand(err_name);
-
-    MnvVertErrorBand* err_mc_SB_Michel = h_mc_SB_Michel->GetVertErrorBand(err_name);
-    MnvVertErrorBand* err_mc_SB_pID = h_mc_SB_pID->GetVertErrorBand(err_name);
-    MnvVertErrorBand* err_mc_SB_LowInvMass = h_mc_SB_LowInvMass->GetVertErrorBand(err_name);
-    MnvVertErrorBand* err_mc_SB_HighInvMass = h_mc_SB_HighInvMass->GetVertErrorBand(err_name);
-    MnvVertErrorBand* err_mc = h_mc->GetVertErrorBand(err_name);
-
-    std::vector<TH1D*> unv_data_SB_Michel = err_data_SB_Michel->GetHists();
-    std::vector<TH1D*> unv_data_SB_pID = err_data_SB_pID->GetHists();
-    std::vector<TH1D*> unv_data_SB_LowInvMass = err_data_SB_LowInvMass->GetHists();
-    std::vector<TH1D*> unv_data_SB_HighInvMass = err_data_SB_HighInvMass->GetHists();
-    std::vector<TH1D*> unv_data = err_data->GetHists();
- 
-    std::vector<TH1D*> unv_mc_SB_Michel = err_mc_SB_Michel->GetHists();
-    std::vector<TH1D*> unv_mc_SB_pID = err_mc_SB_pID->GetHists();
-    std::vector<TH1D*> unv_mc_SB_LowInvMass = err_mc_SB_LowInvMass->GetHists();
-    std::vector<TH1D*> unv_mc_SB_HighInvMass = err_mc_SB_HighInvMass->GetHists();
-    std::vector<TH1D*> unv_mc = err_mc->GetHists();
-  
+    QSqScan scan;
+    scan.type = scan_ChiSq;
+    scan.data = &GetUniverses(data_dir, "QSq_MaRES_0", err_name);
+    scan.mc = &GetUniverses(mc_dir, "QSq_MaRES_0", err_name);
+    scan.mc_bckg = NULL;
+
     // ------------------------------------------------------------------------
-    // Calculate Global Chi Squre  
+    // Calculate Global Chi Squre
     // ------------------------------------------------------------------------
-    for (int i = 0; i < 201; ++i){
-        double Global_ChiSq = 0.0;
-        //Global_ChiSq += Calc_ChiSq(unv_data_SB_Michel[i], unv_mc_SB_Michel[i]);
-        //Global_ChiSq += Calc_ChiSq(unv_data_SB_pID[i], unv_mc_SB_pID[i]);
-        //Global_ChiSq += Calc_ChiSq(unv_data_SB_LowInvMass[i], unv_mc_SB_LowInvMass[i]);
-        //Global_ChiSq += Calc_ChiSq(unv_data_SB_HighInvMass[i], unv_mc_SB_HighInvMass[i]);
-        Global_ChiSq += Calc_ChiSq(unv_data[i], unv_mc[i]);
-        ChiSqVector.push_back(Global_ChiSq);
-    }
+    ScanChiSq(ChiSqVector, 201, scan);
 
-    if (isDebug){
-        std::cout<<"ChiSq Vector for "<<err_name<<std::endl;
-        for (unsigned int i = 0; i < ChiSqVector.size(); ++i){
-            std::cout<<"\t"<<i<<" "<<ChiSqVector[i]<<std::endl;
-        }
-    }
-
-    // Clean Memory
-    delete h_data_SB_Michel;
-    delete h_data_SB_pID;
-    delete h_data_SB_LowInvMass;
-    delete h_data_SB_HighInvMass;
-    delete h_data;
-
-    delete h_mc_SB_Michel;
-    delete h_mc_SB_pID;
-    delete h_mc_SB_LowInvMass;
-    delete h_mc_SB_HighInvMass;
-    delete h_mc;
-
-    delete f_data_SB_Michel;
-    delete f_data_SB_pID;
-    delete f_data_SB_LowInvMass;
-    delete f_data_SB_HighInvMass;
-    delete f_data;
-
-    delete f_mc_SB_Michel;
-    delete f_mc_SB_pID;
-    delete f_mc_SB_LowInvMass;
-    delete f_mc_SB_HighInvMass;
-    delete f_mc;
+    if (isDebug) PrintChiSqVector(ChiSqVector, err_name);
 }
 
 void CCProtonPi0_QSqFitter::FillChiSqVector_W_Shift(bool isSignal)
@@ -309,282 +284,277 @@ void CCProtonPi0_QSqFitter::FillChiSqVector_W_Shift(bool isSignal)
     // Read Files
     std::string data_dir = Folder_List::rootDir_Interaction_data;
     std::string mc_dir = Folder_List::rootDir_Interaction_mc;
-   
-    TFile* f_data = new TFile(data_dir.c_str());
-    TFile* f_mc = new TFile(mc_dir.c_str());
-
-    for (int i = 0; i < 151; ++i){
-        // Get Histograms
-        MnvH1D* h_data = GetMnvH1D(f_data, Form("%s_%d","W_Shift",i));
-
-        // Background Subtract if Signal
-        if (isSignal){
-            MnvH1D* h_mc_bckg = GetMnvH1D(f_mc, Form("%s_%d","W_Shift_Bckg",i));
-            NormalizeHistogram(h_mc_bckg);
-            h_mc_bckg->Scale(2997.1);
-            h_data->Add(h_mc_bckg, -1);
-            delete h_mc_bckg;
-        }
 
-        MnvH1D* h_mc;
-        if (isSignal){
-            h_mc = GetMnvH1D(f_mc, Form("%s_%d","W_Shift_Signal",i));
-        }else{
-            h_mc = GetMnvH1D(f_mc, Form("%s_%d","W_Shift",i));
-        }
+    QSqScan scan;
+    scan.type = scan_W_Shift;
+    scan.data = &GetHistSeries(data_dir, "W_Shift", 151);
 
-        double ChiSq =  Calc_ChiSq_W_Shift(h_data, h_mc);
-        ChiSqVector_W_Shift.push_back(ChiSq);
-
-        // Clean Memory
-        delete h_data;
-        delete h_mc;
+    // Background Subtract if Signal
+    if (isSignal){
+        scan.mc = &GetHistSeries(mc_dir, "W_Shift_Signal", 151);
+        scan.mc_bckg = &GetHistSeries(mc_dir, "W_Shift_Bckg", 151);
+    }else{
+        scan.mc = &GetHistSeries(mc_dir, "W_Shift", 151);
+        scan.mc_bckg = NULL;
     }
 
+    ScanChiSq(ChiSqVector_W_Shift, 151, scan);
+
     if (isDebug){
-        if (isSignal){
-            std::cout<<"ChiSq Vector for W Shift -- Signal Events"<<std::endl;
-        }else{
-            std::cout<<"ChiSq Vector for W Shift"<<std::endl;
-        }
-        for (unsigned int i = 0; i < ChiSqVector_W_Shift.size(); ++i){
-            std::cout<<"\t"<<i<<" "<<ChiSqVector_W_Shift[i]<<std::endl;
-        }
+        if (isSignal) PrintChiSqVector(ChiSqVector_W_Shift, "W Shift -- Signal Events");
+        else PrintChiSqVector(ChiSqVector_W_Shift, "W Shift");
     }
-
-    delete f_data;
-    delete f_mc;
 }
 
 void CCProtonPi0_QSqFitter::FillChiSqVector_DeltaFactor()
 {
     // ------------------------------------------------------------------------
-    // Read Files
+    // Get Universes
     // ------------------------------------------------------------------------
     std::string data_dir = Folder_List::rootDir_CrossSection_data;
     std::string mc_dir = Folder_List::rootDir_CrossSection_mc;
-   
-    TFile* f_data = new TFile(data_dir.c_str());
-    TFile* f_mc = new TFile(mc_dir.c_str());
-
-    // ------------------------------------------------------------------------
-    // Get Histograms
-    // ------------------------------------------------------------------------
-    MnvH1D* h_data = GetMnvH1D(f_data, "QSq_xsec");
-    MnvH1D* h_mc = GetMnvH1D(f_mc, "QSq_xsec");
- 
-    // ------------------------------------------------------------------------
-    // Get Universes
-    // ------------------------------------------------------------------------
     std::string err_name = "DeltaFactor";
-    MnvVertErrorBand* err_data = h_data->GetVertErrorBand(err_name);
-    MnvVertErrorBand* err_mc = h_mc->GetVertErrorBand(err_name);
 
-    std::vector<TH1D*> unv_data = err_data->GetHists();
-    std::vector<TH1D*> unv_mc = err_mc->GetHists();
-  
+    QSqScan scan;
+    scan.type = scan_Delta;
+    scan.data = &GetUniverses(data_dir, "QSq_xsec", err_name);
+    scan.mc = &GetUniverses(mc_dir, "QSq_xsec", err_name);
+    scan.mc_bckg = NULL;
+
     // ------------------------------------------------------------------------
-    // Calculate Chi Squre  
+    // Calculate Chi Squre
     // ------------------------------------------------------------------------
-    for (unsigned int i = 0; i < unv_mc.size(); ++i){
-        double ChiSq = Calc_ChiSq_Delta(unv_data[i], unv_mc[i]);
-        ChiSqVector_DeltaFactor.push_back(ChiSq);
-    }
-
-    if (isDebug){
-        std::cout<<"ChiSq Vector for "<<err_name<<std::endl;
-        for (unsigned int i = 0; i < ChiSqVector_DeltaFactor.size(); ++i){
-            std::cout<<"\t"<<i<<" "<<ChiSqVector_DeltaFactor[i]<<std::endl;
-        }
-    }
-
-    // Clean Memory
-    delete h_data;
-    delete h_mc;
-    delete f_data;
-    delete f_mc;
-}
-
-double CCProtonPi0_QSqFitter::GetSmallestBinWidth(MnvH1D* hist)
-{
-    double smallest = 99999999;
-    int nBins = hist->GetNbinsX();
-    for (int i = 0; i <= nBins; ++i){
-        double current = hist->GetBinWidth(i);
-        if (current < smallest) smallest = current;
-    }
+    ScanChiSq(ChiSqVector_DeltaFactor, scan.mc->nHists, scan);
 
-    return smallest;
+    if (isDebug) PrintChiSqVector(ChiSqVector_DeltaFactor, err_name);
 }
 
 void CCProtonPi0_QSqFitter::FillChiSqVector(std::vector<double> &ChiSqVector, bool isUpShift)
 {
     // ------------------------------------------------------------------------
-    // Read Files
+    // Get Universes
     // ------------------------------------------------------------------------
     std::string data_dir = "/minerva/data/users/oaltinok/NTupleAnalysis_MaRES_Fit_XSecs/Data/Analyzed/CrossSection.root";
     std::string mc_dir = "/minerva/data/users/oaltinok/NTupleAnalysis_MaRES_Fit_XSecs/MC/Analyzed/CrossSection.root";
-
-    TFile* f_data = new TFile(data_dir.c_str());
-    TFile* f_mc = new TFile(mc_dir.c_str());
-
-    // ------------------------------------------------------------------------
-    // Get Histograms
-    // ------------------------------------------------------------------------
-    MnvH1D* h_data = GetMnvH1D(f_data, "QSq_xsec");
-    MnvH1D* h_mc = GetMnvH1D(f_mc, "QSq_xsec");
-
-    // ------------------------------------------------------------------------
-    // Get Universes
-    // ------------------------------------------------------------------------
     std::string err_name = isUpShift ? "HighMaRES" : "LowMaRES";
 
-    MnvVertErrorBand* err_data = h_data->GetVertErrorBand(err_name);
-    MnvVertErrorBand* err_mc = h_mc->GetVertErrorBand(err_name);
+    QSqScan scan;
+    scan.type = scan_ChiSq;
+    scan.data = &GetUniverses(data_dir, "QSq_xsec", err_name);
+    scan.mc = &GetUniverses(mc_dir, "QSq_xsec", err_name);
+    scan.mc_bckg = NULL;
 
-    std::vector<TH1D*> unv_data = err_data->GetHists();
-    std::vector<TH1D*> unv_mc = err_mc->GetHists();
-  
     // ------------------------------------------------------------------------
-    // Calculate Chi Squre  
+    // Calculate Chi Squre
     // ------------------------------------------------------------------------
-    for (int i = 0; i < 201; ++i){
-        double ChiSq = Calc_ChiSq(unv_data[i], unv_mc[i]);
-        ChiSqVector.push_back(ChiSq);
-    }
-
-    if (isDebug){
-        std::cout<<"ChiSq Vector for "<<err_name<<std::endl;
-        for (unsigned int i = 0; i < ChiSqVector.size(); ++i){
-            std::cout<<"\t"<<i<<" "<<ChiSqVector[i]<<std::endl;
-        }
-    }
-
-    // Clean Memory
-    delete h_data;
-    delete h_mc;
-    delete f_data;
-    delete f_mc;
+    ScanChiSq(ChiSqVector, 201, scan);
 
+    if (isDebug) PrintChiSqVector(ChiSqVector, err_name);
 }
 
 void CCProtonPi0_QSqFitter::FillChiSqVector_AreaNorm(std::vector<double> &ChiSqVector, bool isUpShift)
 {
     // ------------------------------------------------------------------------
-    // Read Files
+    // Get Universes -- Same universes with FillChiSqVector()
     // ------------------------------------------------------------------------
     std::string data_dir = "/minerva/data/users/oaltinok/NTupleAnalysis_MaRES_Fit_XSecs/Data/Analyzed/CrossSection.root";
     std::string mc_dir = "/minerva/data/users/oaltinok/NTupleAnalysis_MaRES_Fit_XSecs/MC/Analyzed/CrossSection.root";
+    std::string err_name = isUpShift ? "HighMaRES" : "LowMaRES";
 
-    TFile* f_data = new TFile(data_dir.c_str());
-    TFile* f_mc = new TFile(mc_dir.c_str());
+    QSqScan scan;
+    scan.type = scan_AreaNorm;
+    scan.data = &GetUniverses(data_dir, "QSq_xsec", err_name);
+    scan.mc = &GetUniverses(mc_dir, "QSq_xsec", err_name);
+    scan.mc_bckg = NULL;
 
     // ------------------------------------------------------------------------
-    // Get Histograms
+    // Calculate Chi Squre
     // ------------------------------------------------------------------------
-    MnvH1D* h_data = GetMnvH1D(f_data, "QSq_xsec");
-    MnvH1D* h_mc = GetMnvH1D(f_mc, "QSq_xsec");
+    ScanChiSq(ChiSqVector, 201, scan);
 
-    // ------------------------------------------------------------------------
-    // Get Universes
-    // ------------------------------------------------------------------------
-    std::string err_name = isUpShift ? "HighMaRES" : "LowMaRES";
+    if (isDebug) PrintChiSqVector(ChiSqVector, err_name);
+}
 
-    MnvVertErrorBand* err_data = h_data->GetVertErrorBand(err_name);
-    MnvVertErrorBand* err_mc = h_mc->GetVertErrorBand(err_name);
+void CCProtonPi0_QSqFitter::PrintChiSqVector(std::vector<double> &ChiSqVector, std::string name)
+{
+    std::cout<<"ChiSq Vector for "<<name<<std::endl;
+    for (unsigned int i = 0; i < ChiSqVector.size(); ++i){
+        std::cout<<"\t"<<i<<" "<<ChiSqVector[i]<<std::endl;
+    }
+}
 
-    std::vector<TH1D*> unv_data = err_data->GetHists();
-    std::vector<TH1D*> unv_mc = err_mc->GetHists();
-  
-    // ------------------------------------------------------------------------
-    // Calculate Chi Squre  
-    // ------------------------------------------------------------------------
-    for (int i = 0; i < 201; ++i){
-        AreaNormalize(unv_data[i], unv_mc[i]);
-        double ChiSq = Calc_ChiSq(unv_data[i], unv_mc[i]);
-        ChiSqVector.push_back(ChiSq);
+void CCProtonPi0_QSqFitter::ScanChiSq(std::vector<double> &ChiSqVector, int nPoints, const QSqScan &scan)
+{
+    if (nPoints > scan.data->nHists || nPoints > scan.mc->nHists || (scan.mc_bckg && nPoints > scan.mc_bckg->nHists)){
+        RunTimeError("QSqFitter: Not enough histograms for the ChiSq scan");
     }
 
-    if (isDebug){
-        std::cout<<"ChiSq Vector for "<<err_name<<std::endl;
-        for (unsigned int i = 0; i < ChiSqVector.size(); ++i){
-            std::cout<<"\t"<<i<<" "<<ChiSqVector[i]<<std::endl;
+    // Each scan fills its vector from scratch
+    ChiSqVector.assign(nPoints, 0.0);
+
+    if (nWorkers > 1 && nPoints > nWorkers){
+        ScanChiSq_Parallel(ChiSqVector, nPoints, scan);
+        return;
+    }
+
+    for (int i = 0; i < nPoints; ++i){
+        ChiSqVector[i] = Calc_ChiSq(scan, i);
+    }
+}
+
+/*
+ *  Scan points are independent -- Each worker process calculates its own list of points
+ *      Worker w calculates points w, w+nWorkers, ...
+ *      Packed histograms are shared with the workers, results are read back in point order
+ */
+void CCProtonPi0_QSqFitter::ScanChiSq_Parallel(std::vector<double> &ChiSqVector, int nPoints, const QSqScan &scan)
+{
+    std::string results_file = Folder_List::output + Folder_List::textOut + "QSqFitter_ChiSqScan.txt";
+
+    std::cout.flush();
+    std::vector<pid_t> pids;
+    for (int w = 0; w < nWorkers; ++w){
+        pid_t pid = fork();
+        if (pid < 0) RunTimeError("QSqFitter: Cannot start ChiSq Scan Worker");
+
+        if (pid == 0){
+            std::string file_name = GetPartitionFileName(results_file, w);
+            std::ofstream file(file_name.c_str());
+            if (!file.is_open()){
+                std::cout<<"Cannot open "<<file_name<<std::endl;
+                _exit(1);
+            }
+            file<<std::setprecision(17);
+            for (int i = w; i < nPoints; i += nWorkers){
+                file<<i<<" "<<Calc_ChiSq(scan, i)<<std::endl;
+            }
+            file.close();
+            _exit(0);
         }
+        pids.push_back(pid);
     }
 
-    // Clean Memory
-    delete h_data;
-    delete h_mc;
-    delete f_data;
-    delete f_mc;
+    bool isFailed = false;
+    for (unsigned int w = 0; w < pids.size(); ++w){
+        int status;
+        waitpid(pids[w], &status, 0);
+        if (!WIFEXITED(status) || WEXITSTATUS(status) != 0){
+            std::cout<<"ChiSq Scan Worker "<<w<<" Failed!"<<std::endl;
+            isFailed = true;
+        }
+    }
+    if (isFailed) RunTimeError("QSqFitter: ChiSq Scan Failed");
 
+    for (int w = 0; w < nWorkers; ++w){
+        std::string file_name = GetPartitionFileName(results_file, w);
+        std::ifstream file(file_name.c_str());
+        if (!file.is_open()) RunTimeError("QSqFitter: Cannot open " + file_name);
+
+        int i;
+        while (file>>i) file>>ChiSqVector[i];
+        file.close();
+        remove(file_name.c_str());
+    }
 }
 
-double CCProtonPi0_QSqFitter::Calc_ChiSq(TH1D* data, TH1D* MC)
+double CCProtonPi0_QSqFitter::Calc_ChiSq(const QSqScan &scan, int point)
 {
-    // Do not Scale MC for XSec
-    //MC->Scale(POT_ratio);
+    const double* data = scan.data->GetContents(point);
+    const double* MC = scan.mc->GetContents(point);
+    int nBins = scan.data->nBins;
+
+    if (scan.type == scan_AreaNorm){
+        return Calc_ChiSq_AreaNorm(data, MC, &(scan.data->widths[0]), nBins);
+    }else if (scan.type == scan_Delta){
+        return Calc_ChiSq_Delta(data, MC);
+    }else if (scan.type == scan_W_Shift){
+        const double* bckg = scan.mc_bckg ? scan.mc_bckg->GetContents(point) : NULL;
+        const double* bckg_err = scan.mc_bckg ? scan.mc_bckg->GetErrors(point) : NULL;
+        return Calc_ChiSq_W_Shift(data, scan.data->GetErrors(point), MC, bckg, bckg_err, nBins);
+    }else{
+        return Calc_ChiSq(data, MC, nBins);
+    }
+}
 
-    int nBins = data->GetNbinsX();
+double CCProtonPi0_QSqFitter::Calc_ChiSq(const double* data, const double* MC, int nBins)
+{
+    // Do not Scale MC for XSec
     double ChiSq = 0.0;
 
     // Do not use first 2 bins
     for (int i = 3; i <= nBins; ++i){
-        double nData = data->GetBinContent(i);
-        double nMC = MC->GetBinContent(i);
-        
+        double nData = data[i];
+        double nMC = MC[i];
+
         ChiSq += std::pow((nData-nMC),2) / nMC;
     }
 
     return ChiSq;
 }
 
-void CCProtonPi0_QSqFitter::AreaNormalize(TH1D* data, TH1D* MC)
+double CCProtonPi0_QSqFitter::Calc_ChiSq_AreaNorm(const double* data, const double* MC, const double* widths, int nBins)
 {
     // Do not Scale MC for XSec
-    //MC->Scale(POT_ratio);
-
-    int nBins = data->GetNbinsX();
-    double area_data = data->Integral(3,nBins,"width");
-    double area_mc = MC->Integral(3,nBins,"width");
+    //      Area Normalize MC to Data without first 2 bins
+    double area_data = 0.0;
+    double area_mc = 0.0;
+    for (int i = 3; i <= nBins; ++i){
+        area_data += data[i] * widths[i];
+        area_mc += MC[i] * widths[i];
+    }
     double ratio = area_data/area_mc;
-    MC->Scale(ratio);
+
+    double ChiSq = 0.0;
+    for (int i = 3; i <= nBins; ++i){
+        double nData = data[i];
+        double nMC = MC[i] * ratio;
+
+        ChiSq += std::pow((nData-nMC),2) / nMC;
+    }
+
+    return ChiSq;
 }
 
-double CCProtonPi0_QSqFitter::Calc_ChiSq_W_Shift(MnvH1D* data, MnvH1D* MC)
+double CCProtonPi0_QSqFitter::Calc_ChiSq_W_Shift(const double* data, const double* data_err, const double* MC, const double* bckg, const double* bckg_err, int nBins)
 {
-    MC->Scale(POT_ratio);
+    // Background is Normalized (including underflow and overflow) and Scaled to N(Background)
+    double bckg_norm = 0.0;
+    if (bckg != NULL){
+        double area = 0.0;
+        for (int i = 0; i <= nBins+1; ++i) area += bckg[i];
+        bckg_norm = 1/area;
+    }
 
-    int nBins = data->GetNbinsX();
     double ChiSq = 0.0;
-
     for (int i = 1; i <= nBins; ++i){
-        double nData = data->GetBinContent(i);
-        double nMC = MC->GetBinContent(i);
-        double err = data->GetBinError(i);
+        double nData = data[i];
+        double err2 = data_err[i] * data_err[i];
+        if (bckg != NULL){
+            double nBckg = bckg[i] * bckg_norm * 2997.1;
+            double err_bckg = bckg_err[i] * bckg_norm * 2997.1;
+            nData -= nBckg;
+            err2 += err_bckg * err_bckg;
+        }
+        double nMC = MC[i] * POT_ratio;
 
-        ChiSq += std::pow((nData-nMC),2) / std::pow(err,2);
+        ChiSq += std::pow((nData-nMC),2) / err2;
     }
 
     return ChiSq;
 }
 
-double CCProtonPi0_QSqFitter::Calc_ChiSq_Delta(TH1D* data, TH1D* MC)
+double CCProtonPi0_QSqFitter::Calc_ChiSq_Delta(const double* data, const double* MC)
 {
     // Do not Scale MC for XSec
-    //MC->Scale(POT_ratio);
-
-    //int nBins = data->GetNbinsX();
     double ChiSq = 0.0;
 
     for (int i = 1; i <= 3; ++i){
-        double nData = data->GetBinContent(i);
-        double nMC = MC->GetBinContent(i);
-        
+        double nData = data[i];
+        double nMC = MC[i];
+
         ChiSq += std::pow((nData-nMC),2) / nMC;
     }
 
     return ChiSq;
 }
 #endif
-
@@ -1,19 +1,51 @@
 #ifndef CCProtonPi0_QSqFitter_h
 #define CCProtonPi0_QSqFitter_h
 
+#include <map>
+#include <unistd.h>
+#include <sys/wait.h>
+
 #include "../NTupleAnalysis/CCProtonPi0_NTupleAnalysis.h"
 #include "../../Libraries/Folder_List.h"
 
+// Packed contents of a list of histograms with the same binning
+//      Universes of an Error Band or a numbered histogram series (name_0, name_1, ...)
+//      Bins include underflow [0] and overflow [nBins+1]
+struct QSqHistList
+{
+    int nHists;
+    int nBins;
+    std::vector<double> contents;   // [hist][bin]
+    std::vector<double> errors;     // [hist][bin]
+    std::vector<double> widths;     // [bin]
+
+    const double* GetContents(int hist) const { return &contents[hist * (nBins+2)]; }
+    const double* GetErrors(int hist) const { return &errors[hist * (nBins+2)]; }
+};
+
+// A single ChiSq scan over the points of packed histogram lists
+struct QSqScan
+{
+    int type;
+    const QSqHistList* data;
+    const QSqHistList* mc;
+    const QSqHistList* mc_bckg;     // Only for W Shift on Signal
+};
+
 class CCProtonPi0_QSqFitter: public CCProtonPi0_NTupleAnalysis
 {
     public:
         CCProtonPi0_QSqFitter();
+        ~CCProtonPi0_QSqFitter();
         std::vector<double> GetWeights(double genie_1sigma, double genie_2sigma);
 
         int GetMinChiSq(bool isAreaNorm);
         int GetMinChiSq_DeltaFactor();
         int GetMinChiSq_W_Shift(bool isSignal = false);
 
+        // Scan points are shared by nWorkers processes -- Default is 1 (sequential)
+        void SetNWorkers(int n);
+
         std::vector<double> MaRESVector_up;
         std::vector<double> ChiSqVector_up;
         std::vector<double> MaRESVector_dn;
@@ -28,7 +60,22 @@ class CCProtonPi0_QSqFitter: public CCProtonPi0_NTupleAnalysis
         static const double x1_2sigma; // 1Sigma Element -- 50;
         static const double x2_2sigma; // 2Sigma Element -- 100;
 
+        // Scan Types
+        static const int scan_ChiSq = 0;
+        static const int scan_AreaNorm = 1;
+        static const int scan_Delta = 2;
+        static const int scan_W_Shift = 3;
+
         bool isDebug;
+        int nWorkers;
+
+        // Loader -- Each input file is opened once, each histogram list is packed once
+        std::map<std::string, TFile*> files;
+        std::map<std::string, QSqHistList> hist_lists;
+        TFile* GetFile(const std::string& file_name);
+        const QSqHistList& GetUniverses(const std::string& file_name, const std::string& hist_name, const std::string& err_name);
+        const QSqHistList& GetHistSeries(const std::string& file_name, const std::string& hist_name, int nHists);
+        void PackHist(QSqHistList& hist_list, TH1* hist);
 
         int FindMinChiSq(std::vector<double> &ChiSqVector);
         void FillMaRESVector(std::vector<double> &MaRESVector, double one_sigma, double two_sigma);
@@ -37,19 +84,23 @@ class CCProtonPi0_QSqFitter: public CCProtonPi0_NTupleAnalysis
         void FillChiSqVector_SB(std::vector<double> &ChiSqVector, bool isUpShift);
         void FillChiSqVector_DeltaFactor();
         void FillChiSqVector_W_Shift(bool isSignal);
-        void NormalizeHistogram(TH1D* h);
-        void NormalizeHistogram(MnvH1D* h);
-        void AreaNormalize(TH1D* data, TH1D* MC);
+        void PrintChiSqVector(std::vector<double> &ChiSqVector, std::string name);
 
-        double Calc_ChiSq(TH1D* data, TH1D* MC);
-        double Calc_ChiSq_Delta(TH1D* data, TH1D* MC);
-        double Calc_ChiSq_W_Shift(MnvH1D* data, MnvH1D* MC);
+        void ScanChiSq(std::vector<double> &ChiSqVector, int nPoints, const QSqScan &scan);
+        void ScanChiSq_Parallel(std::vector<double> &ChiSqVector, int nPoints, const QSqScan &scan);
+        double Calc_ChiSq(const QSqScan &scan, int point);
+        double Calc_ChiSq(const double* data, const double* MC, int nBins);
+        double Calc_ChiSq_AreaNorm(const double* data, const double* MC, const double* widths, int nBins);
+        double Calc_ChiSq_Delta(const double* data, const double* MC);
+        double Calc_ChiSq_W_Shift(const double* data, const double* data_err, const double* MC, const double* bckg, const double* bckg_err, int nBins);
         double Calc_Slope(double x1, double x2, double y1, double y2);
         double Calc_Constant(double m, double x, double y);
         double Calc_Weight(double m, double c, double x);
-        double GetSmallestBinWidth(MnvH1D* hist);
+
+        // Owns the input files -- No copies
+        CCProtonPi0_QSqFitter(const CCProtonPi0_QSqFitter&);
+        CCProtonPi0_QSqFitter& operator=(const CCProtonPi0_QSqFitter&);
 };
 
 
 #endif
-
@@ -0,0 +1,291 @@
+/*
+   See CCProtonPi0_ReduceManifest.h header for Class Information
+   */
+#ifndef CCProtonPi0_ReduceManifest_cpp
+#define CCProtonPi0_ReduceManifest_cpp
+
+#include "CCProtonPi0_ReduceManifest.h"
+
+using namespace std;
+
+CCProtonPi0_ReduceManifest::CCProtonPi0_ReduceManifest(bool isMC) : CCProtonPi0_NTupleAnalysis()
+{
+    m_isMC = isMC;
+    next_chunk_id = 0;
+
+    // Content Checksum (MD5) of the inputs in the Staleness Check
+    //      Set true if inputs can change without a change in size and mtime
+    //      Reads every input file completely -- See header for details
+    isContentChecksum = false;
+
+    std::string reducedDir;
+    if (m_isMC) reducedDir = Folder_List::rootOut + Folder_List::MC + Folder_List::reduced;
+    else reducedDir = Folder_List::rootOut + Folder_List::Data + Folder_List::reduced;
+
+    manifestFile = reducedDir + "ReduceManifest_" + version + ".txt";
+    reducedFile = reducedDir + "ReducedNTuple_" + version + ".root";
+
+    ReadManifest();
+}
+
+void CCProtonPi0_ReduceManifest::ReadManifest()
+{
+    chunks.clear();
+
+    ifstream file(manifestFile.c_str());
+    if (!file.is_open()){
+        cout<<"No Reduce Manifest -- All inputs will be reduced"<<endl;
+        return;
+    }
+    cout<<"Reading Reduce Manifest: "<<manifestFile<<endl;
+
+    std::string line;
+    while (getline(file, line)){
+        if (line.empty() || line[0] == '#') continue;
+
+        ReduceChunk chunk;
+        std::istringstream ss(line);
+        std::string checksum_or_input;
+        if (!(ss>>chunk.chunk_id>>chunk.size>>chunk.mtime>>chunk.nEntries>>checksum_or_input)){
+            RunTimeError("Corrupted line in Reduce Manifest: " + line);
+        }
+
+        // Manifests written before the checksum column: input file is the last column
+        if (ss>>chunk.input){
+            chunk.checksum = checksum_or_input;
+        }else{
+            chunk.checksum = "-";
+            chunk.input = checksum_or_input;
+        }
+        chunk.isReduced = true;
+        chunks.push_back(chunk);
+
+        if (chunk.chunk_id >= next_chunk_id) next_chunk_id = chunk.chunk_id + 1;
+    }
+    file.close();
+}
+
+void CCProtonPi0_ReduceManifest::Update(std::string playlist)
+{
+    ifstream input_pl(playlist.c_str());
+    if (!input_pl.is_open()){
+        cerr<<"Cannot open Playlist File!"<<endl;
+        exit(1);
+    }
+    cout<<"Reading Playlist: "<<playlist<<endl;
+
+    // Chunks follow the playlist order -- Inputs removed from the playlist are dropped
+    std::vector<ReduceChunk> updated;
+    std::string filename;
+    int nNew = 0;
+    int nChanged = 0;
+    while (input_pl>>filename){
+        if (filename[0] != '/') break;
+
+        Long64_t size;
+        Long64_t mtime;
+        if (!GetFileInfo(filename, size, mtime)) RunTimeError("Cannot read input file " + filename);
+        std::string checksum = isContentChecksum ? GetFileChecksum(filename) : "-";
+
+        ReduceChunk* chunk = FindChunk(filename);
+        if (chunk == NULL){
+            ReduceChunk new_chunk;
+            new_chunk.chunk_id = next_chunk_id++;
+            new_chunk.size = size;
+            new_chunk.mtime = mtime;
+            new_chunk.nEntries = -1;
+            new_chunk.checksum = checksum;
+            new_chunk.input = filename;
+            new_chunk.isReduced = false;
+            updated.push_back(new_chunk);
+            nNew++;
+            continue;
+        }
+
+        // Chunks reduced without a checksum are reduced again once it is enabled
+        bool isChanged;
+        if (isContentChecksum) isChanged = chunk->size != size || chunk->checksum != checksum;
+        else isChanged = chunk->size != size || chunk->mtime != mtime;
+
+        bool isChunkMissing = !IsFileExist(GetPartitionFileName(reducedFile, chunk->chunk_id));
+        if (isChanged || isChunkMissing){
+            chunk->isReduced = false;
+            nChanged++;
+        }
+        chunk->size = size;
+        chunk->mtime = mtime;
+        if (isContentChecksum || !chunk->isReduced) chunk->checksum = checksum;
+        updated.push_back(*chunk);
+    }
+    input_pl.close();
+
+    int nRemoved = chunks.size() - (updated.size() - nNew);
+    chunks = updated;
+
+    cout<<"\tInputs = "<<chunks.size()<<endl;
+    cout<<"\tNew = "<<nNew<<" Changed = "<<nChanged<<" Removed = "<<nRemoved<<endl;
+}
+
+std::vector<int> CCProtonPi0_ReduceManifest::GetPendingChunks() const
+{
+    std::vector<int> pending;
+    for (unsigned int i = 0; i < chunks.size(); ++i){
+        if (!chunks[i].isReduced) pending.push_back(chunks[i].chunk_id);
+    }
+    return pending;
+}
+
+std::vector<int> CCProtonPi0_ReduceManifest::GetChunkIDs() const
+{
+    std::vector<int> chunk_ids;
+    for (unsigned int i = 0; i < chunks.size(); ++i){
+        if (chunks[i].isReduced) chunk_ids.push_back(chunks[i].chunk_id);
+    }
+    return chunk_ids;
+}
+
+int CCProtonPi0_ReduceManifest::GetNChunks() const
+{
+    return next_chunk_id;
+}
+
+std::string CCProtonPi0_ReduceManifest::GetChunkPlaylist(int chunk_id)
+{
+    ReduceChunk* chunk = GetChunk(chunk_id);
+
+    // Single input playlist for the chunk
+    std::string playlist = GetPartitionFileName(manifestFile.substr(0, manifestFile.rfind('.')) + ".dat", chunk_id);
+    ofstream file(playlist.c_str());
+    if (!file.is_open()) RunTimeError("Cannot write chunk playlist " + playlist);
+    file<<chunk->input<<endl;
+    file.close();
+
+    return playlist;
+}
+
+void CCProtonPi0_ReduceManifest::SetReduced(int chunk_id)
+{
+    ReduceChunk* chunk = GetChunk(chunk_id);
+    chunk->nEntries = GetNEntries(chunk->input);
+    chunk->isReduced = true;
+}
+
+void CCProtonPi0_ReduceManifest::WriteManifest()
+{
+    // Write to a temporary file first -- Manifest is never left half written
+    std::string tempFile = manifestFile + ".tmp";
+    ofstream file(tempFile.c_str());
+    if (!file.is_open()) RunTimeError("Cannot write Reduce Manifest " + tempFile);
+
+    file<<"# Reduce Manifest -- Version "<<version<<endl;
+    file<<"# chunk_id size mtime nEntries checksum input_file"<<endl;
+    for (unsigned int i = 0; i < chunks.size(); ++i){
+        // Pending chunks are reduced again in the next run
+        if (!chunks[i].isReduced) continue;
+        file<<chunks[i].chunk_id<<" "<<chunks[i].size<<" "<<chunks[i].mtime<<" "<<chunks[i].nEntries<<" "<<chunks[i].checksum<<" "<<chunks[i].input<<endl;
+    }
+    file.close();
+
+    if (rename(tempFile.c_str(), manifestFile.c_str()) != 0) RunTimeError("Cannot update Reduce Manifest " + manifestFile);
+}
+
+void CCProtonPi0_ReduceManifest::WriteReducedPlaylist()
+{
+    std::vector<std::string> files;
+    std::vector<int> chunk_ids = GetChunkIDs();
+    for (unsigned int i = 0; i < chunk_ids.size(); ++i){
+        files.push_back(GetPartitionFileName(reducedFile, chunk_ids[i]));
+    }
+    WritePlaylist(files);
+}
+
+void CCProtonPi0_ReduceManifest::WriteMergedPlaylist()
+{
+    std::vector<std::string> files;
+    files.push_back(reducedFile);
+    WritePlaylist(files);
+}
+
+void CCProtonPi0_ReduceManifest::WritePlaylist(const std::vector<std::string>& files)
+{
+    // Analysis Mode reads this playlist -- Points to the output of the last Reduce
+    std::string playlist = m_isMC ? Folder_List::pl_MC_Reduced : Folder_List::pl_Data_Reduced;
+
+    ofstream file(playlist.c_str());
+    if (!file.is_open()) RunTimeError("Cannot write Reduced Playlist " + playlist);
+
+    for (unsigned int i = 0; i < files.size(); ++i){
+        file<<files[i]<<endl;
+    }
+    file.close();
+
+    cout<<"Reduced Playlist for Analysis: "<<playlist<<" ("<<files.size()<<" files)"<<endl;
+}
+
+ReduceChunk* CCProtonPi0_ReduceManifest::FindChunk(const std::string& input)
+{
+    for (unsigned int i = 0; i < chunks.size(); ++i){
+        if (chunks[i].input == input) return &chunks[i];
+    }
+    return NULL;
+}
+
+ReduceChunk* CCProtonPi0_ReduceManifest::GetChunk(int chunk_id)
+{
+    for (unsigned int i = 0; i < chunks.size(); ++i){
+        if (chunks[i].chunk_id == chunk_id) return &chunks[i];
+    }
+
+    std::stringstream msg;
+    msg<<"No Reduce Chunk with ID "<<chunk_id;
+    RunTimeError(msg.str());
+    return NULL;
+}
+
+bool CCProtonPi0_ReduceManifest::IsFileExist(const std::string& file_name) const
+{
+    struct stat file_stat;
+    return stat(file_name.c_str(), &file_stat) == 0;
+}
+
+bool CCProtonPi0_ReduceManifest::GetFileInfo(const std::string& file_name, Long64_t& size, Long64_t& mtime) const
+{
+    struct stat file_stat;
+    if (stat(file_name.c_str(), &file_stat) != 0) return false;
+
+    size = file_stat.st_size;
+    mtime = file_stat.st_mtime;
+    return true;
+}
+
+std::string CCProtonPi0_ReduceManifest::GetFileChecksum(const std::string& file_name) const
+{
+    TMD5* md5 = TMD5::FileChecksum(file_name.c_str());
+    if (md5 == NULL){
+        cerr<<"Cannot compute checksum of input file "<<file_name<<endl;
+        exit(1);
+    }
+
+    std::string checksum = md5->AsString();
+    delete md5;
+    return checksum;
+}
+
+Long64_t CCProtonPi0_ReduceManifest::GetNEntries(const std::string& file_name) const
+{
+    TFile* f = new TFile(file_name.c_str());
+    if (f->IsZombie()){
+        delete f;
+        return -1;
+    }
+
+    TTree* tree = (TTree*)f->Get("CCProtonPi0");
+    Long64_t nEntries = tree ? tree->GetEntries() : -1;
+
+    f->Close();
+    delete f;
+    return nEntries;
+}
+
+#endif
+
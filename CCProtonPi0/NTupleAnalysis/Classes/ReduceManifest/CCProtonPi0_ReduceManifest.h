@@ -0,0 +1,87 @@
+/*
+================================================================================
+Class: CCProtonPi0_ReduceManifest
+    Keeps track of the input files of the Incremental Reduce
+    Each input file is reduced into its own chunk (ReducedNTuple_<version>_Part<chunk_id>.root)
+        Only new or changed inputs are reduced again
+
+    Main Directory:
+        Classes/ReduceManifest
+
+    Manifest File:
+        <rootOut>/<MC|Data>/Reduced/ReduceManifest_<version>.txt
+        chunk_id size mtime nEntries checksum input_file
+            checksum is the MD5 of the input file, "-" if it was not computed
+            Manifests without the checksum column are still read
+
+    Staleness Check:
+        Default: input is changed if its size or mtime changed
+        isContentChecksum: input is changed if its size or MD5 changed
+            mtime alone does not trigger a Reduce (copied or touched files)
+            Every input is read completely in each Incremental Reduce
+
+    Analysis Playlist:
+        Input/Playlists/pl_<MC|Data>_Reduced.dat is rewritten after each Reduce
+        Incremental Reduce lists the chunks, Reduce lists the single Reduced NTuple
+================================================================================
+*/
+#ifndef CCProtonPi0_ReduceManifest_h
+#define CCProtonPi0_ReduceManifest_h
+
+#include <sys/stat.h>
+
+#include <TTree.h>
+#include <TMD5.h>
+
+#include "../NTupleAnalysis/CCProtonPi0_NTupleAnalysis.h"
+
+struct ReduceChunk
+{
+    int chunk_id;
+    Long64_t size;
+    Long64_t mtime;
+    Long64_t nEntries;
+    std::string checksum;
+    std::string input;
+    bool isReduced;
+};
+
+class CCProtonPi0_ReduceManifest : public CCProtonPi0_NTupleAnalysis
+{
+    public:
+        CCProtonPi0_ReduceManifest(bool isMC);
+
+        // Compares the playlist with the manifest and finds the chunks to reduce
+        void Update(std::string playlist);
+
+        std::vector<int> GetPendingChunks() const;
+        std::vector<int> GetChunkIDs() const;
+        int GetNChunks() const;
+        std::string GetChunkPlaylist(int chunk_id);
+        void SetReduced(int chunk_id);
+
+        void WriteManifest();
+        // Playlist read by Analysis Mode -- All reduced chunks or the single Reduced NTuple
+        void WriteReducedPlaylist();
+        void WriteMergedPlaylist();
+
+    private:
+        bool m_isMC;
+        bool isContentChecksum;
+        int next_chunk_id;
+        std::string manifestFile;
+        std::string reducedFile;
+        std::vector<ReduceChunk> chunks;
+
+        void ReadManifest();
+        void WritePlaylist(const std::vector<std::string>& files);
+        ReduceChunk* FindChunk(const std::string& input);
+        ReduceChunk* GetChunk(int chunk_id);
+        bool IsFileExist(const std::string& file_name) const;
+        bool GetFileInfo(const std::string& file_name, Long64_t& size, Long64_t& mtime) const;
+        Long64_t GetNEntries(const std::string& file_name) const;
+        std::string GetFileChecksum(const std::string& file_name) const;
+};
+
+#endif
+
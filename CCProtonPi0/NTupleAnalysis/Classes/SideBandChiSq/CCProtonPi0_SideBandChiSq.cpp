@@ -0,0 +1,164 @@
+/*
+   See CCProtonPi0_SideBandChiSq.h header for Class Information
+   */
+#ifndef CCProtonPi0_SideBandChiSq_cpp
+#define CCProtonPi0_SideBandChiSq_cpp
+
+#include "CCProtonPi0_SideBandChiSq.h"
+#include "../SideBandTool/CCProtonPi0_SideBandTool.h"
+
+using namespace std;
+
+CCProtonPi0_SideBandChiSq::CCProtonPi0_SideBandChiSq()
+{
+    nUniverses = 0;
+    packed = NULL;
+}
+
+CCProtonPi0_SideBandChiSq::~CCProtonPi0_SideBandChiSq()
+{
+    free(packed);
+}
+
+void CCProtonPi0_SideBandChiSq::AddSideBand(SideBand &sb, bool isPartial, int min_bin, int max_bin)
+{
+    if (!isPartial){
+        min_bin = 1;
+        max_bin = sb.data->GetNbinsX();
+    }
+
+    if (min_bin == max_bin){
+        cout<<"Wrong Range for Fit"<<endl;
+        exit(EXIT_FAILURE);
+    }
+
+    // Fit starts at the first bin, min_bin only checks the range
+    //      Same bins as the original fit -- Changing it changes the High Inv Mass normalization
+    side_bands.push_back(&sb);
+    max_bins.push_back(max_bin);
+}
+
+void CCProtonPi0_SideBandChiSq::Pack(double POT_ratio)
+{
+    if (side_bands.empty()){
+        cout<<"Side Band ChiSq: No Side Bands to Pack! Exiting!..."<<endl;
+        exit(EXIT_FAILURE);
+    }
+
+    nUniverses = side_bands[0]->data_all_universes.size();
+
+    offsets.clear();
+    size_t size = 0;
+    for (unsigned int s = 0; s < side_bands.size(); ++s){
+        if ((int)side_bands[s]->data_all_universes.size() != nUniverses){
+            cout<<"Side Band ChiSq: Different N(Universes) in "<<side_bands[s]->name<<"! Exiting!..."<<endl;
+            exit(EXIT_FAILURE);
+        }
+        offsets.push_back(size);
+        size += (size_t)nUniverses * GetNBins(s) * nComponents;
+    }
+
+    // Single bin is a single cache line
+    free(packed);
+    packed = NULL;
+    if (posix_memalign((void**)&packed, 64, size * sizeof(double)) != 0){
+        cout<<"Side Band ChiSq: Cannot allocate packed bins! Exiting!..."<<endl;
+        exit(EXIT_FAILURE);
+    }
+
+    for (unsigned int s = 0; s < side_bands.size(); ++s){
+        SideBand &sb = *side_bands[s];
+        for (int unv = 0; unv < nUniverses; ++unv){
+            double* bin = packed + offsets[s] + (size_t)unv * GetNBins(s) * nComponents;
+            for (int i = 1; i <= max_bins[s]; ++i){
+                double nData = sb.data_all_universes[unv]->GetBinContent(i);
+                bin[ind_data] = nData;
+                bin[ind_signal] = sb.signal_all_universes[unv]->GetBinContent(i) * POT_ratio;
+                bin[ind_Other] = sb.Other_all_universes[unv]->GetBinContent(i) * POT_ratio;
+                bin[ind_WithPi0] = sb.WithPi0_all_universes[unv]->GetBinContent(i) * POT_ratio;
+                bin[ind_QELike] = sb.QELike_all_universes[unv]->GetBinContent(i) * POT_ratio;
+                bin[ind_SinglePiPlus] = sb.SinglePiPlus_all_universes[unv]->GetBinContent(i) * POT_ratio;
+                bin[ind_inv_data] = nData == 0 ? 0.0 : 1.0/nData;
+                bin[7] = 0.0;
+                bin += nComponents;
+            }
+        }
+    }
+}
+
+/*
+ *  residual = coeff . bin = nData - (nSignal + nOther + sum_k par_k * n_k)
+ *  ChiSq = sum_i residual^2 / nData
+ */
+void CCProtonPi0_SideBandChiSq::GetCoefficients(const double* par, double coeff[nComponents])
+{
+    for (int c = 0; c < nComponents; ++c) coeff[c] = 0.0;
+    coeff[ind_data] = 1.0;
+    coeff[ind_signal] = -1.0;
+    coeff[ind_Other] = -1.0;
+    coeff[ind_WithPi0] = -par[0];
+    coeff[ind_QELike] = -par[1];
+    coeff[ind_SinglePiPlus] = -par[2];
+}
+
+double CCProtonPi0_SideBandChiSq::ChiSq(const double* bins, int nBins, const double coeff[nComponents])
+{
+    double ChiSq = 0.0;
+    for (int i = 0; i < nBins; ++i){
+        const double* bin = bins + i * nComponents;
+
+        // Pairwise sum -- Independent products are vectorized by the compiler
+        double residual = (coeff[0]*bin[0] + coeff[1]*bin[1]) + (coeff[2]*bin[2] + coeff[3]*bin[3])
+                        + (coeff[4]*bin[4] + coeff[5]*bin[5]) + (coeff[6]*bin[6] + coeff[7]*bin[7]);
+
+        ChiSq += residual * residual * bin[ind_inv_data];
+    }
+    return ChiSq;
+}
+
+double CCProtonPi0_SideBandChiSq::ChiSq(int unv, const double* par) const
+{
+    double coeff[nComponents];
+    GetCoefficients(par, coeff);
+
+    double ChiSq = 0.0;
+    for (int s = 0; s < GetNSideBands(); ++s){
+        ChiSq += CCProtonPi0_SideBandChiSq::ChiSq(GetBins(s, unv), GetNBins(s), coeff);
+    }
+    return ChiSq;
+}
+
+double CCProtonPi0_SideBandChiSq::ChiSq(int sb_ind, int unv, const double* par) const
+{
+    double coeff[nComponents];
+    GetCoefficients(par, coeff);
+
+    return CCProtonPi0_SideBandChiSq::ChiSq(GetBins(sb_ind, unv), GetNBins(sb_ind), coeff);
+}
+
+int CCProtonPi0_SideBandChiSq::GetNSideBands() const
+{
+    return side_bands.size();
+}
+
+int CCProtonPi0_SideBandChiSq::GetNUniverses() const
+{
+    return nUniverses;
+}
+
+int CCProtonPi0_SideBandChiSq::GetNBins(int sb_ind) const
+{
+    return max_bins[sb_ind];
+}
+
+const double* CCProtonPi0_SideBandChiSq::GetBins(int sb_ind, int unv) const
+{
+    if (packed == NULL){
+        cout<<"Side Band ChiSq: Bins are not packed! Exiting!..."<<endl;
+        exit(EXIT_FAILURE);
+    }
+    return packed + offsets[sb_ind] + (size_t)unv * GetNBins(sb_ind) * nComponents;
+}
+
+#endif
+
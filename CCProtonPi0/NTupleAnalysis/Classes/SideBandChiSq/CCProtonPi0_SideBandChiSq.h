@@ -0,0 +1,78 @@
+/*
+================================================================================
+Class: CCProtonPi0_SideBandChiSq
+    Side Band ChiSq on a packed copy of the side band histograms
+        Bins used in the fit are packed once for all universes
+        ChiSq is a dot product of each bin with the fit coefficients
+        Bins 1 to max_bin of each side band are used (same range as the original fit)
+
+    Main Directory:
+        Classes/SideBandChiSq
+
+    Packed Layout (contiguous, 64 byte aligned):
+        [sideband][universe][bin][component]
+        Components are scaled with POT_ratio (except data)
+            data, signal, Other, WithPi0, QELike, SinglePiPlus, 1/data, padding
+        1/data is 0 for empty data bins -- Empty bins do not add to ChiSq
+
+    Fit Parameters:
+        [0] WithPi0, [1] QELike, [2] SinglePiPlus
+================================================================================
+*/
+#ifndef CCProtonPi0_SideBandChiSq_h
+#define CCProtonPi0_SideBandChiSq_h
+
+#include <iostream>
+#include <cstdlib>
+#include <vector>
+
+struct SideBand;
+
+class CCProtonPi0_SideBandChiSq
+{
+    public:
+        CCProtonPi0_SideBandChiSq();
+        ~CCProtonPi0_SideBandChiSq();
+
+        static const int nPars = 3;
+
+        // Components of a packed bin
+        static const int nComponents = 8;
+        static const int ind_data = 0;
+        static const int ind_signal = 1;
+        static const int ind_Other = 2;
+        static const int ind_WithPi0 = 3;
+        static const int ind_QELike = 4;
+        static const int ind_SinglePiPlus = 5;
+        static const int ind_inv_data = 6;
+
+        // Side Bands must be added before Pack()
+        void AddSideBand(SideBand &sb, bool isPartial = false, int min_bin = 1, int max_bin = 1);
+        void Pack(double POT_ratio);
+
+        // ChiSq over all side bands or a single side band
+        double ChiSq(int unv, const double* par) const;
+        double ChiSq(int sb_ind, int unv, const double* par) const;
+
+        int GetNSideBands() const;
+        int GetNUniverses() const;
+        int GetNBins(int sb_ind) const;
+        const double* GetBins(int sb_ind, int unv) const;
+
+    private:
+        std::vector<SideBand*> side_bands;
+        std::vector<int> max_bins;
+        std::vector<size_t> offsets;    // Start of each side band in packed
+        int nUniverses;
+        double* packed;
+
+        static double ChiSq(const double* bins, int nBins, const double coeff[nComponents]);
+        static void GetCoefficients(const double* par, double coeff[nComponents]);
+
+        // Owns the packed array -- No copies
+        CCProtonPi0_SideBandChiSq(const CCProtonPi0_SideBandChiSq&);
+        CCProtonPi0_SideBandChiSq& operator=(const CCProtonPi0_SideBandChiSq&);
+};
+
+#endif
+
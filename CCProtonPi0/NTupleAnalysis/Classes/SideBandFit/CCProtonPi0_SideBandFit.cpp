@@ -0,0 +1,279 @@
+/*
+   See CCProtonPi0_SideBandFit.h header for Class Information
+   */
+#ifndef CCProtonPi0_SideBandFit_cpp
+#define CCProtonPi0_SideBandFit_cpp
+
+#include "CCProtonPi0_SideBandFit.h"
+
+using namespace std;
+
+const double CCProtonPi0_SideBandFit::par_min[CCProtonPi0_SideBandFit::nPars] = {0.5, 0.2, 0.5};
+const double CCProtonPi0_SideBandFit::par_max[CCProtonPi0_SideBandFit::nPars] = {2.0, 2.0, 2.0};
+
+CCProtonPi0_SideBandFit::CCProtonPi0_SideBandFit(CCProtonPi0_SideBandTool &sbtool, int universe) : unv(universe)
+{
+    // Side Bands and bin ranges are set in SideBandTool
+    fit_ChiSq = &sbtool.fit_ChiSq;
+
+    for (int i = 0; i < nPars; ++i){
+        start[i] = 1.0;
+        par_values[i] = 0.0;
+        par_errors[i] = 0.0;
+        for (int j = 0; j < nPars; ++j) cov[i][j] = 0.0;
+    }
+    min_ChiSq = 0.0;
+    edm = 0.0;
+    icstat = 0;
+}
+
+void CCProtonPi0_SideBandFit::SetStart(const double par[nPars])
+{
+    for (int i = 0; i < nPars; ++i) start[i] = par[i];
+}
+
+double CCProtonPi0_SideBandFit::ChiSq(const double* par) const
+{
+    return fit_ChiSq->ChiSq(unv, par);
+}
+
+void CCProtonPi0_SideBandFit::FCN(Int_t &npar, Double_t *gin, Double_t &f, Double_t *par, Int_t iflag)
+{
+    // Silence Unused Variable Warning
+    (void) npar;
+    (void) gin;
+    (void) iflag;
+
+    const CCProtonPi0_SideBandFit* fit = static_cast<const CCProtonPi0_SideBandFit*>(gMinuit->GetObjectFit());
+    f = fit->ChiSq(par);
+}
+
+void CCProtonPi0_SideBandFit::Fit(bool isVerbose)
+{
+    TMinuit *ptMinuit = new TMinuit(nPars);  //initialize TMinuit with a maximum of 3 params
+    if (isVerbose) ptMinuit->SetPrintLevel();
+    else ptMinuit->SetPrintLevel(-1);
+
+    // FCN finds this fit through the current TMinuit
+    ptMinuit->SetObjectFit(this);
+    ptMinuit->SetFCN(FCN);
+
+    Double_t arglist[10];
+    Int_t ierflg = 0;
+
+    arglist[0] = 1;
+    ptMinuit->mnexcm("SET ERR", arglist ,1,ierflg);
+
+    // Set starting values and step sizes for parameters
+    //      Step 0.01
+    ptMinuit->mnparm(0, "WithPi0", start[0], 0.01, par_min[0], par_max[0], ierflg);
+    ptMinuit->mnparm(1, "QELike", start[1], 0.01, par_min[1], par_max[1], ierflg);
+    ptMinuit->mnparm(2, "SinglePiPlus", start[2], 0.01, par_min[2], par_max[2], ierflg);
+
+    // Now ready for minimization step
+    arglist[0] = 500;
+    arglist[1] = 1.;
+    ptMinuit->mnexcm("MIGRAD", arglist ,2,ierflg);
+
+    for (int i = 0; i < nPars; ++i){
+        ptMinuit->GetParameter(i, par_values[i], par_errors[i]);
+    }
+
+    Double_t errdef;
+    Int_t nvpar,nparx;
+    ptMinuit->mnstat(min_ChiSq,edm,errdef,nvpar,nparx,icstat);
+    ptMinuit->mnemat(&cov[0][0], nPars);
+
+    if (isVerbose){
+        std::cout<<"\nPrint results from minuit\n";
+        std::cout << "WithPi0 = " << par_values[0] << "\n";
+        std::cout << "QELike = " << par_values[1] << "\n";
+        std::cout << "SinglePiPlus = " << par_values[2] << "\n";
+
+        std::cout << "\n";
+        std::cout << " Minimum chi square = " << min_ChiSq<< "\n";
+        std::cout << " Estimated vert. distance to min. = " << edm << "\n";
+        std::cout << " Number of variable parameters = " << nvpar << "\n";
+        std::cout << " Highest number of parameters defined by user = " << nparx << "\n";
+        std::cout << " Status of covariance matrix = " << icstat << "\n";
+
+        std::cout << "\n";
+        ptMinuit->mnprin(1,min_ChiSq);
+    }
+
+    delete ptMinuit;
+}
+
+/*
+ *  nMC = nFixed + sum_k par_k * n_k   where nFixed = nSignal + nOther
+ *  ChiSq = sum_i (nData - nMC)^2 / nData
+ *      A_kl = sum_i n_k n_l / nData
+ *      y_k  = sum_i n_k (nData - nFixed) / nData
+ *  Minimum at A * par = y, Covariance = A^-1 (SET ERR 1)
+ */
+void CCProtonPi0_SideBandFit::GetNormalEquations(double A[nPars][nPars], double y[nPars]) const
+{
+    for (int k = 0; k < nPars; ++k){
+        y[k] = 0.0;
+        for (int l = 0; l < nPars; ++l) A[k][l] = 0.0;
+    }
+
+    for (int s = 0; s < fit_ChiSq->GetNSideBands(); ++s){
+        const double* bins = fit_ChiSq->GetBins(s, unv);
+        for (int i = 0; i < fit_ChiSq->GetNBins(s); ++i) {
+            const double* bin = bins + i * CCProtonPi0_SideBandChiSq::nComponents;
+            double inv_data = bin[CCProtonPi0_SideBandChiSq::ind_inv_data];
+            if (inv_data == 0) continue;
+
+            double nFixed = bin[CCProtonPi0_SideBandChiSq::ind_signal] + bin[CCProtonPi0_SideBandChiSq::ind_Other];
+            double n[nPars];
+            n[0] = bin[CCProtonPi0_SideBandChiSq::ind_WithPi0];
+            n[1] = bin[CCProtonPi0_SideBandChiSq::ind_QELike];
+            n[2] = bin[CCProtonPi0_SideBandChiSq::ind_SinglePiPlus];
+
+            double residual = bin[CCProtonPi0_SideBandChiSq::ind_data] - nFixed;
+            for (int k = 0; k < nPars; ++k){
+                y[k] += n[k] * residual * inv_data;
+                for (int l = 0; l < nPars; ++l) A[k][l] += n[k] * n[l] * inv_data;
+            }
+        }
+    }
+}
+
+void CCProtonPi0_SideBandFit::Solve()
+{
+    double A[nPars][nPars];
+    double y[nPars];
+    GetNormalEquations(A, y);
+
+    // Each parameter is free (0), at lower limit (1) or at upper limit (2)
+    //      ChiSq is convex -- Minimum is the best solution over all faces of the limits
+    //      First face is the unconstrained solution
+    bool isSolved = false;
+    int nFaces = 1;
+    for (int k = 0; k < nPars; ++k) nFaces *= 3;
+
+    for (int face = 0; face < nFaces; ++face){
+        int state[nPars];
+        int code = face;
+        for (int k = 0; k < nPars; ++k){
+            state[k] = code % 3;
+            code /= 3;
+        }
+
+        double par[nPars];
+        double inv[nPars][nPars];
+        if (!SolveFace(A, y, state, par, inv)) continue;
+
+        double face_ChiSq = ChiSq(par);
+        if (isSolved && face_ChiSq >= min_ChiSq) continue;
+
+        isSolved = true;
+        min_ChiSq = face_ChiSq;
+        for (int k = 0; k < nPars; ++k){
+            par_values[k] = par[k];
+            par_errors[k] = inv[k][k] > 0.0 ? sqrt(inv[k][k]) : 0.0;
+            for (int l = 0; l < nPars; ++l) cov[k][l] = inv[k][l];
+        }
+
+        // Unconstrained solution within limits is the minimum
+        if (face == 0) break;
+    }
+
+    if (!isSolved){
+        cout<<"Side Band Fit: No solution for Universe = "<<unv<<"! Exiting!..."<<endl;
+        exit(EXIT_FAILURE);
+    }
+
+    // Exact solution -- Full accurate covariance matrix
+    edm = 0.0;
+    icstat = 3;
+}
+
+bool CCProtonPi0_SideBandFit::SolveFace(const double A[nPars][nPars], const double y[nPars], const int state[nPars], double par[nPars], double inv[nPars][nPars]) const
+{
+    // Parameters at the limits
+    int free_ind[nPars];
+    int nFree = 0;
+    for (int k = 0; k < nPars; ++k){
+        if (state[k] == 0) free_ind[nFree++] = k;
+        else if (state[k] == 1) par[k] = par_min[k];
+        else par[k] = par_max[k];
+    }
+
+    for (int k = 0; k < nPars; ++k){
+        for (int l = 0; l < nPars; ++l) inv[k][l] = 0.0;
+    }
+    if (nFree == 0) return true;
+
+    // Reduced normal equations for the free parameters
+    double M[nPars][nPars];
+    double b[nPars];
+    for (int i = 0; i < nFree; ++i){
+        int k = free_ind[i];
+        b[i] = y[k];
+        for (int l = 0; l < nPars; ++l){
+            if (state[l] != 0) b[i] -= A[k][l] * par[l];
+        }
+        for (int j = 0; j < nFree; ++j) M[i][j] = A[k][free_ind[j]];
+    }
+
+    double M_inv[nPars][nPars];
+    if (!Invert(nFree, M, M_inv)) return false;
+
+    for (int i = 0; i < nFree; ++i){
+        double value = 0.0;
+        for (int j = 0; j < nFree; ++j) value += M_inv[i][j] * b[j];
+
+        // Free parameter must be within limits
+        int k = free_ind[i];
+        if (value < par_min[k] || value > par_max[k]) return false;
+        par[k] = value;
+
+        for (int j = 0; j < nFree; ++j) inv[k][free_ind[j]] = M_inv[i][j];
+    }
+
+    return true;
+}
+
+bool CCProtonPi0_SideBandFit::Invert(int n, double M[nPars][nPars], double inv[nPars][nPars])
+{
+    // Gauss-Jordan with partial pivoting
+    for (int i = 0; i < n; ++i){
+        for (int j = 0; j < n; ++j) inv[i][j] = (i == j) ? 1.0 : 0.0;
+    }
+
+    for (int col = 0; col < n; ++col){
+        int pivot = col;
+        for (int row = col+1; row < n; ++row){
+            if (fabs(M[row][col]) > fabs(M[pivot][col])) pivot = row;
+        }
+        if (M[pivot][col] == 0.0) return false;
+
+        for (int j = 0; j < n; ++j){
+            std::swap(M[col][j], M[pivot][j]);
+            std::swap(inv[col][j], inv[pivot][j]);
+        }
+
+        double norm = 1.0 / M[col][col];
+        for (int j = 0; j < n; ++j){
+            M[col][j] *= norm;
+            inv[col][j] *= norm;
+        }
+
+        for (int row = 0; row < n; ++row){
+            if (row == col) continue;
+            double factor = M[row][col];
+            if (factor == 0.0) continue;
+            for (int j = 0; j < n; ++j){
+                M[row][j] -= factor * M[col][j];
+                inv[row][j] -= factor * inv[col][j];
+            }
+        }
+    }
+
+    return true;
+}
+
+#endif
+
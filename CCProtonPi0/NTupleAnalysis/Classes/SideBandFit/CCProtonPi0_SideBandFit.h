@@ -0,0 +1,65 @@
+/*
+================================================================================
+Class: CCProtonPi0_SideBandFit
+    Side Band Fit for a single universe
+        Reads the packed side band bins of its universe and owns its fit parameters
+        ChiSq does not change any state -- Fits of different universes
+        are independent of each other
+
+    Main Directory:
+        Classes/SideBandFit
+
+    Fit Parameters:
+        [0] WithPi0, [1] QELike, [2] SinglePiPlus
+================================================================================
+*/
+#ifndef CCProtonPi0_SideBandFit_h
+#define CCProtonPi0_SideBandFit_h
+
+#include "../SideBandTool/CCProtonPi0_SideBandTool.h"
+
+class CCProtonPi0_SideBandFit : public TObject
+{
+    public:
+        CCProtonPi0_SideBandFit(CCProtonPi0_SideBandTool &sbtool, int universe);
+
+        static const int nPars = 3;
+
+        // Warm Start -- Default is 1.0 for all parameters
+        void SetStart(const double par[nPars]);
+        double ChiSq(const double* par) const;
+
+        // MIGRAD Fit
+        void Fit(bool isVerbose);
+
+        // Closed Form Fit
+        //      ChiSq is linear least squares in the parameters (weights 1/nData)
+        //      Normal equations are solved directly, on the faces of the parameter limits if required
+        void Solve();
+
+        int unv;
+        double min_ChiSq;
+        double edm;
+        int icstat;
+        double par_values[nPars];
+        double par_errors[nPars];
+        double cov[nPars][nPars];
+
+    private:
+        const CCProtonPi0_SideBandChiSq* fit_ChiSq;
+        double start[nPars];
+
+        // Same limits as MIGRAD Fit
+        static const double par_min[nPars];
+        static const double par_max[nPars];
+
+        void GetNormalEquations(double A[nPars][nPars], double y[nPars]) const;
+        bool SolveFace(const double A[nPars][nPars], const double y[nPars], const int state[nPars], double par[nPars], double inv[nPars][nPars]) const;
+        static bool Invert(int n, double M[nPars][nPars], double inv[nPars][nPars]);
+
+        // TMinuit FCN -- Fit is the ObjectFit of the current TMinuit
+        static void FCN(Int_t &npar, Double_t *gin, Double_t &f, Double_t *par, Int_t iflag);
+};
+
+#endif
+
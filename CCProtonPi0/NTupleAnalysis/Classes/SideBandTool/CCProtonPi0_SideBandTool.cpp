@@ -1,4 +1,5 @@
 #include "CCProtonPi0_SideBandTool.h"
+#include "TStopwatch.h"
 
 using namespace PlotUtils;
 
@@ -79,6 +80,16 @@ void CCProtonPi0_SideBandTool::initSideBands()
     initSideBand_AllUniverses(LowInvMass);
     initSideBand_AllUniverses(HighInvMass);
 
+    // Pack bins used in the fit
+    //      Michel and pID for ALL Bins
+    //      Low Inv Mass -- Inv Mass itself for first 6 bins
+    //      High Inv Mass -- Inv Mass itself for last 30 bins
+    fit_ChiSq.AddSideBand(Michel);
+    fit_ChiSq.AddSideBand(pID);
+    fit_ChiSq.AddSideBand(LowInvMass, true, 1, 6);
+    fit_ChiSq.AddSideBand(HighInvMass, true, 21, 50);
+    fit_ChiSq.Pack(POT_ratio);
+
     initSideBand_XSecHistograms(Original);
     initSideBand_XSecHistograms(Michel);
     initSideBand_XSecHistograms(pID);
@@ -741,7 +752,7 @@ void CCProtonPi0_SideBandTool::ColorHists(TH1D* data, TH1D* signal, TH1D* WithPi
     data->SetFillStyle(0);
 }
 
-void CCProtonPi0_SideBandTool::SaveFitResults(double chisq, double par_values[3], double par_errors[3])
+void CCProtonPi0_SideBandTool::SaveFitResults(double chisq, double par_values[3], double par_errors[3], double cov[3][3])
 {
     ChiSq_after_fit.push_back(chisq);
     wgt_WithPi0.push_back(par_values[0]);
@@ -751,6 +762,10 @@ void CCProtonPi0_SideBandTool::SaveFitResults(double chisq, double par_values[3]
     err_WithPi0.push_back(par_errors[0]);
     err_QELike.push_back(par_errors[1]);
     err_SinglePiPlus.push_back(par_errors[2]);
+
+    for (int i = 0; i < 3; ++i){
+        for (int j = 0; j < 3; ++j) cov_fit.push_back(cov[i][j]);
+    }
 }
 
 void CCProtonPi0_SideBandTool::ApplyFitResults()
@@ -876,7 +891,11 @@ void CCProtonPi0_SideBandTool::DrawDataMCWithErrorBand(SideBand &sb)
     delete plotter;
 }
 
-double CCProtonPi0_SideBandTool::calc_ChiSq_SideBand(SideBand &sb, int unv, bool isPartial, int min_bin, int max_bin)
+/*
+ *  Reference ChiSq on the universe histograms
+ *      Same result as fit_ChiSq -- Used only to validate and benchmark the packed bins
+ */
+double CCProtonPi0_SideBandTool::calc_ChiSq_SideBand(SideBand &sb, int unv, const double* par, bool isPartial, int min_bin, int max_bin)
 {
     if (!isPartial){
         min_bin = 1;
@@ -890,16 +909,19 @@ double CCProtonPi0_SideBandTool::calc_ChiSq_SideBand(SideBand &sb, int unv, bool
 
     double ChiSq = 0.0;
 
+    // Starts at the first bin, not at min_bin -- Same bins as fit_ChiSq
     for (int i = 1; i <= max_bin; ++i) {
         double nData = sb.data_all_universes[unv]->GetBinContent(i);
         if (nData == 0) continue;
 
         // Do not use Signal and Other in Fit
         double nSignal = sb.signal_all_universes[unv]->GetBinContent(i) * POT_ratio;
-        double nWithPi0 = sb.WithPi0_all_universes[unv]->GetBinContent(i) * POT_ratio;
-        double nQELike = sb.QELike_all_universes[unv]->GetBinContent(i) * POT_ratio;
-        double nSinglePiPlus = sb.SinglePiPlus_all_universes[unv]->GetBinContent(i) * POT_ratio;
         double nOther = sb.Other_all_universes[unv]->GetBinContent(i) * POT_ratio;
+
+        // par[] will be the weights associated with that background
+        double nWithPi0 = par[0] * sb.WithPi0_all_universes[unv]->GetBinContent(i) * POT_ratio;
+        double nQELike = par[1] * sb.QELike_all_universes[unv]->GetBinContent(i) * POT_ratio;
+        double nSinglePiPlus = par[2] * sb.SinglePiPlus_all_universes[unv]->GetBinContent(i) * POT_ratio;
         
         double nTotalMC = nSignal + nWithPi0 + nQELike + nSinglePiPlus + nOther;
 
@@ -910,27 +932,70 @@ double CCProtonPi0_SideBandTool::calc_ChiSq_SideBand(SideBand &sb, int unv, bool
     return ChiSq;
 }
 
-double CCProtonPi0_SideBandTool::calc_Global_ChiSq(int unv)
+double CCProtonPi0_SideBandTool::calc_Global_ChiSq_Histograms(int unv, const double* par)
 {
     double ChiSq = 0;
 
     // Calculate ChiSq for Michel for ALL Bins
-    ChiSq += calc_ChiSq_SideBand(Michel, unv);
+    ChiSq += calc_ChiSq_SideBand(Michel, unv, par);
    
     // Calculate ChiSq for pID for ALL Bins
-    ChiSq += calc_ChiSq_SideBand(pID, unv);
+    ChiSq += calc_ChiSq_SideBand(pID, unv, par);
 
     // Calculate ChiSq for Low Inv Mass 
     //      Inv Mass itself for first 6 bins
-    ChiSq += calc_ChiSq_SideBand(LowInvMass, unv, true, 1, 6);
+    ChiSq += calc_ChiSq_SideBand(LowInvMass, unv, par, true, 1, 6);
     
     // Calculate ChiSq for High Inv Mass
     //      Inv Mass itself for last 30 bins
-    ChiSq += calc_ChiSq_SideBand(HighInvMass, unv, true, 21, 50);
+    ChiSq += calc_ChiSq_SideBand(HighInvMass, unv, par, true, 21, 50);
 
     return ChiSq;
 }
 
+double CCProtonPi0_SideBandTool::calc_Global_ChiSq(int unv)
+{
+    // Before Fit -- All weights are 1.0
+    double par[3] = {1.0, 1.0, 1.0};
+    return fit_ChiSq.ChiSq(unv, par);
+}
+
+void CCProtonPi0_SideBandTool::Benchmark_ChiSq(int nRepeat)
+{
+    // Typical weights after fit
+    double par[3] = {1.1, 0.9, 1.05};
+
+    TStopwatch timer;
+    double sum_hist = 0.0;
+    timer.Start();
+    for (int n = 0; n < nRepeat; ++n){
+        for (int unv = 0; unv < N_Universes; ++unv) sum_hist += calc_Global_ChiSq_Histograms(unv, par);
+    }
+    timer.Stop();
+    double time_hist = timer.RealTime() / nRepeat;
+
+    double sum_packed = 0.0;
+    timer.Start();
+    for (int n = 0; n < nRepeat; ++n){
+        for (int unv = 0; unv < N_Universes; ++unv) sum_packed += fit_ChiSq.ChiSq(unv, par);
+    }
+    timer.Stop();
+    double time_packed = timer.RealTime() / nRepeat;
+
+    double max_diff = 0.0;
+    for (int unv = 0; unv < N_Universes; ++unv){
+        double ChiSq_hist = calc_Global_ChiSq_Histograms(unv, par);
+        double ChiSq_packed = fit_ChiSq.ChiSq(unv, par);
+        double diff = ChiSq_hist == 0.0 ? fabs(ChiSq_packed) : fabs(ChiSq_packed - ChiSq_hist) / fabs(ChiSq_hist);
+        if (diff > max_diff) max_diff = diff;
+    }
+
+    std::cout<<std::left;
+    std::cout<<"Side Band ChiSq for "<<N_Universes<<" Universes ("<<nRepeat<<" Repeats, Checksum "<<sum_hist<<" vs "<<sum_packed<<")"<<std::endl;
+    std::cout<<std::setw(20)<<"Histograms [s]"<<std::setw(20)<<"Packed [s]"<<std::setw(10)<<"Speedup"<<std::setw(15)<<"Max Diff"<<std::endl;
+    std::cout<<std::setw(20)<<time_hist<<std::setw(20)<<time_packed<<std::setw(10)<<time_hist/time_packed<<std::setw(15)<<max_diff<<std::endl;
+}
+
 void CCProtonPi0_SideBandTool::GetStatistics(SideBand &sb)
 {
     int first_bin;
@@ -1020,8 +1085,19 @@ void CCProtonPi0_SideBandTool::WriteFitResults()
     file.width(20); file<<"err(SinglePiPlus)"<<" ";    
     file.width(20); file<<"err(QELike)"<<" ";    
     file.width(20); file<<"err(WithPi0)"<<" ";    
+    // Covariance of the weights -- Upper triangle
+    //      Columns after err(WithPi0) are not read by CCProtonPi0_BckgConstrainer
+    file.width(20); file<<"cov(SPP,SPP)"<<" ";
+    file.width(20); file<<"cov(SPP,QEL)"<<" ";
+    file.width(20); file<<"cov(SPP,WPi0)"<<" ";
+    file.width(20); file<<"cov(QEL,QEL)"<<" ";
+    file.width(20); file<<"cov(QEL,WPi0)"<<" ";
+    file.width(20); file<<"cov(WPi0,WPi0)"<<" ";
     file<<std::endl;
 
+    // Same order as the weights: SinglePiPlus, QELike, WithPi0
+    const int ind[3] = {2, 1, 0};
+
     for (unsigned int i = 0; i < ChiSq_after_fit.size(); ++i){
         file.width(32); file<<Original.err_bands_data_all_universes[i]<<" "; 
         file.width(6); file<<Original.hist_ind_data_all_universes[i]<<" "; 
@@ -1033,6 +1109,11 @@ void CCProtonPi0_SideBandTool::WriteFitResults()
         file.width(20); file<<err_SinglePiPlus[i]<<" ";    
         file.width(20); file<<err_QELike[i]<<" ";    
         file.width(20); file<<err_WithPi0[i]<<" ";    
+        for (int j = 0; j < 3; ++j){
+            for (int k = j; k < 3; ++k){
+                file.width(20); file<<cov_fit[9*i + 3*ind[j] + ind[k]]<<" ";
+            }
+        }
         file<<std::endl;
     }
 
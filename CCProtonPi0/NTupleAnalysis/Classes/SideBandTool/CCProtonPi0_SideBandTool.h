@@ -3,6 +3,7 @@
 
 #include <iomanip>
 #include "../NTupleAnalysis/CCProtonPi0_NTupleAnalysis.h"
+#include "../SideBandChiSq/CCProtonPi0_SideBandChiSq.h"
 #include "TObjArray.h"
 #include "TFractionFitter.h"
 #include "TCanvas.h"
@@ -114,11 +115,12 @@ class CCProtonPi0_SideBandTool : public CCProtonPi0_NTupleAnalysis
         CCProtonPi0_SideBandTool();
         ~CCProtonPi0_SideBandTool();
         
-        void SaveFitResults(double chisq, double par_values[3], double par_errors[3]);
+        void SaveFitResults(double chisq, double par_values[3], double par_errors[3], double cov[3][3]);
         void ApplyFitResults();
         void Plot();
         void WriteFitResults();
         void WriteStatistics();
+        void Benchmark_ChiSq(int nRepeat = 100);
         
         SideBand Original;
         SideBand Michel;
@@ -129,6 +131,9 @@ class CCProtonPi0_SideBandTool : public CCProtonPi0_NTupleAnalysis
         int N_Universes;
         int current_unv;
 
+        // Packed bins used in the fit for all universes
+        CCProtonPi0_SideBandChiSq fit_ChiSq;
+
         std::vector<double> ChiSq_before_fit;
         std::vector<double> ChiSq_after_fit;
         std::vector<double> wgt_WithPi0;
@@ -139,6 +144,9 @@ class CCProtonPi0_SideBandTool : public CCProtonPi0_NTupleAnalysis
         std::vector<double> err_QELike;
         std::vector<double> err_SinglePiPlus;
 
+        // Fit Covariance [universe][3][3] -- Fit parameter order: WithPi0, QELike, SinglePiPlus
+        std::vector<double> cov_fit;
+
     private:
         void OpenRootFiles();
         void initSideBands();
@@ -152,7 +160,8 @@ class CCProtonPi0_SideBandTool : public CCProtonPi0_NTupleAnalysis
         void ApplyFitResults(XSec_Var &xsec_var);
         void WriteStatistics(SideBand &sb);
         double calc_Global_ChiSq(int unv);
-        double calc_ChiSq_SideBand(SideBand &sb, int unv = 0, bool isPartial = false, int min_bin = 1, int max_bin = 1);
+        double calc_Global_ChiSq_Histograms(int unv, const double* par);
+        double calc_ChiSq_SideBand(SideBand &sb, int unv, const double* par, bool isPartial = false, int min_bin = 1, int max_bin = 1);
         
         // Plot Functions
         void DrawDataMCWithErrorBand(SideBand &sb);
@@ -0,0 +1,261 @@
+/*
+   See CCProtonPi0_WFitModel.h header for Class Information
+   */
+#ifndef CCProtonPi0_WFitModel_cpp
+#define CCProtonPi0_WFitModel_cpp
+
+#include "CCProtonPi0_WFitModel.h"
+
+using namespace std;
+
+const double CCProtonPi0_WFitModel::proton_mass = 0.938;
+
+CCProtonPi0_WFitModel::CCProtonPi0_WFitModel()
+{
+    first_bin = 1;
+    for (int i = 0; i < nPars; ++i){
+        start[i] = 1.0;
+        isFixed[i] = false;
+        par_values[i] = 0.0;
+        par_errors[i] = 0.0;
+    }
+    min_ChiSq = 0.0;
+    edm = 0.0;
+    icstat = 0;
+}
+
+void CCProtonPi0_WFitModel::SetBins(const TH1* hist, int min_bin, int max_bin)
+{
+    if (min_bin < 1 || max_bin > hist->GetNbinsX() || min_bin > max_bin){
+        cout<<"W Fit Model: Wrong Range for Fit"<<endl;
+        exit(EXIT_FAILURE);
+    }
+
+    first_bin = min_bin;
+    int nBins = max_bin - min_bin + 1;
+    W.resize(nBins);
+    W_Sq.resize(nBins);
+    phase_space.resize(nBins);
+    data.assign(nBins, 0.0);
+    inv_err_Sq.assign(nBins, 0.0);
+
+    for (int i = 0; i < nBins; ++i){
+        W[i] = hist->GetBinCenter(min_bin + i);
+        W_Sq[i] = W[i] * W[i];
+        phase_space[i] = std::pow((W[i]/proton_mass), 3);
+    }
+}
+
+void CCProtonPi0_WFitModel::SetData(const TH1* hist)
+{
+    for (int i = 0; i < GetNBins(); ++i){
+        double err = hist->GetBinError(first_bin + i);
+        data[i] = hist->GetBinContent(first_bin + i);
+        inv_err_Sq[i] = err == 0.0 ? 0.0 : 1.0/(err*err);
+    }
+}
+
+void CCProtonPi0_WFitModel::SetStart(const double par[nPars])
+{
+    for (int i = 0; i < nPars; ++i) start[i] = par[i];
+}
+
+void CCProtonPi0_WFitModel::FixParameter(int i, bool isFixed)
+{
+    this->isFixed[i] = isFixed;
+}
+
+/*
+ *  Breit-Wigner: y = N * (W/M_p)^3 * A / D
+ *      A = M*G, D = (W^2 - M^2)^2 + A^2
+ */
+double CCProtonPi0_WFitModel::BreitWigner(const double* par, int i, double* grad) const
+{
+    double N = par[0];
+    double M = par[1];
+    double G = par[2];
+
+    double A = M * G;
+    double diff = W_Sq[i] - M*M;
+    double D = diff*diff + A*A;
+    double shape = phase_space[i] * A / D;
+
+    if (grad != NULL){
+        double dD_dM = -4.0*M*diff + 2.0*A*G;
+        double dD_dG = 2.0*A*M;
+        grad[0] = shape;
+        grad[1] = N * phase_space[i] * (G*D - A*dD_dM) / (D*D);
+        grad[2] = N * phase_space[i] * (M*D - A*dD_dG) / (D*D);
+    }
+
+    return N * shape;
+}
+
+/*
+ *  Gaussian: y = N * exp(-u^2), u = (W - mean) / sigma
+ */
+double CCProtonPi0_WFitModel::Gaussian(const double* par, int i, double* grad) const
+{
+    double N = par[0];
+    double u = (W[i] - par[1]) / par[2];
+    double shape = std::exp(-u*u);
+
+    if (grad != NULL){
+        grad[0] = shape;
+        grad[1] = N * shape * 2.0*u / par[2];
+        grad[2] = N * shape * 2.0*u*u / par[2];
+    }
+
+    return N * shape;
+}
+
+void CCProtonPi0_WFitModel::Evaluate(int component, const double* par, double* y) const
+{
+    const double* comp_par = par + 3*component;
+    for (int i = 0; i < GetNBins(); ++i){
+        if (component == 0) y[i] = BreitWigner(comp_par, i, NULL);
+        else y[i] = Gaussian(comp_par, i, NULL);
+    }
+}
+
+void CCProtonPi0_WFitModel::Evaluate(const double* par, double* y) const
+{
+    for (int i = 0; i < GetNBins(); ++i){
+        y[i] = BreitWigner(par, i, NULL) + Gaussian(par+3, i, NULL) + Gaussian(par+6, i, NULL) + Gaussian(par+9, i, NULL);
+    }
+}
+
+double CCProtonPi0_WFitModel::ChiSq(const double* par) const
+{
+    return ChiSq(par, NULL);
+}
+
+double CCProtonPi0_WFitModel::ChiSq(const double* par, double* grad) const
+{
+    double ChiSq = 0.0;
+    if (grad != NULL){
+        for (int k = 0; k < nPars; ++k) grad[k] = 0.0;
+    }
+
+    double dy[nPars];
+    double* dy_ptr = grad != NULL ? dy : NULL;
+    for (int i = 0; i < GetNBins(); ++i){
+        if (inv_err_Sq[i] == 0.0) continue;
+
+        double y = BreitWigner(par, i, dy_ptr)
+                 + Gaussian(par+3, i, dy_ptr ? dy_ptr+3 : NULL)
+                 + Gaussian(par+6, i, dy_ptr ? dy_ptr+6 : NULL)
+                 + Gaussian(par+9, i, dy_ptr ? dy_ptr+9 : NULL);
+
+        double residual = data[i] - y;
+        ChiSq += residual * residual * inv_err_Sq[i];
+
+        if (grad != NULL){
+            double factor = -2.0 * residual * inv_err_Sq[i];
+            for (int k = 0; k < nPars; ++k) grad[k] += factor * dy[k];
+        }
+    }
+
+    return ChiSq;
+}
+
+void CCProtonPi0_WFitModel::BreitWigner(const double* par, const double* x, double* y, int nPoints)
+{
+    for (int i = 0; i < nPoints; ++i){
+        double A = par[1]*par[2];
+        double diff = x[i]*x[i] - par[1]*par[1];
+        y[i] = par[0] * std::pow((x[i]/proton_mass), 3) * ( A / (diff*diff + A*A));
+    }
+}
+
+void CCProtonPi0_WFitModel::Gaussian(const double* par, const double* x, double* y, int nPoints)
+{
+    for (int i = 0; i < nPoints; ++i){
+        double u = (x[i]-par[1])/par[2];
+        y[i] = par[0] * std::exp(-u*u);
+    }
+}
+
+int CCProtonPi0_WFitModel::GetNBins() const
+{
+    return W.size();
+}
+
+const double* CCProtonPi0_WFitModel::GetBinCenters() const
+{
+    return &W[0];
+}
+
+void CCProtonPi0_WFitModel::FCN(Int_t &npar, Double_t *gin, Double_t &f, Double_t *par, Int_t iflag)
+{
+    // Silence Unused Variable Warning
+    (void) npar;
+
+    const CCProtonPi0_WFitModel* model = static_cast<const CCProtonPi0_WFitModel*>(gMinuit->GetObjectFit());
+
+    // iflag = 2 -- Minuit asks for the gradient
+    if (iflag == 2) f = model->ChiSq(par, gin);
+    else f = model->ChiSq(par);
+}
+
+void CCProtonPi0_WFitModel::Fit(bool isVerbose)
+{
+    const char* par_names[nPars] = {
+        "DeltaRES_N", "DeltaRES_M", "DeltaRES_G",
+        "OtherRES_N", "OtherRES_Mean", "OtherRES_Sigma",
+        "NonRES_G1_N", "NonRES_G1_Mean", "NonRES_G1_Sigma",
+        "NonRES_G2_N", "NonRES_G2_Mean", "NonRES_G2_Sigma"};
+
+    TMinuit *ptMinuit = new TMinuit(nPars);
+    if (isVerbose) ptMinuit->SetPrintLevel();
+    else ptMinuit->SetPrintLevel(-1);
+
+    // FCN finds this model through the current TMinuit
+    ptMinuit->SetObjectFit(this);
+    ptMinuit->SetFCN(FCN);
+
+    Double_t arglist[10];
+    Int_t ierflg = 0;
+
+    arglist[0] = 1;
+    ptMinuit->mnexcm("SET ERR", arglist ,1,ierflg);
+
+    // Analytic gradient -- Do not check against numerical derivatives
+    arglist[0] = 1;
+    ptMinuit->mnexcm("SET GRAD", arglist ,1,ierflg);
+
+    // Step is 1% of the starting value
+    for (int i = 0; i < nPars; ++i){
+        double step = start[i] != 0.0 ? 0.01 * fabs(start[i]) : 0.01;
+        ptMinuit->mnparm(i, par_names[i], start[i], step, 0, 0, ierflg);
+        if (isFixed[i]) ptMinuit->FixParameter(i);
+    }
+
+    arglist[0] = 1000;
+    arglist[1] = 1.;
+    ptMinuit->mnexcm("MIGRAD", arglist ,2,ierflg);
+
+    for (int i = 0; i < nPars; ++i){
+        ptMinuit->GetParameter(i, par_values[i], par_errors[i]);
+    }
+
+    Double_t errdef;
+    Int_t nvpar,nparx;
+    ptMinuit->mnstat(min_ChiSq,edm,errdef,nvpar,nparx,icstat);
+
+    if (isVerbose){
+        std::cout<<"\nW Fit Model Results\n";
+        for (int i = 0; i < nPars; ++i){
+            std::cout<<"\t"<<par_names[i]<<" = "<<par_values[i]<<" +/- "<<par_errors[i]<<"\n";
+        }
+        std::cout << " Minimum chi square = " << min_ChiSq<< "\n";
+        std::cout << " Estimated vert. distance to min. = " << edm << "\n";
+        std::cout << " Number of variable parameters = " << nvpar << "\n";
+        std::cout << " Status of covariance matrix = " << icstat << "\n";
+    }
+
+    delete ptMinuit;
+}
+
+#endif
+
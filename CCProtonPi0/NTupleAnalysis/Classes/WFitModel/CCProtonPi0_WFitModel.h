@@ -0,0 +1,95 @@
+/*
+================================================================================
+Class: CCProtonPi0_WFitModel
+    Resonance Model for the W distribution evaluated on a fixed bin grid
+        Delta(1232) RES:    Breit-Wigner
+        Other RES:          Gaussian
+        Non-RES:            Double Gaussian
+    Bin centers and W dependent factors are calculated once in SetBins()
+    ChiSq and its analytic gradient do not allocate -- Same model is used
+    for any universe with SetData()
+
+    Main Directory:
+        Classes/WFitModel
+
+    Fit Parameters (Normalization, Mean or Mass, Width for each component):
+        [0-2] DeltaRES, [3-5] OtherRES, [6-8] NonRES G1, [9-11] NonRES G2
+
+    ChiSq = sum_i (data_i - model_i)^2 / err_i^2     (bins with err = 0 are skipped)
+================================================================================
+*/
+#ifndef CCProtonPi0_WFitModel_h
+#define CCProtonPi0_WFitModel_h
+
+#include <iostream>
+#include <cstdlib>
+#include <cmath>
+#include <vector>
+
+#include <TH1.h>
+#include <TMinuit.h>
+
+class CCProtonPi0_WFitModel : public TObject
+{
+    public:
+        CCProtonPi0_WFitModel();
+
+        static const int nPars = 12;
+        static const int nComponents = 4;
+
+        // Bin grid is taken from the histogram -- Bins [min_bin, max_bin]
+        void SetBins(const TH1* hist, int min_bin, int max_bin);
+        void SetData(const TH1* data);
+
+        void SetStart(const double par[nPars]);
+        void FixParameter(int i, bool isFixed = true);
+
+        // Batch evaluation on the bin grid
+        void Evaluate(const double* par, double* y) const;
+        void Evaluate(int component, const double* par, double* y) const;
+
+        double ChiSq(const double* par) const;
+        double ChiSq(const double* par, double* grad) const;
+
+        // MIGRAD Fit with the analytic gradient
+        void Fit(bool isVerbose);
+
+        // Batch evaluation on any W points -- 3 parameters of a single component
+        static void BreitWigner(const double* par, const double* x, double* y, int nPoints);
+        static void Gaussian(const double* par, const double* x, double* y, int nPoints);
+
+        int GetNBins() const;
+        const double* GetBinCenters() const;
+
+        double min_ChiSq;
+        double edm;
+        int icstat;
+        double par_values[nPars];
+        double par_errors[nPars];
+
+    private:
+        static const double proton_mass;    // GeV
+
+        // Bin Grid
+        std::vector<double> W;
+        std::vector<double> W_Sq;
+        std::vector<double> phase_space;    // (W/M_p)^3
+        int first_bin;
+
+        // Data on the Bin Grid
+        std::vector<double> data;
+        std::vector<double> inv_err_Sq;
+
+        double start[nPars];
+        bool isFixed[nPars];
+
+        // Value and gradient of a single component at bin i
+        double BreitWigner(const double* par, int i, double* grad) const;
+        double Gaussian(const double* par, int i, double* grad) const;
+
+        // TMinuit FCN -- Model is the ObjectFit of the current TMinuit
+        static void FCN(Int_t &npar, Double_t *gin, Double_t &f, Double_t *par, Int_t iflag);
+};
+
+#endif
+
@@ -19,6 +19,9 @@ Namespace: Data_Functions
 #ifndef Data_Functions_h
 #define Data_Functions_h
 
+#include <cmath>
+#include <algorithm>
+
 namespace Data_Functions
 {
 
@@ -29,6 +32,28 @@ inline double getError(double trueValue, double recoValue)
     return error;
 }
 
+// Rounding error of new_sum = sum + x (Neumaier)
+//      Accumulate it separately and add it once at the end to get a
+//      compensated sum, which does not depend on the size of the partial sums
+inline double getRoundingError(double sum, double x, double new_sum)
+{
+    if (fabs(sum) >= fabs(x)) return (sum - new_sum) + x;
+    else return (x - new_sum) + sum;
+}
+
+inline void compensatedAdd(double& sum, double& comp, double x)
+{
+    double new_sum = sum + x;
+    comp += getRoundingError(sum, x, new_sum);
+    sum = new_sum;
+}
+
+// |a - b| relative to the larger of the two, 0 if they are identical
+inline double getRelativeDiff(double a, double b)
+{
+    if (a == b) return 0.0;
+    return fabs(a - b) / std::max(fabs(a), fabs(b));
+}
     
 }
 
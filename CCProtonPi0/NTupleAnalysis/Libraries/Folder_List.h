@@ -30,6 +30,15 @@ namespace Folder_List
     // Background Constraints
     const std::string BckgConstraints = input + "BckgConstraints/" + "Weights_All_Universes.txt";
     const std::string BckgConstraints_TruthAnalysis = "../" + input + "BckgConstraints/" + "Weights_All_Universes.txt";
+
+    // Branch Manifests -- Branches activated in Analysis Mode
+    const std::string BranchManifest = input + "BranchManifests/" + "Analyze.txt";
+    const std::string BranchManifest_MC = input + "BranchManifests/" + "Analyze_MC.txt";
+    const std::string BranchManifest_MC_Systematics = input + "BranchManifests/" + "Analyze_MC_Systematics.txt";
+
+    // Playlists read in Analysis Mode -- Rewritten by every Reduce
+    const std::string pl_MC_Reduced = input + "Playlists/" + "pl_MC_Reduced.dat";
+    const std::string pl_Data_Reduced = input + "Playlists/" + "pl_Data_Reduced.dat";
     
     //-------------------------------------------------------------------------
     // Data files on /minerva/data/users/oaltinok/NTupleAnalysis Disk
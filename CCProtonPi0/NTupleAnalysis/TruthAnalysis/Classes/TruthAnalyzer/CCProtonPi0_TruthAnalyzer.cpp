@@ -31,17 +31,11 @@ void CCProtonPi0_TruthAnalyzer::Loop(std::string playlist)
     std::cout<<"Looping over all entries"<<std::endl;
 
     Long64_t nentries = fChain->GetEntriesFast();
-    Long64_t nbytes = 0, nb = 0;
+    CCProtonPi0_EventSource events(fChain, 0, nentries);
 
-    for (Long64_t jentry=0; jentry<nentries;jentry++) {
+    while (events.Next()) {
 
-        nb = fChain->GetEntry(jentry);   nbytes += nb;    
-        Long64_t ientry = fChain->GetEntry(jentry);
-
-        if (ientry == 0) {
-            std::cout<<"\tGetEntry failure "<<jentry<<std::endl;
-            break;
-        }
+        Long64_t jentry = events.GetEntryNumber();
 
         // Progress Message on Terminal
         if (jentry % 1000000 == 0 ) std::cout<<"Entry = "<<jentry<<std::endl;
@@ -25,6 +25,7 @@
 #include "../../../Classes/Counter/CCProtonPi0_Counter.h"
 #include "../../../Classes/BckgConstrainer/CCProtonPi0_BckgConstrainer.h"
 #include "../../../Classes/QSqFitter/CCProtonPi0_QSqFitter.h"
+#include "../../../Classes/EventSource/CCProtonPi0_EventSource.h"
 
 using namespace PlotUtils;
 
@@ -287,6 +287,12 @@ void CCProtonPi0_TruthAnalyzer::Init(string playlist, TChain* fChain)
     fChain->SetBranchAddress("mc_wgt_ppfx1_Total_sz", &mc_wgt_ppfx1_Total_sz, &b_mc_wgt_ppfx1_Total_sz);
     fChain->SetBranchAddress("mc_wgt_ppfx1_Total", mc_wgt_ppfx1_Total, &b_mc_wgt_ppfx1_Total);
 
+    // Prefetch the next cluster while the current entry is analyzed
+    CCProtonPi0_EventSource::EnableAsyncPrefetching();
+    fChain->SetCacheSize(100000000);
+    fChain->AddBranchToCache("*", kTRUE);
+    fChain->StopCacheLearningPhase();
+
 
 
 }
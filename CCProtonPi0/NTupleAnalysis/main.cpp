@@ -22,25 +22,29 @@ using namespace std;
 
 // See src/Main_functions.cpp for definitions
 int GetMode(int argc, char* argv[]);
+int GetNWorkers(int argc, char* argv[]);
 void showInputError(char *argv[]);
-void Plot();
+void Plot(int nWorkers);
 void Reduce(string playlist, bool isMC);
-void Analyze(string playlist, bool isMC);
-void Calculate_CrossSection(bool isMC);
+void Reduce_Incremental(string playlist, bool isMC);
+void Analyze(string playlist, bool isMC, int nWorkers);
+void Analyze_Partitioned(string playlist, bool isMC, int nWorkers);
+void Calculate_CrossSection(bool isMC, int nWorkers);
+void Benchmark_Unfolding(bool isMC);
+void Check_Partitioned(string playlist, bool isMC, int nWorkers);
 
 // See src/Minuit_Functions.cpp for definitions 
-void FitSideBands();
-void FitMinuit();
+void FitSideBands(int nWorkers);
+void Benchmark_SideBandChiSq();
 void FitMinuit_W();
+void FitModel_W_Universes();
 void ApplyStyle(PlotUtils::MnvPlotter* plotter);
 void Fit(std::string fileName, std::string plotName);
 void Fit(std::string rootDir_data, std::string rootDir_mc, std::string plotName, std::string histName_data, std::string histName_mc);
 void Fit_QSq_Ozgur();
 void Fit_QSq_Trung();
 void Fit_QSq();
-void calc_ChiSq(Int_t &npar, Double_t *gin, Double_t &f, Double_t *par, Int_t iflag);
 void calc_ChiSq_W(Int_t &npar, Double_t *gin, Double_t &f, Double_t *par, Int_t iflag);
-double calc_ChiSq_SideBand(SideBand &sb, Double_t *par, int unv = 0, bool isPartial = false, int min_bin = 1, int max_bin = 1);
 
 int main(int argc, char *argv[] )
 {
@@ -69,22 +73,27 @@ int main(int argc, char *argv[] )
         if (isMC){
             cout<<"MC Playlists Selected!\n"<<endl;
             pl_reduce = "Input/Playlists/pl_MC_Merged.dat"; 
-            pl_analyze = "Input/Playlists/pl_MC_Reduced.dat"; 
+            pl_analyze = Folder_List::pl_MC_Reduced; 
         }else{
             cout<<"Data Playlists Selected!\n"<<endl;
             pl_reduce = "Input/Playlists/pl_Data_Merged.dat"; 
-            pl_analyze = "Input/Playlists/pl_Data_Reduced.dat"; 
+            pl_analyze = Folder_List::pl_Data_Reduced; 
         }
     }
 
     ROOT::Cintex::Cintex::Enable();
 
     if ( abs(nMode) == 1) Reduce(pl_reduce, isMC);
-    else if ( abs(nMode) == 2) Analyze(pl_analyze, isMC);
-    else if ( abs(nMode) == 3) Calculate_CrossSection(isMC);
-    else if ( nMode == 10) Plot();
-    else if ( nMode == 20) FitSideBands();
+    else if ( abs(nMode) == 2) Analyze(pl_analyze, isMC, GetNWorkers(argc, argv));
+    else if ( abs(nMode) == 3) Calculate_CrossSection(isMC, GetNWorkers(argc, argv));
+    else if ( abs(nMode) == 4) Reduce_Incremental(pl_reduce, isMC);
+    else if ( abs(nMode) == 5) Benchmark_Unfolding(isMC);
+    else if ( abs(nMode) == 6) Check_Partitioned(pl_analyze, isMC, GetNWorkers(argc, argv));
+    else if ( nMode == 10) Plot(GetNWorkers(argc, argv));
+    else if ( nMode == 20) FitSideBands(GetNWorkers(argc, argv));
+    else if ( nMode == 21) Benchmark_SideBandChiSq();
     else if ( nMode == 30) FitMinuit_W();
+    else if ( nMode == 31) FitModel_W_Universes();
     else if ( nMode == 40) Fit_QSq();
     else{
         cout<<"Problem on Mode!, Returning"<<endl;
@@ -2,18 +2,31 @@
 #include "../Classes/CrossSection/CCProtonPi0_CrossSection.h"
 #include "../Classes/Plotter/CCProtonPi0_Plotter.h"
 #include "../Classes/SideBandTool/CCProtonPi0_SideBandTool.h"
+#include "../Classes/ReduceManifest/CCProtonPi0_ReduceManifest.h"
+
+#include <unistd.h>
+#include <sys/wait.h>
+#include <cstdio>
 
 const string runOption_Run = "run";
 const string runOption_Plot = "plot";
 const string runOption_Reduce = "reduce";
+const string runOption_ReduceIncremental = "reduceInc";
 const string runOption_CrossSection = "calc";
+const string runOption_BenchmarkUnfolding = "benchUnfold";
+const string runOption_CheckRun = "checkRun";
 const string runOption_FitSideBand = "fit";
+const string runOption_BenchmarkSideBand = "benchFit";
 const string runOption_FitW = "fitW";
+const string runOption_FitWModel = "fitWModel";
 const string runOption_FitQSq = "fitQSq";
 
 const string typeOption_mc = "mc";
 const string typeOption_data = "data";
 
+void Analyze_Partitioned(string playlist, bool isMC, int nWorkers);
+int GetNWorkers(int argc, char* argv[]);
+
 void Reduce(string playlist, bool isMC)
 {
     bool isModeReduce = true;
@@ -21,37 +34,246 @@ void Reduce(string playlist, bool isMC)
     cout<<"======================================================================"<<endl;
     cout<<"Reducing NTuples..."<<endl;
     cout<<"======================================================================"<<endl;
-    CCProtonPi0_Analyzer t(isModeReduce, isMC);
-    t.reduce(playlist);
+    {
+        CCProtonPi0_Analyzer t(isModeReduce, isMC);
+        t.reduce(playlist);
+    }
+
+    // Analysis reads the new Reduced NTuple, not the chunks of an earlier Incremental Reduce
+    CCProtonPi0_ReduceManifest manifest(isMC);
+    manifest.WriteMergedPlaylist();
+}
+
+/*
+ *  Each new or changed input file is reduced into its own chunk by a separate process
+ *      Chunks are listed in the Reduce Manifest and chained at analysis time
+ *      Cut Tables and Cut Histograms are accumulated over ALL chunks
+ */
+void Reduce_Incremental(string playlist, bool isMC)
+{
+    bool isModeReduce = true;
+    cout<<"\n"<<endl;
+    cout<<"======================================================================"<<endl;
+    cout<<"Reducing NTuples Incrementally..."<<endl;
+    cout<<"======================================================================"<<endl;
+
+    CCProtonPi0_ReduceManifest manifest(isMC);
+    manifest.Update(playlist);
+
+    std::vector<int> pending = manifest.GetPendingChunks();
+    cout<<"Reducing "<<pending.size()<<" Chunks"<<endl;
+    for (unsigned int i = 0; i < pending.size(); ++i){
+        std::string chunk_playlist = manifest.GetChunkPlaylist(pending[i]);
+
+        pid_t pid = fork();
+        if (pid < 0){
+            cout<<"Cannot start Reduce for Chunk "<<pending[i]<<"! Exiting!..."<<endl;
+            exit(1);
+        }
+
+        if (pid == 0){
+            CCProtonPi0_NTupleAnalysis::SetPartition(manifest.GetNChunks(), pending[i]);
+            {
+                CCProtonPi0_Analyzer t(isModeReduce, isMC);
+                t.reduce(chunk_playlist);
+            }
+            exit(0);
+        }
+
+        int status;
+        waitpid(pid, &status, 0);
+        if (!WIFEXITED(status) || WEXITSTATUS(status) != 0){
+            cout<<"Reduce for Chunk "<<pending[i]<<" Failed!"<<endl;
+            exit(1);
+        }
+
+        // Update Manifest after each chunk -- A failed run keeps the finished chunks
+        manifest.SetReduced(pending[i]);
+        manifest.WriteManifest();
+    }
+    manifest.WriteManifest();
+    manifest.WriteReducedPlaylist();
+
+    CCProtonPi0_NTupleAnalysis::SetPartition(manifest.GetNChunks(), -1);
+    CCProtonPi0_Analyzer analyzer(isModeReduce, isMC);
+    analyzer.mergeReduceChunks(manifest.GetChunkIDs());
 }
 
-void Analyze(string playlist, bool isMC)
+void Analyze(string playlist, bool isMC, int nWorkers)
 {
     bool isModeReduce = false;
     cout<<"\n"<<endl;
     cout<<"======================================================================"<<endl;
     cout<<"Analyzing NTuples, Creating Histograms..."<<endl;
     cout<<"======================================================================"<<endl;
+    if (nWorkers > 1){
+        Analyze_Partitioned(playlist, isMC, nWorkers);
+        return;
+    }
+
     CCProtonPi0_Analyzer analyzer(isModeReduce, isMC);
     analyzer.analyze(playlist);
 }
 
-void Calculate_CrossSection(bool isMC)
+/*
+ *  Each worker is a separate process with its own Analyzer 
+ *      Histograms (including all Error Band Universes), Counters and TFiles are never shared 
+ *      Outputs are merged in partition order after all workers finish
+ */
+void Analyze_Partitioned(string playlist, bool isMC, int nWorkers)
+{
+    bool isModeReduce = false;
+    cout<<"Running "<<nWorkers<<" Workers"<<endl;
+
+    std::vector<pid_t> workers;
+    for (int i = 0; i < nWorkers; ++i){
+        pid_t pid = fork();
+        if (pid < 0){
+            cout<<"Cannot start Worker "<<i<<"! Exiting!..."<<endl;
+            exit(1);
+        }
+
+        if (pid == 0){
+            CCProtonPi0_NTupleAnalysis::SetPartition(nWorkers, i);
+            {
+                CCProtonPi0_Analyzer analyzer(isModeReduce, isMC);
+                analyzer.analyze(playlist);
+            }
+            exit(0);
+        }
+
+        workers.push_back(pid);
+    }
+
+    // Wait for ALL Workers before Merging
+    bool isFailed = false;
+    for (int i = 0; i < nWorkers; ++i){
+        int status;
+        waitpid(workers[i], &status, 0);
+        if (!WIFEXITED(status) || WEXITSTATUS(status) != 0){
+            cout<<"Worker "<<i<<" Failed!"<<endl;
+            isFailed = true;
+        }
+    }
+    if (isFailed) exit(1);
+
+    CCProtonPi0_NTupleAnalysis::SetPartition(nWorkers, -1);
+    CCProtonPi0_Analyzer analyzer(isModeReduce, isMC);
+    analyzer.mergePartitions();
+}
+
+/*
+ *  Runs analyze() serially, then with nWorkers partitions, and compares the outputs
+ *      Serial outputs are kept as *_Serial.root and PartitionCounters_Serial.txt
+ *      Every histogram (CV and all Error Band Universes) and every weighted Counter
+ *      must agree within CCProtonPi0_NTupleAnalysis::partitionTolerance
+ *      Output files of the last run are the partitioned (merged) ones
+ */
+void Check_Partitioned(string playlist, bool isMC, int nWorkers)
+{
+    cout<<"\n"<<endl;
+    cout<<"======================================================================"<<endl;
+    cout<<"Checking Partitioned Analysis against the Serial Run..."<<endl;
+    cout<<"======================================================================"<<endl;
+    if (nWorkers < 2){
+        cout<<"checkRun needs at least 2 Workers! Exiting!..."<<endl;
+        exit(1);
+    }
+
+    std::vector<string> files = CCProtonPi0_Analyzer::GetOutputRootFiles(isMC);
+    files.push_back(CCProtonPi0_Analyzer::GetCountersFileName());
+
+    // Serial Run in its own process -- Same state as './main.exe run'
+    pid_t pid = fork();
+    if (pid < 0){
+        cout<<"Cannot start Serial Run! Exiting!..."<<endl;
+        exit(1);
+    }
+    if (pid == 0){
+        Analyze(playlist, isMC, 1);
+        exit(0);
+    }
+    int status;
+    waitpid(pid, &status, 0);
+    if (!WIFEXITED(status) || WEXITSTATUS(status) != 0){
+        cout<<"Serial Run Failed!"<<endl;
+        exit(1);
+    }
+
+    for (unsigned int i = 0; i < files.size(); ++i){
+        string serial_name = CCProtonPi0_NTupleAnalysis::GetTaggedFileName(files[i], "Serial");
+        if (std::rename(files[i].c_str(), serial_name.c_str()) != 0){
+            cout<<"Cannot rename "<<files[i]<<" to "<<serial_name<<"! Exiting!..."<<endl;
+            exit(1);
+        }
+    }
+
+    // Partitioned Run in its own process -- Merge happens before it exits
+    pid = fork();
+    if (pid < 0){
+        cout<<"Cannot start Partitioned Run! Exiting!..."<<endl;
+        exit(1);
+    }
+    if (pid == 0){
+        Analyze(playlist, isMC, nWorkers);
+        exit(0);
+    }
+    waitpid(pid, &status, 0);
+    if (!WIFEXITED(status) || WEXITSTATUS(status) != 0){
+        cout<<"Partitioned Run Failed!"<<endl;
+        exit(1);
+    }
+
+    cout<<"\nSerial vs "<<nWorkers<<" Workers -- Tolerance = "<<CCProtonPi0_NTupleAnalysis::partitionTolerance<<endl;
+    bool isPassed = true;
+    for (unsigned int i = 0; i < files.size(); ++i){
+        string serial_name = CCProtonPi0_NTupleAnalysis::GetTaggedFileName(files[i], "Serial");
+        bool isFilePassed;
+        if (files[i] == CCProtonPi0_Analyzer::GetCountersFileName()){
+            isFilePassed = CCProtonPi0_NTupleAnalysis::ComparePartitionedCounters(files[i], serial_name);
+        }else{
+            isFilePassed = CCProtonPi0_NTupleAnalysis::ComparePartitionedFile(files[i], serial_name);
+        }
+        if (!isFilePassed) isPassed = false;
+    }
+
+    if (!isPassed){
+        cout<<"Partitioned Analysis does NOT agree with the Serial Run!"<<endl;
+        exit(1);
+    }
+    cout<<"Partitioned Analysis agrees with the Serial Run"<<endl;
+}
+
+void Calculate_CrossSection(bool isMC, int nWorkers)
 {
     cout<<"\n"<<endl;
     cout<<"======================================================================"<<endl;
     cout<<"Calculating Cross Section..."<<endl;
     cout<<"======================================================================"<<endl;
     CCProtonPi0_CrossSection crossSection(isMC);
-    crossSection.Calc_CrossSections();
+    crossSection.Calc_CrossSections(nWorkers);
 }
 
-void Plot()
+void Benchmark_Unfolding(bool isMC)
+{
+    cout<<"\n"<<endl;
+    cout<<"======================================================================"<<endl;
+    cout<<"Benchmarking Unfolding..."<<endl;
+    cout<<"======================================================================"<<endl;
+    CCProtonPi0_CrossSection crossSection(isMC);
+    bool isPassed = crossSection.Benchmark_Unfolding();
+    if (!isPassed){
+        cout<<"Native Unfolding does not agree with MnvUnfold -- See Unfolding_Parity log"<<endl;
+    }
+}
+
+void Plot(int nWorkers)
 {
     cout<<"======================================================================"<<endl;
     cout<<"Plotting Histograms..."<<endl;
     cout<<"======================================================================"<<endl;
     CCProtonPi0_Plotter plotter;
+    plotter.SetNWorkers(nWorkers);
     plotter.plotHistograms();
 }
 
@@ -59,27 +281,49 @@ void Plot()
  *  1   reduce
  *  2   run
  *  3   calculate cross section
+ *  4   incremental reduce
+ *  5   benchmark unfolding
+ *  6   check partitioned analysis against the serial run
  *  10  plot
  *  20  fit side band
+ *  21  benchmark side band ChiSq
+ *  30  fit W
+ *  31  fit W resonance model to data universes
  *   
 */
 int GetMode(int argc, char* argv[])
 {
-    // argc can only be 2 or 3
-    if (argc != 2 && argc != 3) return 0;
+    // argc can only be 2, 3 or 4 (run or calc with number of workers)
+    if (argc != 2 && argc != 3 && argc != 4) return 0;
 
     std::string runSelect = argv[1];
     if (argc == 2){
         if (runSelect.compare(runOption_Plot) == 0) return 10;
         else if (runSelect.compare(runOption_FitSideBand) == 0) return 20;
+        else if (runSelect.compare(runOption_BenchmarkSideBand) == 0) return 21;
         else if (runSelect.compare(runOption_FitW) == 0) return 30;
+        else if (runSelect.compare(runOption_FitWModel) == 0) return 31;
         else if (runSelect.compare(runOption_FitQSq) == 0) return 40;
         else return 0;
     }
      
+    // fit with number of workers
+    if (argc == 3 && runSelect.compare(runOption_FitSideBand) == 0){
+        if (GetNWorkers(argc, argv) < 1) return 0;
+        return 20;
+    }
+
+    // plot with number of workers for the QSq Fitter scans
+    if (argc == 3 && runSelect.compare(runOption_Plot) == 0){
+        if (GetNWorkers(argc, argv) < 1) return 0;
+        return 10;
+    }
+
     std::string typeSelect = argv[2];
+    bool isWorkersAllowed = runSelect.compare(runOption_Run) == 0 || runSelect.compare(runOption_CrossSection) == 0 || runSelect.compare(runOption_CheckRun) == 0;
+    if (argc == 4 && (!isWorkersAllowed || GetNWorkers(argc, argv) < 1)) return 0;
     // First check for ERROR
-    if (runSelect.compare(runOption_Reduce) != 0 && runSelect.compare(runOption_Run) != 0 && runSelect.compare(runOption_CrossSection) != 0) return 0;
+    if (runSelect.compare(runOption_Reduce) != 0 && runSelect.compare(runOption_ReduceIncremental) != 0 && runSelect.compare(runOption_Run) != 0 && runSelect.compare(runOption_CrossSection) != 0 && runSelect.compare(runOption_BenchmarkUnfolding) != 0 && runSelect.compare(runOption_CheckRun) != 0) return 0;
     if (typeSelect.compare(typeOption_mc) != 0 && typeSelect.compare(typeOption_data) != 0) return 0;
 
     // Passed ERROR Check - Valid Input    
@@ -89,6 +333,12 @@ int GetMode(int argc, char* argv[])
         else return 0;
     }
 
+    if (runSelect.compare(runOption_ReduceIncremental) == 0){
+        if (typeSelect.compare(typeOption_mc) == 0) return -4;
+        else if (typeSelect.compare(typeOption_data) == 0) return 4;
+        else return 0;
+    }
+
     if (runSelect.compare(runOption_Run) == 0){
         if (typeSelect.compare(typeOption_mc) == 0) return -2;
         else if (typeSelect.compare(typeOption_data) == 0) return 2;
@@ -101,9 +351,29 @@ int GetMode(int argc, char* argv[])
         else return 0;
     }
 
+    if (runSelect.compare(runOption_BenchmarkUnfolding) == 0){
+        if (typeSelect.compare(typeOption_mc) == 0) return -5;
+        else if (typeSelect.compare(typeOption_data) == 0) return 5;
+        else return 0;
+    }
+
+    if (runSelect.compare(runOption_CheckRun) == 0){
+        if (typeSelect.compare(typeOption_mc) == 0) return -6;
+        else if (typeSelect.compare(typeOption_data) == 0) return 6;
+        else return 0;
+    }
+
     return 0;
 }
 
+int GetNWorkers(int argc, char* argv[])
+{
+    if (argc == 3 && runOption_FitSideBand.compare(argv[1]) == 0) return atoi(argv[2]);
+    if (argc == 3 && runOption_Plot.compare(argv[1]) == 0) return atoi(argv[2]);
+    if (argc != 4) return 1;
+    return atoi(argv[3]);
+}
+
 void showInputError(char *argv[])
 {
     cout<<std::left;
@@ -112,17 +382,32 @@ void showInputError(char *argv[])
     cout<<"----------------------------------------------------------------------"<<endl;
     cout<<"Correct Syntax for NTuple Reduce"<<endl;
     cout<<"\t"<<argv[0]<<" "<<runOption_Reduce<<" "<<typeOption_mc<<endl;
-    cout<<"\t"<<argv[0]<<" "<<runOption_Reduce<<" "<<typeOption_data<<"\n"<<endl;
+    cout<<"\t"<<argv[0]<<" "<<runOption_Reduce<<" "<<typeOption_data<<endl;
+    cout<<"\t"<<argv[0]<<" "<<runOption_ReduceIncremental<<" "<<typeOption_mc<<endl;
+    cout<<"\t"<<argv[0]<<" "<<runOption_ReduceIncremental<<" "<<typeOption_data<<"\n"<<endl;
     cout<<"Correct Syntax for NTuple Analysis"<<endl;
     cout<<"\t"<<argv[0]<<" "<<runOption_Run<<" "<<typeOption_mc<<endl;
-    cout<<"\t"<<argv[0]<<" "<<runOption_Run<<" "<<typeOption_data<<"\n"<<endl;
+    cout<<"\t"<<argv[0]<<" "<<runOption_Run<<" "<<typeOption_data<<endl;
+    cout<<"\t"<<argv[0]<<" "<<runOption_Run<<" "<<typeOption_mc<<" nWorkers"<<"\n"<<endl;
+    cout<<"Correct Syntax for Partitioned Analysis Check (Serial vs nWorkers)"<<endl;
+    cout<<"\t"<<argv[0]<<" "<<runOption_CheckRun<<" "<<typeOption_mc<<" nWorkers"<<"\n"<<endl;
     cout<<"Correct Syntax for Calculating Cross Section"<<endl;
     cout<<"\t"<<argv[0]<<" "<<runOption_CrossSection<<" "<<typeOption_mc<<endl;
-    cout<<"\t"<<argv[0]<<" "<<runOption_CrossSection<<" "<<typeOption_data<<"\n"<<endl;
+    cout<<"\t"<<argv[0]<<" "<<runOption_CrossSection<<" "<<typeOption_data<<endl;
+    cout<<"\t"<<argv[0]<<" "<<runOption_CrossSection<<" "<<typeOption_mc<<" nWorkers"<<"\n"<<endl;
+    cout<<"Correct Syntax for Unfolding Benchmark"<<endl;
+    cout<<"\t"<<argv[0]<<" "<<runOption_BenchmarkUnfolding<<" "<<typeOption_mc<<"\n"<<endl;
     cout<<"Correct Syntax for Plotting"<<endl;
-    cout<<"\t"<<argv[0]<<" "<<runOption_Plot<<"\n"<<endl;
+    cout<<"\t"<<argv[0]<<" "<<runOption_Plot<<endl;
+    cout<<"\t"<<argv[0]<<" "<<runOption_Plot<<" nWorkers"<<"\n"<<endl;
     cout<<"Correct Syntax for Fitting SideBands"<<endl;
-    cout<<"\t"<<argv[0]<<" "<<runOption_FitSideBand<<"\n"<<endl;
+    cout<<"\t"<<argv[0]<<" "<<runOption_FitSideBand<<endl;
+    cout<<"\t"<<argv[0]<<" "<<runOption_FitSideBand<<" nWorkers"<<"\n"<<endl;
+    cout<<"Correct Syntax for Side Band ChiSq Benchmark"<<endl;
+    cout<<"\t"<<argv[0]<<" "<<runOption_BenchmarkSideBand<<"\n"<<endl;
+    cout<<"Correct Syntax for W Fits"<<endl;
+    cout<<"\t"<<argv[0]<<" "<<runOption_FitW<<endl;
+    cout<<"\t"<<argv[0]<<" "<<runOption_FitWModel<<"\n"<<endl;
     cout<<"----------------------------------------------------------------------"<<endl;
 }
 
@@ -1,189 +1,172 @@
 #include "../Classes/SideBandTool/CCProtonPi0_SideBandTool.h"
+#include "../Classes/SideBandFit/CCProtonPi0_SideBandFit.h"
+
+#include <unistd.h>
+#include <sys/wait.h>
 
 using namespace std;
 
 CCProtonPi0_SideBandTool sbtool;
 
-double calc_ChiSq_SideBand(SideBand &sb, Double_t *par, int unv = 0, bool isPartial = false, int min_bin = 1, int max_bin = 1)
-{
-    if (!isPartial){
-        min_bin = 1;
-        max_bin = sb.data->GetNbinsX();
-    }
-    
-    if (min_bin == max_bin){
-        cout<<"Wrong Range for Fit"<<endl;
-        exit(EXIT_FAILURE);
-    }
-
-    double ChiSq = 0.0;
-
-    for (int i = 1; i <= max_bin; ++i) {
-        double nData = sb.data_all_universes[unv]->GetBinContent(i);
-        if (nData == 0) continue;
-
-        // Do not use Signal and Other in Fit
-        double nSignal = sb.signal_all_universes[unv]->GetBinContent(i) * sbtool.POT_ratio;
-        double nOther = sb.Other_all_universes[unv]->GetBinContent(i) * sbtool.POT_ratio;
+// Closed Form Fit is the default -- Set true to fit all universes with MIGRAD
+const bool isFitMigrad = false;
 
-        // par[] will be the weights associated with that background
-        double nWithPi0 = par[0] * sb.WithPi0_all_universes[unv]->GetBinContent(i) * sbtool.POT_ratio;
-        double nQELike = par[1] * sb.QELike_all_universes[unv]->GetBinContent(i) * sbtool.POT_ratio;
-        double nSinglePiPlus = par[2] * sb.SinglePiPlus_all_universes[unv]->GetBinContent(i) * sbtool.POT_ratio;
-        
-        double nTotalMC = nSignal + nWithPi0 + nQELike + nSinglePiPlus + nOther;
-
-        double delta  = std::pow((nData - nTotalMC),2)/nData;
-        ChiSq += delta;
+void FitMinuit(CCProtonPi0_SideBandFit &fit, bool isVerbose)
+{
+    if (isVerbose){
+        cout<<"======================================================================"<<endl;
+        cout<<"Universe = "<<fit.unv<<endl;
+        cout<<"======================================================================"<<endl;
     }
 
-    return ChiSq;
+    if (isFitMigrad) fit.Fit(isVerbose);
+    else fit.Solve();
 }
 
-void calc_ChiSq(Int_t &npar, Double_t *gin, Double_t &f, Double_t *par, Int_t iflag)
+// Validation -- MIGRAD on Central Value must agree with the Closed Form Fit
+void ValidateFit(CCProtonPi0_SideBandFit &fit)
 {
-    // Silence Unused Variable Warning
-    (void) npar;
-    (void) gin;
-    (void) iflag;
-
-    double ChiSq = 0;
-
-    // Calculate ChiSq for Michel for ALL Bins
-    ChiSq += calc_ChiSq_SideBand(sbtool.Michel, par, sbtool.current_unv);
-   
-    // Calculate ChiSq for pID for ALL Bins
-    ChiSq += calc_ChiSq_SideBand(sbtool.pID, par, sbtool.current_unv);
-
-    // Calculate ChiSq for Low Inv Mass 
-    //      Inv Mass itself for first 6 bins
-    ChiSq += calc_ChiSq_SideBand(sbtool.LowInvMass, par, sbtool.current_unv, true, 1, 6);
-    
-    // Calculate ChiSq for High Inv Mass
-    //      Inv Mass itself for last 30 bins
-    ChiSq += calc_ChiSq_SideBand(sbtool.HighInvMass, par, sbtool.current_unv, true, 21, 50);
-
-    f = ChiSq;
-    return;
+    CCProtonPi0_SideBandFit migrad(sbtool, fit.unv);
+    migrad.Fit(true);
+
+    CCProtonPi0_SideBandFit solved(sbtool, fit.unv);
+    solved.Solve();
+
+    cout<<std::left;
+    cout<<"Closed Form vs MIGRAD for Universe = "<<fit.unv<<endl;
+    cout<<"\tChiSq = "<<solved.min_ChiSq<<" vs "<<migrad.min_ChiSq<<endl;
+    std::string par_names[3] = {"WithPi0", "QELike", "SinglePiPlus"};
+    for (int i = 0; i < 3; ++i){
+        cout<<"\t"<<setw(14)<<par_names[i]<<solved.par_values[i]<<" +/- "<<solved.par_errors[i];
+        cout<<" vs "<<migrad.par_values[i]<<" +/- "<<migrad.par_errors[i]<<endl;
+    }
 }
 
-void FitMinuit()
+void Benchmark_SideBandChiSq()
 {
     cout<<"======================================================================"<<endl;
-    cout<<"Universe = "<<sbtool.current_unv<<endl;
+    cout<<"Benchmarking Side Band ChiSq..."<<endl;
     cout<<"======================================================================"<<endl;
-    
-    TMinuit *ptMinuit = new TMinuit(3);  //initialize TMinuit with a maximum of 3 params
-    //
-    //  select verbose level:
-    //    default :     (58 lines in this test)
-    //    -1 : minimum  ( 4 lines in this test)
-    //     0 : low      (31 lines)
-    //     1 : medium   (61 lines)
-    //     2 : high     (89 lines)
-    //     3 : maximum (199 lines in this test)
-    //
-    ptMinuit->SetPrintLevel();
-    // set the user function that calculates chi_square (the value to minimize)
-    ptMinuit->SetFCN(calc_ChiSq);
-
-    Double_t arglist[10];
-    Int_t ierflg = 0;
-
-    arglist[0] = 1;
-    ptMinuit->mnexcm("SET ERR", arglist ,1,ierflg);
-
-    // Set starting values and step sizes for parameters
-    //      Start from 1.0 and step 0.01
-    ptMinuit->mnparm(0, "WithPi0", 1.0, 0.01, 0.5, 2.0 , ierflg);
-    ptMinuit->mnparm(1, "QELike", 1.0, 0.01, 0.2, 2.0, ierflg);
-    ptMinuit->mnparm(2, "SinglePiPlus", 1.0, 0.01, 0.5, 2.0, ierflg);
-
-    // Now ready for minimization step
-    arglist[0] = 500;
-    arglist[1] = 1.;
-    ptMinuit->mnexcm("MIGRAD", arglist ,2,ierflg);
-
-    // Print results
-    std::cout<<"\nPrint results from minuit\n";
-    double fParamVal[3];
-    double fParamErr[3];
-    ptMinuit->GetParameter(0, fParamVal[0], fParamErr[0]);
-    std::cout << "WithPi0 = " << fParamVal[0] << "\n";
-    ptMinuit->GetParameter(1, fParamVal[1], fParamErr[1]);
-    std::cout << "QELike = " << fParamVal[1] << "\n";
-    ptMinuit->GetParameter(2, fParamVal[2], fParamErr[2]);
-    std::cout << "SinglePiPlus = " << fParamVal[2] << "\n";
-    
-    // if you want to access to these parameters, use:
-    Double_t min_ChiSq,edm,errdef;
-    Int_t nvpar,nparx,icstat;
-    ptMinuit->mnstat(min_ChiSq,edm,errdef,nvpar,nparx,icstat);
-    //void mnstat(Double_t &fmin, Double_t &fedm, Double_t &errdef, Int_t &npari, Int_t &nparx, Int_t &istat) 
-    //*-*-*-*-*Returns concerning the current status of the minimization*-*-*-*-*
-    //*-*      =========================================================
-    //*-*       User-called
-    //*-*          Namely, it returns:
-    //*-*        FMIN: the best function value found so far
-    //*-*        FEDM: the estimated vertical distance remaining to minimum
-    //*-*        ERRDEF: the value of UP defining parameter uncertainties
-    //*-*        NPARI: the number of currently variable parameters
-    //*-*        NPARX: the highest (external) parameter number defined by user
-    //*-*        ISTAT: a status integer indicating how good is the covariance
-    //*-*           matrix:  0= not calculated at all
-    //*-*                    1= approximation only, not accurate
-    //*-*                    2= full matrix, but forced positive-definite
-    //*-*                    3= full accurate covariance matrix
-    //*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*
-    
-    sbtool.SaveFitResults(min_ChiSq, fParamVal, fParamErr);
+    sbtool.Benchmark_ChiSq();
+}
 
-    // Plot only for Central Value
-    if (sbtool.current_unv == 0){
-        sbtool.ApplyFitResults();
-        sbtool.Plot();
+/*
+ *  Universe fits are independent -- Each worker process fits its own list of universes
+ *      Worker w fits universes w+1, w+1+nWorkers, ...
+ *      Results are written to the worker file and read back in universe order
+ */
+void FitUniverses_Parallel(int nWorkers, const double cv_par[3], std::vector<CCProtonPi0_SideBandFit*> &fits)
+{
+    std::string results_file = Folder_List::output + Folder_List::textOut + "SideBand_FitResults.txt";
+
+    std::cout.flush();
+    std::vector<pid_t> pids;
+    for (int w = 0; w < nWorkers; ++w){
+        pid_t pid = fork();
+        if (pid < 0){
+            cout<<"Cannot start Side Band Fit Worker "<<w<<"! Exiting!..."<<endl;
+            exit(1);
+        }
+
+        if (pid == 0){
+            std::string file_name = CCProtonPi0_NTupleAnalysis::GetPartitionFileName(results_file, w);
+            ofstream file(file_name.c_str());
+            if (!file.is_open()){
+                cout<<"Cannot open "<<file_name<<endl;
+                _exit(1);
+            }
+            file<<std::setprecision(17);
+            for (int unv = w+1; unv < sbtool.N_Universes; unv += nWorkers){
+                CCProtonPi0_SideBandFit* fit = fits[unv];
+                fit->SetStart(cv_par);
+                FitMinuit(*fit, false);
+                file<<fit->unv<<" "<<fit->min_ChiSq<<" "<<fit->edm<<" "<<fit->icstat;
+                for (int i = 0; i < 3; ++i) file<<" "<<fit->par_values[i]<<" "<<fit->par_errors[i];
+                for (int i = 0; i < 3; ++i){
+                    for (int j = 0; j < 3; ++j) file<<" "<<fit->cov[i][j];
+                }
+                file<<endl;
+            }
+            file.close();
+            std::cout.flush();
+            _exit(0);
+        }
+        pids.push_back(pid);
+    }
+
+    bool isFailed = false;
+    for (unsigned int w = 0; w < pids.size(); ++w){
+        int status;
+        waitpid(pids[w], &status, 0);
+        if (!WIFEXITED(status) || WEXITSTATUS(status) != 0){
+            cout<<"Side Band Fit Worker "<<w<<" Failed!"<<endl;
+            isFailed = true;
+        }
+    }
+    if (isFailed) exit(1);
+
+    for (int w = 0; w < nWorkers; ++w){
+        std::string file_name = CCProtonPi0_NTupleAnalysis::GetPartitionFileName(results_file, w);
+        ifstream file(file_name.c_str());
+        if (!file.is_open()){
+            cout<<"Cannot open "<<file_name<<"! Exiting!..."<<endl;
+            exit(1);
+        }
+
+        int unv;
+        while (file>>unv){
+            CCProtonPi0_SideBandFit* fit = fits[unv];
+            file>>fit->min_ChiSq>>fit->edm>>fit->icstat;
+            for (int i = 0; i < 3; ++i) file>>fit->par_values[i]>>fit->par_errors[i];
+            for (int i = 0; i < 3; ++i){
+                for (int j = 0; j < 3; ++j) file>>fit->cov[i][j];
+            }
+        }
+        file.close();
+        remove(file_name.c_str());
     }
-    
-    std::cout << "\n";
-    std::cout << " Minimum chi square = " << min_ChiSq<< "\n";
-    std::cout << " Estimated vert. distance to min. = " << edm << "\n";
-    std::cout << " Number of variable parameters = " << nvpar << "\n";
-    std::cout << " Highest number of parameters defined by user = " << nparx << "\n";
-    std::cout << " Status of covariance matrix = " << icstat << "\n";
-
-    std::cout << "\n";
-    ptMinuit->mnprin(1,min_ChiSq);
-    //*-*-*-*Prints the values of the parameters at the time of the call*-*-*-*-*
-    //*-*    ===========================================================
-    //*-*        also prints other relevant information such as function value,
-    //*-*        estimated distance to minimum, parameter errors, step sizes.
-    //*-*
-    //*-*         According to the value of IKODE, the printout is:
-    //*-*    IKODE=INKODE= 0    only info about function value
-    //*-*                  1    parameter values, errors, limits
-    //*-*                  2    values, errors, step sizes, internal values
-    //*-*                  3    values, errors, step sizes, first derivs.
-    //*-*                  4    values, parabolic errors, MINOS errors
-    //*-*    when INKODE=5, MNPRIN chooses IKODE=1,2, or 3, according to ISW(2)
-    //*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*
-
-    delete ptMinuit;
 }
 
-void FitSideBands()
+void FitSideBands(int nWorkers)
 {
     cout<<"======================================================================"<<endl;
     cout<<"Fitting Side Bands..."<<endl;
     cout<<"======================================================================"<<endl;
 
-    while(sbtool.current_unv < sbtool.N_Universes){
-        FitMinuit();
-        sbtool.current_unv++;
+    std::vector<CCProtonPi0_SideBandFit*> fits;
+    for (int unv = 0; unv < sbtool.N_Universes; ++unv){
+        fits.push_back(new CCProtonPi0_SideBandFit(sbtool, unv));
     }
 
-    sbtool.WriteStatistics();
-    sbtool.WriteFitResults();
+    // Central Value -- All universes start from the CV solution
+    FitMinuit(*fits[0], true);
+    ValidateFit(*fits[0]);
     
-}
+    // Universes
+    if (nWorkers > 1){
+        cout<<"Fitting "<<sbtool.N_Universes-1<<" Universes on "<<nWorkers<<" Workers"<<endl;
+        FitUniverses_Parallel(nWorkers, fits[0]->par_values, fits);
+    }else{
+        for (int unv = 1; unv < sbtool.N_Universes; ++unv){
+            fits[unv]->SetStart(fits[0]->par_values);
+            FitMinuit(*fits[unv], false);
+        }
+    }
+
+    // Results in universe order
+    for (int unv = 0; unv < sbtool.N_Universes; ++unv){
+        sbtool.current_unv = unv;
+        sbtool.SaveFitResults(fits[unv]->min_ChiSq, fits[unv]->par_values, fits[unv]->par_errors, fits[unv]->cov);
+
+        // Plot only for Central Value
+        if (unv == 0){
+            sbtool.ApplyFitResults();
+            sbtool.Plot();
+        }
+    }
 
+    sbtool.WriteStatistics();
+    sbtool.WriteFitResults();
 
+    for (unsigned int i = 0; i < fits.size(); ++i) delete fits[i];
+}
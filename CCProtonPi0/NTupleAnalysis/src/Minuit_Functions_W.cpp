@@ -1,14 +1,28 @@
 #include <iostream>
+#include <fstream>
 #include <cstdlib>
 #include <cmath>
 #include <string>
+#include <vector>
 #include <TFile.h>
 #include <TMinuit.h>
 #include <PlotUtils/MnvH1D.h>
 #include "../Libraries/Folder_List.h"
+#include "../Classes/WFitModel/CCProtonPi0_WFitModel.h"
 
 using namespace PlotUtils;
 
+// Bins used in the fit -- Read once, FCN does not touch the ROOT files
+struct WFitTemplates
+{
+    std::vector<double> data;       // Background Subtracted
+    std::vector<double> DeltaRES;   // Scaled with POT_ratio
+    std::vector<double> OtherRES;
+    std::vector<double> NonRES;
+};
+
+WFitTemplates W_templates;
+
 void NormalizeHistogram(MnvH1D* h)
 {
     int NBins = h->GetNbinsX();
@@ -18,24 +32,11 @@ void NormalizeHistogram(MnvH1D* h)
     h->Scale(1/(area+nOverFlow+nUnderFlow),"",false); // Scale only on CentralValue
 }
 
-void calc_ChiSq_W(Int_t &npar, Double_t *gin, Double_t &f, Double_t *par, Int_t iflag)
+MnvH1D* GetBckgSubtractedData_W(TFile* f_data, TFile* f_mc)
 {
-    // Silence Unused Variable Warning
-    (void) npar;
-    (void) gin;
-    (void) iflag;
-    
-    double data_POT = 3.33153e+20;
-    double mc_POT = 2.21867e+21; 
-    double POT_ratio = data_POT/mc_POT;
-
-    double ChiSq = 0.0;
-
-    // Get Background Subtracted Data
-    TFile* f_data = new TFile(Folder_List::rootDir_Interaction_data.c_str());
-    TFile* f_mc = new TFile(Folder_List::rootDir_Interaction_mc.c_str());
     MnvH1D* data = new MnvH1D( * dynamic_cast<MnvH1D*>(f_data->Get("W_All_0")) );
     MnvH1D* mc_bckg = new MnvH1D( * dynamic_cast<MnvH1D*>(f_mc->Get("W_All_2")) );
+    data->SetDirectory(NULL);
 
     NormalizeHistogram(mc_bckg);
     
@@ -43,43 +44,153 @@ void calc_ChiSq_W(Int_t &npar, Double_t *gin, Double_t &f, Double_t *par, Int_t
     mc_bckg->Scale(nBckg);
 
     data->Add(mc_bckg, -1); 
-   
+    delete mc_bckg;
+
+    return data;
+}
+
+void Fill_W_Template(std::vector<double> &bins, TFile* f, std::string var_name, double scale)
+{
+    MnvH1D* h = dynamic_cast<MnvH1D*>(f->Get(var_name.c_str()));
+    if (h == NULL){
+        std::cout<<"Cannot find "<<var_name<<" for W Fit! Exiting!..."<<std::endl;
+        exit(1);
+    }
+
+    bins.clear();
+    for (int i = 1; i <= h->GetNbinsX(); ++i) bins.push_back(h->GetBinContent(i) * scale);
+}
+
+void Load_W_Templates(TFile* f_data, TFile* f_mc)
+{
+    double data_POT = 3.33153e+20;
+    double mc_POT = 2.21867e+21; 
+    double POT_ratio = data_POT/mc_POT;
+
+    // Get Background Subtracted Data
+    MnvH1D* data = GetBckgSubtractedData_W(f_data, f_mc);
+    W_templates.data.clear();
+    for (int i = 1; i <= data->GetNbinsX(); ++i) W_templates.data.push_back(data->GetBinContent(i));
+    delete data;
+
     // Get MC Signal Types
-    MnvH1D* mc_DeltaRES = new MnvH1D( * dynamic_cast<MnvH1D*>(f_mc->Get("W_All_7")) );
-    MnvH1D* mc_OtherRES = new MnvH1D( * dynamic_cast<MnvH1D*>(f_mc->Get("W_All_8")) );
-    MnvH1D* mc_NonRES = new MnvH1D( * dynamic_cast<MnvH1D*>(f_mc->Get("W_All_9")) );
+    Fill_W_Template(W_templates.DeltaRES, f_mc, "W_All_7", POT_ratio);
+    Fill_W_Template(W_templates.OtherRES, f_mc, "W_All_8", POT_ratio);
+    Fill_W_Template(W_templates.NonRES, f_mc, "W_All_9", POT_ratio);
+}
 
-    int nBins = data->GetNbinsX(); 
+/*
+ *  nTotalMC is linear in the weights
+ *      dChiSq/dpar_k = -2 * sum_i (nData - nTotalMC) * n_k / nData
+ */
+void calc_ChiSq_W(Int_t &npar, Double_t *gin, Double_t &f, Double_t *par, Int_t iflag)
+{
+    // Silence Unused Variable Warning
+    (void) npar;
 
-    for (int i = 1; i <= nBins ; ++i) {
-        double nData = data->GetBinContent(i);
+    const WFitTemplates &t = W_templates;
+    bool isGradient = iflag == 2;
+    if (isGradient){
+        for (int k = 0; k < 3; ++k) gin[k] = 0.0;
+    }
+
+    double ChiSq = 0.0;
+    int nBins = t.data.size(); 
+
+    for (int i = 0; i < nBins ; ++i) {
+        double nData = t.data[i];
         if (nData == 0) continue;
 
         // par[] will be the weights associated with that background
-        double nDeltaRES = par[0] * mc_DeltaRES->GetBinContent(i) * POT_ratio;
-        double nOtherRES = par[1] * mc_OtherRES->GetBinContent(i) * POT_ratio;
-        double nNonRES = par[2] * mc_NonRES->GetBinContent(i) * POT_ratio;
+        double nDeltaRES = par[0] * t.DeltaRES[i];
+        double nOtherRES = par[1] * t.OtherRES[i];
+        double nNonRES = par[2] * t.NonRES[i];
         
         double nTotalMC = nDeltaRES + nOtherRES + nNonRES;
 
         double delta  = std::pow((nData - nTotalMC),2)/nData;
         ChiSq += delta;
-    }
 
-    delete data;
-    delete mc_bckg;
-    delete mc_DeltaRES; 
-    delete mc_OtherRES; 
-    delete mc_NonRES; 
-    delete f_data;
-    delete f_mc;
+        if (isGradient){
+            double factor = -2.0 * (nData - nTotalMC) / nData;
+            gin[0] += factor * t.DeltaRES[i];
+            gin[1] += factor * t.OtherRES[i];
+            gin[2] += factor * t.NonRES[i];
+        }
+    }
 
     f = ChiSq;
     return;
 }
 
+/*
+ *  Resonance Model Fit to Background Subtracted Data -- Run Mode fitWModel
+ *      Starts from the fit to MC (Same values as Plotter::init_W_FitResults())
+ *      Non-RES is fixed to MC, bins 7-26 (Last 4 bins are zero)
+ *      Central Value first, then all universes of the data with the same model
+ */
+void FitModel_W(MnvH1D* data)
+{
+    double start[CCProtonPi0_WFitModel::nPars] = {
+        31.47, 1.215, 0.246,        // DeltaRES
+        68.48, 1.473, 0.2864,       // OtherRES
+        28.66, 1.197, 0.1498,       // NonRES G1
+        55.57, 1.439, 0.3686};      // NonRES G2
+
+    // Last 4 bins are zero ( W > 1.8 GeV)
+    CCProtonPi0_WFitModel model;
+    model.SetBins(data, 7, 26);
+    model.SetStart(start);
+    for (int i = 6; i < CCProtonPi0_WFitModel::nPars; ++i) model.FixParameter(i);
+
+    model.SetData(data);
+    model.Fit(true);
+
+    std::string file_name = Folder_List::output + Folder_List::textOut + "W_Fit_Universes.txt";
+    std::ofstream file(file_name.c_str());
+    if (!file.is_open()){
+        std::cout<<"Cannot open "<<file_name<<std::endl;
+        return;
+    }
+    file<<"Band Universe ChiSq DeltaRES_N DeltaRES_M DeltaRES_G OtherRES_N OtherRES_Mean OtherRES_Sigma"<<std::endl;
+
+    // Universes start from the Central Value solution
+    model.SetStart(model.par_values);
+
+    std::vector<std::string> vert_names = data->GetVertErrorBandNames();
+    for (unsigned int b = 0; b < vert_names.size(); ++b){
+        std::vector<TH1D*> universes = data->GetVertErrorBand(vert_names[b])->GetHists();
+        for (unsigned int u = 0; u < universes.size(); ++u){
+            model.SetData(universes[u]);
+            model.Fit(false);
+            file<<vert_names[b]<<" "<<u<<" "<<model.min_ChiSq;
+            for (int i = 0; i < 6; ++i) file<<" "<<model.par_values[i];
+            file<<std::endl;
+        }
+    }
+
+    std::vector<std::string> lat_names = data->GetLatErrorBandNames();
+    for (unsigned int b = 0; b < lat_names.size(); ++b){
+        std::vector<TH1D*> universes = data->GetLatErrorBand(lat_names[b])->GetHists();
+        for (unsigned int u = 0; u < universes.size(); ++u){
+            model.SetData(universes[u]);
+            model.Fit(false);
+            file<<lat_names[b]<<" "<<u<<" "<<model.min_ChiSq;
+            for (int i = 0; i < 6; ++i) file<<" "<<model.par_values[i];
+            file<<std::endl;
+        }
+    }
+
+    file.close();
+    std::cout<<"W Fit Results for Universes: "<<file_name<<std::endl;
+}
+
 void FitMinuit_W()
 {
+    TFile* f_data = new TFile(Folder_List::rootDir_Interaction_data.c_str());
+    TFile* f_mc = new TFile(Folder_List::rootDir_Interaction_mc.c_str());
+    Load_W_Templates(f_data, f_mc);
+
     TMinuit *ptMinuit = new TMinuit(3);  //initialize TMinuit with a maximum of 3 params
     //
     //  select verbose level:
@@ -100,6 +211,10 @@ void FitMinuit_W()
     arglist[0] = 1;
     ptMinuit->mnexcm("SET ERR", arglist ,1,ierflg);
 
+    // Analytic gradient -- Do not check against numerical derivatives
+    arglist[0] = 1;
+    ptMinuit->mnexcm("SET GRAD", arglist ,1,ierflg);
+
     // Set starting values and step sizes for parameters
     //      Start from 1.0 and step 0.01
     ptMinuit->mnparm(0, "DeltaRES", 1.0, 0.01, 0.5, 2.0, ierflg);
@@ -168,5 +283,19 @@ void FitMinuit_W()
     //*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*-*
 
     delete ptMinuit;
+    delete f_data;
+    delete f_mc;
 }
 
+void FitModel_W_Universes()
+{
+    TFile* f_data = new TFile(Folder_List::rootDir_Interaction_data.c_str());
+    TFile* f_mc = new TFile(Folder_List::rootDir_Interaction_mc.c_str());
+
+    MnvH1D* data = GetBckgSubtractedData_W(f_data, f_mc);
+    FitModel_W(data);
+
+    delete data;
+    delete f_data;
+    delete f_mc;
+}
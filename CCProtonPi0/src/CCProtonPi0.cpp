@@ -3265,7 +3265,7 @@ void CCProtonPi0::Calculate_dEdx( Minerva::PhysicsEvent* event, const Minerva::I
     debug() << "Calculate dEdx for blob: " << blob_number <<  " (forward,backward) ("
         << (blob->direction().Z() > 0) << "," << (blob->direction().Z() < 0) << ")"
         << endmsg;
-    std::map<int, std::vector<double> > planeClusterEnergyMap;
+    BlobProfile planeProfile(BlobProfile::nMaxBins, 1.0); // one bin per plane
     SmartRefVector<Minerva::IDCluster> clusters = blob->clusters();
 
     debug()<<"Vertex to increasingDistanceFromVertex = ("<<vtx_position.X()<<","<<vtx_position.Y()<<","<<vtx_position.Z()<<")"<<endmsg;
@@ -3279,7 +3279,9 @@ void CCProtonPi0::Calculate_dEdx( Minerva::PhysicsEvent* event, const Minerva::I
         unsigned int module = planeId.module();
         const unsigned int planeNo = 2*module + plane;
 
-        planeClusterEnergyMap[planeNo].push_back((*c)->energy());
+        if (!planeProfile.FillBin(planeNo, (*c)->energy())) {
+            warning()<<"Plane "<<planeNo<<" is outside the dEdx profile"<<endmsg;
+        }
     }
 
 
@@ -3291,40 +3293,34 @@ void CCProtonPi0::Calculate_dEdx( Minerva::PhysicsEvent* event, const Minerva::I
     bool doublet     = false;
     bool empty_plane = false;
 
-    for ( std::map<int, std::vector<double> >::iterator pl = planeClusterEnergyMap.begin(); pl != planeClusterEnergyMap.end(); ++pl) {
-        const int plane = pl->first;
-        const std::vector<double>& clusterEnergies = pl->second;
-
-        std::map<int, std::vector<double> >::iterator next_pl = pl; ++next_pl;
-        const int next_plane = next_pl->first;
+    int nPlane = 0;
+    for (int plane = planeProfile.GetFirstFilledBin(); plane >= 0; plane = planeProfile.GetNextFilledBin(plane)) {
+        const int next_plane = planeProfile.GetNextFilledBin(plane);
 
-        const double total_plane_energy = std::accumulate(clusterEnergies.begin(), clusterEnergies.end(), 0.0);
-        blob_cluster_occupancy.push_back(clusterEnergies.size());
+        const double total_plane_energy = planeProfile.GetBinContent(plane);
+        blob_cluster_occupancy.push_back(planeProfile.GetBinEntries(plane));
         blob_cluster_energy.push_back(total_plane_energy);
 
         total += total_plane_energy;
-        if (pl != planeClusterEnergyMap.begin()) total1 += total_plane_energy;
+        if (nPlane > 0) total1 += total_plane_energy;
 
-        if (clusterEnergies.size() > 1)     doublet = true;
+        if (planeProfile.GetBinEntries(plane) > 1) doublet = true;
 
-        if (next_pl != planeClusterEnergyMap.end() &&
-                std::abs(next_plane-plane) > 1) empty_plane = true;
+        if (next_plane >= 0 && std::abs(next_plane-plane) > 1) empty_plane = true;
 
-        if (std::distance(planeClusterEnergyMap.begin(),pl) > 4) break;
+        if (nPlane > 4) break;
+        ++nPlane;
     }
 
     // Less complicated logic for cluster energies from the shower back since
     // I'm not making plot for the NIM paper!
     std::vector<double> blob_rev_cluster_energy; // cluster energies from the shower back (rev. for reverse)
-    std::map<int, std::vector<double> >::reverse_iterator pl; 
-    for ( std::map<int, std::vector<double> >::reverse_iterator pl = planeClusterEnergyMap.rbegin(); pl != planeClusterEnergyMap.rend(); ++pl) {
-        const std::vector<double>& clusterEnergies = pl->second;
-        const double total_plane_energy = std::accumulate(clusterEnergies.begin(), clusterEnergies.end(), 0.0);
-        blob_rev_cluster_energy.push_back(total_plane_energy);
+    for (int plane = planeProfile.GetLastFilledBin(); plane >= 0; plane = planeProfile.GetPreviousFilledBin(plane)) {
+        blob_rev_cluster_energy.push_back(planeProfile.GetBinContent(plane));
     }
 
     if (blob_number == 1) {
-        event->setIntData("g1dedx_nplane", planeClusterEnergyMap.size());
+        event->setIntData("g1dedx_nplane", planeProfile.GetNFilledBins());
         event->setIntData("g1dedx_doublet", (int) doublet);
         event->setIntData("g1dedx_empty_plane", (int) empty_plane);
         event->setDoubleData("g1dedx_total", total);
@@ -3337,7 +3333,7 @@ void CCProtonPi0::Calculate_dEdx( Minerva::PhysicsEvent* event, const Minerva::I
     }
 
     if (blob_number == 2) {
-        event->setIntData("g2dedx_nplane", planeClusterEnergyMap.size());
+        event->setIntData("g2dedx_nplane", planeProfile.GetNFilledBins());
         event->setIntData("g2dedx_doublet", (int) doublet);
         event->setIntData("g2dedx_empty_plane", (int) empty_plane);
         event->setDoubleData("g2dedx_total", total);
@@ -52,6 +52,7 @@ Author:         Ozgur Altinok  - ozgur.altinok@tufts.edu
 #include "Pi0Reco/AngleScan.h"
 #include "Pi0Reco/AngleScan_U.h"
 #include "Pi0Reco/AngleScan_V.h"
+#include "Pi0Reco/BlobProfile.h"
 #include "Pi0Reco/ClusterVectorInfo.h"
 #include "Pi0Reco/OneParLineFit.h"
 #include "Pi0Reco/TwoParLineFit.h"
@@ -1,115 +1,22 @@
 #ifndef cc1pi0_AngleScan_h
 #define cc1pi0_AngleScan_h
 
-#include <functional>
+#include "AngleScanEngine.h"
 
-#include <TVector2.h>
-
-#include <Event/MinervaEventFwd.h>
-
-
-class TH1F;
-
-class AngleScan {
+/// Angle scan seeded in the X view -- See AngleScanEngine
+class AngleScan : public AngleScanEngine {
   public:
-    
-    typedef SmartRefVector<Minerva::IDCluster> ShowerCand;
-    
-    AngleScan(const SmartRefVector<Minerva::IDCluster>& clusters, const Gaudi::XYZPoint& vertex);
-    void DoReco();
 
-    const std::vector<TVector2>& GetPeaks() const;
-    const std::vector<TVector2>& GetGoodPeaks() const;
+    AngleScan(const SmartRefVector<Minerva::IDCluster>& clusters, const Gaudi::XYZPoint& vertex);
 
     const std::vector<double>& GetXShowerClosestDistances() const;
     const std::vector<double>& GetXShowerWeightedDistances() const;
-    
+
     unsigned int GetNxCandidate() const;
-    unsigned int GetNCandidate() const;
 
     const std::vector<SmartRefVector<Minerva::IDCluster> >& GetXShowerCandVector() const;
-    const std::vector<SmartRefVector<Minerva::IDCluster> >& GetShowerCandVector() const;
-    std::vector<Minerva::IDBlob*>  GetShowers();
-
-    const SmartRefVector<Minerva::IDCluster>& GetXClusters() const;
-    const SmartRefVector<Minerva::IDCluster>& GetUClusters() const;
-    const SmartRefVector<Minerva::IDCluster>& GetVClusters() const;
 
-    const SmartRefVector<Minerva::IDCluster>& GetUnusedClusters() const;
-    const SmartRefVector<Minerva::IDCluster>& GetUnusedXClusters() const;
-    const SmartRefVector<Minerva::IDCluster>& GetUnusedUClusters() const;
-    const SmartRefVector<Minerva::IDCluster>& GetUnusedVClusters() const;        
-
-    void SetUVMatchTolerance(double epsilon);
-    void SetUVMatchMoreTolerance(double big_epsilon);
-    void AllowUVMatchWithMoreTolerance(bool b);
-    void AllowSmallConeAngle(bool isSmallAngle);
-  
-  private:
-    void Initialize();
-    void BuildThetaHistogram();
-    void FillThetaHistogram();
-    void FindPeaks();
-    
-    void FormXShowerCand();
-    void FormXUVShowerCand();
-    void CleanAllShowerCand();
-    
-    int GetLimitBin(const TH1F *hMax, int n_bin )const;
-
-    void addClustersToBlob(SmartRefVector<Minerva::IDCluster>& xshowerCand,
-                           SmartRefVector<Minerva::IDCluster>& uclusters,
-                           SmartRefVector<Minerva::IDCluster>& vclusters,
-                           SmartRefVector<Minerva::IDCluster>& showerCand,
-                           double epsilon);
-
-    void completeView(SmartRefVector<Minerva::IDCluster>& unusedViewClusters,
-                      SmartRefVector<Minerva::IDCluster>& showerCand,
-                      double vtxT);
-    
-    void coneView(SmartRefVector<Minerva::IDCluster>& unusedViewClusters,
-                  SmartRefVector<Minerva::IDCluster>& showerCand,
-                  double vtxT,
-                  double min_angle, double max_angle,
-                  double zmin, double zmax);   
-    
-    SmartRefVector<Minerva::IDCluster> fAllClusters;
-    SmartRefVector<Minerva::IDCluster> fXClusters;
-    SmartRefVector<Minerva::IDCluster> fUClusters;
-    SmartRefVector<Minerva::IDCluster> fVClusters;
-    
-    SmartRefVector<Minerva::IDCluster> fRemainingClusters;
-    SmartRefVector<Minerva::IDCluster> fRemainingXClusters;
-    SmartRefVector<Minerva::IDCluster> fRemainingUClusters;
-    SmartRefVector<Minerva::IDCluster> fRemainingVClusters;
-    
-    double fX;
-    double fY;
-    double fZ;
-    double fU;
-    double fV;
-    
-    TH1F* fTheta;
-    std::vector<TVector2> fPeaks;
-    std::vector<TVector2> fGoodPeaks; /// peaks in the angular distributon that
-                                      /// produce shower candidates in the X view
-
-    std::vector<double> fXShowerClosestDistances;
-    std::vector<double> fXShowerWeightedDistances;
-    
-    std::vector<ShowerCand> fShowerCandidates;
-    std::vector<ShowerCand> fXShowerCandidates;
-
-    unsigned int nBins;
-    double theta_low;
-    double theta_high;
-
-    // Data member controlling the algorithm behaviors
-    double fUVMatchTolerance;
-    double fUVMatchMoreTolerance;
-    bool   fAllowUVMatchWithMoreTolerance;
-    bool m_UseSmallConeAngle;
+    using AngleScanEngine::AllowSmallConeAngle;
 };
 
-#endif 
-
+#endif
@@ -0,0 +1,425 @@
+#include <cmath>
+#include <algorithm>
+
+#include "AngleScanCore.h"
+
+namespace {
+    struct greaterShower {
+        bool operator()(const std::vector<unsigned int>& lhs,
+                        const std::vector<unsigned int>& rhs) const {
+
+            return lhs.size() > rhs.size();
+        }
+    };
+}
+
+AngleScanCore::AngleScanCore()
+: fSeedView(0),
+    fZRangeView(0),
+    nBins(0),
+    theta_low(-180.0),
+    theta_high(180.0),
+    fUVMatchTolerance(10.0),
+    fUVMatchMoreTolerance(100.0),
+    fAllowUVMatchWithMoreTolerance(true),
+    m_UseSmallConeAngle(false)
+{
+    fOtherViews[0] = 1;
+    fOtherViews[1] = 2;
+}
+
+void AngleScanCore::Run(const std::vector<RecoCluster>& clusters, const RecoKernels::ViewPoint& vertex, int seedView)
+{
+    fSeedView = seedView;
+
+    // completeView() takes the z range from the seed view clusters,
+    // except for the V seed, AngleScan_V has always used the U clusters
+    fZRangeView = fSeedView;
+    if (fSeedView == RecoCluster::V) fZRangeView = RecoCluster::U;
+
+    // Other views are always completed in X, U, V order
+    unsigned int n = 0;
+    for (unsigned int view = 0; view < nViews; ++view) {
+        if (view != fSeedView) fOtherViews[n++] = view;
+    }
+
+    fIndex.Build(clusters, vertex);
+    fUsed.assign(fIndex.GetN(), false);
+
+    fPeaks.clear();
+    fGoodPeaks.clear();
+    fSeedShowerClosestDistances.clear();
+    fSeedShowerWeightedDistances.clear();
+    fSeedCandidates.clear();
+    fCandidates.clear();
+
+    FillThetaHistogram();
+    FindPeaks();
+    FormSeedShowerCand();
+    FormXUVShowerCand();
+}
+
+void AngleScanCore::FillThetaHistogram()
+{
+    if (m_UseSmallConeAngle) nBins = 180;
+    else nBins = 90;
+
+    theta_low = -180.0;
+    theta_high = 180.0;
+
+    std::fill(fTheta, fTheta + nBins + 2, 0.0f);
+
+    // Same binning and single precision sum as TH1F::Fill()
+    const std::vector<unsigned int>& seedClusters = fIndex.GetViewClusters(fSeedView);
+    for (unsigned int i = 0; i < seedClusters.size(); ++i) {
+        if (fUsed[seedClusters[i]]) continue;
+
+        const double theta = fIndex.GetAngle(seedClusters[i]);
+        const double w = fIndex.GetCluster(seedClusters[i]).pe;
+
+        unsigned int bin;
+        if (theta < theta_low) bin = 0;
+        else if (!(theta < theta_high)) bin = nBins + 1;
+        else bin = 1 + int(nBins*(theta - theta_low)/(theta_high - theta_low));
+
+        fTheta[bin] += float(w);
+    }
+}
+
+void AngleScanCore::FindPeaks()
+{
+    /* Detect and save lower and upper edges around peaks in the histogram */
+    const double width = (theta_high - theta_low)/double(nBins);
+    for (unsigned int bin = 1; bin <= nBins; bin++){
+        if (fTheta[bin] > 15 ){                       /* Peak is detected */
+            int Limitbin = GetLimitBin(bin);          /* Find the upper edge of the peak */
+
+            const double lower_edge = GetBinCenter(bin) - 0.5*width;
+            const double upper_edge = GetBinCenter(Limitbin) + 0.5*width;
+
+            fPeaks.push_back(Peak(lower_edge,upper_edge));
+
+            bin = Limitbin;  /* Finding the next peak starting from this peak's upper edge */
+        }
+    }
+}
+
+void AngleScanCore::FormSeedShowerCand()
+{
+    for (std::vector<Peak>::const_iterator peak = fPeaks.begin();
+            peak != fPeaks.end(); ++peak) {
+        const double lower_edge = peak->first;
+        const double upper_edge = peak->second;
+        const double zmin       = 4500.0;
+        const double zmax       = 10000.0;
+
+        Candidate showerCand;
+        coneView(fSeedView, showerCand, lower_edge, upper_edge, zmin, zmax);
+
+        if (showerCand.empty()) continue;
+
+        if (showerCand.size() == 1 && fIndex.GetCluster(showerCand.front()).pe > 30) {
+
+            fSeedCandidates.push_back(showerCand);
+            fGoodPeaks.push_back(*peak);
+
+        } else if (showerCand.size() > 1) {
+
+            fSeedCandidates.push_back(showerCand);
+            fGoodPeaks.push_back(*peak);
+        }
+
+    }
+
+    // Calculate the distance from the shower candidates to the event vertex
+    // Try two definitions of distance: closest and energy weighted
+    const double vtxT = fIndex.GetVertex().t[fSeedView];
+    const double vtxZ = fIndex.GetVertex().z;
+    for (std::vector<Candidate>::const_iterator s = fSeedCandidates.begin();
+            s != fSeedCandidates.end(); ++s) {
+
+        double d_min = 1.e6;
+        double d_weighted = 0.0;
+        double total_energy = 0.0;
+        for (Candidate::const_iterator i = s->begin(); i != s->end(); ++i) {
+            const RecoCluster& c = fIndex.GetCluster(*i);
+
+            double t = c.position;
+            double z = c.z;
+            double d = std::sqrt(std::pow(t-vtxT,2) + std::pow(z-vtxZ,2));
+
+            if (d < d_min) {
+                d_min = d;
+            }
+
+            d_weighted   += d * c.energy;
+            total_energy += c.energy;
+        }
+
+        fSeedShowerClosestDistances.push_back(d_min);
+        fSeedShowerWeightedDistances.push_back(d_weighted/total_energy);
+    }
+
+    std::sort(fSeedCandidates.begin(),fSeedCandidates.end(), greaterShower());
+
+}
+
+void AngleScanCore::FormXUVShowerCand()
+{
+    std::vector<Candidate> nogrowShowerCandidates;
+    for (std::vector<Candidate>::const_iterator s = fSeedCandidates.begin();
+            s != fSeedCandidates.end(); ++s) {
+        const Candidate& seedShowerCand = *s;
+
+        Candidate showerCand = seedShowerCand;
+        double zmin = +1e6;
+        double zmax = -1e6;
+        double ztot = 0.0;
+        for (Candidate::const_iterator i = seedShowerCand.begin(); i != seedShowerCand.end(); ++i) {
+            const double z = fIndex.GetCluster(*i).z;
+            zmin  = std::min(zmin,z);
+            zmax  = std::max(zmax,z);
+            ztot += z;
+        }
+
+        if (zmax-zmin < 50.0) {
+            // Candidate with small z extent -- Add all other view clusters around its z
+            const double zcenter = ztot/seedShowerCand.size();
+            for (unsigned int k = 0; k < 2; ++k) {
+                const std::vector<unsigned int>& viewClusters = fIndex.GetViewClusters(fOtherViews[k]);
+                for (unsigned int i = 0; i < viewClusters.size(); ++i) {
+                    const unsigned int c = viewClusters[i];
+                    if (!fUsed[c] && std::abs(fIndex.GetCluster(c).z-zcenter) < 50.0) TakeCluster(c, showerCand);
+                }
+            }
+
+            fCandidates.push_back(showerCand);
+
+        } else {
+            addClustersToBlob(seedShowerCand,fOtherViews[0],fOtherViews[1],showerCand,
+                    fUVMatchTolerance);
+
+            if (showerCand.size() > seedShowerCand.size()) fCandidates.push_back(showerCand);
+            else if (seedShowerCand.size() >= 3) nogrowShowerCandidates.push_back(seedShowerCand);
+        }
+    }
+
+    if (fAllowUVMatchWithMoreTolerance) {
+        for (std::vector<Candidate>::const_iterator s = nogrowShowerCandidates.begin();
+                s != nogrowShowerCandidates.end(); ++s) {
+            Candidate showerCand = *s;
+
+            addClustersToBlob(*s,fOtherViews[0],fOtherViews[1],showerCand,
+                    fUVMatchMoreTolerance);
+
+            fCandidates.push_back(showerCand);
+        }
+    }
+
+    for (std::vector<Candidate>::iterator s = fCandidates.begin(); s != fCandidates.end(); ++s) {
+        completeView(fOtherViews[0], *s);
+        completeView(fOtherViews[1], *s);
+    }
+
+    std::sort(fCandidates.begin(), fCandidates.end(), greaterShower());
+}
+
+int AngleScanCore::GetLimitBin(int n_bin) const
+{
+    // Bins outside the histogram are empty
+    const int nCells = nBins + 2;
+
+    int max=n_bin, x = 1, count = 0;
+    while ( count < 1 ){
+        if ( n_bin + x < nCells && fTheta[n_bin + x] > 0 ) max = n_bin + x;
+        else count++;
+        x++;
+    }
+
+    return max;
+}
+
+/// Same arithmetic as TAxis::GetBinCenter()
+double AngleScanCore::GetBinCenter(int bin) const
+{
+    const double width = (theta_high - theta_low)/double(nBins);
+    return theta_low + (bin-1)*width + 0.5*width;
+}
+
+void AngleScanCore::TakeCluster(unsigned int i, Candidate& showerCand)
+{
+    showerCand.push_back(i);
+    fUsed[i] = true;
+}
+
+/// Unused clusters with !(|z - c.z| > dz), in no particular order
+void AngleScanCore::FindZMatches(unsigned int view, double z, double dz, std::vector<unsigned int>& matches) const
+{
+    // Window is padded by 1 mm, the exact test decides
+    fIndex.FindInZRange(view, z - dz - 1.0, z + dz + 1.0, matches);
+
+    unsigned int n = 0;
+    for (unsigned int i = 0; i < matches.size(); ++i) {
+        const unsigned int c = matches[i];
+        if (!fUsed[c] && !(std::abs( z - fIndex.GetCluster(c).z ) > dz)) matches[n++] = c;
+    }
+    matches.resize(n);
+}
+
+void AngleScanCore::addClustersToBlob(const Candidate& seedShowerCand,
+        unsigned int uview,
+        unsigned int vview,
+        Candidate& showerCand,
+        double epsilon)
+{
+    for (Candidate::const_iterator c = seedShowerCand.begin(); c != seedShowerCand.end(); ++c) {
+        const RecoCluster& cluster_x = fIndex.GetCluster(*c);
+
+        // Unused clusters within 50 mm in z
+        FindZMatches(uview, cluster_x.z, 50.0, fUMatches);
+        if (fUMatches.empty()) continue;
+
+        FindZMatches(vview, cluster_x.z, 50.0, fVMatches);
+        if (fVMatches.empty()) continue;
+
+        // Ties go to the first U, then the first V cluster in the original
+        // order, as a scan of the unused lists would pick them
+        double min = 1e3;
+        int ucluster = -1;
+        int vcluster = -1;
+        for (unsigned int iU = 0; iU < fUMatches.size(); ++iU) {
+            const int u_index = fUMatches[iU];
+            const RecoCluster& u = fIndex.GetCluster(u_index);
+            for (unsigned int iV = 0; iV < fVMatches.size(); ++iV) {
+                const int v_index = fVMatches[iV];
+                const RecoCluster& v = fIndex.GetCluster(v_index);
+
+                double delta = std::abs(u.tpos1+u.tpos2+        /* |u+v-x| */
+                        v.tpos1+v.tpos2-
+                        cluster_x.tpos1-cluster_x.tpos2);
+                if ( delta < min ||
+                     (delta == min && ucluster >= 0 &&
+                      (u_index < ucluster || (u_index == ucluster && v_index < vcluster))) ) {
+                    min = delta;
+                    ucluster = u_index;
+                    vcluster = v_index;
+                }
+            }
+        }
+
+        if (min <= epsilon && (ucluster >= 0 && vcluster >= 0)) {
+            TakeCluster(ucluster, showerCand);
+            TakeCluster(vcluster, showerCand);
+        }
+
+    }
+
+}
+
+void AngleScanCore::completeView(unsigned int view,
+        Candidate& showerCand)
+{
+    bool hasUnused = false;
+    const std::vector<unsigned int>& viewClusters = fIndex.GetViewClusters(view);
+    for (unsigned int i = 0; i < viewClusters.size() && !hasUnused; ++i) hasUnused = !fUsed[viewClusters[i]];
+    if (!hasUnused) return;
+
+    double z_min = 10000;
+    double z_max = -10000;
+    double angle_min = 180;
+    double angle_max = -180;
+    bool hasViewCluster = false;
+
+    for (Candidate::const_iterator i = showerCand.begin(); i != showerCand.end(); ++i){
+        const RecoCluster& c = fIndex.GetCluster(*i);
+        if ( c.view == int(view) ) {
+            hasViewCluster = true;
+
+            const double ang = fIndex.GetAngle(*i);
+            if ( ang >= angle_max ) angle_max = ang;
+            if ( ang <= angle_min ) angle_min = ang;
+        }
+        if ( c.view == int(fZRangeView) && c.z < z_min ) z_min = c.z;
+        if ( c.view == int(fZRangeView) && c.z > z_max ) z_max = c.z;
+    }
+
+    if (!hasViewCluster) return;
+
+    z_min = z_min - 100;
+    z_max = z_max + 100;
+    angle_max = angle_max + 10.0;
+    angle_min = angle_min - 10.0;
+
+    /* Move clusters between (angle_min,angle_max) and (z_min,z_max) from
+       'unusedClusters' to blob */
+    coneView(view, showerCand, angle_min, angle_max, z_min, z_max );
+}
+
+void AngleScanCore::coneView(unsigned int view,
+        Candidate& showerCand,
+        double min_angle, double max_angle,
+        double zmin, double zmax)
+{
+    // Clusters are sorted by angle in the index -- Cone is a binary search
+    fIndex.FindInAngleRange(view, min_angle, max_angle, fMatches);
+
+    unsigned int n = 0;
+    for (unsigned int i = 0; i < fMatches.size(); ++i) {
+        const unsigned int c = fMatches[i];
+        const double z = fIndex.GetCluster(c).z;
+        if (!fUsed[c] && (zmin < z && z < zmax)) fMatches[n++] = c;
+    }
+    fMatches.resize(n);
+
+    // Keep the original cluster order in the candidate
+    std::sort(fMatches.begin(), fMatches.end());
+    for (unsigned int i = 0; i < fMatches.size(); ++i) TakeCluster(fMatches[i], showerCand);
+}
+
+const ClusterIndex& AngleScanCore::GetIndex() const {
+    return fIndex;
+}
+
+bool AngleScanCore::IsUsed(unsigned int i) const {
+    return fUsed[i];
+}
+
+const std::vector<AngleScanCore::Peak>& AngleScanCore::GetPeaks() const {
+    return fPeaks;
+}
+
+const std::vector<AngleScanCore::Peak>& AngleScanCore::GetGoodPeaks() const {
+    return fGoodPeaks;
+}
+
+const std::vector<double>& AngleScanCore::GetSeedShowerClosestDistances() const {
+    return fSeedShowerClosestDistances;
+}
+
+const std::vector<double>& AngleScanCore::GetSeedShowerWeightedDistances() const {
+    return fSeedShowerWeightedDistances;
+}
+
+const std::vector<AngleScanCore::Candidate>& AngleScanCore::GetSeedCandidates() const {
+    return fSeedCandidates;
+}
+
+const std::vector<AngleScanCore::Candidate>& AngleScanCore::GetCandidates() const {
+    return fCandidates;
+}
+
+void AngleScanCore::SetUVMatchTolerance(double epsilon) {
+    fUVMatchTolerance = epsilon;
+}
+
+void AngleScanCore::SetUVMatchMoreTolerance(double big_epsilon) {
+    fUVMatchMoreTolerance = big_epsilon;
+}
+
+void AngleScanCore::AllowUVMatchWithMoreTolerance(bool b) {
+    fAllowUVMatchWithMoreTolerance = b;
+}
+
+void AngleScanCore::AllowSmallConeAngle(bool isSmallAngle) {
+    m_UseSmallConeAngle = isSmallAngle;
+}
@@ -0,0 +1,109 @@
+#ifndef AngleScanCore_h
+#define AngleScanCore_h
+
+#include <utility>
+#include <vector>
+
+#include "ClusterIndex.h"
+#include "RecoCluster.h"
+#include "RecoKernels.h"
+
+/// Angle scan around the vertex with no Gaudi or ROOT dependency
+///
+///     Runs the AngleScanEngine algorithm on a RecoCluster list: pe weighted
+///     angle histogram and peaks in the seed view, a cone per peak, the UV
+///     match by z and the completion of the two other views. Candidates are
+///     lists of indices in the input list, in the order the clusters were
+///     taken. AngleScanEngine converts the IDClusters and the results.
+///
+///     The buffers are kept between Run() calls, so one object can scan
+///     every event of a job or a benchmark.
+class AngleScanCore {
+  public:
+    typedef std::vector<unsigned int> Candidate;
+    typedef std::pair<double,double> Peak;    ///< lower and upper edge [deg]
+
+    AngleScanCore();
+
+    void Run(const std::vector<RecoCluster>& clusters, const RecoKernels::ViewPoint& vertex, int seedView);
+
+    const ClusterIndex& GetIndex() const;
+    bool IsUsed(unsigned int i) const;
+
+    const std::vector<Peak>& GetPeaks() const;
+    const std::vector<Peak>& GetGoodPeaks() const;
+
+    const std::vector<double>& GetSeedShowerClosestDistances() const;
+    const std::vector<double>& GetSeedShowerWeightedDistances() const;
+
+    const std::vector<Candidate>& GetSeedCandidates() const;
+    const std::vector<Candidate>& GetCandidates() const;
+
+    void SetUVMatchTolerance(double epsilon);
+    void SetUVMatchMoreTolerance(double big_epsilon);
+    void AllowUVMatchWithMoreTolerance(bool b);
+    void AllowSmallConeAngle(bool isSmallAngle);
+
+  private:
+    static const unsigned int nViews = 3;
+    static const unsigned int nMaxBins = 180;
+
+    void FillThetaHistogram();
+    void FindPeaks();
+
+    void FormSeedShowerCand();
+    void FormXUVShowerCand();
+
+    int GetLimitBin(int n_bin) const;
+    double GetBinCenter(int bin) const;
+    void TakeCluster(unsigned int i, Candidate& showerCand);
+    void FindZMatches(unsigned int view, double z, double dz, std::vector<unsigned int>& matches) const;
+
+    void addClustersToBlob(const Candidate& seedShowerCand,
+                           unsigned int uview,
+                           unsigned int vview,
+                           Candidate& showerCand,
+                           double epsilon);
+
+    void completeView(unsigned int view,
+                      Candidate& showerCand);
+
+    void coneView(unsigned int view,
+                  Candidate& showerCand,
+                  double min_angle, double max_angle,
+                  double zmin, double zmax);
+
+    unsigned int fSeedView;
+    unsigned int fOtherViews[2];    ///< in X, U, V order
+    unsigned int fZRangeView;       ///< view of the candidate clusters that set the z range in completeView()
+
+    ClusterIndex fIndex;
+    std::vector<bool> fUsed;
+
+    float fTheta[nMaxBins+2];       ///< TH1F bins: [0] underflow, [nBins+1] overflow
+    unsigned int nBins;
+    double theta_low;
+    double theta_high;
+
+    std::vector<Peak> fPeaks;
+    std::vector<Peak> fGoodPeaks;   ///< peaks that produce shower candidates in the seed view
+
+    std::vector<double> fSeedShowerClosestDistances;
+    std::vector<double> fSeedShowerWeightedDistances;
+
+    std::vector<Candidate> fSeedCandidates;
+    std::vector<Candidate> fCandidates;
+
+    // Scratch buffers reused by every cone and UV match
+    std::vector<unsigned int> fMatches;
+    std::vector<unsigned int> fUMatches;
+    std::vector<unsigned int> fVMatches;
+
+    // Data member controlling the algorithm behaviors
+    double fUVMatchTolerance;
+    double fUVMatchMoreTolerance;
+    bool   fAllowUVMatchWithMoreTolerance;
+    bool   m_UseSmallConeAngle;
+};
+
+#endif
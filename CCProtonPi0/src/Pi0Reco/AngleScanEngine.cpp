@@ -0,0 +1,216 @@
+#ifndef AngleScanEngine_cpp
+#define AngleScanEngine_cpp
+
+#include <cmath>
+#include <algorithm>
+
+#include <Event/IDCluster.h>
+#include <Event/IDBlob.h>
+#include <Event/VectorTypeDefs.h>
+#include <Event/Vertex.h>
+
+#include "AngleScanEngine.h"
+#include "ClusterVectorInfo.h"
+
+namespace {
+    const Minerva::IDCluster::View viewTypes[3] = { Minerva::IDCluster::X,
+                                                    Minerva::IDCluster::U,
+                                                    Minerva::IDCluster::V };
+}
+
+
+    AngleScanEngine::AngleScanEngine(const SmartRefVector<Minerva::IDCluster>& clusters, const Gaudi::XYZPoint& vertex,
+                                     Minerva::IDCluster::View seedView)
+{
+    std::copy(clusters.begin(), clusters.end(), std::back_inserter(fAllClusters));
+
+    fX = vertex.X();
+    fY = vertex.Y();
+    fZ = vertex.Z();
+    fU = -fY*sqrt(3.)/2 + fX/2;
+    fV =  fY*sqrt(3.)/2 + fX/2;
+
+    fSeedView = 0;
+    for (unsigned int view = 0; view < nViews; ++view) {
+        if (viewTypes[view] == seedView) fSeedView = view;
+    }
+
+    Initialize();
+}
+
+void AngleScanEngine::Initialize()
+{
+    ClusterVectorInfo clusterVectorInfo(fAllClusters,true,true,true);
+    fXClusters = clusterVectorInfo.GetXClusters();
+    fUClusters = clusterVectorInfo.GetUClusters();
+    fVClusters = clusterVectorInfo.GetVClusters();
+
+    // X then U then V keeps the original order in each view
+    fIndexClusters.clear();
+    fIndexClusters.reserve(fXClusters.size() + fUClusters.size() + fVClusters.size());
+    std::copy(fXClusters.begin(), fXClusters.end(), std::back_inserter(fIndexClusters));
+    std::copy(fUClusters.begin(), fUClusters.end(), std::back_inserter(fIndexClusters));
+    std::copy(fVClusters.begin(), fVClusters.end(), std::back_inserter(fIndexClusters));
+
+    ClusterVectorInfo::FillRecoClusters(fIndexClusters, fRecoClusters);
+
+    // Copy to the working containers
+    fRemainingXClusters = fXClusters;
+    fRemainingUClusters = fUClusters;
+    fRemainingVClusters = fVClusters;
+}
+
+void AngleScanEngine::FillUnusedClusters()
+{
+    SmartRefVector<Minerva::IDCluster>* remaining[nViews] = { &fRemainingXClusters,
+                                                              &fRemainingUClusters,
+                                                              &fRemainingVClusters };
+
+    for (unsigned int view = 0; view < nViews; ++view) {
+        remaining[view]->clear();
+        const std::vector<unsigned int>& viewClusters = fCore.GetIndex().GetViewClusters(view);
+        for (unsigned int i = 0; i < viewClusters.size(); ++i) {
+            if (!fCore.IsUsed(viewClusters[i])) remaining[view]->push_back(fIndexClusters[viewClusters[i]]);
+        }
+    }
+}
+
+void AngleScanEngine::ConvertCandidates(const std::vector<AngleScanCore::Candidate>& in,
+                                        std::vector<ShowerCand>& out) const
+{
+    out.resize(in.size());
+    for (unsigned int s = 0; s < in.size(); ++s) {
+        out[s].clear();
+        for (unsigned int i = 0; i < in[s].size(); ++i) out[s].push_back(fIndexClusters[in[s][i]]);
+    }
+}
+
+void AngleScanEngine::ConvertPeaks(const std::vector<AngleScanCore::Peak>& in,
+                                   std::vector<TVector2>& out) const
+{
+    out.clear();
+    for (unsigned int i = 0; i < in.size(); ++i) out.push_back(TVector2(in[i].first, in[i].second));
+}
+
+void AngleScanEngine::DoReco()
+{
+    RecoKernels::ViewPoint vertex;
+    vertex.t[RecoCluster::X] = fX;
+    vertex.t[RecoCluster::U] = fU;
+    vertex.t[RecoCluster::V] = fV;
+    vertex.z = fZ;
+
+    fCore.Run(fRecoClusters, vertex, fSeedView);
+
+    ConvertPeaks(fCore.GetPeaks(), fPeaks);
+    ConvertPeaks(fCore.GetGoodPeaks(), fGoodPeaks);
+    ConvertCandidates(fCore.GetSeedCandidates(), fSeedShowerCandidates);
+    ConvertCandidates(fCore.GetCandidates(), fShowerCandidates);
+    FillUnusedClusters();
+
+    // Unused clusters of the seed view first, then the other views in X, U, V order
+    SmartRefVector<Minerva::IDCluster>* remaining[nViews] = { &fRemainingXClusters,
+                                                              &fRemainingUClusters,
+                                                              &fRemainingVClusters };
+    fRemainingClusters.clear();
+    std::copy(remaining[fSeedView]->begin(), remaining[fSeedView]->end(), std::back_inserter(fRemainingClusters));
+    for (unsigned int view = 0; view < nViews; ++view) {
+        if (view == fSeedView) continue;
+        std::copy(remaining[view]->begin(), remaining[view]->end(), std::back_inserter(fRemainingClusters));
+    }
+}
+
+const std::vector<TVector2>& AngleScanEngine::GetPeaks() const {
+    return fPeaks;
+}
+
+const std::vector<TVector2>& AngleScanEngine::GetGoodPeaks() const {
+    return fGoodPeaks;
+}
+
+const std::vector<double>& AngleScanEngine::GetSeedShowerClosestDistances() const {
+    return fCore.GetSeedShowerClosestDistances();
+}
+
+const std::vector<double>& AngleScanEngine::GetSeedShowerWeightedDistances() const {
+    return fCore.GetSeedShowerWeightedDistances();
+}
+
+unsigned int AngleScanEngine::GetNSeedCandidate() const {
+    return fSeedShowerCandidates.size();
+}
+
+unsigned int AngleScanEngine::GetNCandidate() const {
+    return fShowerCandidates.size();
+}
+
+const std::vector<SmartRefVector<Minerva::IDCluster> >&
+AngleScanEngine::GetSeedShowerCandVector() const {
+    return fSeedShowerCandidates;
+}
+
+const std::vector<SmartRefVector<Minerva::IDCluster> >&
+AngleScanEngine::GetShowerCandVector() const {
+    return fShowerCandidates;
+}
+
+const SmartRefVector<Minerva::IDCluster>& AngleScanEngine::GetXClusters() const {
+    return fXClusters;
+}
+
+const SmartRefVector<Minerva::IDCluster>& AngleScanEngine::GetUClusters() const {
+    return fUClusters;
+}
+
+const SmartRefVector<Minerva::IDCluster>& AngleScanEngine::GetVClusters() const {
+    return fVClusters;
+}
+
+const SmartRefVector<Minerva::IDCluster>& AngleScanEngine::GetUnusedClusters() const {
+    return fRemainingClusters;
+}
+
+const SmartRefVector<Minerva::IDCluster>& AngleScanEngine::GetUnusedXClusters() const {
+    return fRemainingXClusters;
+}
+
+const SmartRefVector<Minerva::IDCluster>& AngleScanEngine::GetUnusedUClusters() const {
+    return fRemainingUClusters;
+}
+
+const SmartRefVector<Minerva::IDCluster>& AngleScanEngine::GetUnusedVClusters() const {
+    return fRemainingVClusters;
+}
+
+std::vector<Minerva::IDBlob*> AngleScanEngine::GetShowers()
+{
+    std::vector<Minerva::IDBlob*> finalBlobs;
+    std::vector<SmartRefVector<Minerva::IDCluster> >::const_iterator s;
+
+    for ( s = fShowerCandidates.begin(); s != fShowerCandidates.end(); ++s) {
+        Minerva::IDBlob* newBlob = new Minerva::IDBlob;
+        newBlob->add(*s);
+        finalBlobs.push_back(newBlob);
+    }
+
+    return finalBlobs;
+}
+
+void AngleScanEngine::SetUVMatchTolerance(double epsilon) {
+    fCore.SetUVMatchTolerance(epsilon);
+}
+
+void AngleScanEngine::SetUVMatchMoreTolerance(double big_epsilon) {
+    fCore.SetUVMatchMoreTolerance(big_epsilon);
+}
+
+void AngleScanEngine::AllowUVMatchWithMoreTolerance(bool b) {
+    fCore.AllowUVMatchWithMoreTolerance(b);
+}
+
+void AngleScanEngine::AllowSmallConeAngle(bool isSmallAngle) {
+    fCore.AllowSmallConeAngle(isSmallAngle);
+}
+
+
+#endif
@@ -0,0 +1,105 @@
+#ifndef cc1pi0_AngleScanEngine_h
+#define cc1pi0_AngleScanEngine_h
+
+#include <functional>
+#include <vector>
+
+#include <TVector2.h>
+
+#include <GaudiKernel/SmartRef.h>
+#include <Event/MinervaEventFwd.h>
+#include <Event/IDCluster.h>
+
+#include "AngleScanCore.h"
+#include "RecoCluster.h"
+
+/// Angle scan around the vertex in one seed view (X, U or V)
+///
+///     Shower candidates are seeded by the peaks of the pe weighted angle
+///     distribution in the seed view, then completed with the two other views.
+///     AngleScan, AngleScan_U and AngleScan_V are thin adapters for each view.
+///
+///     The scan itself is AngleScanCore, which runs on RecoCluster copies of
+///     the clusters with no Gaudi dependency. This class converts the
+///     IDClusters and turns the index candidates back into IDClusters.
+///     Clusters are always added to the candidates and left in the unused
+///     lists in their original order.
+class AngleScanEngine {
+  public:
+
+    typedef SmartRefVector<Minerva::IDCluster> ShowerCand;
+
+    void DoReco();
+
+    const std::vector<TVector2>& GetPeaks() const;
+    const std::vector<TVector2>& GetGoodPeaks() const;
+
+    unsigned int GetNCandidate() const;
+
+    const std::vector<SmartRefVector<Minerva::IDCluster> >& GetShowerCandVector() const;
+    std::vector<Minerva::IDBlob*>  GetShowers();
+
+    const SmartRefVector<Minerva::IDCluster>& GetXClusters() const;
+    const SmartRefVector<Minerva::IDCluster>& GetUClusters() const;
+    const SmartRefVector<Minerva::IDCluster>& GetVClusters() const;
+
+    const SmartRefVector<Minerva::IDCluster>& GetUnusedClusters() const;
+    const SmartRefVector<Minerva::IDCluster>& GetUnusedXClusters() const;
+    const SmartRefVector<Minerva::IDCluster>& GetUnusedUClusters() const;
+    const SmartRefVector<Minerva::IDCluster>& GetUnusedVClusters() const;
+
+    void SetUVMatchTolerance(double epsilon);
+    void SetUVMatchMoreTolerance(double big_epsilon);
+    void AllowUVMatchWithMoreTolerance(bool b);
+
+  protected:
+    AngleScanEngine(const SmartRefVector<Minerva::IDCluster>& clusters, const Gaudi::XYZPoint& vertex,
+                    Minerva::IDCluster::View seedView);
+
+    void AllowSmallConeAngle(bool isSmallAngle);
+
+    /// Shower candidates in the seed view
+    const std::vector<double>& GetSeedShowerClosestDistances() const;
+    const std::vector<double>& GetSeedShowerWeightedDistances() const;
+    unsigned int GetNSeedCandidate() const;
+    const std::vector<SmartRefVector<Minerva::IDCluster> >& GetSeedShowerCandVector() const;
+
+  private:
+    static const unsigned int nViews = 3;
+
+    void Initialize();
+    void FillUnusedClusters();
+    void ConvertCandidates(const std::vector<AngleScanCore::Candidate>& in, std::vector<ShowerCand>& out) const;
+    void ConvertPeaks(const std::vector<AngleScanCore::Peak>& in, std::vector<TVector2>& out) const;
+
+    SmartRefVector<Minerva::IDCluster> fAllClusters;
+    SmartRefVector<Minerva::IDCluster> fXClusters;
+    SmartRefVector<Minerva::IDCluster> fUClusters;
+    SmartRefVector<Minerva::IDCluster> fVClusters;
+
+    SmartRefVector<Minerva::IDCluster> fRemainingClusters;
+    SmartRefVector<Minerva::IDCluster> fRemainingXClusters;
+    SmartRefVector<Minerva::IDCluster> fRemainingUClusters;
+    SmartRefVector<Minerva::IDCluster> fRemainingVClusters;
+
+    double fX;
+    double fY;
+    double fZ;
+    double fU;
+    double fV;
+
+    unsigned int fSeedView;
+
+    AngleScanCore fCore;
+    SmartRefVector<Minerva::IDCluster> fIndexClusters;  ///< X, then U, then V clusters
+    std::vector<RecoCluster> fRecoClusters;             ///< copy of fIndexClusters given to fCore
+
+    std::vector<TVector2> fPeaks;
+    std::vector<TVector2> fGoodPeaks; /// peaks in the angular distributon that
+                                      /// produce shower candidates in the seed view
+
+    std::vector<ShowerCand> fShowerCandidates;
+    std::vector<ShowerCand> fSeedShowerCandidates;
+};
+
+#endif
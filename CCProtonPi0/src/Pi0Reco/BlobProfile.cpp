@@ -0,0 +1,129 @@
+#include "BlobProfile.h"
+
+BlobProfile::BlobProfile(int nBins, double binWidth)
+    : fNBins(nBins < nMaxBins ? nBins : nMaxBins),
+      fXMax(fNBins*binWidth)
+{
+    Reset();
+}
+
+void BlobProfile::Reset()
+{
+    for ( int i = 0; i < fNBins; ++i ){
+        fContent[i] = 0.0;
+        fEntries[i] = 0;
+    }
+    fFirstFilled = -1;
+    fLastFilled = -1;
+    fNFilled = 0;
+}
+
+void BlobProfile::Fill(double x, double energy)
+{
+    // same arithmetic as TAxis::FindBin() with xmin = 0
+    if ( !(x >= 0.0 && x < fXMax) ) return;
+    double u = fNBins*x/fXMax;
+    if ( u >= fNBins ) return;
+
+    FillBin(int(u), energy);
+}
+
+bool BlobProfile::FillBin(int bin, double energy)
+{
+    if ( bin < 0 || bin >= fNBins ) return false;
+
+    if ( fEntries[bin] == 0 ){
+        if ( fFirstFilled < 0 || bin < fFirstFilled ) fFirstFilled = bin;
+        if ( bin > fLastFilled ) fLastFilled = bin;
+        fNFilled++;
+    }
+
+    fContent[bin] += energy;
+    fEntries[bin]++;
+
+    return true;
+}
+
+int BlobProfile::GetNBins() const
+{
+    return fNBins;
+}
+
+double BlobProfile::GetBinContent(int bin) const
+{
+    return fContent[bin];
+}
+
+int BlobProfile::GetBinEntries(int bin) const
+{
+    return fEntries[bin];
+}
+
+int BlobProfile::GetFirstFilledBin() const
+{
+    return fFirstFilled;
+}
+
+int BlobProfile::GetLastFilledBin() const
+{
+    return fLastFilled;
+}
+
+int BlobProfile::GetNextFilledBin(int bin) const
+{
+    for ( int i = bin+1; i <= fLastFilled; ++i ){
+        if ( fEntries[i] > 0 ) return i;
+    }
+    return -1;
+}
+
+int BlobProfile::GetPreviousFilledBin(int bin) const
+{
+    if ( fFirstFilled < 0 ) return -1;
+    for ( int i = bin-1; i >= fFirstFilled; --i ){
+        if ( fEntries[i] > 0 ) return i;
+    }
+    return -1;
+}
+
+int BlobProfile::GetNFilledBins() const
+{
+    return fNFilled;
+}
+
+int BlobProfile::FindLastBinAbove(double threshold) const
+{
+    for ( int i = fLastFilled; i >= 0; --i ){
+        if ( fContent[i] > threshold ) return i;
+    }
+    return -1;
+}
+
+bool BlobProfile::FindWindow(int width, int minStart, int maxStart, double &sum) const
+{
+    if ( minStart < 0 ) minStart = 0;
+    if ( minStart > maxStart ) return false;
+    if ( width <= 0 ){
+        sum = 0.0;
+        return true;
+    }
+
+    int last = maxStart + width - 1;
+    if ( last >= fNBins ) last = fNBins - 1;
+
+    int run = 0;
+    double window = 0.0;
+    for ( int i = minStart; i <= last; ++i ){
+        if ( fContent[i] > 0 ){
+            if ( run == 0 ) window = 0.0;
+            window += fContent[i];
+            if ( ++run == width ){
+                sum = window;
+                return true;
+            }
+        }
+        else run = 0;
+    }
+
+    return false;
+}
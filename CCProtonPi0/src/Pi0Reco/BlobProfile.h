@@ -0,0 +1,56 @@
+#ifndef BlobProfile_h
+#define BlobProfile_h
+
+/// Longitudinal energy profile of a blob with no Gaudi or ROOT dependency
+///
+///     Fixed number of bins of equal width starting from 0, kept in arrays on
+///     the stack so a profile per blob costs no allocation.
+///     Fill() uses the same bin as TH1D(nBins, 0, nBins*binWidth)::Fill(),
+///     values outside the range are dropped. FillBin() fills a bin directly,
+///     e.g. one bin per plane. Every bin keeps the energy sum and the number
+///     of entries, bins start from 0.
+class BlobProfile {
+  public:
+    static const int nMaxBins = 512;
+
+    BlobProfile(int nBins, double binWidth);
+
+    void Reset();
+
+    void Fill(double x, double energy);
+
+    /// false if the bin is outside the profile
+    bool FillBin(int bin, double energy);
+
+    int GetNBins() const;
+    double GetBinContent(int bin) const;
+    int GetBinEntries(int bin) const;
+
+    /// Bins with at least one entry, -1 if there is none
+    int GetFirstFilledBin() const;
+    int GetLastFilledBin() const;
+    int GetNextFilledBin(int bin) const;
+    int GetPreviousFilledBin(int bin) const;
+    int GetNFilledBins() const;
+
+    /// Last bin with content > threshold, -1 if there is none
+    int FindLastBinAbove(double threshold) const;
+
+    /// Single pass search for the first window of width consecutive bins with
+    /// content > 0 that starts in [minStart, maxStart]
+    /// sum is the content of the window, left unchanged if there is none
+    bool FindWindow(int width, int minStart, int maxStart, double &sum) const;
+
+  private:
+    int fNBins;
+    double fXMax;
+
+    double fContent[nMaxBins];
+    int fEntries[nMaxBins];
+
+    int fFirstFilled;
+    int fLastFilled;
+    int fNFilled;
+};
+
+#endif
@@ -0,0 +1,133 @@
+#include <cmath>
+#include <algorithm>
+
+#include "ClusterIndex.h"
+
+namespace {
+    // Same value as TMath::RadToDeg()
+    const double radToDeg = 180.0/3.14159265358979323846;
+}
+
+ClusterIndex::ClusterIndex()
+{
+    for (int view = 0; view < nViews; ++view) {
+        fVertex.t[view] = 0.0;
+        fAngleSorted[view] = false;
+        fZSorted[view] = false;
+    }
+    fVertex.z = 0.0;
+}
+
+void ClusterIndex::Build(const std::vector<RecoCluster>& clusters, const RecoKernels::ViewPoint& vertex)
+{
+    fClusters = clusters;
+    fVertex = vertex;
+    fAngles.assign(fClusters.size(), 0.0);
+
+    for (int view = 0; view < nViews; ++view) {
+        fViewClusters[view].clear();
+        fViewClusters[view].reserve(fClusters.size());
+        fAngleSorted[view] = false;
+        fZSorted[view] = false;
+    }
+
+    for (unsigned int i = 0; i < fClusters.size(); ++i) {
+        const RecoCluster& c = fClusters[i];
+        if (c.view < 0 || c.view >= nViews) continue;
+
+        const double dZ = c.z - fVertex.z;
+        const double dT = c.position - fVertex.t[c.view];
+        fAngles[i] = std::atan2(dT,dZ)*radToDeg;
+
+        fViewClusters[c.view].push_back(i);
+    }
+}
+
+unsigned int ClusterIndex::GetN() const
+{
+    return fClusters.size();
+}
+
+const RecoCluster& ClusterIndex::GetCluster(unsigned int i) const
+{
+    return fClusters[i];
+}
+
+double ClusterIndex::GetAngle(unsigned int i) const
+{
+    return fAngles[i];
+}
+
+const std::vector<unsigned int>& ClusterIndex::GetViewClusters(int view) const
+{
+    return fViewClusters[view];
+}
+
+const RecoKernels::ViewPoint& ClusterIndex::GetVertex() const
+{
+    return fVertex;
+}
+
+void ClusterIndex::FindInAngleRange(int view, double angle_min, double angle_max, std::vector<unsigned int>& found) const
+{
+    if (fViewClusters[view].size() < minSortedView) {
+        Scan(view, true, angle_min, angle_max, found);
+        return;
+    }
+
+    if (!fAngleSorted[view]) {
+        SortView(view, true, fByAngle[view]);
+        fAngleSorted[view] = true;
+    }
+
+    Collect(fByAngle[view], angle_min, angle_max, found);
+}
+
+void ClusterIndex::FindInZRange(int view, double zmin, double zmax, std::vector<unsigned int>& found) const
+{
+    if (fViewClusters[view].size() < minSortedView) {
+        Scan(view, false, zmin, zmax, found);
+        return;
+    }
+
+    if (!fZSorted[view]) {
+        SortView(view, false, fByZ[view]);
+        fZSorted[view] = true;
+    }
+
+    Collect(fByZ[view], zmin, zmax, found);
+}
+
+void ClusterIndex::Scan(int view, bool byAngle, double min, double max, std::vector<unsigned int>& found) const
+{
+    const std::vector<unsigned int>& viewClusters = fViewClusters[view];
+
+    found.clear();
+    for (unsigned int i = 0; i < viewClusters.size(); ++i) {
+        const unsigned int c = viewClusters[i];
+        const double key = byAngle ? fAngles[c] : fClusters[c].z;
+        if (min <= key && key <= max) found.push_back(c);
+    }
+}
+
+void ClusterIndex::SortView(int view, bool byAngle, SortedKeys& sorted) const
+{
+    const std::vector<unsigned int>& viewClusters = fViewClusters[view];
+
+    sorted.clear();
+    sorted.reserve(viewClusters.size());
+    for (unsigned int i = 0; i < viewClusters.size(); ++i) {
+        const unsigned int c = viewClusters[i];
+        sorted.push_back(std::make_pair(byAngle ? fAngles[c] : fClusters[c].z, c));
+    }
+
+    std::sort(sorted.begin(), sorted.end());
+}
+
+void ClusterIndex::Collect(const SortedKeys& sorted, double min, double max, std::vector<unsigned int>& found)
+{
+    found.clear();
+
+    SortedKeys::const_iterator c = std::lower_bound(sorted.begin(), sorted.end(), std::make_pair(min, 0u));
+    for ( ; c != sorted.end() && c->first <= max; ++c) found.push_back(c->second);
+}
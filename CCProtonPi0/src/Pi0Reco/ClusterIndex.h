@@ -0,0 +1,64 @@
+#ifndef ClusterIndex_h
+#define ClusterIndex_h
+
+#include <utility>
+#include <vector>
+
+#include "RecoCluster.h"
+#include "RecoKernels.h"
+
+/// Per event index of X, U and V clusters around the vertex with no Gaudi or ROOT dependency
+///
+///     Built once per event from a RecoCluster list, clusters keep their position
+///     in that list as their index. Each view is sorted by z and by the angle
+///     atan2(t - vtxT, z - vtxZ) [deg] around the vertex, so "clusters within dz
+///     of this one" and "clusters in this cone" are binary searches. A view is
+///     sorted by the first query that needs it, views with fewer than
+///     minSortedView clusters are scanned instead.
+///
+///     Range queries return the indices in no particular order. Indices of one
+///     view grow with the position in the input list, so a caller that needs
+///     the input order sorts the (usually few) indices it keeps. Range limits
+///     are inclusive, callers that need an exact cut apply it on the result.
+///     Which clusters are still free is kept by the caller.
+class ClusterIndex {
+  public:
+    ClusterIndex();
+
+    void Build(const std::vector<RecoCluster>& clusters, const RecoKernels::ViewPoint& vertex);
+
+    unsigned int GetN() const;
+    const RecoCluster& GetCluster(unsigned int i) const;
+    double GetAngle(unsigned int i) const;                          ///< [deg], 0 for other views
+    const std::vector<unsigned int>& GetViewClusters(int view) const; ///< in the original order
+    const RecoKernels::ViewPoint& GetVertex() const;
+
+    /// Clusters of a view with angle_min <= angle <= angle_max [deg]
+    void FindInAngleRange(int view, double angle_min, double angle_max, std::vector<unsigned int>& found) const;
+
+    /// Clusters of a view with zmin <= z <= zmax
+    void FindInZRange(int view, double zmin, double zmax, std::vector<unsigned int>& found) const;
+
+  private:
+    static const int nViews = 3;
+    static const unsigned int minSortedView = 32;  ///< smaller views are scanned, a sort costs more than it saves
+
+    typedef std::vector<std::pair<double,unsigned int> > SortedKeys;   ///< (key, index) sorted by key
+
+    std::vector<RecoCluster> fClusters;
+    std::vector<double> fAngles;
+    RecoKernels::ViewPoint fVertex;
+
+    std::vector<unsigned int> fViewClusters[nViews];
+    // Sorted on first use by the const queries
+    mutable SortedKeys fByAngle[nViews];
+    mutable SortedKeys fByZ[nViews];
+    mutable bool fAngleSorted[nViews];
+    mutable bool fZSorted[nViews];
+
+    void Scan(int view, bool byAngle, double min, double max, std::vector<unsigned int>& found) const;
+    void SortView(int view, bool byAngle, SortedKeys& sorted) const;
+    static void Collect(const SortedKeys& sorted, double min, double max, std::vector<unsigned int>& found);
+};
+
+#endif
@@ -85,3 +85,30 @@ const SmartRefVector<Minerva::IDCluster>& ClusterVectorInfo::GetUClusters() cons
 const SmartRefVector<Minerva::IDCluster>& ClusterVectorInfo::GetVClusters() const {
     return fVClusters;
 }
+
+void ClusterVectorInfo::FillRecoClusters(const SmartRefVector<Minerva::IDCluster>& clusters,
+                                         std::vector<RecoCluster>& recoClusters)
+{
+    recoClusters.resize(clusters.size());
+
+    for (unsigned int i = 0; i < clusters.size(); ++i) {
+        const Minerva::IDCluster* cluster = clusters[i];
+        RecoCluster& c = recoClusters[i];
+
+        switch (cluster->view()) {
+            case Minerva::IDCluster::X: c.view = RecoCluster::X; break;
+            case Minerva::IDCluster::U: c.view = RecoCluster::U; break;
+            case Minerva::IDCluster::V: c.view = RecoCluster::V; break;
+            default: c.view = RecoCluster::Other;
+        }
+
+        c.z        = cluster->z();
+        c.position = cluster->position();
+        c.tpos1    = cluster->tpos1();
+        c.tpos2    = cluster->tpos2();
+        c.energy   = cluster->energy();
+        c.pe       = cluster->pe();
+        c.time     = cluster->time();
+        c.nDigits  = cluster->iddigs();
+    }
+}
@@ -1,8 +1,12 @@
 #ifndef ClusterVectorInfo_h
 #define ClusterVectorInfo_h
 
+#include <vector>
+
 #include <Event/MinervaEventFwd.h>
 
+#include "RecoCluster.h"
+
 class ClusterVectorInfo {
   public:
     explicit ClusterVectorInfo(const SmartRefVector<Minerva::IDCluster>& clusters,
@@ -23,6 +27,10 @@ class ClusterVectorInfo {
     const SmartRefVector<Minerva::IDCluster>& GetXClusters() const;
     const SmartRefVector<Minerva::IDCluster>& GetUClusters() const;
     const SmartRefVector<Minerva::IDCluster>& GetVClusters() const;
+
+    /// Copy of the clusters for the framework independent kernels, same order
+    static void FillRecoClusters(const SmartRefVector<Minerva::IDCluster>& clusters,
+                                 std::vector<RecoCluster>& recoClusters);
     
   private:
     SmartRefVector<Minerva::IDCluster> fAllClusters;
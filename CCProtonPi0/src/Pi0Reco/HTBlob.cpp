@@ -1,5 +1,6 @@
 #include "HTBlob.h"
 #include <cmath>
+#include <algorithm>
 #include <limits>
 
 #include "Event/IDCluster.h"
@@ -7,8 +8,10 @@
 
 #include "MinervaUtils/IMinervaMathTool.h"
 
+#include "ClusterVectorInfo.h"
+#include "RecoKernels.h"
+
 #include "TMath.h"
-#include "TH1D.h"
 #include "TH2D.h"
 #include "TF1.h"
 
@@ -394,57 +397,27 @@ bool HTBlob::GetDirection( Minerva::IDBlob *idBlob, Gaudi::XYZPoint vert ) const
 
     debug() << " HTBlob::GetDirection " << endmsg;
 
-    SmartRefVector<Minerva::IDCluster> idClusters = idBlob->clusters();
-    SmartRefVector<Minerva::IDCluster>::iterator itClus = idClusters.begin();
+    ClusterVectorInfo::FillRecoClusters(idBlob->clusters(), m_recoClusters);
+
+    RecoKernels::ViewPoint vertex;
+    vertex.t[RecoCluster::X] = vert.x();
+    vertex.t[RecoCluster::U] = m_mathTool->calcUfromXY(vert.x(), vert.y());
+    vertex.t[RecoCluster::V] = m_mathTool->calcVfromXY(vert.x(), vert.y());
+    vertex.z = vert.z();
+
+    RecoKernels::DirectionSums sums;
+    if ( !RecoKernels::BlobDirectionSums(m_recoClusters, vertex, sums) ) throw MinervaException("Unknown cluster view");
 
-    double Xx = 0.0;
-    double Zx = 0.0;
-    double Xu = 0.0;
-    double Xv = 0.0;
-    double totalX = 0.0;
-    double totalU = 0.0;
-    double totalV = 0.0;
+    const double Xx = sums.Xx;
+    const double Zx = sums.Zx;
+    const double Xu = sums.Xu;
+    const double Xv = sums.Xv;
+    const double totalX = sums.totalX;
+    const double totalU = sums.totalU;
+    const double totalV = sums.totalV;
     double dx = 0.0;
     double dy = 0.0;
     double dz = 0.0;
-    double distance = 0.0;
-
-    for ( ; itClus != idClusters.end(); itClus++ ){
-
-        dz = (*itClus)->z() - vert.z();
-
-        switch((*itClus)->view())
-        {
-            case Minerva::IDCluster::X:
-                dx = (*itClus)->position() - vert.x();
-                distance = sqrt(pow(dx,2)+pow(dz,2));
-                if ( distance == .0 ) distance = 25;
-                Xx += dx*(*itClus)->energy()/distance;
-                Zx += dz*(*itClus)->energy()/distance;
-                totalX += (*itClus)->energy()/distance;
-                break;
-
-            case Minerva::IDCluster::U:
-                dx = (*itClus)->position() - m_mathTool->calcUfromXY(vert.x(), vert.y());
-                distance = sqrt(pow(dx,2)+pow(dz,2));
-                if ( distance == .0 ) distance = 25;
-                Xu += dx*(*itClus)->energy()/distance;
-                totalU += (*itClus)->energy()/distance;
-                break;
-
-            case Minerva::IDCluster::V:
-                dx = (*itClus)->position() - m_mathTool->calcVfromXY(vert.x(), vert.y());
-                distance = sqrt(pow(dx,2)+pow(dz,2));
-                if ( distance == .0 ) distance = 25;
-                Xv += dx*(*itClus)->energy()/distance;
-                totalV += (*itClus)->energy()/distance;
-                break;
-
-            default:
-                throw MinervaException("Unknown cluster view");
-        }
-
-    }
 
     Gaudi::XYZVector direction;
 
@@ -673,80 +646,25 @@ StatusCode HTBlob::idBlobdEdx( Minerva::IDBlob *idblob, double &dEdx ) const
 {
     debug() << "CCPi0HoughTool::idBlobdEdx"  << endmsg;
 
-    SmartRefVector< Minerva::IDCluster > idClusters = idblob->clusters();
-    SmartRefVector< Minerva::IDCluster >::iterator it_clus = idClusters.begin();
-    TH1D *h = new TH1D ("h","h", 100,0,4500); // bin size 45mm <> 1 module
-    dEdx = 0;
+    ClusterVectorInfo::FillRecoClusters(idblob->clusters(), m_recoClusters);
 
     Gaudi::XYZPoint vert = idblob->startPoint();
-    double x, z, distance, vt_x, vt_u, vt_v, vt_z;
 
     // event vertex per view
-    vt_x =  vert.x();
-    vt_u = -vert.y()*sqrt(3)/2 + vert.x()*.5; //  -ycos30 + xsin30
-    vt_v =  vert.y()*sqrt(3)/2 + vert.x()*.5; //   ycos30 + xsin30
-    vt_z =  vert.z();
+    RecoKernels::ViewPoint start;
+    start.t[RecoCluster::X] =  vert.x();
+    start.t[RecoCluster::U] = -vert.y()*sqrt(3)/2 + vert.x()*.5; //  -ycos30 + xsin30
+    start.t[RecoCluster::V] =  vert.y()*sqrt(3)/2 + vert.x()*.5; //   ycos30 + xsin30
+    start.z = vert.z();
 
+    dEdx = RecoKernels::BlobdEdx(m_recoClusters, start, m_planesdEdx);
 
-    for ( ; it_clus != idClusters.end(); it_clus++ ){
-
-        x = vt_x - (*it_clus)->position();
-        z = vt_z - (*it_clus)->z();
-
-        if ( (*it_clus)->view() ==  Minerva::IDCluster::U ){
-            x = vt_u - (*it_clus)->position();
-            z = vt_z - (*it_clus)->z();
-        }
-
-        if ( (*it_clus)->view() ==  Minerva::IDCluster::V ){
-            x = vt_v - (*it_clus)->position();
-            z = vt_z - (*it_clus)->z();
-        }
-
-        distance = sqrt( pow(x,2) + pow(z,2) );
-        h->Fill(distance, (*it_clus)->energy());
-    }
-
-    // dEdx calculation, maybe not clear
-    int binmin = h->FindFirstBinAbove();
-    int binmax = (h->FindLastBinAbove()-m_planesdEdx/2);
-
-    for ( int i = binmin; i <= binmax; i++ ){
-        if ( FinddEdxPlanes(h, i, dEdx) ) break;
-        dEdx = 0;
-    }
-    if ( dEdx == 0 ) dEdx = -999;
-    else dEdx = dEdx/m_planesdEdx;
-
-    info () << " dEdx = " << dEdx << " number planes " << m_planesdEdx << endmsg;
-
-    delete h;
+    debug() << " dEdx = " << dEdx << " number planes " << m_planesdEdx << endmsg;
 
     return StatusCode::SUCCESS;
 
 }
 
-//=======================================================================
-//  FinddEdxPlanes
-//=======================================================================
-StatusCode HTBlob::FinddEdxPlanes(TH1D *h, int &index, double &dEdx) const
-{
-
-    dEdx = 0;
-    int count = 0;
-
-    for ( int i = index; i <= m_planesdEdx/2; i++){
-        if ( h->GetBinContent(i) > 0 ) {
-            count++;
-            dEdx += h->GetBinContent(i);
-        }
-        else { index = i; break; }
-    }
-    if ( count == m_planesdEdx/2 ) 	return StatusCode::SUCCESS;
-    else 	return StatusCode::FAILURE;
-
-}
-
 //=======================================================================
 //  isPhoton
 //  Calculating distance from event vertex to photon, 
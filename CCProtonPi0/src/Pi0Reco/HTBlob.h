@@ -12,13 +12,16 @@
 #ifndef HTBLOB_H
 #define HTBLOB_H 1
 
+#include <vector>
+
 // inheritance
 #include "MinervaUtils/MinervaHistoTool.h"
 #include "CCProtonPi0/IHoughBlob.h"
 
+#include "RecoCluster.h"
+
 // forwards
 class IMinervaMathTool;
-class TH1D;
 
 class HTBlob: public MinervaHistoTool, virtual public IHoughBlob {
 
@@ -88,8 +91,11 @@ class HTBlob: public MinervaHistoTool, virtual public IHoughBlob {
     double m_kS_X;
     double m_kS_UV;
     double m_kH;
+
+    // Clusters of the current blob for RecoKernels, reused by every call
+    mutable std::vector<RecoCluster> m_recoClusters;
     
-    StatusCode FinddEdxPlanes(TH1D *h, int &index, double &dEdx) const;
+
     double get_kT(double evis) const;
     double getShowerEnergy(std::vector<double>& evis_v, std::vector<double>& energy_v) const;
    
@@ -4,7 +4,6 @@
 
 #include <cmath>
 #include "TMath.h"
-#include "TH2D.h"
 
 DECLARE_TOOL_FACTORY( HTtool );
 
@@ -12,7 +11,10 @@ DECLARE_TOOL_FACTORY( HTtool );
 // Standard constructor, initializes variables
 //=============================================================================
 HTtool::HTtool( const std::string& type, const std::string& name, const IInterface* parent ) : 
-  MinervaHistoTool( type, name, parent ) 
+  MinervaHistoTool( type, name, parent ),
+  fHoughClusters(46,-92,92,275,-5500,5500),
+  fHoughSeeds(90,-90,90,275,-5500,5500),
+  fHoughSeedsVertex(92,-92,92,260,-5500,5500)
 {
     debug() << "Instantiating HTtool..." << endmsg;
     declareInterface<IHoughTool>(this);
@@ -122,24 +124,17 @@ StatusCode HTtool::Hough2D( SmartRefVector<Minerva::IDCluster> idClusterVec, dou
         return StatusCode::FAILURE;
     }
 	
-    TH2D *h = new TH2D("h","Hough Space",46,-92,92,275,-5500,5500); // less granulated because lot of hits
+    HoughAccumulator &h = fHoughClusters;
+    h.Reset();
     SmartRefVector<Minerva::IDCluster>::iterator itClus = idClusterVec.begin();
     
     for ( ; itClus != idClusterVec.end(); itClus++ ) FillHough1Cluster(*itClus, h, ref);
     
-    int x,y,z, maxbin;
-    if ( h->GetEntries() ){
-        maxbin = h->GetMaximumBin(x, y, z);
-        r      = h->GetYaxis()->GetBinCenter(y);
-        theta  = h->GetXaxis()->GetBinCenter(x);
-    }
-    else {
+    if ( !h.GetMaximum(r, theta) ){
         debug() << " ALERT: Hough space is empty " << endmsg;
-        delete h;
         return StatusCode::FAILURE;
     }
     
-    delete h;
     return StatusCode::SUCCESS;
     
 }
@@ -158,12 +153,13 @@ StatusCode HTtool::Hough2D( SmartRefVector<Minerva::IDCluster> idClusterVec, dou
         return StatusCode::FAILURE;
     }
 	
-    TH2D *h = new TH2D("h","Hough Space",46,-92,92,275,-5500,5500); // less granulated because lot of hits
+    HoughAccumulator &h = fHoughClusters;
+    h.Reset();
     SmartRefVector<Minerva::IDCluster>::iterator itClus = idClusterVec.begin();
     
     double x = vert.x()-ref.x();
     double z = vert.z()-ref.z();
-    double radius, theta_var, maxpe = 0;
+    double maxpe = 0;
     debug() << " Ref " << ref << " vert " << vert << endmsg; 
   
     for ( ; itClus != idClusterVec.end(); itClus++ ) {
@@ -174,25 +170,13 @@ StatusCode HTtool::Hough2D( SmartRefVector<Minerva::IDCluster> idClusterVec, dou
     debug() << " Hough2D we found maxpe for vertex " << maxpe << endmsg;
 
         //must be filled with the vertex direction and weighted by max pe
-    for ( int i = h->GetXaxis()->GetFirst(); i <= h->GetXaxis()->GetLast(); i++){
-        theta_var = h->GetXaxis()->GetBinCenter(i)*CLHEP::pi/180; // angle radians
-        radius = x*sin(theta_var) + z*cos(theta_var);
-        h->Fill( theta_var*180/CLHEP::pi, radius, maxpe / 2 ); // must be filled in degrees
-    }
+    h.Fill( x, z, maxpe / 2 );
 
-    int xbin,ybin,zbin, maxbin;
-    if ( h->GetEntries() ) {
-        maxbin = h->GetMaximumBin(xbin, ybin, zbin);
-        r      = h->GetYaxis()->GetBinCenter(ybin);
-        theta  = h->GetXaxis()->GetBinCenter(xbin);
-    }
-    else {
+    if ( !h.GetMaximum(r, theta) ) {
         debug() << " ALERT: Hough space is empty " << endmsg;
-        delete h;
         return StatusCode::FAILURE;
     }
 
-    delete h;
     return StatusCode::SUCCESS;
     
 }
@@ -211,24 +195,17 @@ StatusCode HTtool::Hough2D( BlobSeeds::seedCandVector Seeds, double &r, double &
         return StatusCode::FAILURE;
     }
     
-    TH2D *h = new TH2D("h","Hough Space",90,-90,90,275,-5500,5500);
+    HoughAccumulator &h = fHoughSeeds;
+    h.Reset();
     BlobSeeds::seedCandVector::iterator itSeed = Seeds.begin();
     
     for ( ; itSeed != Seeds.end(); itSeed++ ) FillHough1Cluster(*itSeed, h, ref);
     
-    int x,y,z, maxbin;
-    if ( h->GetEntries() ) {
-        maxbin = h->GetMaximumBin(x, y, z);
-        r      = h->GetYaxis()->GetBinCenter(y);
-        theta  = h->GetXaxis()->GetBinCenter(x);
-    }
-    else {
+    if ( !h.GetMaximum(r, theta) ) {
         debug() << " ALERT: Hough space is empty " << endmsg;
-        delete h;
         return StatusCode::FAILURE;
     }
 
-    delete h;
     return StatusCode::SUCCESS;
     
 }
@@ -247,12 +224,12 @@ StatusCode HTtool::Hough2D( BlobSeeds::seedCandVector Seeds, double &r, double &
         return StatusCode::FAILURE;
     }
     
-	//TH2D *h = new TH2D("h","Hough Space",45,-90,90,275,-5500,5500);
-    TH2D *h = new TH2D("h","Hough Space",92,-92,92,260,-5500,5500); // more granulated because few points?
+    HoughAccumulator &h = fHoughSeedsVertex;
+    h.Reset();
 
     double x = vert.x()-ref.x();
     double z = vert.z()-ref.z();
-    double radius, theta_var, maxpe = 0;
+    double maxpe = 0;
     
     BlobSeeds::seedCandVector::iterator itSeed = Seeds.begin();
     for ( ; itSeed != Seeds.end(); itSeed++ ) {
@@ -263,27 +240,13 @@ StatusCode HTtool::Hough2D( BlobSeeds::seedCandVector Seeds, double &r, double &
     debug() << " Hough2D we found maxpe for vertex " << maxpe << endmsg;
 
         //must be filled with the vertex direction and weighted by max pe
-    for ( int i = h->GetXaxis()->GetFirst(); i <= h->GetXaxis()->GetLast(); i++){
-        theta_var = h->GetXaxis()->GetBinCenter(i)*CLHEP::pi/180; // angle radians
-        radius = x*sin(theta_var) + z*cos(theta_var);
-        h->Fill( theta_var*180/CLHEP::pi, radius, maxpe ); // must be filled in degrees
-    }
+    h.Fill( x, z, maxpe );
     
-    int xbin, ybin, zbin, maxbin;
-    if ( h->GetEntries() ) {
-        maxbin = h->GetMaximumBin(xbin, ybin, zbin);
-        r      = h->GetYaxis()->GetBinCenter(ybin);
-        theta  = h->GetXaxis()->GetBinCenter(xbin);
-        debug() << " Hough2D we found theta " << theta << " radius " << r << endmsg;
-    }
-    else {
+    if ( !h.GetMaximum(r, theta) ) {
         debug() << " ALERT: Hough space is empty " << endmsg;
-        delete h;
-
         return StatusCode::FAILURE;
     }
-    
-    delete h;
+    debug() << " Hough2D we found theta " << theta << " radius " << r << endmsg;
 
     return StatusCode::SUCCESS;
 
@@ -292,21 +255,14 @@ StatusCode HTtool::Hough2D( BlobSeeds::seedCandVector Seeds, double &r, double &
 //=============================================================================
 // FillHough1Cluster - Cluster
 //=============================================================================
-StatusCode HTtool::FillHough1Cluster( SmartRef<Minerva::IDCluster> idCluster, TH2D *h, const Gaudi::XYZPoint& ref) const
+StatusCode HTtool::FillHough1Cluster( SmartRef<Minerva::IDCluster> idCluster, HoughAccumulator &h, const Gaudi::XYZPoint& ref) const
 {
     double x = idCluster->position()-ref.x();
     double z = idCluster->z()-ref.z();
-    double r, theta;
     debug() << " Fill Hough; pos " << idCluster->position() << "; z clus " << idCluster->z()
             << "; x " << x << "; z " << z << "; pe " << idCluster->pe() << endmsg;
     
-    for ( int i = h->GetXaxis()->GetFirst(); i <= h->GetXaxis()->GetLast(); i++){
-        
-        theta = h->GetXaxis()->GetBinCenter(i)*CLHEP::pi/180; // angle radians
-        r = x*sin(theta) + z*cos(theta);
-        h->Fill( theta*180/CLHEP::pi, r, idCluster->pe() ); // must be filled in degree
-        
-    }
+    h.Fill( x, z, idCluster->pe() );
 
     return StatusCode::SUCCESS;
 }
@@ -314,21 +270,14 @@ StatusCode HTtool::FillHough1Cluster( SmartRef<Minerva::IDCluster> idCluster, TH
 //=============================================================================
 // FillHough1Cluster - Seed
 //=============================================================================
-StatusCode HTtool::FillHough1Cluster( BlobSeeds::seedCandidate *Seed, TH2D *h, const Gaudi::XYZPoint& ref) const
+StatusCode HTtool::FillHough1Cluster( BlobSeeds::seedCandidate *Seed, HoughAccumulator &h, const Gaudi::XYZPoint& ref) const
 {
     double x = Seed->seedcoordcentroid-ref.x();
     double z = Seed->seedzcentroid-ref.z();
-    double r, theta;
     debug() << " Fill Hough; pos " << Seed->seedcoordcentroid << "; x " << x << "; z clus "
             << Seed->seedzcentroid << "; z " << z << "; pe " <<  Seed->seedpe << endmsg;
     
-    for ( int i = h->GetXaxis()->GetFirst(); i <= h->GetXaxis()->GetLast(); i++){
-        
-        theta = h->GetXaxis()->GetBinCenter(i)*CLHEP::pi/180; // angle radians
-        r = x*sin(theta) + z*cos(theta);
-        h->Fill( theta*180/CLHEP::pi, r, Seed->seedpe ); // must be filled in degree
-        
-    }
+    h.Fill( x, z, Seed->seedpe );
     
     return StatusCode::SUCCESS;
 }
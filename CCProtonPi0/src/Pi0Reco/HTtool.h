@@ -5,8 +5,7 @@
 #include "CCProtonPi0/IHoughTool.h"
 #include "MinervaUtils/MinervaHistoTool.h"
 
-//forwards
-class TH2D;
+#include "HoughAccumulator.h"
 
 
 class HTtool: public MinervaHistoTool, virtual public IHoughTool {
@@ -27,12 +26,17 @@ class HTtool: public MinervaHistoTool, virtual public IHoughTool {
     StatusCode Hough2D( BlobSeeds::seedCandVector Seeds, double &r, double &theta, const Gaudi::XYZPoint& ref ) const;
     StatusCode Hough2D( BlobSeeds::seedCandVector Seeds, double &r, double &theta, const Gaudi::XYZPoint& ref, const Gaudi::XYZPoint& vert ) const;
     
-    StatusCode FillHough1Cluster( SmartRef<Minerva::IDCluster> idCluster, TH2D *h, const Gaudi::XYZPoint& ref) const;
-    StatusCode FillHough1Cluster( BlobSeeds::seedCandidate *Seed, TH2D *h, const Gaudi::XYZPoint& ref) const;
+    StatusCode FillHough1Cluster( SmartRef<Minerva::IDCluster> idCluster, HoughAccumulator &h, const Gaudi::XYZPoint& ref) const;
+    StatusCode FillHough1Cluster( BlobSeeds::seedCandidate *Seed, HoughAccumulator &h, const Gaudi::XYZPoint& ref) const;
     
   private:
 			
     double a;
 
+    // Hough spaces are built once and reset for each call
+    mutable HoughAccumulator fHoughClusters;    ///< 46x275, less granulated because lot of hits
+    mutable HoughAccumulator fHoughSeeds;       ///< 90x275
+    mutable HoughAccumulator fHoughSeedsVertex; ///< 92x260, more granulated because few points
+
 };
 #endif
@@ -0,0 +1,133 @@
+#include <cmath>
+
+#include "HoughAccumulator.h"
+
+namespace {
+    const double pi = 3.14159265358979323846;
+}
+
+HoughAccumulator::HoughAccumulator(int nThetaBins, double thetaMin, double thetaMax,
+                                   int nRBins, double rMin, double rMax)
+    : fNThetaBins(nThetaBins),
+      fThetaMin(thetaMin),
+      fThetaMax(thetaMax),
+      fNRBins(nRBins),
+      fRMin(rMin),
+      fRMax(rMax),
+      fSin(nThetaBins),
+      fCos(nThetaBins),
+      fGrid(nThetaBins*nRBins, 0.0),
+      fRBins(nThetaBins),
+      fEntries(0),
+      fMaxBin(0)
+{
+    for ( int i = 0; i < fNThetaBins; ++i ){
+        double theta = GetThetaBinCenter(i)*pi/180; // angle radians
+        fSin[i] = sin(theta);
+        fCos[i] = cos(theta);
+    }
+}
+
+void HoughAccumulator::Reset()
+{
+    fGrid.assign(fGrid.size(), 0.0);
+    fEntries = 0;
+    fMaxBin = 0;
+}
+
+void HoughAccumulator::Fill(double x, double z, double w)
+{
+    const double* sin_theta = &fSin[0];
+    const double* cos_theta = &fCos[0];
+    int* rBins = &fRBins[0];
+
+        // r bin for every theta bin -- no dependency between iterations
+        // same arithmetic as TAxis::FindBin()
+    for ( int i = 0; i < fNThetaBins; ++i ){
+        double r = x*sin_theta[i] + z*cos_theta[i];
+        double u = fNRBins*(r - fRMin)/(fRMax - fRMin);
+        rBins[i] = ( r >= fRMin && r < fRMax && u < fNRBins ) ? int(u) : -1;
+    }
+
+        // Scatter the votes and keep the running maximum
+    double* grid = &fGrid[0];
+    double max = grid[fMaxBin];
+    for ( int i = 0; i < fNThetaBins; ++i ){
+        if ( rBins[i] < 0 ) continue;
+        int bin = rBins[i]*fNThetaBins + i;
+        grid[bin] += w;
+        if ( grid[bin] > max || ( grid[bin] == max && bin < fMaxBin ) ) {
+            max = grid[bin];
+            fMaxBin = bin;
+        }
+    }
+
+    fEntries += fNThetaBins;
+}
+
+bool HoughAccumulator::GetMaximum(double &r, double &theta) const
+{
+    if ( !fEntries ) return false;
+
+    r     = GetRBinCenter(fMaxBin/fNThetaBins);
+    theta = GetThetaBinCenter(fMaxBin%fNThetaBins);
+
+    return true;
+}
+
+unsigned int HoughAccumulator::GetEntries() const
+{
+    return fEntries;
+}
+
+int HoughAccumulator::GetNThetaBins() const
+{
+    return fNThetaBins;
+}
+
+int HoughAccumulator::GetNRBins() const
+{
+    return fNRBins;
+}
+
+double HoughAccumulator::GetThetaMin() const
+{
+    return fThetaMin;
+}
+
+double HoughAccumulator::GetThetaMax() const
+{
+    return fThetaMax;
+}
+
+double HoughAccumulator::GetRMin() const
+{
+    return fRMin;
+}
+
+double HoughAccumulator::GetRMax() const
+{
+    return fRMax;
+}
+
+double HoughAccumulator::GetBinContent(int thetaBin, int rBin) const
+{
+    return fGrid[rBin*fNThetaBins + thetaBin];
+}
+
+double HoughAccumulator::GetThetaBinCenter(int thetaBin) const
+{
+    return GetBinCenter(thetaBin, fNThetaBins, fThetaMin, fThetaMax);
+}
+
+double HoughAccumulator::GetRBinCenter(int rBin) const
+{
+    return GetBinCenter(rBin, fNRBins, fRMin, fRMax);
+}
+
+/// Same arithmetic as TAxis::GetBinCenter() for a fixed bin width
+double HoughAccumulator::GetBinCenter(int bin, int nBins, double min, double max)
+{
+    double binwidth = (max - min)/double(nBins);
+    return min + bin*binwidth + 0.5*binwidth;
+}
@@ -0,0 +1,61 @@
+#ifndef HoughAccumulator_h
+#define HoughAccumulator_h
+
+#include <vector>
+
+/// Hough space (theta, r) on a fixed grid with no Gaudi or ROOT dependency
+///
+///     A point (x, z) relative to the reference votes once per theta bin at
+///         r = x*sin(theta) + z*cos(theta)
+///     sin/cos of the theta bin centers are tabulated once in the constructor,
+///     Reset() clears the votes so the same grid is reused for every call.
+///
+///     Binning follows TH2D: theta [deg] on the x axis, r [mm] on the y axis,
+///     r outside [rMin, rMax) is counted as an entry but not stored.
+///     GetMaximum() returns the same bin as TH2D::GetMaximumBin(), ties go to the
+///     lowest global bin (r bin first, then theta bin).
+class HoughAccumulator {
+  public:
+    HoughAccumulator(int nThetaBins, double thetaMin, double thetaMax,
+                     int nRBins, double rMin, double rMax);
+
+    void Reset();
+
+    /// Votes of a single point with weight w (pe) -- w must not be negative
+    void Fill(double x, double z, double w);
+
+    /// false if there are no entries
+    bool GetMaximum(double &r, double &theta) const;
+
+    unsigned int GetEntries() const;
+    int GetNThetaBins() const;
+    int GetNRBins() const;
+    double GetThetaMin() const;
+    double GetThetaMax() const;
+    double GetRMin() const;
+    double GetRMax() const;
+    double GetBinContent(int thetaBin, int rBin) const;   ///< bins start from 0
+    double GetThetaBinCenter(int thetaBin) const;         ///< [deg]
+    double GetRBinCenter(int rBin) const;                 ///< [mm]
+
+  private:
+    int fNThetaBins;
+    double fThetaMin;
+    double fThetaMax;
+    int fNRBins;
+    double fRMin;
+    double fRMax;
+
+    std::vector<double> fSin;
+    std::vector<double> fCos;
+
+    std::vector<double> fGrid;      ///< [rBin][thetaBin]
+    std::vector<int> fRBins;        ///< r bin of each theta bin for the current point, -1 if outside
+
+    unsigned int fEntries;
+    int fMaxBin;                    ///< Running maximum, global bin of fGrid
+
+    static double GetBinCenter(int bin, int nBins, double min, double max);
+};
+
+#endif
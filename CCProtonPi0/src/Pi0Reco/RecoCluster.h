@@ -0,0 +1,23 @@
+#ifndef RecoCluster_h
+#define RecoCluster_h
+
+/// Plain copy of the IDCluster quantities used by the reconstruction kernels
+///
+///     No Gaudi or ROOT dependency, so RecoKernels, HoughAccumulator and
+///     BlobProfile can be run and profiled outside the framework.
+///     ClusterVectorInfo::FillRecoClusters() fills them from IDClusters.
+struct RecoCluster {
+    enum View { X = 0, U = 1, V = 2, Other = -1 };
+
+    int view;
+    double z;
+    double position;    ///< transverse position in the cluster view
+    double tpos1;
+    double tpos2;
+    double energy;
+    double pe;
+    double time;
+    int nDigits;
+};
+
+#endif
@@ -0,0 +1,71 @@
+#include <cmath>
+
+#include "RecoKernels.h"
+#include "BlobProfile.h"
+
+double RecoKernels::BlobdEdx(const std::vector<RecoCluster>& clusters, const ViewPoint& start, int nPlanes)
+{
+    BlobProfile profile(100, 45.0); // bin size 45mm <> 1 module
+
+    for ( std::vector<RecoCluster>::const_iterator c = clusters.begin(); c != clusters.end(); ++c ){
+        double vt = start.t[RecoCluster::X];
+        if ( c->view == RecoCluster::U ) vt = start.t[RecoCluster::U];
+        if ( c->view == RecoCluster::V ) vt = start.t[RecoCluster::V];
+
+        double x = vt - c->position;
+        double z = start.z - c->z;
+
+        profile.Fill(sqrt( x*x + z*z ), c->energy);
+    }
+
+    // dEdx from the first nPlanes/2 bins, all of them must have energy
+    // and the profile must extend nPlanes/2 bins past the window.
+    // The old bin by bin search never accepted a window after the first bin.
+    double dEdx = 0;
+    int binmax = profile.FindLastBinAbove(0.0) - nPlanes/2;
+    if ( binmax < 0 || !profile.FindWindow(nPlanes/2, 0, 0, dEdx) ) dEdx = 0;
+
+    if ( dEdx == 0 ) return -999;
+    return dEdx/nPlanes;
+}
+
+bool RecoKernels::BlobDirectionSums(const std::vector<RecoCluster>& clusters, const ViewPoint& vertex, DirectionSums& sums)
+{
+    sums.Xx = 0.0;
+    sums.Zx = 0.0;
+    sums.Xu = 0.0;
+    sums.Xv = 0.0;
+    sums.totalX = 0.0;
+    sums.totalU = 0.0;
+    sums.totalV = 0.0;
+
+    for ( std::vector<RecoCluster>::const_iterator c = clusters.begin(); c != clusters.end(); ++c ){
+        if ( c->view != RecoCluster::X && c->view != RecoCluster::U && c->view != RecoCluster::V ) return false;
+
+        double dz = c->z - vertex.z;
+        double dx = c->position - vertex.t[c->view];
+        double distance = sqrt(pow(dx,2)+pow(dz,2));
+        if ( distance == .0 ) distance = 25;
+
+        switch ( c->view )
+        {
+            case RecoCluster::X:
+                sums.Xx += dx*c->energy/distance;
+                sums.Zx += dz*c->energy/distance;
+                sums.totalX += c->energy/distance;
+                break;
+
+            case RecoCluster::U:
+                sums.Xu += dx*c->energy/distance;
+                sums.totalU += c->energy/distance;
+                break;
+
+            case RecoCluster::V:
+                sums.Xv += dx*c->energy/distance;
+                sums.totalV += c->energy/distance;
+                break;
+        }
+    }
+
+    return true;
+}
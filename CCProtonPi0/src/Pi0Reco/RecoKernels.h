@@ -0,0 +1,42 @@
+#ifndef RecoKernels_h
+#define RecoKernels_h
+
+#include <vector>
+
+#include "RecoCluster.h"
+
+/// Numerical cores of the blob reconstruction with no Gaudi or ROOT dependency
+///
+///     Input is a list of RecoCluster and the vertex in each view, the tools
+///     (HTBlob) convert their IDClusters, call these and keep the framework
+///     side: math tool projections, logging, setting the blob data.
+///     Results are identical to the code the tools used before.
+namespace RecoKernels {
+
+    /// Vertex (or blob start point) as seen in each view
+    struct ViewPoint {
+        double t[3];    ///< X, U, V transverse positions
+        double z;
+    };
+
+    /// Energy/distance weighted sums of the cluster offsets from the vertex
+    struct DirectionSums {
+        double Xx;
+        double Zx;
+        double Xu;
+        double Xv;
+        double totalX;
+        double totalU;
+        double totalV;
+    };
+
+    /// dE/dx of the first nPlanes/2 45 mm bins of the distance profile,
+    /// -999 if the blob does not have them
+    double BlobdEdx(const std::vector<RecoCluster>& clusters, const ViewPoint& start, int nPlanes);
+
+    /// Sums for HTBlob::GetDirection(), false if a cluster is not in X, U or V
+    bool BlobDirectionSums(const std::vector<RecoCluster>& clusters, const ViewPoint& vertex, DirectionSums& sums);
+
+}
+
+#endif